@@ -11,7 +11,9 @@
 #include <memory>
 
 #include <boost/optional.hpp>
+#include "common/cloneable.hpp"
 #include "interfaces/iroha_internal/block.hpp"
+#include "interfaces/transaction.hpp"
 
 namespace iroha {
   namespace ametsuchi {
@@ -36,6 +38,25 @@ namespace iroha {
           std::shared_ptr<const shared_model::interface::Block>>
       fetch(shared_model::interface::types::HeightType height) const = 0;
 
+      /**
+       * Get a single transaction of the block with given height. The default
+       * implementation decodes the whole block, storages which can address
+       * separate transactions should override it.
+       * @param height - height of the block
+       * @param index - position of the transaction in the block
+       * @return transaction if exists, boost::none otherwise
+       */
+      virtual boost::optional<
+          std::unique_ptr<shared_model::interface::Transaction>>
+      fetchTransaction(shared_model::interface::types::HeightType height,
+                       size_t index) const {
+        auto block = fetch(height);
+        if (not block or index >= (*block)->transactions().size()) {
+          return boost::none;
+        }
+        return clone((*block)->transactions()[index]);
+      }
+
       /**
        * Returns the size of the storage
        */
@@ -0,0 +1,26 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_AMOUNT_STORAGE_MODE_HPP
+#define IROHA_AMOUNT_STORAGE_MODE_HPP
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /// The way account balances are kept in account_has_asset table.
+    enum class AmountStorageMode {
+      /// Arbitrary precision decimal with the scale of the commands which
+      /// changed it.
+      kDecimal,
+      /// Integer count of the asset's minimal units, that is the balance
+      /// multiplied by 10 ^ asset precision. Arithmetic and overflow checks
+      /// do not involve fractional decimals.
+      kScaledInteger
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_AMOUNT_STORAGE_MODE_HPP
@@ -0,0 +1,77 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/block_transaction_offsets.hpp"
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite.h>
+
+using google::protobuf::io::CodedInputStream;
+using google::protobuf::internal::WireFormatLite;
+
+namespace {
+  // field numbers of Block_v1.payload and Block_v1.Payload.transactions
+  const int kPayloadField = 1;
+  const int kTransactionsField = 1;
+
+  bool isLengthDelimited(uint32_t tag, int field_number) {
+    return WireFormatLite::GetTagFieldNumber(tag) == field_number
+        and WireFormatLite::GetTagWireType(tag)
+        == WireFormatLite::WIRETYPE_LENGTH_DELIMITED;
+  }
+
+  /// Collect transaction slices of the payload message the input is limited to
+  bool readPayload(CodedInputStream &input,
+                   std::vector<iroha::ametsuchi::TransactionSlice> &slices) {
+    while (auto tag = input.ReadTag()) {
+      if (isLengthDelimited(tag, kTransactionsField)) {
+        uint32_t length;
+        if (not input.ReadVarint32(&length)) {
+          return false;
+        }
+        slices.push_back(
+            {static_cast<size_t>(input.CurrentPosition()), length});
+        if (not input.Skip(length)) {
+          return false;
+        }
+      } else if (not WireFormatLite::SkipField(&input, tag)) {
+        return false;
+      }
+    }
+    return input.ConsumedEntireMessage();
+  }
+}  // namespace
+
+namespace iroha {
+  namespace ametsuchi {
+
+    boost::optional<std::vector<TransactionSlice>> findTransactionSlices(
+        const std::vector<uint8_t> &block_v1) {
+      CodedInputStream input(block_v1.data(),
+                             static_cast<int>(block_v1.size()));
+      std::vector<TransactionSlice> slices;
+      while (auto tag = input.ReadTag()) {
+        if (isLengthDelimited(tag, kPayloadField)) {
+          uint32_t length;
+          if (not input.ReadVarint32(&length)) {
+            return boost::none;
+          }
+          auto limit = input.PushLimit(static_cast<int>(length));
+          if (not readPayload(input, slices)) {
+            return boost::none;
+          }
+          input.PopLimit(limit);
+        } else if (not WireFormatLite::SkipField(&input, tag)) {
+          return boost::none;
+        }
+      }
+      if (not input.ConsumedEntireMessage()) {
+        return boost::none;
+      }
+      return slices;
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,35 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_BLOCK_TRANSACTION_OFFSETS_HPP
+#define IROHA_BLOCK_TRANSACTION_OFFSETS_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /// Location of a serialized transaction inside a serialized block.
+    struct TransactionSlice {
+      size_t offset;
+      size_t length;
+    };
+
+    /**
+     * Locate the transactions of a serialized Block_v1 without parsing them.
+     * @param block_v1 - Block_v1 protobuf serialization
+     * @return slices in the block order, or boost::none if the bytes are not
+     * a well-formed block
+     */
+    boost::optional<std::vector<TransactionSlice>> findTransactionSlices(
+        const std::vector<uint8_t> &block_v1);
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_BLOCK_TRANSACTION_OFFSETS_HPP
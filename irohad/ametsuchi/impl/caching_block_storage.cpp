@@ -0,0 +1,96 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/caching_block_storage.hpp"
+
+using namespace iroha::ametsuchi;
+
+using shared_model::interface::types::HeightType;
+
+CachingBlockStorage::CachingBlockStorage(std::unique_ptr<BlockStorage> storage,
+                                         size_t capacity)
+    : storage_(std::move(storage)), capacity_(capacity) {}
+
+bool CachingBlockStorage::insert(
+    std::shared_ptr<const shared_model::interface::Block> block) {
+  if (not storage_->insert(block)) {
+    return false;
+  }
+  cache(std::move(block));
+  return true;
+}
+
+boost::optional<std::shared_ptr<const shared_model::interface::Block>>
+CachingBlockStorage::fetch(HeightType height) const {
+  if (auto block = findCached(height)) {
+    return block;
+  }
+  auto block = storage_->fetch(height);
+  if (block) {
+    cache(*block);
+  }
+  return block;
+}
+
+boost::optional<std::unique_ptr<shared_model::interface::Transaction>>
+CachingBlockStorage::fetchTransaction(HeightType height, size_t index) const {
+  // a single transaction is cheaper to decode than a block, so the cache is
+  // only read here
+  if (auto block = findCached(height)) {
+    if (index >= (*block)->transactions().size()) {
+      return boost::none;
+    }
+    return clone((*block)->transactions()[index]);
+  }
+  return storage_->fetchTransaction(height, index);
+}
+
+size_t CachingBlockStorage::size() const {
+  return storage_->size();
+}
+
+void CachingBlockStorage::clear() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    index_.clear();
+  }
+  storage_->clear();
+}
+
+void CachingBlockStorage::forEach(FunctionType function) const {
+  storage_->forEach(std::move(function));
+}
+
+boost::optional<CachingBlockStorage::BlockPtr> CachingBlockStorage::findCached(
+    HeightType height) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = index_.find(height);
+  if (it == index_.end()) {
+    return boost::none;
+  }
+  entries_.splice(entries_.begin(), entries_, it->second);
+  return it->second->second;
+}
+
+void CachingBlockStorage::cache(BlockPtr block) const {
+  if (capacity_ == 0) {
+    return;
+  }
+  const auto height = block->height();
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = index_.find(height);
+  if (it != index_.end()) {
+    it->second->second = std::move(block);
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return;
+  }
+  entries_.emplace_front(height, std::move(block));
+  index_.emplace(height, entries_.begin());
+  if (entries_.size() > capacity_) {
+    index_.erase(entries_.back().first);
+    entries_.pop_back();
+  }
+}
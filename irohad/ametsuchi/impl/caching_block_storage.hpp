@@ -0,0 +1,75 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_CACHING_BLOCK_STORAGE_HPP
+#define IROHA_CACHING_BLOCK_STORAGE_HPP
+
+#include "ametsuchi/block_storage.hpp"
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Block storage decorator which keeps the least recently used decoded
+     * blocks in memory, so that repeated queries to the same blocks do not
+     * fetch and parse them again
+     */
+    class CachingBlockStorage : public BlockStorage {
+     public:
+      /**
+       * @param storage - underlying storage
+       * @param capacity - maximum number of cached blocks
+       */
+      CachingBlockStorage(std::unique_ptr<BlockStorage> storage,
+                          size_t capacity);
+
+      bool insert(
+          std::shared_ptr<const shared_model::interface::Block> block) override;
+
+      boost::optional<std::shared_ptr<const shared_model::interface::Block>>
+      fetch(shared_model::interface::types::HeightType height) const override;
+
+      boost::optional<std::unique_ptr<shared_model::interface::Transaction>>
+      fetchTransaction(shared_model::interface::types::HeightType height,
+                       size_t index) const override;
+
+      size_t size() const override;
+
+      void clear() override;
+
+      void forEach(FunctionType function) const override;
+
+     private:
+      using BlockPtr = std::shared_ptr<const shared_model::interface::Block>;
+      using Entries =
+          std::list<std::pair<shared_model::interface::types::HeightType,
+                              BlockPtr>>;
+
+      /// Get a cached block and mark it as the most recently used one
+      boost::optional<BlockPtr> findCached(
+          shared_model::interface::types::HeightType height) const;
+
+      /// Add a block to the cache, evicting the least recently used one
+      void cache(BlockPtr block) const;
+
+      std::unique_ptr<BlockStorage> storage_;
+      const size_t capacity_;
+
+      mutable std::mutex mutex_;
+      /// blocks ordered from the most to the least recently used
+      mutable Entries entries_;
+      mutable std::unordered_map<shared_model::interface::types::HeightType,
+                                 Entries::iterator>
+          index_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_CACHING_BLOCK_STORAGE_HPP
@@ -13,11 +13,18 @@ FailoverCallback &FailoverCallbackHolder::makeFailoverCallback(
     std::string connection_options,
     std::unique_ptr<ReconnectionStrategy> reconnection_strategy,
     logger::LoggerPtr log) {
-  callbacks_.push_back(
-      std::make_unique<FailoverCallback>(connection,
-                                         std::move(init),
-                                         std::move(connection_options),
-                                         std::move(reconnection_strategy),
-                                         std::move(log)));
+  callbacks_.push_back(std::make_unique<FailoverCallback>(
+      connection,
+      [this, init = std::move(init)](soci::session &session) {
+        ++session_resets_;
+        init(session);
+      },
+      std::move(connection_options),
+      std::move(reconnection_strategy),
+      std::move(log)));
   return *callbacks_.back();
 }
+
+size_t FailoverCallbackHolder::sessionResets() const {
+  return session_resets_.load();
+}
@@ -8,6 +8,8 @@
 
 #include "ametsuchi/impl/failover_callback.hpp"
 
+#include <atomic>
+
 namespace iroha {
   namespace ametsuchi {
     class FailoverCallbackHolder {
@@ -19,8 +21,13 @@ namespace iroha {
           std::unique_ptr<ReconnectionStrategy> reconnection_strategy,
           logger::LoggerPtr log);
 
+      /// @return number of times the sessions were reset after a connection
+      /// loss, so that the state kept on them is invalid
+      size_t sessionResets() const;
+
      private:
       std::vector<std::unique_ptr<FailoverCallback>> callbacks_;
+      std::atomic<size_t> session_resets_{0};
     };
   }  // namespace ametsuchi
 }  // namespace iroha
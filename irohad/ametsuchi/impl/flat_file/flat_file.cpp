@@ -16,11 +16,42 @@
 #include "common/files.hpp"
 #include "common/result.hpp"
 #include "logger/logger.hpp"
+#include "metrics/metrics.hpp"
 
 using namespace iroha::ametsuchi;
 using Identifier = FlatFile::Identifier;
 using BlockIdCollectionType = FlatFile::BlockIdCollectionType;
 
+namespace {
+  /// Metrics of the block files reads or writes
+  struct BlockIoMetrics {
+    iroha::metrics::Histogram &time;
+    iroha::metrics::Counter &bytes;
+  };
+
+  BlockIoMetrics makeBlockIoMetrics(const std::string &operation) {
+    auto &registry = iroha::metrics::defaultRegistry();
+    return BlockIoMetrics{
+        registry.histogram("iroha_block_store_io_microseconds",
+                           "Time to read or write a block file",
+                           iroha::metrics::latencyBounds(),
+                           {{"operation", operation}}),
+        registry.counter("iroha_block_store_io_bytes_total",
+                         "Bytes of block files read or written",
+                         {{"operation", operation}})};
+  }
+
+  BlockIoMetrics &writeMetrics() {
+    static BlockIoMetrics metrics = makeBlockIoMetrics("write");
+    return metrics;
+  }
+
+  BlockIoMetrics &readMetrics() {
+    static BlockIoMetrics metrics = makeBlockIoMetrics("read");
+    return metrics;
+  }
+}  // namespace
+
 // ----------| public API |----------
 
 std::string FlatFile::id_to_name(Identifier id) {
@@ -76,6 +107,8 @@ bool FlatFile::add(Identifier id, const Bytes &block) {
     log_->warn("insertion for {} failed, because file already exists", id);
     return false;
   }
+  auto &metrics = writeMetrics();
+  iroha::metrics::ScopedTimer timer(metrics.time);
   // New file will be created
   boost::filesystem::ofstream file(file_name.native(), std::ofstream::binary);
   if (not file.is_open()) {
@@ -88,6 +121,7 @@ bool FlatFile::add(Identifier id, const Bytes &block) {
 
   file.write(reinterpret_cast<const char *>(block.data()),
              block.size() * val_size);
+  metrics.bytes.increment(block.size() * val_size);
 
   available_blocks_.insert(id);
   return true;
@@ -100,8 +134,14 @@ boost::optional<FlatFile::Bytes> FlatFile::get(Identifier id) const {
     log_->info("get({}) file not found", id);
     return boost::none;
   }
-  return iroha::expected::resultToOptionalValue(
+  auto &metrics = readMetrics();
+  iroha::metrics::ScopedTimer timer(metrics.time);
+  auto bytes = iroha::expected::resultToOptionalValue(
       iroha::readBinaryFile(filename.string()));
+  if (bytes) {
+    metrics.bytes.increment(bytes->size());
+  }
+  return bytes;
 }
 
 std::string FlatFile::directory() const {
@@ -13,7 +13,9 @@ using namespace iroha::ametsuchi;
 PoolWrapper::PoolWrapper(
     std::shared_ptr<soci::connection_pool> connection_pool,
     std::unique_ptr<FailoverCallbackHolder> failover_callback_holder,
-    bool enable_prepared_transactions)
+    bool enable_prepared_transactions,
+    AmountStorageMode amount_storage_mode)
     : connection_pool_(std::move(connection_pool)),
       failover_callback_holder_(std::move(failover_callback_holder)),
-      enable_prepared_transactions_(enable_prepared_transactions) {}
+      enable_prepared_transactions_(enable_prepared_transactions),
+      amount_storage_mode_(amount_storage_mode) {}
@@ -8,6 +8,8 @@
 
 #include <memory>
 
+#include "ametsuchi/impl/amount_storage_mode.hpp"
+
 namespace soci {
   class connection_pool;
 }
@@ -20,11 +22,13 @@ namespace iroha {
       PoolWrapper(
           std::shared_ptr<soci::connection_pool> connection_pool,
           std::unique_ptr<FailoverCallbackHolder> failover_callback_holder,
-          bool enable_prepared_transactions);
+          bool enable_prepared_transactions,
+          AmountStorageMode amount_storage_mode = AmountStorageMode::kDecimal);
 
       std::shared_ptr<soci::connection_pool> connection_pool_;
       std::unique_ptr<FailoverCallbackHolder> failover_callback_holder_;
       bool enable_prepared_transactions_;
+      AmountStorageMode amount_storage_mode_;
     };
 
   }  // namespace ametsuchi
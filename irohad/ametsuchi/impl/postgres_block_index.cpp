@@ -5,12 +5,13 @@
 
 #include "ametsuchi/impl/postgres_block_index.hpp"
 
-#include <boost/range/adaptor/filtered.hpp>
-#include <boost/range/adaptor/indexed.hpp>
-#include <boost/range/adaptor/transformed.hpp>
-#include "ametsuchi/tx_cache_response.hpp"
+#include <algorithm>
+#include <tuple>
+
 #include "common/visitor.hpp"
+#include "interfaces/commands/add_asset_quantity.hpp"
 #include "interfaces/commands/command_variant.hpp"
+#include "interfaces/commands/subtract_asset_quantity.hpp"
 #include "interfaces/commands/transfer_asset.hpp"
 #include "interfaces/iroha_internal/block.hpp"
 #include "logger/logger.hpp"
@@ -20,43 +21,47 @@ using namespace shared_model::interface::types;
 
 using TxPosition = iroha::ametsuchi::Indexer::TxPosition;
 
-namespace {
-  // Return transfer asset if command contains it
-  boost::optional<const shared_model::interface::TransferAsset &>
-  getTransferAsset(const shared_model::interface::Command &cmd) noexcept {
-    using ReturnType =
-        boost::optional<const shared_model::interface::TransferAsset &>;
-    return iroha::visit_in_place(
-        cmd.get(),
-        [](const shared_model::interface::TransferAsset &c) {
-          return ReturnType(c);
-        },
-        [](const auto &) -> ReturnType { return boost::none; });
-  }
-}  // namespace
-
-// Collect all assets belonging to creator, sender, and receiver
-// to make account_id:height:asset_id -> list of tx indexes
-// for transfer asset in command
+// Collect the (account, asset) pairs touched by asset commands of the
+// transaction, each pair is indexed once per transaction
 void PostgresBlockIndex::makeAccountAssetIndex(
     const AccountIdType &account_id,
     TxPosition position,
     const shared_model::interface::Transaction::CommandsType &commands) {
-  for (const auto &transfer :
-       commands | boost::adaptors::transformed(getTransferAsset)
-           | boost::adaptors::filtered(
-                 [](const auto &opt_tx) { return static_cast<bool>(opt_tx); })
-           | boost::adaptors::transformed(
-                 [](const auto &opt_tx) -> const auto & { return *opt_tx; })) {
-    const auto &src_id = transfer.srcAccountId();
-    const auto &dest_id = transfer.destAccountId();
+  account_assets_.clear();
+  auto add = [this](const auto &account, const auto &asset) {
+    account_assets_.emplace_back(&account, &asset);
+  };
+  for (const auto &command : commands) {
+    iroha::visit_in_place(
+        command.get(),
+        [&](const shared_model::interface::TransferAsset &c) {
+          add(account_id, c.assetId());
+          add(c.srcAccountId(), c.assetId());
+          add(c.destAccountId(), c.assetId());
+        },
+        [&](const shared_model::interface::AddAssetQuantity &c) {
+          add(account_id, c.assetId());
+        },
+        [&](const shared_model::interface::SubtractAssetQuantity &c) {
+          add(account_id, c.assetId());
+        },
+        [](const auto &) {});
+  }
+
+  auto less = [](const auto &a, const auto &b) {
+    return std::tie(*a.first, *a.second) < std::tie(*b.first, *b.second);
+  };
+  auto equal = [](const auto &a, const auto &b) {
+    return *a.first == *b.first and *a.second == *b.second;
+  };
+  std::sort(account_assets_.begin(), account_assets_.end(), less);
+  account_assets_.erase(
+      std::unique(account_assets_.begin(), account_assets_.end(), equal),
+      account_assets_.end());
 
-    const auto ids = {account_id, src_id, dest_id};
-    const auto &asset_id = transfer.assetId();
-    // flat map accounts to unindexed keys
-    for (const auto &id : ids) {
-      indexer_->accountAssetTxPosition(id, asset_id, position);
-    }
+  for (const auto &account_asset : account_assets_) {
+    indexer_->accountAssetTxPosition(
+        *account_asset.first, *account_asset.second, position);
   }
 }
 
@@ -65,15 +70,14 @@ PostgresBlockIndex::PostgresBlockIndex(std::unique_ptr<Indexer> indexer,
     : indexer_(std::move(indexer)), log_(std::move(log)) {}
 
 void PostgresBlockIndex::index(const shared_model::interface::Block &block) {
-  auto height = block.height();
-  for (const auto &tx : block.transactions() | boost::adaptors::indexed(0)) {
-    const auto &creator_id = tx.value().creatorAccountId();
-    const TxPosition position{height, static_cast<size_t>(tx.index())};
+  const auto height = block.height();
+  size_t index = 0;
+  for (const auto &tx : block.transactions()) {
+    const auto &creator_id = tx.creatorAccountId();
+    const TxPosition position{height, index++};
 
-    makeAccountAssetIndex(creator_id, position, tx.value().commands());
-    indexer_->txHashPosition(tx.value().hash(), position);
-    indexer_->committedTxHash(tx.value().hash());
-    indexer_->txPositionByCreator(creator_id, position);
+    indexer_->committedTx(tx.hash(), creator_id, position);
+    makeAccountAssetIndex(creator_id, position, tx.commands());
   }
 
   for (const auto &rejected_tx_hash : block.rejected_transactions_hashes()) {
@@ -8,6 +8,9 @@
 
 #include "ametsuchi/impl/block_index.hpp"
 
+#include <utility>
+#include <vector>
+
 #include "ametsuchi/indexer.hpp"
 #include "interfaces/transaction.hpp"
 #include "logger/logger_fwd.hpp"
@@ -19,13 +22,14 @@ namespace iroha {
      * transaction hash -> block, where this transaction is stored
      * transaction creator -> block where his transaction is located
      *
-     * Additionally, for each Transfer Asset command:
-     *   1. (account, asset) -> block for each:
+     * Additionally, (account, asset) -> transaction position, once per
+     * transaction, for:
+     *   1. Transfer Asset commands:
      *     a. creator of the transaction
      *     b. source account
      *     c. destination account
-     *   2. account -> block for source and destination accounts
-     *   3. (account, height) -> list of txes
+     *   2. Add and Subtract Asset Quantity commands: creator of the
+     *   transaction
      */
     class PostgresBlockIndex : public BlockIndex {
      public:
@@ -36,7 +40,7 @@ namespace iroha {
       void index(const shared_model::interface::Block &block) override;
 
      private:
-      /// Index a transaction.
+      /// Index the account assets affected by a transaction.
       void makeAccountAssetIndex(
           const shared_model::interface::types::AccountIdType &account_id,
           Indexer::TxPosition position,
@@ -44,6 +48,13 @@ namespace iroha {
 
       std::unique_ptr<Indexer> indexer_;
       logger::LoggerPtr log_;
+
+      /// (account, asset) pairs of the transaction being indexed, the buffer
+      /// is kept between transactions to avoid reallocations
+      std::vector<
+          std::pair<const shared_model::interface::types::AccountIdType *,
+                    const shared_model::interface::types::AssetIdType *>>
+          account_assets_;
     };
   }  // namespace ametsuchi
 }  // namespace iroha
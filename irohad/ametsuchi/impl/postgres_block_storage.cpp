@@ -5,6 +5,10 @@
 
 #include "ametsuchi/impl/postgres_block_storage.hpp"
 
+#include <boost/algorithm/string/join.hpp>
+#include <boost/range/adaptor/transformed.hpp>
+#include "ametsuchi/impl/block_transaction_offsets.hpp"
+#include "backend/protobuf/transaction.hpp"
 #include "common/hexutils.hpp"
 #include "logger/logger.hpp"
 
@@ -37,13 +41,28 @@ bool PostgresBlockStorage::insert(
   }
 
   auto b = block->blob().hex();
+  // flattened array of (offset, length) pairs, which allows to fetch a single
+  // transaction; left NULL for blocks which can not be sliced
+  auto tx_offsets = findTransactionSlices(block->blob().blob()) |
+      [](const auto &slices) {
+        std::vector<std::string> values;
+        values.reserve(slices.size() * 2);
+        for (const auto &slice : slices) {
+          values.push_back(std::to_string(slice.offset));
+          values.push_back(std::to_string(slice.length));
+        }
+        return boost::make_optional("{" + boost::algorithm::join(values, ",")
+                                    + "}");
+      };
 
   soci::session sql(*pool_wrapper_->connection_pool_);
-  soci::statement st = (sql.prepare << "INSERT INTO " << table_
-                                    << " (height, block_data) VALUES(:height, "
-                                       ":block_data)",
-                        soci::use(inserted_height),
-                        soci::use(b));
+  soci::statement st =
+      (sql.prepare << "INSERT INTO " << table_
+                   << " (height, block_data, tx_offsets) VALUES(:height, "
+                      ":block_data, :tx_offsets::bigint[])",
+       soci::use(inserted_height),
+       soci::use(b),
+       soci::use(tx_offsets));
   log_->debug("insert block {}: {}", inserted_height, b);
   try {
     st.execute(true);
@@ -96,6 +115,48 @@ PostgresBlockStorage::fetch(HeightType height) const {
   };
 }
 
+boost::optional<std::unique_ptr<shared_model::interface::Transaction>>
+PostgresBlockStorage::fetchTransaction(HeightType height, size_t index) const {
+  soci::session sql(*pool_wrapper_->connection_pool_);
+  using QueryTuple = boost::tuple<boost::optional<std::string>>;
+  QueryTuple row;
+  // offsets are in bytes, while the block is stored as hex
+  const int64_t tx_index = index;
+  try {
+    sql << "SELECT substr(block_data, 2 * tx_offsets[2 * :index + 1] + 1, "
+           "2 * tx_offsets[2 * :index + 2]) FROM "
+        << table_
+        << " WHERE height = :height "
+           "AND 2 * :index < coalesce(array_length(tx_offsets, 1), 0)",
+        soci::use(tx_index, "index"), soci::use(height, "height"),
+        soci::into(row);
+  } catch (const std::exception &e) {
+    log_->error("Failed to execute query: {}", e.what());
+    return boost::none;
+  }
+
+  auto tx = rebind(viewQuery<QueryTuple>(row)) | [](auto row) {
+    return iroha::ametsuchi::apply(row, [](auto &tx_data) {
+      return iroha::hexstringToBytestring(tx_data) | [](auto byte_tx) {
+        iroha::protocol::Transaction proto_tx;
+        if (not proto_tx.ParseFromString(byte_tx)) {
+          return boost::optional<
+              std::unique_ptr<shared_model::interface::Transaction>>{};
+        }
+        return boost::make_optional<
+            std::unique_ptr<shared_model::interface::Transaction>>(
+            std::make_unique<shared_model::proto::Transaction>(
+                std::move(proto_tx)));
+      };
+    });
+  };
+  if (tx) {
+    return tx;
+  }
+  // the block is missing, stored without offsets or has no such transaction
+  return BlockStorage::fetchTransaction(height, index);
+}
+
 size_t PostgresBlockStorage::size() const {
   return (getBlockHeightsRange() |
           [](auto range) {
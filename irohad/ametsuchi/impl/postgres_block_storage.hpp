@@ -32,6 +32,14 @@ namespace iroha {
       boost::optional<std::shared_ptr<const shared_model::interface::Block>>
       fetch(shared_model::interface::types::HeightType height) const override;
 
+      /**
+       * Decode only the requested transaction, which is sliced out of the
+       * stored block by the offsets saved on insertion
+       */
+      boost::optional<std::unique_ptr<shared_model::interface::Transaction>>
+      fetchTransaction(shared_model::interface::types::HeightType height,
+                       size_t index) const override;
+
       size_t size() const override;
 
       void clear() override;
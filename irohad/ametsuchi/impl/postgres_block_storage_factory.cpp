@@ -34,11 +34,13 @@ std::unique_ptr<BlockStorage> PostgresBlockStorageFactory::create() {
 iroha::expected::Result<void, std::string>
 PostgresBlockStorageFactory::createTable(soci::session &sql,
                                          const std::string &table) {
-  soci::statement st =
-      (sql.prepare << "CREATE TABLE IF NOT EXISTS " << table
-                   << "(height bigint PRIMARY KEY, block_data text not null)");
   try {
-    st.execute(true);
+    sql << "CREATE TABLE IF NOT EXISTS " << table
+        << "(height bigint PRIMARY KEY, block_data text not null, "
+           "tx_offsets bigint[])";
+    // tables created by previous versions lack transaction offsets
+    sql << "ALTER TABLE " << table
+        << " ADD COLUMN IF NOT EXISTS tx_offsets bigint[]";
     return {};
   } catch (const std::exception &e) {
     return expected::makeError("Unable to create block store: "
@@ -6,12 +6,14 @@
 #include "ametsuchi/impl/postgres_command_executor.hpp"
 
 #include <forward_list>
+#include <unordered_map>
 
 #include <soci/postgresql/soci-postgresql.h>
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/join.hpp>
 #include <boost/format.hpp>
 #include "ametsuchi/impl/executor_common.hpp"
+#include "ametsuchi/impl/scaled_amount.hpp"
 #include "ametsuchi/impl/soci_utils.hpp"
 #include "cryptography/public_key.hpp"
 #include "interfaces/commands/add_asset_quantity.hpp"
@@ -36,6 +38,8 @@
 #include "interfaces/commands/transfer_asset.hpp"
 #include "interfaces/common_objects/types.hpp"
 #include "interfaces/permission_to_string.hpp"
+#include "metrics/metrics.hpp"
+#include "tracing/command_hot_keys.hpp"
 #include "utils/string_builder.hpp"
 
 using shared_model::interface::permissions::Grantable;
@@ -52,6 +56,36 @@ namespace {
   const std::string kPgTrue{"true"};
   const std::string kPgFalse{"false"};
 
+  /// SQL execution metrics of a command
+  struct SqlCommandMetrics {
+    iroha::metrics::Histogram &latency;
+    iroha::metrics::Counter &errors;
+  };
+
+  /// @return metrics of the command, cached per thread to keep the registry
+  /// lock out of the execution path
+  SqlCommandMetrics &sqlCommandMetrics(const std::string &command_name) {
+    thread_local std::unordered_map<std::string, SqlCommandMetrics> cache;
+    auto it = cache.find(command_name);
+    if (it == cache.end()) {
+      auto &registry = iroha::metrics::defaultRegistry();
+      const iroha::metrics::Labels labels{{"command", command_name}};
+      it = cache
+               .emplace(command_name,
+                        SqlCommandMetrics{
+                            registry.histogram(
+                                "iroha_sql_command_microseconds",
+                                "Time of SQL execution of a command",
+                                iroha::metrics::latencyBounds(),
+                                labels),
+                            registry.counter("iroha_sql_command_errors_total",
+                                             "Commands failed in SQL",
+                                             labels)})
+               .first;
+    }
+    return it->second;
+  }
+
   std::string makeJsonString(std::string value) {
     return std::string{"\""} + value + "\"";
   }
@@ -385,7 +419,8 @@ namespace iroha {
               perm_converter)
           : statement_(statements->getStatement(enable_validation)),
             command_name_(std::move(command_name)),
-            perm_converter_(std::move(perm_converter)) {
+            perm_converter_(std::move(perm_converter)),
+            metrics_(sqlCommandMetrics(command_name_)) {
         arguments_string_builder_.init(command_name_)
             .append("Validation", std::to_string(enable_validation));
       }
@@ -453,6 +488,7 @@ namespace iroha {
       }
 
       iroha::ametsuchi::CommandResult execute() noexcept {
+        iroha::metrics::ScopedTimer timer(metrics_.latency);
         try {
           soci::row r;
           statement_.define_and_bind();
@@ -462,11 +498,13 @@ namespace iroha {
           statement_.bind_clean_up();
           temp_values_.clear();
           if (result != 0) {
+            metrics_.errors.increment();
             return makeCommandError(
                 command_name_, result, arguments_string_builder_.finalize());
           }
           return {};
         } catch (const std::exception &e) {
+          metrics_.errors.increment();
           statement_.bind_clean_up();
           temp_values_.clear();
           return getCommandError(
@@ -479,6 +517,7 @@ namespace iroha {
       std::string command_name_;
       std::shared_ptr<shared_model::interface::PermissionToString>
           perm_converter_;
+      SqlCommandMetrics &metrics_;
       shared_model::detail::PrettyStringBuilder arguments_string_builder_;
       std::forward_list<std::string> temp_values_;
     };
@@ -496,13 +535,27 @@ namespace iroha {
       // TODO [IR-1830] Akvinikym 31.10.18: make benchmarks to compare exception
       // parsing vs nested queries
       // 14.09.18 nickaleks: IR-1708 Load SQL from separate files
+      // Scaled integer balances need the command quantity to be brought to
+      // the asset precision, but then the overflow bound does not depend on
+      // it and no fractional arithmetic is involved.
+      const bool scaled_amounts =
+          amount_storage_mode_ == AmountStorageMode::kScaledInteger;
+      const std::string quantity = scaled_amounts
+          ? R"((:quantity::numeric * 10::numeric ^ (
+                (SELECT precision FROM asset WHERE asset_id = :asset_id)
+                - :precision)))"
+          : ":quantity::decimal";
+      const std::string max_quantity = scaled_amounts
+          ? std::string{kScaledAmountUpperBound}
+          : "(2::decimal ^ 256) / (10::decimal ^ precision)";
+
       add_asset_quantity_statements_ = makeCommandStatements(
           sql_,
-          R"(
-          WITH %s
+          (boost::format(R"(
+          WITH %%s
              new_quantity AS
              (
-                 SELECT :quantity::decimal + coalesce(sum(amount), 0) as value
+                 SELECT %1% + coalesce(sum(amount), 0) as value
                  FROM account_has_asset
                  WHERE asset_id = :asset_id
                      AND account_id = :creator
@@ -525,7 +578,7 @@ namespace iroha {
                  UNION
                  SELECT
                     4,
-                    value < (2::decimal ^ 256) / (10::decimal ^ precision)
+                    value < %2%
                  FROM new_quantity, asset
                  WHERE asset_id = :asset_id
              ),
@@ -534,17 +587,19 @@ namespace iroha {
                 INSERT INTO account_has_asset(account_id, asset_id, amount)
                 (
                     SELECT :creator, :asset_id, value FROM new_quantity
-                    WHERE (SELECT bool_and(checks.result) FROM checks) %s
+                    WHERE (SELECT bool_and(checks.result) FROM checks) %%s
                 )
                 ON CONFLICT (account_id, asset_id) DO UPDATE
                 SET amount = EXCLUDED.amount
                 RETURNING (1)
              )
           SELECT CASE
-              %s
+              %%s
               WHEN EXISTS (SELECT * FROM inserted LIMIT 1) THEN 0
               ELSE (SELECT code FROM checks WHERE not result LIMIT 1)
-          END AS result;)",
+          END AS result;)")
+           % quantity % max_quantity)
+              .str(),
           {(boost::format(R"(has_perm AS (%s),)")
             % checkAccountDomainRoleOrGlobalRolePermission(
                   Role::kAddAssetQty,
@@ -1173,8 +1228,8 @@ namespace iroha {
 
       subtract_asset_quantity_statements_ = makeCommandStatements(
           sql_,
-          R"(
-          WITH %s
+          (boost::format(R"(
+          WITH %%s
             has_account AS (SELECT account_id FROM account
                             WHERE account_id = :creator LIMIT 1),
             has_asset AS (SELECT asset_id FROM asset
@@ -1189,7 +1244,7 @@ namespace iroha {
                                    (SELECT amount FROM amount LIMIT 1)
                                    THEN (SELECT amount FROM amount LIMIT 1)
                                ELSE 0::decimal
-                           END) - :quantity::decimal AS value
+                           END) - %1% AS value
                        ),
             inserted AS
             (
@@ -1199,7 +1254,7 @@ namespace iroha {
                    WHERE EXISTS (SELECT * FROM has_account LIMIT 1) AND
                      EXISTS (SELECT * FROM has_asset LIMIT 1) AND
                      EXISTS (SELECT value FROM new_value WHERE value >= 0 LIMIT 1)
-                     %s
+                     %%s
                )
                ON CONFLICT (account_id, asset_id)
                DO UPDATE SET amount = EXCLUDED.amount
@@ -1207,12 +1262,14 @@ namespace iroha {
             )
           SELECT CASE
               WHEN EXISTS (SELECT * FROM inserted LIMIT 1) THEN 0
-              %s
+              %%s
               WHEN NOT EXISTS (SELECT * FROM has_asset LIMIT 1) THEN 3
               WHEN NOT EXISTS
                   (SELECT value FROM new_value WHERE value >= 0 LIMIT 1) THEN 4
               ELSE 1
-          END AS result)",
+          END AS result)")
+           % quantity)
+              .str(),
           {(boost::format(R"(
                has_perm AS (%s),)")
             % checkAccountDomainRoleOrGlobalRolePermission(
@@ -1226,18 +1283,18 @@ namespace iroha {
 
       transfer_asset_statements_ = makeCommandStatements(
           sql_,
-          R"(
-          WITH %s
+          (boost::format(R"(
+          WITH %%s
             new_src_quantity AS
             (
-                SELECT coalesce(sum(amount), 0) - :quantity::decimal as value
+                SELECT coalesce(sum(amount), 0) - %1% as value
                 FROM account_has_asset
                    WHERE asset_id = :asset_id AND
                    account_id = :source_account_id
             ),
             new_dest_quantity AS
             (
-                SELECT coalesce(sum(amount), 0) + :quantity::decimal as value
+                SELECT coalesce(sum(amount), 0) + %1% as value
                 FROM account_has_asset
                    WHERE asset_id = :asset_id AND
                    account_id = :dest_account_id
@@ -1271,7 +1328,7 @@ namespace iroha {
                 UNION
                 SELECT
                     7,
-                    value < (2::decimal ^ 256) / (10::decimal ^ precision)
+                    value < %2%
                 FROM new_dest_quantity, asset
                 WHERE asset_id = :asset_id
             ),
@@ -1283,7 +1340,7 @@ namespace iroha {
                 WHERE
                     account_id = :source_account_id
                     AND asset_id = :asset_id
-                    AND (SELECT bool_and(checks.result) FROM checks) %s
+                    AND (SELECT bool_and(checks.result) FROM checks) %%s
             ),
             insert_dest AS
             (
@@ -1291,7 +1348,7 @@ namespace iroha {
                 (
                     SELECT :dest_account_id, :asset_id, value
                     FROM new_dest_quantity
-                    WHERE (SELECT bool_and(checks.result) FROM checks) %s
+                    WHERE (SELECT bool_and(checks.result) FROM checks) %%s
                 )
                 ON CONFLICT (account_id, asset_id)
                 DO UPDATE SET amount = EXCLUDED.amount
@@ -1299,9 +1356,11 @@ namespace iroha {
             )
           SELECT CASE
               WHEN EXISTS (SELECT * FROM insert_dest LIMIT 1) THEN 0
-              %s
+              %%s
               ELSE (SELECT code FROM checks WHERE not result LIMIT 1)
-          END AS result)",
+          END AS result)")
+           % quantity % max_quantity)
+              .str(),
           {(boost::format(R"(
               has_role_perm AS (%s),
               has_grantable_perm AS (%s),
@@ -1355,8 +1414,11 @@ namespace iroha {
     PostgresCommandExecutor::PostgresCommandExecutor(
         std::unique_ptr<soci::session> sql,
         std::shared_ptr<shared_model::interface::PermissionToString>
-            perm_converter)
-        : sql_(std::move(sql)), perm_converter_{std::move(perm_converter)} {
+            perm_converter,
+        AmountStorageMode amount_storage_mode)
+        : sql_(std::move(sql)),
+          perm_converter_{std::move(perm_converter)},
+          amount_storage_mode_(amount_storage_mode) {
       initStatements();
     }
 
@@ -1366,6 +1428,18 @@ namespace iroha {
         const shared_model::interface::Command &cmd,
         const shared_model::interface::types::AccountIdType &creator_account_id,
         bool do_validation) {
+      auto &hot_keys = tracing::defaultHotKeyTracker();
+      // commands are validated only in stateful validation of proposals, and
+      // the apply phase is counted by the committed blocks
+      if (do_validation and hot_keys.enabled()) {
+        // permissions of the creator are checked
+        hot_keys.record(tracing::Phase::kValidation,
+                        tracing::Access::kRead,
+                        tracing::KeyKind::kAccount,
+                        creator_account_id);
+        tracing::recordCommandKeys(
+            hot_keys, tracing::Phase::kValidation, cmd, creator_account_id);
+      }
       return boost::apply_visitor(
           [this, &creator_account_id, do_validation](const auto &command) {
             return (*this)(command, creator_account_id, do_validation);
@@ -1377,12 +1451,19 @@ namespace iroha {
       return *sql_;
     }
 
+    std::string PostgresCommandExecutor::quantityParameter(
+        const shared_model::interface::Amount &amount) const {
+      return amount_storage_mode_ == AmountStorageMode::kScaledInteger
+          ? toScaledIntegerString(amount)
+          : amount.toStringRepr();
+    }
+
     CommandResult PostgresCommandExecutor::operator()(
         const shared_model::interface::AddAssetQuantity &command,
         const shared_model::interface::types::AccountIdType &creator_account_id,
         bool do_validation) {
       auto &asset_id = command.assetId();
-      auto quantity = command.amount().toStringRepr();
+      auto quantity = quantityParameter(command.amount());
       int precision = command.amount().precision();
 
       StatementExecutor executor(add_asset_quantity_statements_,
@@ -1694,7 +1775,7 @@ namespace iroha {
         const shared_model::interface::types::AccountIdType &creator_account_id,
         bool do_validation) {
       auto &asset_id = command.assetId();
-      auto quantity = command.amount().toStringRepr();
+      auto quantity = quantityParameter(command.amount());
       uint32_t precision = command.amount().precision();
 
       StatementExecutor executor(subtract_asset_quantity_statements_,
@@ -1716,7 +1797,7 @@ namespace iroha {
       auto &src_account_id = command.srcAccountId();
       auto &dest_account_id = command.destAccountId();
       auto &asset_id = command.assetId();
-      auto quantity = command.amount().toStringRepr();
+      auto quantity = quantityParameter(command.amount());
       uint32_t precision = command.amount().precision();
 
       StatementExecutor executor(transfer_asset_statements_,
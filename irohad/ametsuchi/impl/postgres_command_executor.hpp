@@ -8,6 +8,7 @@
 
 #include "ametsuchi/command_executor.hpp"
 
+#include "ametsuchi/impl/amount_storage_mode.hpp"
 #include "ametsuchi/impl/soci_utils.hpp"
 
 namespace soci {
@@ -19,6 +20,7 @@ namespace shared_model {
     class AddAssetQuantity;
     class AddPeer;
     class AddSignatory;
+    class Amount;
     class AppendRole;
     class CompareAndSetAccountDetail;
     class CreateAccount;
@@ -44,10 +46,16 @@ namespace iroha {
 
     class PostgresCommandExecutor final : public CommandExecutor {
      public:
+      /**
+       * @param sql - session to execute commands in
+       * @param perm_converter - permission names for error messages
+       * @param amount_storage_mode - balance representation of the database
+       */
       PostgresCommandExecutor(
           std::unique_ptr<soci::session> sql,
           std::shared_ptr<shared_model::interface::PermissionToString>
-              perm_converter);
+              perm_converter,
+          AmountStorageMode amount_storage_mode = AmountStorageMode::kDecimal);
 
       ~PostgresCommandExecutor();
 
@@ -178,6 +186,10 @@ namespace iroha {
 
       void initStatements();
 
+      /// @return command quantity in the representation of stored balances
+      std::string quantityParameter(
+          const shared_model::interface::Amount &amount) const;
+
       std::unique_ptr<CommandStatements> makeCommandStatements(
           const std::unique_ptr<soci::session> &session,
           const std::string &base_statement,
@@ -188,6 +200,8 @@ namespace iroha {
       std::shared_ptr<shared_model::interface::PermissionToString>
           perm_converter_;
 
+      const AmountStorageMode amount_storage_mode_;
+
       std::unique_ptr<CommandStatements> add_asset_quantity_statements_;
       std::unique_ptr<CommandStatements> add_peer_statements_;
       std::unique_ptr<CommandStatements> add_signatory_statements_;
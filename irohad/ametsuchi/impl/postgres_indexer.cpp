@@ -5,6 +5,8 @@
 
 #include "ametsuchi/impl/postgres_indexer.hpp"
 
+#include <map>
+
 #include <soci/soci.h>
 #include <boost/format.hpp>
 #include "cryptography/hash.hpp"
@@ -12,61 +14,137 @@
 using namespace iroha::ametsuchi;
 using namespace shared_model::interface::types;
 
-PostgresIndexer::PostgresIndexer(soci::session &sql) : sql_(sql) {}
+namespace {
+  /// Make a text[] literal of the values.
+  std::string textArray(const std::vector<std::string> &values) {
+    std::string result = "ARRAY[";
+    for (const auto &value : values) {
+      result.append("'").append(value).append("',");
+    }
+    if (not values.empty()) {
+      result.pop_back();
+    }
+    return result + "]::text[]";
+  }
 
-void PostgresIndexer::txHashPosition(const HashType &hash,
-                                     TxPosition position) {
-  boost::format base(
-      "INSERT INTO position_by_hash"
-      "(hash, height, index) VALUES "
-      "('%s', '%s', '%s');\n");
-  statements_.append(
-      (base % hash.hex() % position.height % position.index).str());
-}
+  /// Make a bigint[] literal of the values.
+  template <typename T>
+  std::string bigintArray(const std::vector<T> &values) {
+    std::string result = "'{";
+    for (const auto &value : values) {
+      result.append(std::to_string(value)).append(",");
+    }
+    if (not values.empty()) {
+      result.pop_back();
+    }
+    return result + "}'::bigint[]";
+  }
 
-void PostgresIndexer::txHashStatus(const HashType &rejected_tx_hash,
-                                   bool is_committed) {
-  boost::format base(
-      "INSERT INTO tx_status_by_hash"
-      "(hash, status) VALUES "
-      "('%s', '%s');\n");
-  statements_.append(
-      (base % rejected_tx_hash.hex() % (is_committed ? "TRUE" : "FALSE"))
-          .str());
-}
+  /// Make a boolean[] literal of the values.
+  std::string booleanArray(const std::vector<bool> &values) {
+    std::string result = "'{";
+    for (bool value : values) {
+      result.append(value ? "t," : "f,");
+    }
+    if (not values.empty()) {
+      result.pop_back();
+    }
+    return result + "}'::boolean[]";
+  }
+}  // namespace
 
-void PostgresIndexer::committedTxHash(const HashType &committed_tx_hash) {
-  txHashStatus(committed_tx_hash, true);
-}
+PostgresIndexer::PostgresIndexer(soci::session &sql) : sql_(sql) {}
 
-void PostgresIndexer::rejectedTxHash(const HashType &rejected_tx_hash) {
-  txHashStatus(rejected_tx_hash, false);
+void PostgresIndexer::committedTx(const HashType &hash,
+                                  const AccountIdType &creator,
+                                  TxPosition position) {
+  auto hex_hash = hash.hex();
+  committed_txs_.hash.push_back(hex_hash);
+  committed_txs_.creator.push_back(creator);
+  committed_txs_.height.push_back(position.height);
+  committed_txs_.index.push_back(position.index);
+  tx_statuses_.hash.push_back(std::move(hex_hash));
+  tx_statuses_.is_committed.push_back(true);
 }
 
-void PostgresIndexer::txPositionByCreator(const AccountIdType creator,
-                                          TxPosition position) {
-  boost::format base(
-      "INSERT INTO tx_position_by_creator"
-      "(creator_id, height, index) VALUES "
-      "('%s', '%s', '%s');\n");
-  statements_.append((base % creator % position.height % position.index).str());
+void PostgresIndexer::rejectedTxHash(const HashType &rejected_tx_hash) {
+  tx_statuses_.hash.push_back(rejected_tx_hash.hex());
+  tx_statuses_.is_committed.push_back(false);
 }
 
 void PostgresIndexer::accountAssetTxPosition(const AccountIdType &account_id,
                                              const AssetIdType &asset_id,
                                              TxPosition position) {
-  boost::format base(
-      "INSERT INTO position_by_account_asset"
-      "(account_id, asset_id, height, index) VALUES "
-      "('%s', '%s', '%s', '%s');\n");
-  statements_.append(
-      (base % account_id % asset_id % position.height % position.index).str());
+  account_asset_txs_.account_id.push_back(account_id);
+  account_asset_txs_.asset_id.push_back(asset_id);
+  account_asset_txs_.height.push_back(position.height);
+  account_asset_txs_.index.push_back(position.index);
+}
+
+std::string PostgresIndexer::makeStatements() const {
+  std::string statements;
+  if (not committed_txs_.hash.empty()) {
+    const auto heights = bigintArray(committed_txs_.height);
+    const auto indices = bigintArray(committed_txs_.index);
+
+    std::map<AccountIdType, size_t> creator_txs;
+    for (const auto &creator : committed_txs_.creator) {
+      ++creator_txs[creator];
+    }
+    std::vector<std::string> creators;
+    std::vector<size_t> counts;
+    for (const auto &creator_count : creator_txs) {
+      creators.push_back(creator_count.first);
+      counts.push_back(creator_count.second);
+    }
+
+    statements.append(
+        (boost::format("INSERT INTO position_by_hash(hash, height, index) "
+                       "SELECT * FROM unnest(%s, %s, %s);\n"
+                       "INSERT INTO tx_position_by_creator"
+                       "(creator_id, height, index) "
+                       "SELECT * FROM unnest(%s, %s, %s);\n"
+                       "INSERT INTO tx_count_by_creator(creator_id, count) "
+                       "SELECT * FROM unnest(%s, %s) "
+                       "ON CONFLICT (creator_id) DO UPDATE "
+                       "SET count = tx_count_by_creator.count "
+                       "+ excluded.count;\n")
+         % textArray(committed_txs_.hash) % heights % indices
+         % textArray(committed_txs_.creator) % heights % indices
+         % textArray(creators) % bigintArray(counts))
+            .str());
+  }
+  if (not tx_statuses_.hash.empty()) {
+    statements.append(
+        (boost::format("INSERT INTO tx_status_by_hash(hash, status) "
+                       "SELECT * FROM unnest(%s, %s);\n")
+         % textArray(tx_statuses_.hash)
+         % booleanArray(tx_statuses_.is_committed))
+            .str());
+  }
+  if (not account_asset_txs_.account_id.empty()) {
+    statements.append(
+        (boost::format("INSERT INTO position_by_account_asset"
+                       "(account_id, asset_id, height, index) "
+                       "SELECT * FROM unnest(%s, %s, %s, %s);\n")
+         % textArray(account_asset_txs_.account_id)
+         % textArray(account_asset_txs_.asset_id)
+         % bigintArray(account_asset_txs_.height)
+         % bigintArray(account_asset_txs_.index))
+            .str());
+  }
+  return statements;
 }
 
 iroha::expected::Result<void, std::string> PostgresIndexer::flush() {
   try {
-    sql_ << statements_;
-    statements_.clear();
+    auto statements = makeStatements();
+    if (not statements.empty()) {
+      sql_ << statements;
+    }
+    committed_txs_ = {};
+    tx_statuses_ = {};
+    account_asset_txs_ = {};
   } catch (const std::exception &e) {
     return e.what();
   }
@@ -8,6 +8,8 @@
 
 #include "ametsuchi/indexer.hpp"
 
+#include <vector>
+
 namespace soci {
   class session;
 }
@@ -15,23 +17,22 @@ namespace soci {
 namespace iroha {
   namespace ametsuchi {
 
+    /**
+     * Collects the indices column by column and writes each table with a
+     * single statement on flush().
+     */
     class PostgresIndexer : public Indexer {
      public:
       PostgresIndexer(soci::session &sql);
 
-      void txHashPosition(const shared_model::interface::types::HashType &hash,
-                          TxPosition position) override;
-
-      void committedTxHash(const shared_model::interface::types::HashType
-                               &committed_tx_hash) override;
+      void committedTx(
+          const shared_model::interface::types::HashType &hash,
+          const shared_model::interface::types::AccountIdType &creator,
+          TxPosition position) override;
 
       void rejectedTxHash(const shared_model::interface::types::HashType
                               &rejected_tx_hash) override;
 
-      void txPositionByCreator(
-          const shared_model::interface::types::AccountIdType creator,
-          TxPosition position) override;
-
       void accountAssetTxPosition(
           const shared_model::interface::types::AccountIdType &account_id,
           const shared_model::interface::types::AssetIdType &asset_id,
@@ -40,13 +41,35 @@ namespace iroha {
       iroha::expected::Result<void, std::string> flush() override;
 
      private:
-      /// Index tx status by its hash.
-      void txHashStatus(
-          const shared_model::interface::types::HashType &rejected_tx_hash,
-          bool is_committed);
+      /// Rows of position_by_hash and tx_position_by_creator.
+      struct CommittedTxs {
+        std::vector<std::string> hash;
+        std::vector<shared_model::interface::types::AccountIdType> creator;
+        std::vector<shared_model::interface::types::HeightType> height;
+        std::vector<size_t> index;
+      };
+
+      /// Rows of tx_status_by_hash.
+      struct TxStatuses {
+        std::vector<std::string> hash;
+        std::vector<bool> is_committed;
+      };
+
+      /// Rows of position_by_account_asset.
+      struct AccountAssetTxs {
+        std::vector<shared_model::interface::types::AccountIdType> account_id;
+        std::vector<shared_model::interface::types::AssetIdType> asset_id;
+        std::vector<shared_model::interface::types::HeightType> height;
+        std::vector<size_t> index;
+      };
+
+      /// Make SQL inserting all the collected rows.
+      std::string makeStatements() const;
 
       soci::session &sql_;
-      std::string statements_;  ///< A bunch of SQL to be committed on flush().
+      CommittedTxs committed_txs_;
+      TxStatuses tx_statuses_;
+      AccountAssetTxs account_asset_txs_;
     };
 
   }  // namespace ametsuchi
@@ -53,7 +53,8 @@ namespace {
 
 PostgresOptions::PostgresOptions(const std::string &pg_opt,
                                  std::string default_dbname,
-                                 logger::LoggerPtr log)
+                                 logger::LoggerPtr log,
+                                 AmountStorageMode amount_storage_mode)
     : PostgresOptions(
           extractField(pg_opt, "host"),
           getPort(extractField(pg_opt, "port")),
@@ -61,7 +62,8 @@ PostgresOptions::PostgresOptions(const std::string &pg_opt,
           extractField(pg_opt, "password"),
           extractOptionalField(pg_opt, "dbname").value_or(default_dbname),
           extractField(pg_opt, "user"),
-          std::move(log)) {}
+          std::move(log),
+          amount_storage_mode) {}
 
 PostgresOptions::PostgresOptions(const std::string &host,
                                  uint16_t port,
@@ -69,14 +71,16 @@ PostgresOptions::PostgresOptions(const std::string &host,
                                  const std::string &password,
                                  const std::string &working_dbname,
                                  const std::string &maintenance_dbname,
-                                 logger::LoggerPtr log)
+                                 logger::LoggerPtr log,
+                                 AmountStorageMode amount_storage_mode)
     : host_(host),
       port_(port),
       user_(user),
       password_(password),
       working_dbname_(working_dbname),
       maintenance_dbname_(maintenance_dbname),
-      prepared_block_name_(kPreparedBlockPrefix + working_dbname_) {
+      prepared_block_name_(kPreparedBlockPrefix + working_dbname_),
+      amount_storage_mode_(amount_storage_mode) {
   if (working_dbname_ == maintenance_dbname_) {
     log->warn(
         "Working database has the same name with maintenance database: '{}'. "
@@ -115,3 +119,7 @@ std::string PostgresOptions::maintenanceDbName() const {
 const std::string &PostgresOptions::preparedBlockName() const {
   return prepared_block_name_;
 }
+
+AmountStorageMode PostgresOptions::amountStorageMode() const {
+  return amount_storage_mode_;
+}
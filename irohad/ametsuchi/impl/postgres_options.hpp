@@ -7,6 +7,7 @@
 #define IROHA_POSTGRES_OPTIONS_HPP
 
 #include <unordered_map>
+#include "ametsuchi/impl/amount_storage_mode.hpp"
 #include "common/result.hpp"
 #include "logger/logger_fwd.hpp"
 
@@ -23,12 +24,15 @@ namespace iroha {
        * @param default_dbname The default name of database to use when one is
        * not provided in pg_opt.
        * @param log Logger for internal messages.
+       * @param amount_storage_mode Balance representation for new databases.
        *
        * TODO 2019.06.07 mboldyrev IR-556 remove this constructor
        */
-      PostgresOptions(const std::string &pg_opt,
-                      std::string default_dbname,
-                      logger::LoggerPtr log);
+      PostgresOptions(
+          const std::string &pg_opt,
+          std::string default_dbname,
+          logger::LoggerPtr log,
+          AmountStorageMode amount_storage_mode = AmountStorageMode::kDecimal);
 
       /**
        * @param host PostgreSQL host.
@@ -40,14 +44,18 @@ namespace iroha {
        * purposes. It will not be altered in any way and is used to manage
        * working database.
        * @param log Logger for internal messages.
+       * @param amount_storage_mode Balance representation for new databases.
+       * Existing databases keep the representation they were created with.
        */
-      PostgresOptions(const std::string &host,
-                      uint16_t port,
-                      const std::string &user,
-                      const std::string &password,
-                      const std::string &working_dbname,
-                      const std::string &maintenance_dbname,
-                      logger::LoggerPtr log);
+      PostgresOptions(
+          const std::string &host,
+          uint16_t port,
+          const std::string &user,
+          const std::string &password,
+          const std::string &working_dbname,
+          const std::string &maintenance_dbname,
+          logger::LoggerPtr log,
+          AmountStorageMode amount_storage_mode = AmountStorageMode::kDecimal);
 
       /// @return connection string without dbname param
       std::string connectionStringWithoutDbName() const;
@@ -67,6 +75,9 @@ namespace iroha {
       /// @return prepared block name
       const std::string &preparedBlockName() const;
 
+      /// @return balance representation requested for new databases
+      AmountStorageMode amountStorageMode() const;
+
      private:
       std::string getConnectionStringWithDbName(
           const std::string &dbname) const;
@@ -78,6 +89,7 @@ namespace iroha {
       const std::string working_dbname_;
       const std::string maintenance_dbname_;
       const std::string prepared_block_name_;
+      const AmountStorageMode amount_storage_mode_;
     };
 
   }  // namespace ametsuchi
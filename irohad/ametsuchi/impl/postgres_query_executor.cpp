@@ -55,6 +55,7 @@ namespace iroha {
             soci::use(query.creatorAccountId(), "account_id"),
             soci::use(keys, "pk");
       } catch (const std::exception &e) {
+        failed_ = true;
         log_->error("{}", e.what());
         return false;
       }
@@ -94,5 +95,9 @@ namespace iroha {
       return true;
     }
 
+    bool PostgresQueryExecutor::failed() const {
+      return failed_;
+    }
+
   }  // namespace ametsuchi
 }  // namespace iroha
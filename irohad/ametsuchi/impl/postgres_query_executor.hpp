@@ -38,6 +38,10 @@ namespace iroha {
       bool validate(const shared_model::interface::BlocksQuery &query,
                     const bool validate_signatories) override;
 
+      /// @return true if a statement has thrown, so that the session may be
+      /// broken
+      bool failed() const;
+
      private:
       template <class Q>
       bool validateSignatures(const Q &query);
@@ -47,6 +51,7 @@ namespace iroha {
       std::shared_ptr<shared_model::interface::QueryResponseFactory>
           query_response_factory_;
       logger::LoggerPtr log_;
+      bool failed_ = false;
     };
 
   }  // namespace ametsuchi
@@ -14,6 +14,7 @@
 #include <boost/range/irange.hpp>
 #include "ametsuchi/block_storage.hpp"
 #include "ametsuchi/impl/executor_common.hpp"
+#include "ametsuchi/impl/scaled_amount.hpp"
 #include "ametsuchi/impl/soci_utils.hpp"
 #include "backend/plain/account_detail_record_id.hpp"
 #include "backend/plain/peer.hpp"
@@ -40,6 +41,7 @@
 #include "interfaces/queries/tx_pagination_meta.hpp"
 #include "interfaces/transaction.hpp"
 #include "logger/logger.hpp"
+#include "metrics/metrics.hpp"
 #include "pending_txs_storage/pending_txs_storage.hpp"
 
 using namespace shared_model::interface::permissions;
@@ -48,6 +50,15 @@ namespace {
 
   using namespace iroha;
 
+  /// @return histogram of SQL execution time of queries
+  metrics::Histogram &sqlQueryLatency() {
+    static auto &histogram = metrics::defaultRegistry().histogram(
+        "iroha_sql_query_microseconds",
+        "Time of SQL execution of a query",
+        metrics::latencyBounds());
+    return histogram;
+  }
+
   std::string getAccountRolePermissionCheckSql(
       shared_model::interface::permissions::Role permission,
       const std::string &account_alias = ":role_account_id") {
@@ -76,10 +87,10 @@ namespace {
    * permissions for target account
    * It verifies individual, domain, and global permissions, and returns true if
    * any of listed permissions is present
+   * The creator and the target account are bound as :creator_id and
+   * :target_account_id, so the text only depends on the permissions.
    */
   auto hasQueryPermission(
-      const shared_model::interface::types::AccountIdType &creator,
-      const shared_model::interface::types::AccountIdType &target_account,
       Role indiv_permission_id,
       Role all_permission_id,
       Role domain_permission_id) {
@@ -94,39 +105,38 @@ namespace {
         shared_model::interface::RolePermissionSet({domain_permission_id})
             .toBitstring();
 
-    const std::string creator_quoted{(boost::format("'%s'") % creator).str()};
-
     boost::format cmd(R"(
     WITH
         has_root_perm AS (%1%),
         has_indiv_perm AS (
           SELECT (COALESCE(bit_or(rp.permission), '0'::bit(%2%))
-          & '%4%') = '%4%' FROM role_has_permissions AS rp
+          & '%3%') = '%3%' FROM role_has_permissions AS rp
               JOIN account_has_roles AS ar on ar.role_id = rp.role_id
-              WHERE ar.account_id = '%3%'
+              WHERE ar.account_id = :creator_id
         ),
         has_all_perm AS (
           SELECT (COALESCE(bit_or(rp.permission), '0'::bit(%2%))
-          & '%5%') = '%5%' FROM role_has_permissions AS rp
+          & '%4%') = '%4%' FROM role_has_permissions AS rp
               JOIN account_has_roles AS ar on ar.role_id = rp.role_id
-              WHERE ar.account_id = '%3%'
+              WHERE ar.account_id = :creator_id
         ),
         has_domain_perm AS (
           SELECT (COALESCE(bit_or(rp.permission), '0'::bit(%2%))
-          & '%6%') = '%6%' FROM role_has_permissions AS rp
+          & '%5%') = '%5%' FROM role_has_permissions AS rp
               JOIN account_has_roles AS ar on ar.role_id = rp.role_id
-              WHERE ar.account_id = '%3%'
+              WHERE ar.account_id = :creator_id
         )
     SELECT (SELECT * from has_root_perm)
-        OR ('%3%' = '%7%' AND (SELECT * FROM has_indiv_perm))
+        OR (:creator_id::text = :target_account_id::text
+            AND (SELECT * FROM has_indiv_perm))
         OR (SELECT * FROM has_all_perm)
-        OR ('%8%' = '%9%' AND (SELECT * FROM has_domain_perm)) AS perm
+        OR (split_part(:creator_id::text, '@', 2)
+              = split_part(:target_account_id::text, '@', 2)
+            AND (SELECT * FROM has_domain_perm)) AS perm
     )");
 
-    return (cmd % getAccountRolePermissionCheckSql(Role::kRoot, creator_quoted)
-            % bits % creator % perm_str % all_perm_str % domain_perm_str
-            % target_account % iroha::ametsuchi::getDomainFromName(creator)
-            % iroha::ametsuchi::getDomainFromName(target_account))
+    return (cmd % getAccountRolePermissionCheckSql(Role::kRoot, ":creator_id")
+            % bits % perm_str % all_perm_str % domain_perm_str)
         .str();
   }
 
@@ -134,6 +144,12 @@ namespace {
   template <typename... Value>
   using QueryType = boost::tuple<boost::optional<Value>...>;
 
+  /// Transaction positions with the total number of transactions
+  using TxPositionsQueryTuple =
+      QueryType<shared_model::interface::types::HeightType, uint64_t, uint64_t>;
+  using TxPositionsRow =
+      ametsuchi::concat<TxPositionsQueryTuple, boost::tuple<int>>;
+
   /**
    * Create an error response in case user does not have permissions to perform
    * a query
@@ -167,6 +183,35 @@ namespace {
         | boost::adaptors::transformed([](auto t) { return *t; });
   }
 
+  /**
+   * Execute a prepared statement and fetch all the resulting rows. The
+   * statement stays prepared and can be executed again with new parameters.
+   * @tparam T - type of a row
+   * @param statement - prepared statement
+   * @param uses - parameters to bind, must stay alive during the call
+   * @return fetched rows
+   */
+  template <typename T, typename... Uses>
+  std::vector<T> fetchPrepared(soci::statement &statement, Uses &&... uses) {
+    std::vector<T> rows;
+    T row;
+    try {
+      using Ignored = int[];
+      (void)Ignored{0, (statement.exchange(std::forward<Uses>(uses)), 0)...};
+      statement.define_and_bind();
+      statement.exchange_for_rowset(soci::into(row));
+      statement.execute();
+      while (statement.fetch()) {
+        rows.push_back(row);
+      }
+    } catch (...) {
+      statement.bind_clean_up();
+      throw;
+    }
+    statement.bind_clean_up();
+    return rows;
+  }
+
 }  // namespace
 
 namespace iroha {
@@ -180,16 +225,34 @@ namespace iroha {
             response_factory,
         std::shared_ptr<shared_model::interface::PermissionToString>
             perm_converter,
-        logger::LoggerPtr log)
+        logger::LoggerPtr log,
+        AmountStorageMode amount_storage_mode)
         : sql_(sql),
           block_store_(block_store),
           pending_txs_storage_(std::move(pending_txs_storage)),
           query_response_factory_{std::move(response_factory)},
           perm_converter_(std::move(perm_converter)),
-          log_(std::move(log)) {}
+          log_(std::move(log)),
+          amount_storage_mode_(amount_storage_mode) {}
+
+    template <typename SqlGenerator>
+    soci::statement &PostgresSpecificQueryExecutor::preparedStatement(
+        const std::string &name, SqlGenerator &&make_sql) {
+      auto it = prepared_statements_.find(name);
+      if (it == prepared_statements_.end()) {
+        it = prepared_statements_
+                 .emplace(name,
+                          std::make_unique<soci::statement>(
+                              sql_.prepare
+                              << std::forward<SqlGenerator>(make_sql)()))
+                 .first;
+      }
+      return *it->second;
+    }
 
     QueryExecutorResult PostgresSpecificQueryExecutor::execute(
         const shared_model::interface::Query &qry) {
+      metrics::ScopedTimer timer(sqlQueryLatency());
       return boost::apply_visitor(
           [this, &qry](const auto &query) {
             return (*this)(query, qry.creatorAccountId(), qry.hash());
@@ -239,9 +302,8 @@ namespace iroha {
         const shared_model::interface::types::HashType &query_hash,
         ResponseCreator &&response_creator,
         PermissionsErrResponse &&perms_err_response) {
-      using T = concat<QueryTuple, PermissionTuple>;
       try {
-        soci::rowset<T> st = std::forward<QueryExecutor>(query_executor)();
+        auto st = std::forward<QueryExecutor>(query_executor)();
         auto range = boost::make_iterator_range(st.begin(), st.end());
 
         return iroha::ametsuchi::apply(
@@ -268,6 +330,7 @@ namespace iroha {
                   query_range, perms...);
             });
       } catch (const std::exception &e) {
+        failed_ = true;
         return this->logAndReturnErrorResponse(
             QueryErrorType::kStatefulFailed, e.what(), 1, query_hash);
       }
@@ -285,11 +348,16 @@ namespace iroha {
              soci::use(account_id, "role_account_id"));
         return st.begin()->get<0>();
       } catch (const std::exception &e) {
+        failed_ = true;
         log_->error("Failed to validate query: {}", e.what());
         return false;
       }
     }
 
+    bool PostgresSpecificQueryExecutor::failed() const {
+      return failed_;
+    }
+
     std::unique_ptr<shared_model::interface::QueryResponse>
     PostgresSpecificQueryExecutor::logAndReturnErrorResponse(
         QueryErrorType error_type,
@@ -336,57 +404,47 @@ namespace iroha {
         const shared_model::interface::types::AccountIdType &creator_id,
         const shared_model::interface::types::HashType &query_hash,
         QueryChecker &&qry_checker,
+        const std::string &statement_name,
         const std::string &related_txs,
+        const std::string &total_size_query,
         QueryApplier applier,
         Permissions... perms) {
-      using QueryTuple = QueryType<shared_model::interface::types::HeightType,
-                                   uint64_t,
-                                   uint64_t>;
+      using QueryTuple = TxPositionsQueryTuple;
       using PermissionTuple = boost::tuple<int>;
       const auto &pagination_info = q.paginationMeta();
       auto first_hash = pagination_info.firstTxHash();
       // retrieve one extra transaction to populate next_hash
       auto query_size = pagination_info.pageSize() + 1u;
 
-      auto base = boost::format(R"(WITH has_perms AS (%s),
-      my_txs AS (%s),
-      first_hash AS (%s),
-      total_size AS (
-        SELECT COUNT(*) FROM my_txs
-      ),
+      auto make_sql = [&] {
+        auto base = boost::format(R"(WITH has_perms AS (%s),
+      total_size AS (%s),
       t AS (
-        SELECT my_txs.height, my_txs.index
-        FROM my_txs JOIN
-        first_hash ON my_txs.height > first_hash.height
-        OR (my_txs.height = first_hash.height AND
-            my_txs.index >= first_hash.index)
+        SELECT DISTINCT height, index %s %s
+        ORDER BY height, index ASC
         LIMIT :page_size
       )
       SELECT height, index, count, perm FROM t
       RIGHT OUTER JOIN has_perms ON TRUE
       JOIN total_size ON TRUE
+      ORDER BY height, index ASC
       )");
 
-      // select tx with specified hash
-      auto first_by_hash = R"(SELECT height, index FROM position_by_hash
-      WHERE hash = :hash LIMIT 1)";
-
-      // select first ever tx
-      auto first_tx = R"(SELECT height, index FROM position_by_hash
-      ORDER BY height, index ASC LIMIT 1)";
+        // start the page from the position of tx with specified hash; the
+        // cursor values are computed once, so the positions index is scanned
+        // from the cursor instead of joining all the positions with it
+        auto from_hash = R"(AND (height, index) >= (
+          (SELECT height FROM position_by_hash WHERE hash = :hash),
+          (SELECT index FROM position_by_hash WHERE hash = :hash)))";
 
-      auto cmd = base % hasQueryPermission(creator_id, q.accountId(), perms...)
-          % related_txs;
-      if (first_hash) {
-        cmd = base % first_by_hash;
-      } else {
-        cmd = base % first_tx;
-      }
-
-      auto query = cmd.str();
+        return (base % hasQueryPermission(perms...) % total_size_query
+                % related_txs % (first_hash ? from_hash : ""))
+            .str();
+      };
 
       return executeQuery<QueryTuple, PermissionTuple>(
-          applier(query),
+          applier(preparedStatement(
+              statement_name + (first_hash ? "/first_hash" : ""), make_sql)),
           query_hash,
           [&](auto range, auto &) {
             auto range_without_nulls = resultWithoutNulls(std::move(range));
@@ -406,8 +464,26 @@ namespace iroha {
 
             std::vector<std::unique_ptr<shared_model::interface::Transaction>>
                 response_txs;
-            // get transactions corresponding to indexes
+            // get transactions corresponding to indexes: a block is decoded
+            // once for all its transactions, and a single transaction of a
+            // block is decoded alone
             for (auto &block : index) {
+              if (block.second.size() == 1) {
+                auto tx = block_store_.fetchTransaction(block.first,
+                                                        block.second.front());
+                if (not tx) {
+                  return this->logAndReturnErrorResponse(
+                      QueryErrorType::kStatefulFailed,
+                      fmt::format("Failed to retrieve transaction with id {} "
+                                  "from block height {}.",
+                                  block.second.front(),
+                                  block.first),
+                      1,
+                      query_hash);
+                }
+                response_txs.push_back(std::move(*tx));
+                continue;
+              }
               auto txs_result = this->getTransactionsFromBlock(
                   block.first,
                   [&block](auto) { return block.second; },
@@ -473,7 +549,8 @@ namespace iroha {
                     std::string>;
       using PermissionTuple = boost::tuple<int>;
 
-      auto cmd = (boost::format(R"(WITH has_perms AS (%s),
+      auto &statement = preparedStatement("GetAccount", [] {
+        return (boost::format(R"(WITH has_perms AS (%s),
       t AS (
           SELECT a.account_id, a.domain_id, a.quorum, a.data, ARRAY_AGG(ar.role_id) AS roles
           FROM account AS a, account_has_roles AS ar
@@ -484,12 +561,11 @@ namespace iroha {
       SELECT account_id, domain_id, quorum, data, roles, perm
       FROM t RIGHT OUTER JOIN has_perms AS p ON TRUE
       )")
-                  % hasQueryPermission(creator_id,
-                                       q.accountId(),
-                                       Role::kGetMyAccount,
-                                       Role::kGetAllAccounts,
-                                       Role::kGetDomainAccounts))
-                     .str();
+                % hasQueryPermission(Role::kGetMyAccount,
+                                     Role::kGetAllAccounts,
+                                     Role::kGetDomainAccounts))
+            .str();
+      });
 
       auto query_apply = [this, &query_hash](auto &account_id,
                                              auto &domain_id,
@@ -506,8 +582,10 @@ namespace iroha {
 
       return executeQuery<QueryTuple, PermissionTuple>(
           [&] {
-            return (sql_.prepare << cmd,
-                    soci::use(q.accountId(), "target_account_id"));
+            return fetchPrepared<concat<QueryTuple, PermissionTuple>>(
+                statement,
+                soci::use(creator_id, "creator_id"),
+                soci::use(q.accountId(), "target_account_id"));
           },
           query_hash,
           [this, &q, &query_apply, &query_hash](auto range, auto &) {
@@ -575,23 +653,28 @@ namespace iroha {
       using QueryTuple = QueryType<std::string>;
       using PermissionTuple = boost::tuple<int>;
 
-      auto cmd = (boost::format(R"(WITH has_perms AS (%s),
+      auto &statement = preparedStatement("GetSignatories", [] {
+        return (boost::format(R"(WITH has_perms AS (%s),
       t AS (
           SELECT public_key FROM account_has_signatory
-          WHERE account_id = :account_id
+          WHERE account_id = :target_account_id
       )
       SELECT public_key, perm FROM t
       RIGHT OUTER JOIN has_perms ON TRUE
       )")
-                  % hasQueryPermission(creator_id,
-                                       q.accountId(),
-                                       Role::kGetMySignatories,
-                                       Role::kGetAllSignatories,
-                                       Role::kGetDomainSignatories))
-                     .str();
+                % hasQueryPermission(Role::kGetMySignatories,
+                                     Role::kGetAllSignatories,
+                                     Role::kGetDomainSignatories))
+            .str();
+      });
 
       return executeQuery<QueryTuple, PermissionTuple>(
-          [&] { return (sql_.prepare << cmd, soci::use(q.accountId())); },
+          [&] {
+            return fetchPrepared<concat<QueryTuple, PermissionTuple>>(
+                statement,
+                soci::use(creator_id, "creator_id"),
+                soci::use(q.accountId(), "target_account_id"));
+          },
           query_hash,
           [this, &q, &query_hash](auto range, auto &) {
             auto range_without_nulls = resultWithoutNulls(std::move(range));
@@ -622,27 +705,34 @@ namespace iroha {
         const shared_model::interface::GetAccountTransactions &q,
         const shared_model::interface::types::AccountIdType &creator_id,
         const shared_model::interface::types::HashType &query_hash) {
-      std::string related_txs = R"(SELECT DISTINCT height, index
-      FROM tx_position_by_creator
-      WHERE creator_id = :account_id
-      ORDER BY height, index ASC)";
+      std::string related_txs = R"(FROM tx_position_by_creator
+      WHERE creator_id = :target_account_id)";  // consider index when changing
+
+      // the counter is maintained by the indexer
+      std::string total_size = R"(SELECT COALESCE(
+        (SELECT count FROM tx_count_by_creator
+        WHERE creator_id = :target_account_id), 0) AS count)";
 
       const auto &pagination_info = q.paginationMeta();
       auto first_hash = pagination_info.firstTxHash();
       // retrieve one extra transaction to populate next_hash
       auto query_size = pagination_info.pageSize() + 1u;
 
-      auto apply_query = [&](const auto &query) {
+      auto apply_query = [&](soci::statement &statement) {
         return [&] {
           if (first_hash) {
-            return (sql_.prepare << query,
-                    soci::use(q.accountId()),
-                    soci::use(first_hash->hex()),
-                    soci::use(query_size));
+            return fetchPrepared<TxPositionsRow>(
+                statement,
+                soci::use(creator_id, "creator_id"),
+                soci::use(q.accountId(), "target_account_id"),
+                soci::use(first_hash->hex(), "hash"),
+                soci::use(query_size, "page_size"));
           } else {
-            return (sql_.prepare << query,
-                    soci::use(q.accountId()),
-                    soci::use(query_size));
+            return fetchPrepared<TxPositionsRow>(
+                statement,
+                soci::use(creator_id, "creator_id"),
+                soci::use(q.accountId(), "target_account_id"),
+                soci::use(query_size, "page_size"));
           }
         };
       };
@@ -660,7 +750,9 @@ namespace iroha {
                                       creator_id,
                                       query_hash,
                                       std::move(check_query),
+                                      "GetAccountTransactions",
                                       related_txs,
+                                      total_size,
                                       apply_query,
                                       Role::kGetMyAccTxs,
                                       Role::kGetAllAccTxs,
@@ -753,30 +845,39 @@ namespace iroha {
         const shared_model::interface::GetAccountAssetTransactions &q,
         const shared_model::interface::types::AccountIdType &creator_id,
         const shared_model::interface::types::HashType &query_hash) {
-      std::string related_txs = R"(SELECT DISTINCT height, index
-          FROM position_by_account_asset
-          WHERE account_id = :account_id
-          AND asset_id = :asset_id
-          ORDER BY height, index ASC)";  // consider index when changing this
+      std::string related_txs = R"(FROM position_by_account_asset
+          WHERE account_id = :target_account_id
+          AND asset_id = :asset_id)";  // consider index when changing this
+
+      // the same transaction may be indexed for an account asset several
+      // times, the count is served from the index only
+      std::string total_size = R"(SELECT COUNT(*) FROM (
+          SELECT DISTINCT height, index FROM position_by_account_asset
+          WHERE account_id = :target_account_id
+          AND asset_id = :asset_id) positions)";
 
       const auto &pagination_info = q.paginationMeta();
       auto first_hash = pagination_info.firstTxHash();
       // retrieve one extra transaction to populate next_hash
       auto query_size = pagination_info.pageSize() + 1u;
 
-      auto apply_query = [&](const auto &query) {
+      auto apply_query = [&](soci::statement &statement) {
         return [&] {
           if (first_hash) {
-            return (sql_.prepare << query,
-                    soci::use(q.accountId()),
-                    soci::use(q.assetId()),
-                    soci::use(first_hash->hex()),
-                    soci::use(query_size));
+            return fetchPrepared<TxPositionsRow>(
+                statement,
+                soci::use(creator_id, "creator_id"),
+                soci::use(q.accountId(), "target_account_id"),
+                soci::use(q.assetId(), "asset_id"),
+                soci::use(first_hash->hex(), "hash"),
+                soci::use(query_size, "page_size"));
           } else {
-            return (sql_.prepare << query,
-                    soci::use(q.accountId()),
-                    soci::use(q.assetId()),
-                    soci::use(query_size));
+            return fetchPrepared<TxPositionsRow>(
+                statement,
+                soci::use(creator_id, "creator_id"),
+                soci::use(q.accountId(), "target_account_id"),
+                soci::use(q.assetId(), "asset_id"),
+                soci::use(query_size, "page_size"));
           }
         };
       };
@@ -800,7 +901,9 @@ namespace iroha {
                                       creator_id,
                                       query_hash,
                                       std::move(check_query),
+                                      "GetAccountAssetTransactions",
                                       related_txs,
+                                      total_size,
                                       apply_query,
                                       Role::kGetMyAccAstTxs,
                                       Role::kGetAllAccAstTxs,
@@ -815,19 +918,34 @@ namespace iroha {
           QueryType<shared_model::interface::types::AccountIdType,
                     shared_model::interface::types::AssetIdType,
                     std::string,
+                    int,
                     size_t>;
       using PermissionTuple = boost::tuple<int>;
 
-      // get the assets
-      auto cmd = (boost::format(R"(
+      const bool scaled_amounts =
+          amount_storage_mode_ == AmountStorageMode::kScaledInteger;
+
+      auto &statement = preparedStatement("GetAccountAssets", [&] {
+        // scaled integer balances are formatted with the asset precision
+        const std::string account_assets = scaled_amounts
+            ? R"(
+              select aha.account_id, aha.asset_id, aha.amount, a.precision
+              from account_has_asset aha
+              join asset a on a.asset_id = aha.asset_id
+              where aha.account_id = :target_account_id
+              order by aha.asset_id)"
+            : R"(
+              select account_id, asset_id, amount, 0 AS precision
+              from account_has_asset
+              where account_id = :target_account_id
+              order by asset_id)";
+
+        // get the assets
+        return (boost::format(R"(
       with has_perms as (%s),
       all_data as (
           select row_number() over () rn, *
-          from (
-              select *
-              from account_has_asset
-              where account_id = :account_id
-              order by asset_id
+          from (%s
           ) t
       ),
       total_number as (
@@ -851,17 +969,17 @@ namespace iroha {
                   true
               )
       )
-      select account_id, asset_id, amount, total_number, perm
+      select account_id, asset_id, amount, precision, total_number, perm
           from
               page_data
               right join has_perms on true
       )")
-                  % hasQueryPermission(creator_id,
-                                       q.accountId(),
-                                       Role::kGetMyAccAst,
-                                       Role::kGetAllAccAst,
-                                       Role::kGetDomainAccAst))
-                     .str();
+                % hasQueryPermission(Role::kGetMyAccAst,
+                                     Role::kGetAllAccAst,
+                                     Role::kGetDomainAccAst)
+                % account_assets)
+            .str();
+      });
 
       // These must stay alive while soci query is being done.
       const auto pagination_meta{q.paginationMeta()};
@@ -877,10 +995,12 @@ namespace iroha {
 
       return executeQuery<QueryTuple, PermissionTuple>(
           [&] {
-            return (sql_.prepare << cmd,
-                    soci::use(q.accountId(), "account_id"),
-                    soci::use(req_first_asset_id, "first_asset_id"),
-                    soci::use(req_page_size, "page_size"));
+            return fetchPrepared<concat<QueryTuple, PermissionTuple>>(
+                statement,
+                soci::use(creator_id, "creator_id"),
+                soci::use(q.accountId(), "target_account_id"),
+                soci::use(req_first_asset_id, "first_asset_id"),
+                soci::use(req_page_size, "page_size"));
           },
           query_hash,
           [&](auto range, auto &) {
@@ -894,15 +1014,20 @@ namespace iroha {
             for (const auto &row : range_without_nulls) {
               iroha::ametsuchi::apply(
                   row,
-                  [&assets, &total_number](auto &account_id,
-                                           auto &asset_id,
-                                           auto &amount,
-                                           auto &total_number_col) {
+                  [&assets, &total_number, scaled_amounts](
+                      auto &account_id,
+                      auto &asset_id,
+                      auto &amount,
+                      auto &precision,
+                      auto &total_number_col) {
                     total_number = total_number_col;
                     assets.push_back(std::make_tuple(
                         std::move(account_id),
                         std::move(asset_id),
-                        shared_model::interface::Amount(amount)));
+                        shared_model::interface::Amount(
+                            scaled_amounts
+                                ? fromScaledIntegerString(amount, precision)
+                                : amount)));
                   });
             }
             if (assets.empty() and req_first_asset_id) {
@@ -944,7 +1069,8 @@ namespace iroha {
                     uint32_t>;
       using PermissionTuple = boost::tuple<int>;
 
-      auto cmd = (boost::format(R"(
+      auto &statement = preparedStatement("GetAccountDetail", [] {
+        return (boost::format(R"(
       with has_perms as (%s),
       detail AS (
           with filtered_plain_data as (
@@ -958,7 +1084,7 @@ namespace iroha {
                       jsonb_each((
                           select data
                           from account
-                          where account_id = :account_id
+                          where account_id = :target_account_id
                       )) data_by_writer,
                   jsonb_each(data_by_writer.value) plain_data
                   where
@@ -1002,7 +1128,7 @@ namespace iroha {
           target_account_exists as (
             select count(1) val
             from account
-            where account_id = :account_id
+            where account_id = :target_account_id
           )
           select
               page.json json,
@@ -1019,12 +1145,11 @@ namespace iroha {
       select detail.*, perm from detail
       right join has_perms on true
       )")
-                  % hasQueryPermission(creator_id,
-                                       q.accountId(),
-                                       Role::kGetMyAccDetail,
-                                       Role::kGetAllAccDetail,
-                                       Role::kGetDomainAccDetail))
-                     .str();
+                % hasQueryPermission(Role::kGetMyAccDetail,
+                                     Role::kGetAllAccDetail,
+                                     Role::kGetDomainAccDetail))
+            .str();
+      });
 
       const auto writer = q.writer();
       const auto key = q.key();
@@ -1043,13 +1168,15 @@ namespace iroha {
 
       return executeQuery<QueryTuple, PermissionTuple>(
           [&] {
-            return (sql_.prepare << cmd,
-                    soci::use(q.accountId(), "account_id"),
-                    soci::use(writer, "writer"),
-                    soci::use(key, "key"),
-                    soci::use(first_record_writer, "first_record_writer"),
-                    soci::use(first_record_key, "first_record_key"),
-                    soci::use(page_size, "page_size"));
+            return fetchPrepared<concat<QueryTuple, PermissionTuple>>(
+                statement,
+                soci::use(creator_id, "creator_id"),
+                soci::use(q.accountId(), "target_account_id"),
+                soci::use(writer, "writer"),
+                soci::use(key, "key"),
+                soci::use(first_record_writer, "first_record_writer"),
+                soci::use(first_record_key, "first_record_key"),
+                soci::use(page_size, "page_size"));
           },
           query_hash,
           [&, this](auto range, auto &) {
@@ -8,7 +8,10 @@
 
 #include "ametsuchi/specific_query_executor.hpp"
 
+#include <unordered_map>
+
 #include <soci/soci.h>
+#include "ametsuchi/impl/amount_storage_mode.hpp"
 #include "common/result.hpp"
 #include "interfaces/iroha_internal/query_response_factory.hpp"
 #include "logger/logger_fwd.hpp"
@@ -57,7 +60,8 @@ namespace iroha {
               response_factory,
           std::shared_ptr<shared_model::interface::PermissionToString>
               perm_converter,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          AmountStorageMode amount_storage_mode = AmountStorageMode::kDecimal);
 
       QueryExecutorResult execute(
           const shared_model::interface::Query &qry) override;
@@ -66,6 +70,10 @@ namespace iroha {
           shared_model::interface::permissions::Role permission,
           const std::string &account_id) const override;
 
+      /// @return true if a statement has thrown, so that the session and the
+      /// prepared statements may be broken
+      bool failed() const;
+
       QueryExecutorResult operator()(
           const shared_model::interface::GetAccount &q,
           const shared_model::interface::types::AccountIdType &creator_id,
@@ -152,7 +160,8 @@ namespace iroha {
        * the query, successful or error one
        * @tparam PermissionsErrResponse - type of function, which creates error
        * response in case something wrong with permissions
-       * @param query_executor - function, executing query
+       * @param query_executor - function, executing query and returning a
+       * range of resulting rows
        * @param query_hash - hash of query
        * @param response_creator - function, creating query response
        * @param perms_err_response - function, creating error response
@@ -192,10 +201,14 @@ namespace iroha {
        * @param query_hash - hash of query
        * @param qry_checker - fallback checker of the query, needed if paging
        * hash is not specified and 0 transaction are returned as a query result
-       * @param related_txs - SQL query which returns transaction relevant
-       * to this query
-       * @param applier - function which accepts SQL
-       * and returns another function which executes that query
+       * @param statement_name - name of the prepared statement for this query
+       * @param related_txs - FROM and WHERE clauses of the SQL query which
+       * selects positions of transactions relevant to this query; must allow
+       * an index scan ordered by height and index
+       * @param total_size_query - SQL query which returns the number of
+       * transactions relevant to this query in a single row
+       * @param applier - function which accepts the prepared statement
+       * and returns another function which executes it
        * @param perms - permissions, necessary to execute the query
        * @return Result of a query execution
        */
@@ -208,10 +221,25 @@ namespace iroha {
           const shared_model::interface::types::AccountIdType &creator_id,
           const shared_model::interface::types::HashType &query_hash,
           QueryChecker &&qry_checker,
+          const std::string &statement_name,
           const std::string &related_txs,
+          const std::string &total_size_query,
           QueryApplier applier,
           Permissions... perms);
 
+      /**
+       * Get a statement prepared on the executor session, preparing it on the
+       * first request. The SQL text of a statement must not depend on the
+       * query contents, which are bound as parameters instead, so that the
+       * database parses and plans it only once per session.
+       * @param name - unique name of the statement
+       * @param make_sql - function returning the SQL text of the statement
+       * @return the prepared statement
+       */
+      template <typename SqlGenerator>
+      soci::statement &preparedStatement(const std::string &name,
+                                         SqlGenerator &&make_sql);
+
       /**
        * Check if entry with such key exists in the database
        * @tparam ReturnValueType - type of the value to be returned in the
@@ -262,6 +290,10 @@ namespace iroha {
       std::shared_ptr<shared_model::interface::PermissionToString>
           perm_converter_;
       logger::LoggerPtr log_;
+      const AmountStorageMode amount_storage_mode_;
+      std::unordered_map<std::string, std::unique_ptr<soci::statement>>
+          prepared_statements_;
+      mutable bool failed_ = false;
     };
 
   }  // namespace ametsuchi
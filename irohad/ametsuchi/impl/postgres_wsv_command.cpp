@@ -8,6 +8,7 @@
 #include <numeric>
 
 #include <boost/format.hpp>
+#include "ametsuchi/impl/scaled_amount.hpp"
 #include "backend/protobuf/permissions.hpp"
 #include "cryptography/public_key.hpp"
 #include "interfaces/common_objects/account.hpp"
@@ -30,7 +31,9 @@ namespace iroha {
       }
     }
 
-    PostgresWsvCommand::PostgresWsvCommand(soci::session &sql) : sql_(sql) {}
+    PostgresWsvCommand::PostgresWsvCommand(
+        soci::session &sql, AmountStorageMode amount_storage_mode)
+        : sql_(sql), amount_storage_mode_(amount_storage_mode) {}
 
     WsvCommandResult PostgresWsvCommand::insertRole(
         const shared_model::interface::types::RoleIdType &role_name) {
@@ -219,16 +222,31 @@ namespace iroha {
 
     WsvCommandResult PostgresWsvCommand::upsertAccountAsset(
         const shared_model::interface::AccountAsset &asset) {
-      auto balance = asset.balance().toStringRepr();
+      const bool scaled_amounts =
+          amount_storage_mode_ == AmountStorageMode::kScaledInteger;
+      auto balance = scaled_amounts ? toScaledIntegerString(asset.balance())
+                                    : asset.balance().toStringRepr();
+      // scaled integer balance is brought to the asset precision
+      const std::string amount = scaled_amounts
+          ? "(SELECT :amount::numeric * 10::numeric ^ (precision - "
+            ":balance_precision) FROM asset WHERE asset_id = :asset_id)"
+          : ":amount";
+      int balance_precision = asset.balance().precision();
       soci::statement st = sql_.prepare
-          << "INSERT INTO account_has_asset(account_id, asset_id, amount) "
-             "VALUES (:account_id, :asset_id, :amount) ON CONFLICT "
-             "(account_id, asset_id) DO UPDATE SET "
-             "amount = EXCLUDED.amount";
-
-      st.exchange(soci::use(asset.accountId()));
-      st.exchange(soci::use(asset.assetId()));
-      st.exchange(soci::use(balance));
+          << (boost::format(
+                  "INSERT INTO account_has_asset(account_id, asset_id, amount) "
+                  "VALUES (:account_id, :asset_id, %s) ON CONFLICT "
+                  "(account_id, asset_id) DO UPDATE SET "
+                  "amount = EXCLUDED.amount")
+              % amount)
+                 .str();
+
+      st.exchange(soci::use(asset.accountId(), "account_id"));
+      st.exchange(soci::use(asset.assetId(), "asset_id"));
+      st.exchange(soci::use(balance, "amount"));
+      if (scaled_amounts) {
+        st.exchange(soci::use(balance_precision, "balance_precision"));
+      }
 
       auto msg = [&] {
         return (boost::format("failed to upsert account, account id: '%s', "
@@ -8,6 +8,7 @@
 
 #include "ametsuchi/wsv_command.hpp"
 
+#include "ametsuchi/impl/amount_storage_mode.hpp"
 #include "ametsuchi/impl/soci_utils.hpp"
 
 namespace iroha {
@@ -15,7 +16,10 @@ namespace iroha {
 
     class PostgresWsvCommand : public WsvCommand {
      public:
-      explicit PostgresWsvCommand(soci::session &sql);
+      explicit PostgresWsvCommand(
+          soci::session &sql,
+          AmountStorageMode amount_storage_mode = AmountStorageMode::kDecimal);
+
       WsvCommandResult insertRole(
           const shared_model::interface::types::RoleIdType &role_name) override;
 
@@ -75,6 +79,7 @@ namespace iroha {
 
      private:
       soci::session &sql_;
+      const AmountStorageMode amount_storage_mode_;
     };
   }  // namespace ametsuchi
 }  // namespace iroha
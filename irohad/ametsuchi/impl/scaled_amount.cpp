@@ -0,0 +1,53 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/scaled_amount.hpp"
+
+#include <algorithm>
+
+#include "interfaces/common_objects/amount.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    const char *kScaledAmountUpperBound =
+        "115792089237316195423570985008687907853269984665640564039457584007913"
+        "129639936";
+
+    std::string toScaledIntegerString(
+        const shared_model::interface::Amount &amount) {
+      const auto repr = amount.toStringRepr();
+      std::string scaled;
+      scaled.reserve(repr.size());
+      std::copy_if(repr.begin(),
+                   repr.end(),
+                   std::back_inserter(scaled),
+                   [](char c) { return c != '.'; });
+      const auto first_nonzero = scaled.find_first_not_of('0');
+      if (first_nonzero == std::string::npos) {
+        return "0";
+      }
+      scaled.erase(0, first_nonzero);
+      return scaled;
+    }
+
+    std::string fromScaledIntegerString(
+        const std::string &scaled,
+        shared_model::interface::types::PrecisionType precision) {
+      if (precision == 0) {
+        return scaled;
+      }
+      // pad with zeroes to have at least one integer digit
+      std::string result;
+      if (scaled.size() <= precision) {
+        result.assign(precision + 1 - scaled.size(), '0');
+      }
+      result.append(scaled);
+      result.insert(result.size() - precision, 1, '.');
+      return result;
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,48 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SCALED_AMOUNT_HPP
+#define IROHA_SCALED_AMOUNT_HPP
+
+#include <string>
+
+#include "ametsuchi/impl/amount_storage_mode.hpp"
+#include "interfaces/common_objects/types.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Amount;
+  }
+}  // namespace shared_model
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /// Decimal string of 2 ^ 256, the exclusive upper bound of scaled balance.
+    extern const char *kScaledAmountUpperBound;
+
+    /**
+     * Get the amount digits without the decimal separator, that is the amount
+     * multiplied by 10 ^ amount.precision().
+     * @param amount - the amount to convert
+     * @return integer string without leading zeroes
+     */
+    std::string toScaledIntegerString(
+        const shared_model::interface::Amount &amount);
+
+    /**
+     * Convert a scaled integer balance back to the decimal representation.
+     * @param scaled - nonnegative integer string, as stored in the database
+     * @param precision - the number of fractional digits in result
+     * @return decimal string with exactly precision fractional digits
+     */
+    std::string fromScaledIntegerString(
+        const std::string &scaled,
+        shared_model::interface::types::PrecisionType precision);
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_SCALED_AMOUNT_HPP
@@ -5,6 +5,8 @@
 
 #include "ametsuchi/impl/storage_impl.hpp"
 
+#include <algorithm>
+#include <mutex>
 #include <utility>
 
 #include <soci/callbacks.h>
@@ -12,6 +14,7 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/format.hpp>
 #include <boost/range/algorithm/replace_if.hpp>
+#include "ametsuchi/impl/failover_callback_holder.hpp"
 #include "ametsuchi/impl/mutable_storage_impl.hpp"
 #include "ametsuchi/impl/peer_query_wsv.hpp"
 #include "ametsuchi/impl/postgres_block_index.hpp"
@@ -33,14 +36,134 @@
 #include "logger/logger.hpp"
 #include "logger/logger_manager.hpp"
 #include "main/impl/pg_connection_init.hpp"
+#include "metrics/metrics.hpp"
+#include "tracing/command_hot_keys.hpp"
+#include "tracing/tx_tracer.hpp"
 
 namespace iroha {
   namespace ametsuchi {
 
+    namespace {
+      /// @return histogram of the commit time of the given kind
+      metrics::Histogram &commitTime(const std::string &kind) {
+        return metrics::defaultRegistry().histogram(
+            "iroha_storage_commit_microseconds",
+            "Time to commit a block to the storage",
+            metrics::latencyBounds(),
+            {{"kind", kind}});
+      }
+    }  // namespace
+
     const char *kCommandExecutorError = "Cannot create CommandExecutorFactory";
     const char *kPsqlBroken = "Connection to PostgreSQL broken: %s";
     const char *kTmpWsv = "TemporaryWsv";
 
+    /**
+     * Keeps query executors between queries, so that their sessions stay
+     * leased from the connection pool and their statements stay prepared.
+     * The executors are dropped when the sessions are reset after a
+     * connection loss or the connections are freed.
+     */
+    class StorageImpl::IdleQueryExecutors {
+     public:
+      /// Query executor with the specific executor it uses
+      struct Executor {
+        std::unique_ptr<PostgresQueryExecutor> executor;
+        std::shared_ptr<PostgresSpecificQueryExecutor> specific_executor;
+        /// generation of the kept executors when this one was taken
+        size_t generation;
+      };
+
+      IdleQueryExecutors(size_t capacity,
+                         std::shared_ptr<PoolWrapper> pool_wrapper)
+          : capacity_(capacity), pool_wrapper_(std::move(pool_wrapper)) {}
+
+      /**
+       * Take an idle executor created with the given dependencies.
+       * @return the executor, which is nullptr if there is no such one
+       */
+      Executor take(
+          const std::shared_ptr<PendingTransactionStorage> &pending_txs_storage,
+          const std::shared_ptr<shared_model::interface::QueryResponseFactory>
+              &response_factory) {
+        std::vector<Entry> dropped;
+        std::lock_guard<std::mutex> lock(mutex_);
+        dropIfSessionsReset(dropped);
+        auto it = std::find_if(
+            executors_.begin(), executors_.end(), [&](const auto &entry) {
+              return entry.pending_txs_storage == pending_txs_storage
+                  and entry.response_factory == response_factory;
+            });
+        if (it == executors_.end()) {
+          return Executor{nullptr, nullptr, generation_};
+        }
+        auto executor = std::move(it->executor);
+        executors_.erase(it);
+        return executor;
+      }
+
+      /**
+       * Keep the executor for reuse unless there are enough idle ones, or it
+       * has failed, or the kept executors were dropped since it was taken.
+       * Otherwise the executor is destroyed and its session is returned to
+       * the pool.
+       */
+      void put(
+          std::shared_ptr<PendingTransactionStorage> pending_txs_storage,
+          std::shared_ptr<shared_model::interface::QueryResponseFactory>
+              response_factory,
+          Executor executor) {
+        std::vector<Entry> dropped;
+        std::lock_guard<std::mutex> lock(mutex_);
+        dropIfSessionsReset(dropped);
+        if (executor.generation == generation_
+            and not executor.executor->failed()
+            and not executor.specific_executor->failed()
+            and executors_.size() < capacity_) {
+          executors_.push_back(Entry{std::move(pending_txs_storage),
+                                     std::move(response_factory),
+                                     std::move(executor)});
+        }
+      }
+
+      /// Destroy idle executors, and the taken ones when they are returned.
+      void clear() {
+        std::vector<Entry> dropped;
+        std::lock_guard<std::mutex> lock(mutex_);
+        drop(dropped);
+      }
+
+     private:
+      struct Entry {
+        std::shared_ptr<PendingTransactionStorage> pending_txs_storage;
+        std::shared_ptr<shared_model::interface::QueryResponseFactory>
+            response_factory;
+        Executor executor;
+      };
+
+      /// Move the kept executors out to be destroyed after the lock is freed
+      void drop(std::vector<Entry> &dropped) {
+        ++generation_;
+        dropped.swap(executors_);
+      }
+
+      void dropIfSessionsReset(std::vector<Entry> &dropped) {
+        const auto session_resets =
+            pool_wrapper_->failover_callback_holder_->sessionResets();
+        if (session_resets != session_resets_) {
+          session_resets_ = session_resets;
+          drop(dropped);
+        }
+      }
+
+      const size_t capacity_;
+      const std::shared_ptr<PoolWrapper> pool_wrapper_;
+      std::mutex mutex_;
+      size_t generation_ = 0;
+      size_t session_resets_ = 0;
+      std::vector<Entry> executors_;
+    };
+
     StorageImpl::StorageImpl(
         boost::optional<std::shared_ptr<const iroha::LedgerState>> ledger_state,
         std::unique_ptr<ametsuchi::PostgresOptions> postgres_options,
@@ -67,6 +190,10 @@ namespace iroha {
           log_manager_(std::move(log_manager)),
           log_(log_manager_->getLogger()),
           pool_size_(pool_size),
+          // leave most of the connections to block application and the other
+          // storage users
+          idle_query_executors_(std::make_shared<IdleQueryExecutors>(
+              std::max<size_t>(pool_size_ / 4, 1), pool_wrapper_)),
           prepared_blocks_enabled_(
               pool_wrapper_->enable_prepared_transactions_),
           block_is_prepared_(false),
@@ -125,20 +252,48 @@ namespace iroha {
             "createQueryExecutor: connection to database is not initialised");
         return boost::none;
       }
-      auto sql = std::make_unique<soci::session>(*connection_);
-      auto log_manager = log_manager_->getChild("QueryExecutor");
-      return boost::make_optional<std::shared_ptr<QueryExecutor>>(
-          std::make_shared<PostgresQueryExecutor>(
-              std::move(sql),
-              response_factory,
-              std::make_shared<PostgresSpecificQueryExecutor>(
-                  *sql,
-                  *block_store_,
-                  std::move(pending_txs_storage),
-                  response_factory,
-                  perm_converter_,
-                  log_manager->getChild("SpecificQueryExecutor")->getLogger()),
-              log_manager->getLogger()));
+      auto executor =
+          idle_query_executors_->take(pending_txs_storage, response_factory);
+      if (not executor.executor) {
+        auto sql = std::make_unique<soci::session>(*connection_);
+        auto log_manager = log_manager_->getChild("QueryExecutor");
+        executor.specific_executor =
+            std::make_shared<PostgresSpecificQueryExecutor>(
+                *sql,
+                *block_store_,
+                pending_txs_storage,
+                response_factory,
+                perm_converter_,
+                log_manager->getChild("SpecificQueryExecutor")->getLogger(),
+                pool_wrapper_->amount_storage_mode_);
+        executor.executor =
+            std::make_unique<PostgresQueryExecutor>(std::move(sql),
+                                                    response_factory,
+                                                    executor.specific_executor,
+                                                    log_manager->getLogger());
+      }
+      // return the executor for reuse instead of destroying it
+      std::weak_ptr<IdleQueryExecutors> idle_query_executors =
+          idle_query_executors_;
+      return boost::make_optional(std::shared_ptr<QueryExecutor>(
+          executor.executor.release(),
+          [idle_query_executors,
+           specific_executor = std::move(executor.specific_executor),
+           generation = executor.generation,
+           pending_txs_storage = std::move(pending_txs_storage),
+           response_factory =
+               std::move(response_factory)](QueryExecutor *released) {
+            IdleQueryExecutors::Executor executor{
+                std::unique_ptr<PostgresQueryExecutor>(
+                    static_cast<PostgresQueryExecutor *>(released)),
+                specific_executor,
+                generation};
+            if (auto idle = idle_query_executors.lock()) {
+              idle->put(pending_txs_storage,
+                        response_factory,
+                        std::move(executor));
+            }
+          }));
     }
 
     bool StorageImpl::insertBlock(
@@ -163,7 +318,7 @@ namespace iroha {
         const shared_model::interface::Peer &peer) {
       log_->info("Insert peer {}", peer.pubkey().hex());
       soci::session sql(*connection_);
-      PostgresWsvCommand wsv_command(sql);
+      PostgresWsvCommand wsv_command(sql, pool_wrapper_->amount_storage_mode_);
       return wsv_command.insertPeer(peer);
     }
 
@@ -174,8 +329,10 @@ namespace iroha {
         return expected::makeError("Connection was closed");
       }
       auto sql = std::make_unique<soci::session>(*connection_);
-      return std::make_unique<PostgresCommandExecutor>(std::move(sql),
-                                                       perm_converter_);
+      return std::make_unique<PostgresCommandExecutor>(
+          std::move(sql),
+          perm_converter_,
+          pool_wrapper_->amount_storage_mode_);
     }
 
     std::unique_ptr<MutableStorage> StorageImpl::createMutableStorage(
@@ -249,6 +406,7 @@ namespace iroha {
     }
 
     void StorageImpl::freeConnections() {
+      idle_query_executors_->clear();
       if (connection_ == nullptr) {
         log_->warn("Tried to free connections without active connection");
         return;
@@ -348,6 +506,8 @@ namespace iroha {
 
     CommitResult StorageImpl::commit(
         std::unique_ptr<MutableStorage> mutable_storage) {
+      static auto &commit_time = commitTime("regular");
+      metrics::ScopedTimer timer(commit_time);
       auto storage = static_cast<MutableStorageImpl *>(mutable_storage.get());
 
       try {
@@ -387,6 +547,8 @@ namespace iroha {
       }
 
       log_->info("applying prepared block");
+      static auto &commit_time = commitTime("prepared");
+      metrics::ScopedTimer timer(commit_time);
 
       try {
         std::shared_lock<std::shared_timed_mutex> lock(drop_mutex_);
@@ -502,6 +664,17 @@ namespace iroha {
     StorageImpl::StoreBlockResult StorageImpl::storeBlock(
         std::shared_ptr<const shared_model::interface::Block> block) {
       if (block_store_->insert(block)) {
+        auto &tracer = tracing::defaultTracer();
+        for (const auto &tx : block->transactions()) {
+          tracer.mark(tx.hash(), tracing::Stage::kCommitted);
+        }
+        for (const auto &hash : block->rejected_transactions_hashes()) {
+          tracer.reject(hash);
+        }
+        auto &hot_keys = tracing::defaultHotKeyTracker();
+        if (hot_keys.enabled()) {
+          tracing::recordBlockKeys(hot_keys, *block);
+        }
         notifier_.get_subscriber().on_next(block);
         return {};
       }
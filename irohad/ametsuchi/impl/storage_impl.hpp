@@ -175,6 +175,11 @@ namespace iroha {
 
       const size_t pool_size_;
 
+      class IdleQueryExecutors;
+
+      /// query executors kept with their sessions between queries
+      std::shared_ptr<IdleQueryExecutors> idle_query_executors_;
+
       bool prepared_blocks_enabled_;
 
       std::atomic<bool> block_is_prepared_;
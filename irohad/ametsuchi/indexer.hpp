@@ -29,25 +29,16 @@ namespace iroha {
         size_t index;  ///< the number of this transaction in the block
       };
 
-      /// Index tx position by its hash.
-      virtual void txHashPosition(
+      /// Index a committed tx: its status and position by hash and creator.
+      virtual void committedTx(
           const shared_model::interface::types::HashType &hash,
+          const shared_model::interface::types::AccountIdType &creator,
           TxPosition position) = 0;
 
-      /// Store a committed tx hash.
-      virtual void committedTxHash(
-          const shared_model::interface::types::HashType
-              &committed_tx_hash) = 0;
-
       /// Store a rejected tx hash.
       virtual void rejectedTxHash(
           const shared_model::interface::types::HashType &rejected_tx_hash) = 0;
 
-      /// Index tx position by creator account.
-      virtual void txPositionByCreator(
-          const shared_model::interface::types::AccountIdType creator,
-          TxPosition position) = 0;
-
       /// Index account asset tx position by involved account and asset.
       virtual void accountAssetTxPosition(
           const shared_model::interface::types::AccountIdType &account_id,
@@ -11,7 +11,12 @@ namespace iroha {
     namespace yac {
       TimerImpl::TimerImpl(std::chrono::milliseconds delay_milliseconds,
                            rxcpp::observe_on_one_worker coordination)
-          : delay_milliseconds_(delay_milliseconds),
+          : TimerImpl([delay_milliseconds] { return delay_milliseconds; },
+                      std::move(coordination)) {}
+
+      TimerImpl::TimerImpl(std::function<std::chrono::milliseconds()> delay,
+                           rxcpp::observe_on_one_worker coordination)
+          : delay_(std::move(delay)),
             // use the same worker for all the invocations
             coordination_(coordination.create_coordinator(coordinator_lifetime_)
                               .get_scheduler()) {}
@@ -19,7 +24,7 @@ namespace iroha {
       void TimerImpl::invokeAfterDelay(std::function<void()> handler) {
         deny();
         auto timer_lifetime =
-            rxcpp::observable<>::timer(delay_milliseconds_, coordination_)
+            rxcpp::observable<>::timer(delay_(), coordination_)
                 .subscribe([handler{std::move(handler)}](auto) { handler(); });
         {
           std::lock_guard<std::mutex> lock(timer_lifetime_mutex);
@@ -25,6 +25,15 @@ namespace iroha {
          */
         TimerImpl(std::chrono::milliseconds delay_milliseconds,
                   rxcpp::observe_on_one_worker coordination);
+
+        /**
+         * Constructor
+         * @param delay provides delay before the next method invoke, it is
+         * called on each invocation
+         * @param coordination factory for coordinators to run the timer on
+         */
+        TimerImpl(std::function<std::chrono::milliseconds()> delay,
+                  rxcpp::observe_on_one_worker coordination);
         TimerImpl(const TimerImpl &) = delete;
         TimerImpl &operator=(const TimerImpl &) = delete;
 
@@ -35,7 +44,7 @@ namespace iroha {
 
        private:
         std::mutex timer_lifetime_mutex;
-        std::chrono::milliseconds delay_milliseconds_;
+        std::function<std::chrono::milliseconds()> delay_;
         rxcpp::composite_subscription coordinator_lifetime_;
         rxcpp::observe_on_one_worker coordination_;
         rxcpp::composite_subscription timer_lifetime_;
@@ -0,0 +1,162 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/yac/impl/vote_delay_estimator.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "logger/logger.hpp"
+
+namespace {
+  /// Weight of a new sample in the mean
+  const double kMeanGain = 1. / 8;
+  /// Weight of a new sample in the mean deviation
+  const double kDeviationGain = 1. / 4;
+  /// Number of mean deviations added to the mean latency
+  const double kDeviationFactor = 4.;
+}  // namespace
+
+namespace iroha {
+  namespace consensus {
+    namespace yac {
+
+      // ------| Ewma |------
+
+      void VoteDelayEstimator::Ewma::update(
+          std::chrono::microseconds sample) {
+        const double value = sample.count();
+        if (samples_++ == 0) {
+          mean_ = value;
+          deviation_ = value / 2;
+          return;
+        }
+        deviation_ += kDeviationGain * (std::abs(mean_ - value) - deviation_);
+        mean_ += kMeanGain * (value - mean_);
+      }
+
+      bool VoteDelayEstimator::Ewma::empty() const {
+        return samples_ == 0;
+      }
+
+      VoteDelayEstimator::Estimate VoteDelayEstimator::Ewma::estimate() const {
+        return Estimate{
+            std::chrono::microseconds(std::llround(mean_)),
+            std::chrono::microseconds(std::llround(deviation_)),
+            samples_};
+      }
+
+      std::chrono::microseconds VoteDelayEstimator::Ewma::timeout() const {
+        return std::chrono::microseconds(
+            std::llround(mean_ + kDeviationFactor * deviation_));
+      }
+
+      // ------| VoteDelayEstimator |------
+
+      VoteDelayEstimator::VoteDelayEstimator(
+          std::chrono::milliseconds initial_delay,
+          std::chrono::milliseconds min_delay,
+          std::chrono::milliseconds max_delay,
+          logger::LoggerPtr log,
+          std::function<Clock::time_point()> now)
+          : initial_delay_(initial_delay),
+            min_delay_(min_delay),
+            max_delay_(max_delay),
+            log_(std::move(log)),
+            now_(std::move(now)) {}
+
+      void VoteDelayEstimator::voteSent(const std::string &peer,
+                                        const Round &round) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (round != round_in_progress_) {
+          round_in_progress_ = round;
+          outcome_received_ = false;
+          first_peer_ = peer;
+          first_sent_ = now_();
+          votes_sent_ = 0;
+        }
+        last_peer_ = peer;
+        ++votes_sent_;
+      }
+
+      void VoteDelayEstimator::outcomeReceived(const Round &round) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (round != round_in_progress_ or outcome_received_) {
+          return;
+        }
+        outcome_received_ = true;
+
+        const auto latency = std::chrono::duration_cast<
+            std::chrono::microseconds>(now_() - first_sent_);
+        auto &peer = peers_[first_peer_];
+        peer.round.update(latency);
+        round_.update(latency);
+        // the outcome of a vote passed to several peers can not be
+        // attributed to one of them
+        if (votes_sent_ == 1) {
+          peer.response.update(latency);
+        }
+
+        log_->debug(
+            "Round {} latency {} us, vote delay for {} is {} ms",
+            round,
+            latency.count(),
+            first_peer_,
+            voteDelayLocked(first_peer_).count());
+      }
+
+      std::chrono::milliseconds VoteDelayEstimator::voteDelay() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return voteDelayLocked(last_peer_);
+      }
+
+      std::chrono::milliseconds VoteDelayEstimator::voteDelay(
+          const std::string &peer) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return voteDelayLocked(peer);
+      }
+
+      std::vector<VoteDelayEstimator::PeerEstimates>
+      VoteDelayEstimator::estimates() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<PeerEstimates> result;
+        result.reserve(peers_.size());
+        for (const auto &peer : peers_) {
+          result.push_back(PeerEstimates{peer.first,
+                                         peer.second.response.estimate(),
+                                         peer.second.round.estimate()});
+        }
+        return result;
+      }
+
+      std::chrono::milliseconds VoteDelayEstimator::voteDelayLocked(
+          const std::string &peer) const {
+        auto delay = [&]() -> std::chrono::microseconds {
+          auto it = peers_.find(peer);
+          if (it != peers_.end()) {
+            if (not it->second.response.empty()) {
+              return it->second.response.timeout();
+            }
+            // rounds led by the peer, in which the vote was passed on
+            if (not it->second.round.empty()) {
+              return it->second.round.timeout();
+            }
+          }
+          if (not round_.empty()) {
+            return round_.timeout();
+          }
+          return initial_delay_;
+        }();
+        auto delay_ms =
+            std::chrono::duration_cast<std::chrono::milliseconds>(delay);
+        if (delay_ms < delay) {
+          ++delay_ms;
+        }
+        return std::max(min_delay_, std::min(max_delay_, delay_ms));
+      }
+
+    }  // namespace yac
+  }    // namespace consensus
+}  // namespace iroha
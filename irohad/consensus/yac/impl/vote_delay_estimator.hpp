@@ -0,0 +1,146 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_VOTE_DELAY_ESTIMATOR_HPP
+#define IROHA_VOTE_DELAY_ESTIMATOR_HPP
+
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "consensus/round.hpp"
+#include "logger/logger_fwd.hpp"
+
+namespace iroha {
+  namespace consensus {
+    namespace yac {
+
+      /**
+       * Derives the delay before passing the vote to the next peer from the
+       * observed latency of peers. Each peer has a smoothed latency and its
+       * mean deviation, as in TCP retransmission timeout estimation, and the
+       * delay is the latency plus four deviations.
+       *
+       * The response latency of the peer is used when known, then the
+       * latency of rounds it led, then that of all rounds.
+       */
+      class VoteDelayEstimator {
+       public:
+        using Clock = std::chrono::steady_clock;
+
+        /// Smoothed latency and its mean deviation
+        struct Estimate {
+          std::chrono::microseconds latency;
+          std::chrono::microseconds deviation;
+          size_t samples;
+        };
+
+        struct PeerEstimates {
+          std::string peer;
+          /// Time between the vote sent to the peer and the outcome, taken
+          /// only when the vote was not passed to other peers in the round
+          Estimate response;
+          /// Time between the first vote and the outcome of rounds, in which
+          /// the peer was the first leader
+          Estimate round;
+        };
+
+        /**
+         * @param initial_delay - delay used until there are samples
+         * @param min_delay - lower bound of the delay
+         * @param max_delay - upper bound of the delay
+         * @param log - logger
+         * @param now - source of current time
+         */
+        VoteDelayEstimator(std::chrono::milliseconds initial_delay,
+                           std::chrono::milliseconds min_delay,
+                           std::chrono::milliseconds max_delay,
+                           logger::LoggerPtr log,
+                           std::function<Clock::time_point()> now = [] {
+                             return Clock::now();
+                           });
+
+        /**
+         * Register the vote sent to the peer
+         * @param peer - address of the peer
+         * @param round - round of the vote
+         */
+        void voteSent(const std::string &peer, const Round &round);
+
+        /**
+         * Register the outcome of the round, and take latency samples
+         * @param round - round of the outcome
+         */
+        void outcomeReceived(const Round &round);
+
+        /**
+         * @return delay before passing the vote to the next peer, after it
+         * was sent to the last peer passed to voteSent
+         */
+        std::chrono::milliseconds voteDelay() const;
+
+        /**
+         * @param peer - address of the peer
+         * @return how long to wait for the outcome after the vote was sent to
+         * the peer
+         */
+        std::chrono::milliseconds voteDelay(const std::string &peer) const;
+
+        /**
+         * @return current estimates of all peers with samples
+         */
+        std::vector<PeerEstimates> estimates() const;
+
+       private:
+        /// Exponentially weighted mean and mean deviation
+        class Ewma {
+         public:
+          void update(std::chrono::microseconds sample);
+          bool empty() const;
+          Estimate estimate() const;
+          std::chrono::microseconds timeout() const;
+
+         private:
+          double mean_ = 0.;
+          double deviation_ = 0.;
+          size_t samples_ = 0;
+        };
+
+        struct Latencies {
+          Ewma response;
+          Ewma round;
+        };
+
+        std::chrono::milliseconds voteDelayLocked(
+            const std::string &peer) const;
+
+        const std::chrono::milliseconds initial_delay_;
+        const std::chrono::milliseconds min_delay_;
+        const std::chrono::milliseconds max_delay_;
+        logger::LoggerPtr log_;
+        std::function<Clock::time_point()> now_;
+
+        mutable std::mutex mutex_;
+        std::unordered_map<std::string, Latencies> peers_;
+        /// Round completion of all peers, for peers without own samples
+        Ewma round_;
+
+        // ------| Current round |------
+        Round round_in_progress_{0, 0};
+        bool outcome_received_ = true;
+        std::string first_peer_;
+        Clock::time_point first_sent_;
+        std::string last_peer_;
+        size_t votes_sent_ = 0;
+      };
+
+    }  // namespace yac
+  }    // namespace consensus
+}  // namespace iroha
+
+#endif  // IROHA_VOTE_DELAY_ESTIMATOR_HPP
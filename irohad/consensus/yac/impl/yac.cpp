@@ -12,6 +12,7 @@
 #include "common/bind.hpp"
 #include "common/visitor.hpp"
 #include "consensus/yac/cluster_order.hpp"
+#include "consensus/yac/impl/vote_delay_estimator.hpp"
 #include "consensus/yac/storage/yac_proposal_storage.hpp"
 #include "consensus/yac/timer.hpp"
 #include "consensus/yac/yac_crypto_provider.hpp"
@@ -19,6 +20,32 @@
 #include "cryptography/signed.hpp"
 #include "interfaces/common_objects/peer.hpp"
 #include "logger/logger.hpp"
+#include "metrics/metrics.hpp"
+
+namespace {
+  /// Metrics of the consensus rounds
+  struct YacMetrics {
+    iroha::metrics::Histogram &round_time;
+    iroha::metrics::Counter &votes_sent;
+    iroha::metrics::Counter &votes_received;
+    iroha::metrics::Counter &outcomes;
+  };
+
+  YacMetrics &yacMetrics() {
+    auto &registry = iroha::metrics::defaultRegistry();
+    static YacMetrics metrics{
+        registry.histogram("iroha_yac_round_microseconds",
+                           "Time from the own vote to the outcome of a round",
+                           iroha::metrics::latencyBounds()),
+        registry.counter("iroha_yac_votes_sent_total",
+                         "Votes sent to the next peer in the order"),
+        registry.counter("iroha_yac_votes_received_total",
+                         "Votes received from peers, including duplicates"),
+        registry.counter("iroha_yac_outcomes_total",
+                         "Outcomes passed to the pipeline")};
+    return metrics;
+  }
+}  // namespace
 
 // TODO: 2019-03-04 @muratovv refactor std::vector<VoteMessage> with a
 // separate class IR-374
@@ -38,7 +65,8 @@ namespace iroha {
           ClusterOrdering order,
           Round round,
           rxcpp::observe_on_one_worker worker,
-          logger::LoggerPtr log) {
+          logger::LoggerPtr log,
+          std::shared_ptr<VoteDelayEstimator> vote_delay_estimator) {
         return std::make_shared<Yac>(vote_storage,
                                      network,
                                      crypto,
@@ -46,7 +74,8 @@ namespace iroha {
                                      order,
                                      round,
                                      worker,
-                                     std::move(log));
+                                     std::move(log),
+                                     std::move(vote_delay_estimator));
       }
 
       Yac::Yac(YacVoteStorage vote_storage,
@@ -56,7 +85,8 @@ namespace iroha {
                ClusterOrdering order,
                Round round,
                rxcpp::observe_on_one_worker worker,
-               logger::LoggerPtr log)
+               logger::LoggerPtr log,
+               std::shared_ptr<VoteDelayEstimator> vote_delay_estimator)
           : log_(std::move(log)),
             cluster_order_(order),
             round_(round),
@@ -65,7 +95,8 @@ namespace iroha {
             vote_storage_(std::move(vote_storage)),
             network_(std::move(network)),
             crypto_(std::move(crypto)),
-            timer_(std::move(timer)) {}
+            timer_(std::move(timer)),
+            vote_delay_estimator_(std::move(vote_delay_estimator)) {}
 
       Yac::~Yac() {
         notifier_lifetime_.unsubscribe();
@@ -76,18 +107,25 @@ namespace iroha {
       void Yac::vote(YacHash hash,
                      ClusterOrdering order,
                      boost::optional<ClusterOrdering> alternative_order) {
-        log_->info("Order for voting: [{}]",
-                   boost::algorithm::join(
-                       order.getPeers()
-                           | boost::adaptors::transformed(
-                                 [](const auto &p) { return p->address(); }),
-                       ", "));
+        log_->info("Order for voting: [{}]", logger::lazy([&order] {
+                     return boost::algorithm::join(
+                         order.getPeers()
+                             | boost::adaptors::transformed(
+                                   [](const auto &p) { return p->address(); }),
+                         ", ");
+                   }));
 
         std::unique_lock<std::mutex> lock(mutex_);
         cluster_order_ = order;
         alternative_order_ = std::move(alternative_order);
         round_ = hash.vote_round;
+        round_start_ = std::chrono::steady_clock::now();
         lock.unlock();
+        std::vector<shared_model::crypto::PublicKey> voters;
+        for (const auto &peer : order.getPeers()) {
+          voters.push_back(peer->pubkey());
+        }
+        crypto_->setVoting(hash.vote_round, voters);
         auto vote = crypto_->getVote(hash);
         // TODO 10.06.2018 andrei: IR-1407 move YAC propagation strategy to a
         // separate entity
@@ -130,6 +168,7 @@ namespace iroha {
       }
 
       void Yac::onState(std::vector<VoteMessage> state) {
+        yacMetrics().votes_received.increment(state.size());
         std::unique_lock<std::mutex> guard(mutex_);
 
         removeUnknownPeersVotes(state, getCurrentOrder());
@@ -171,11 +210,13 @@ namespace iroha {
         } else {
           log_->warn(
               "Crypto verification failed for message. Votes: [{}]",
-              boost::algorithm::join(
-                  state | boost::adaptors::transformed([](const auto &v) {
-                    return v.signature->toString();
-                  }),
-                  ", "));
+              logger::lazy([&state] {
+                return boost::algorithm::join(
+                    state | boost::adaptors::transformed([](const auto &v) {
+                      return v.signature->toString();
+                    }),
+                    ", ");
+              }));
         }
       }
 
@@ -200,6 +241,11 @@ namespace iroha {
                    current_leader);
 
         network_->sendState(current_leader, {vote});
+        yacMetrics().votes_sent.increment();
+        if (vote_delay_estimator_) {
+          vote_delay_estimator_->voteSent(current_leader.address(),
+                                          vote.hash.vote_round);
+        }
         cluster_order.switchToNext();
         auto has_next = cluster_order.hasNext();
         lock.unlock();
@@ -278,6 +324,14 @@ namespace iroha {
                 case ProposalState::kSentNotProcessed:
                   vote_storage_.nextProcessingState(proposal_round);
                   log_->info("Pass outcome for {} to pipeline", proposal_round);
+                  if (vote_delay_estimator_) {
+                    vote_delay_estimator_->outcomeReceived(proposal_round);
+                  }
+                  yacMetrics().outcomes.increment();
+                  if (proposal_round == current_round) {
+                    yacMetrics().round_time.record(
+                        std::chrono::steady_clock::now() - round_start_);
+                  }
                   lock.unlock();
                   if (proposal_round >= current_round) {
                     this->closeRound();
@@ -5,11 +5,45 @@
 
 #include "consensus/yac/impl/yac_crypto_provider_impl.hpp"
 
+#include <algorithm>
+#include <iterator>
+
 #include "backend/plain/signature.hpp"
 #include "consensus/yac/transport/yac_pb_converters.hpp"
 #include "cryptography/crypto_provider/crypto_signer.hpp"
 #include "cryptography/crypto_provider/crypto_verifier.hpp"
 
+namespace {
+  /// The maximal number of rounds, for which verified votes are remembered
+  const size_t kCachedRounds = 4;
+
+  /// Vote which is not found among verified ones
+  struct UncheckedVote {
+    const iroha::consensus::yac::VoteMessage *vote;
+    std::string message;
+    std::string key;
+    std::string pubkey;
+  };
+
+  UncheckedVote makeUncheckedVote(
+      const iroha::consensus::yac::VoteMessage &vote) {
+    using iroha::consensus::yac::PbConverters;
+    UncheckedVote unchecked{
+        &vote,
+        PbConverters::serializeVote(vote).hash().SerializeAsString(),
+        {},
+        shared_model::crypto::toBinaryString(vote.signature->publicKey())};
+    const auto &pubkey = vote.signature->publicKey().blob();
+    const auto &signature = vote.signature->signedData().blob();
+    // the message length goes first, since it is not fixed
+    unchecked.key = std::to_string(unchecked.message.size()) + ':'
+        + unchecked.message;
+    unchecked.key.append(pubkey.begin(), pubkey.end());
+    unchecked.key.append(signature.begin(), signature.end());
+    return unchecked;
+  }
+}  // namespace
+
 namespace iroha {
   namespace consensus {
     namespace yac {
@@ -18,17 +52,83 @@ namespace iroha {
           : keypair_(keypair) {}
 
       bool CryptoProviderImpl::verify(const std::vector<VoteMessage> &msg) {
-        return std::all_of(
-            std::begin(msg), std::end(msg), [](const auto &vote) {
-              auto serialized =
-                  PbConverters::serializeVote(vote).hash().SerializeAsString();
-              auto blob = shared_model::crypto::Blob(serialized);
+        std::vector<UncheckedVote> unchecked;
+        unchecked.reserve(msg.size());
+        for (const auto &vote : msg) {
+          unchecked.push_back(makeUncheckedVote(vote));
+        }
+
+        {
+          std::lock_guard<std::mutex> lock(verified_votes_mutex_);
+          unchecked.erase(
+              std::remove_if(unchecked.begin(),
+                             unchecked.end(),
+                             [this](const auto &vote) {
+                               auto round = verified_votes_.find(
+                                   vote.vote->hash.vote_round);
+                               return round != verified_votes_.end()
+                                   and round->second.count(vote.key) > 0;
+                             }),
+              unchecked.end());
+        }
+
+        // the same vote may be repeated in a bundle
+        std::sort(unchecked.begin(),
+                  unchecked.end(),
+                  [](const auto &a, const auto &b) { return a.key < b.key; });
+        unchecked.erase(std::unique(unchecked.begin(),
+                                    unchecked.end(),
+                                    [](const auto &a, const auto &b) {
+                                      return a.key == b.key;
+                                    }),
+                        unchecked.end());
 
+        const bool valid = std::all_of(
+            unchecked.begin(), unchecked.end(), [](const auto &vote) {
               return shared_model::crypto::CryptoVerifier<>::verify(
-                  vote.signature->signedData(),
-                  blob,
-                  vote.signature->publicKey());
+                  vote.vote->signature->signedData(),
+                  shared_model::crypto::Blob(vote.message),
+                  vote.vote->signature->publicKey());
             });
+        if (not valid or unchecked.empty()) {
+          return valid;
+        }
+
+        std::lock_guard<std::mutex> lock(verified_votes_mutex_);
+        for (auto &vote : unchecked) {
+          const auto &round = vote.vote->hash.vote_round;
+          if (voters_.count(vote.pubkey) == 0 or not isCachedRound(round)) {
+            continue;
+          }
+          // each peer has a single vote in a round
+          auto &votes = verified_votes_[round];
+          if (votes.size() < voters_.size()) {
+            votes.insert(std::move(vote.key));
+          }
+        }
+        // keep the nearest rounds
+        while (verified_votes_.size() > kCachedRounds) {
+          verified_votes_.erase(std::prev(verified_votes_.end()));
+        }
+        return true;
+      }
+
+      void CryptoProviderImpl::setVoting(
+          const Round &round,
+          const std::vector<shared_model::crypto::PublicKey> &voters) {
+        std::lock_guard<std::mutex> lock(verified_votes_mutex_);
+        current_round_ = round;
+        voters_.clear();
+        for (const auto &voter : voters) {
+          voters_.insert(shared_model::crypto::toBinaryString(voter));
+        }
+        verified_votes_.erase(verified_votes_.begin(),
+                              verified_votes_.lower_bound(current_round_));
+      }
+
+      bool CryptoProviderImpl::isCachedRound(const Round &round) const {
+        return not(round < current_round_)
+            and round.block_round <= current_round_.block_round + 1;
       }
 
       VoteMessage CryptoProviderImpl::getVote(YacHash hash) {
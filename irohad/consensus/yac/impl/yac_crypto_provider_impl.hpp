@@ -8,11 +8,22 @@
 
 #include "consensus/yac/yac_crypto_provider.hpp"
 
+#include <map>
+#include <mutex>
+#include <unordered_set>
+
+#include "consensus/round.hpp"
 #include "cryptography/keypair.hpp"
 
 namespace iroha {
   namespace consensus {
     namespace yac {
+      /**
+       * Crypto provider which remembers the verified votes of the ledger peers
+       * for the current and the next rounds. The same vote arrives alone and
+       * then inside commit bundles of other peers, so its signature is
+       * checked only once.
+       */
       class CryptoProviderImpl : public YacCryptoProvider {
        public:
         CryptoProviderImpl(const shared_model::crypto::Keypair &keypair);
@@ -21,8 +32,23 @@ namespace iroha {
 
         VoteMessage getVote(YacHash hash) override;
 
+        void setVoting(
+            const Round &round,
+            const std::vector<shared_model::crypto::PublicKey> &voters)
+            override;
+
        private:
+        /// @return true if verified votes of the round may be remembered
+        bool isCachedRound(const Round &round) const;
+
         shared_model::crypto::Keypair keypair_;
+
+        std::mutex verified_votes_mutex_;
+        Round current_round_{};
+        /// public keys of the ledger peers
+        std::unordered_set<std::string> voters_;
+        /// signed message, public key and signature of verified votes
+        std::map<Round, std::unordered_set<std::string>> verified_votes_;
       };
     }  // namespace yac
   }    // namespace consensus
@@ -5,6 +5,8 @@
 
 #include "consensus/yac/storage/yac_block_storage.hpp"
 
+#include "cryptography/public_key.hpp"
+#include "cryptography/signed.hpp"
 #include "logger/logger.hpp"
 
 namespace iroha {
@@ -25,6 +27,7 @@ namespace iroha {
 
       boost::optional<Answer> YacBlockStorage::insert(VoteMessage msg) {
         if (validScheme(msg) and uniqueVote(msg)) {
+          signatures_.insert(signatureKey(msg));
           votes_.push_back(msg);
 
           log_->info(
@@ -65,7 +68,8 @@ namespace iroha {
       }
 
       bool YacBlockStorage::isContains(const VoteMessage &msg) const {
-        return std::count(votes_.begin(), votes_.end(), msg) != 0;
+        return storage_key_ == msg.hash
+            and signatures_.count(signatureKey(msg)) != 0;
       }
 
       YacHash YacBlockStorage::getStorageKey() const {
@@ -75,10 +79,16 @@ namespace iroha {
       // --------| private api |--------
 
       bool YacBlockStorage::uniqueVote(VoteMessage &msg) {
-        // lookup take O(n) times
-        return std::all_of(votes_.begin(), votes_.end(), [&msg](auto vote) {
-          return vote != msg;
-        });
+        return signatures_.count(signatureKey(msg)) == 0;
+      }
+
+      std::string YacBlockStorage::signatureKey(const VoteMessage &vote) {
+        const auto &pubkey = vote.signature->publicKey().blob();
+        const auto &signed_data = vote.signature->signedData().blob();
+        auto key = std::to_string(pubkey.size()) + ':';
+        key.append(pubkey.begin(), pubkey.end());
+        key.append(signed_data.begin(), signed_data.end());
+        return key;
       }
 
       bool YacBlockStorage::validScheme(VoteMessage &vote) {
@@ -7,6 +7,8 @@
 #define IROHA_YAC_BLOCK_VOTE_STORAGE_HPP
 
 #include <memory>
+#include <string>
+#include <unordered_set>
 #include <vector>
 
 #include <boost/optional.hpp>
@@ -31,6 +33,11 @@ namespace iroha {
          */
         std::vector<VoteMessage> votes_;
 
+        /**
+         * Public keys and signatures of stored votes, for uniqueness checks
+         */
+        std::unordered_set<std::string> signatures_;
+
        public:
         YacBlockStorage(
             YacHash hash,
@@ -91,6 +98,11 @@ namespace iroha {
          */
         bool uniqueVote(VoteMessage &vote);
 
+        /**
+         * @return key of the vote signature in signatures_
+         */
+        static std::string signatureKey(const VoteMessage &vote);
+
         /**
          * Verify that vote has the same hash attached as the storage
          * @param vote - vote to be checked
@@ -6,6 +6,7 @@
 #include "consensus/yac/transport/impl/network_impl.hpp"
 
 #include <grpc++/grpc++.h>
+#include <algorithm>
 #include <memory>
 
 #include "consensus/yac/storage/yac_common.hpp"
@@ -25,9 +26,11 @@ namespace iroha {
               async_call,
           std::function<std::unique_ptr<proto::Yac::StubInterface>(
               const shared_model::interface::Peer &)> client_creator,
-          logger::LoggerPtr log)
+          logger::LoggerPtr log,
+          bool send_certificates)
           : async_call_(async_call),
             client_creator_(client_creator),
+            send_certificates_(send_certificates),
             log_(std::move(log)) {}
 
       void NetworkImpl::subscribe(
@@ -37,17 +40,38 @@ namespace iroha {
 
       void NetworkImpl::sendState(const shared_model::interface::Peer &to,
                                   const std::vector<VoteMessage> &state) {
-        createPeerConnection(to);
+        // the stub is not kept, so that the channel replaced by the client
+        // factory is picked up on the next send
+        auto stub = client_creator_(to);
+        if (stub == nullptr) {
+          log_->warn("Failed to connect to {}, votes bundle[size={}] dropped",
+                     to.address(),
+                     state.size());
+          return;
+        }
 
         proto::State request;
-        for (const auto &vote : state) {
-          auto pb_vote = request.add_votes();
-          *pb_vote = PbConverters::serializeVote(vote);
+        auto same_hash = [&state](const auto &vote) {
+          return vote.hash == state.front().hash;
+        };
+        if (send_certificates_ and state.size() > 1
+            and std::all_of(state.begin(), state.end(), same_hash)) {
+          // commit for the same hash: send the hash only once
+          *request.mutable_certificate() =
+              PbConverters::serializeCertificate(state);
+        } else {
+          for (const auto &vote : state) {
+            auto pb_vote = request.add_votes();
+            *pb_vote = PbConverters::serializeVote(vote);
+          }
         }
 
-        async_call_->Call([&](auto context, auto cq) {
-          return peers_.at(to.address())->AsyncSendState(context, request, cq);
-        });
+        if (not async_call_->Call(
+                to.address(), "Yac.SendState", [&](auto context, auto cq) {
+                  return stub->AsyncSendState(context, request, cq);
+                })) {
+          return;
+        }
 
         log_->info(
             "Send votes bundle[size={}] to {}", state.size(), to.address());
@@ -58,6 +82,10 @@ namespace iroha {
           const ::iroha::consensus::yac::proto::State *request,
           ::google::protobuf::Empty *response) {
         std::vector<VoteMessage> state;
+        if (request->has_certificate()) {
+          state = PbConverters::deserializeCertificate(request->certificate(),
+                                                       log_);
+        }
         for (const auto &pb_vote : request->votes()) {
           if (auto vote = PbConverters::deserializeVote(pb_vote, log_)) {
             state.push_back(*vote);
@@ -84,13 +112,6 @@ namespace iroha {
         return grpc::Status::OK;
       }
 
-      void NetworkImpl::createPeerConnection(
-          const shared_model::interface::Peer &peer) {
-        if (peers_.count(peer.address()) == 0) {
-          peers_[peer.address()] = client_creator_(peer);
-        }
-      }
-
     }  // namespace yac
   }    // namespace consensus
 }  // namespace iroha
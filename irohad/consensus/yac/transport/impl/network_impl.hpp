@@ -10,7 +10,6 @@
 #include "yac.grpc.pb.h"
 
 #include <memory>
-#include <unordered_map>
 
 #include "consensus/yac/outcome_messages.hpp"
 #include "consensus/yac/vote_message.hpp"
@@ -29,12 +28,19 @@ namespace iroha {
        */
       class NetworkImpl : public YacNetwork, public proto::Yac::Service {
        public:
+        /**
+         * @param send_certificates - send votes of several peers for the same
+         * hash as a commit certificate. Peers of older versions do not
+         * understand certificates, so it should be enabled only when the
+         * whole network is upgraded. Both encodings are always received.
+         */
         explicit NetworkImpl(
             std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
                 async_call,
             std::function<std::unique_ptr<proto::Yac::StubInterface>(
                 const shared_model::interface::Peer &)> client_creator,
-            logger::LoggerPtr log);
+            logger::LoggerPtr log,
+            bool send_certificates = false);
 
         void subscribe(
             std::shared_ptr<YacNetworkNotifications> handler) override;
@@ -53,20 +59,6 @@ namespace iroha {
             ::google::protobuf::Empty *response) override;
 
        private:
-        /**
-         * Create GRPC connection for given peer if it does not exist in
-         * peers map
-         * @param peer to instantiate connection with
-         */
-        void createPeerConnection(const shared_model::interface::Peer &peer);
-
-        /**
-         * Mapping of peer objects to connections
-         */
-        std::unordered_map<shared_model::interface::types::AddressType,
-                           std::unique_ptr<proto::Yac::StubInterface>>
-            peers_;
-
         /**
          * Subscriber of network messages
          */
@@ -79,12 +71,15 @@ namespace iroha {
             async_call_;
 
         /**
-         * Yac stub creator
+         * Yac stub creator, returns nullptr if the stub can not be created.
+         * Called for each send, stubs of a pooled channel are cheap.
          */
         std::function<std::unique_ptr<proto::Yac::StubInterface>(
             const shared_model::interface::Peer &)>
             client_creator_;
 
+        bool send_certificates_;
+
         logger::LoggerPtr log_;
       };
 
@@ -143,6 +143,77 @@ namespace iroha {
 
           return vote;
         }
+
+        /**
+         * Serialize votes as a certificate with the common hash sent once
+         * @param votes - non-empty collection of votes with the same hash
+         */
+        static proto::CommitCertificate serializeCertificate(
+            const std::vector<VoteMessage> &votes) {
+          proto::CommitCertificate certificate;
+          auto pb_hash = serializeRoundAndHashes(votes.front()).hash();
+          *certificate.mutable_vote_round() = pb_hash.vote_round();
+          *certificate.mutable_vote_hashes() = pb_hash.vote_hashes();
+
+          for (const auto &vote : votes) {
+            auto pb_vote = certificate.add_votes();
+            const auto &pubkey = vote.signature->publicKey();
+            auto signature = pb_vote->mutable_signature();
+            signature->set_signature(shared_model::crypto::toBinaryString(
+                vote.signature->signedData()));
+            signature->set_pubkey(shared_model::crypto::toBinaryString(pubkey));
+
+            if (vote.hash.block_signature) {
+              const auto &block_pubkey = vote.hash.block_signature->publicKey();
+              auto block_signature = pb_vote->mutable_block_signature();
+              block_signature->set_signature(
+                  shared_model::crypto::toBinaryString(
+                      vote.hash.block_signature->signedData()));
+              if (block_pubkey != pubkey) {
+                block_signature->set_pubkey(
+                    shared_model::crypto::toBinaryString(block_pubkey));
+              }
+            }
+          }
+
+          return certificate;
+        }
+
+        /**
+         * Restore votes from the certificate
+         * @return votes which are successfully deserialized
+         */
+        static std::vector<VoteMessage> deserializeCertificate(
+            const proto::CommitCertificate &certificate,
+            logger::LoggerPtr log) {
+          std::vector<VoteMessage> votes;
+          votes.reserve(certificate.votes_size());
+
+          proto::Vote pb_vote;
+          auto pb_hash = pb_vote.mutable_hash();
+          *pb_hash->mutable_vote_round() = certificate.vote_round();
+          *pb_hash->mutable_vote_hashes() = certificate.vote_hashes();
+
+          for (const auto &certificate_vote : certificate.votes()) {
+            *pb_vote.mutable_signature() = certificate_vote.signature();
+            if (certificate_vote.has_block_signature()) {
+              auto block_signature = pb_hash->mutable_block_signature();
+              *block_signature = certificate_vote.block_signature();
+              if (block_signature->pubkey().empty()) {
+                block_signature->set_pubkey(
+                    certificate_vote.signature().pubkey());
+              }
+            } else {
+              pb_hash->clear_block_signature();
+            }
+
+            if (auto vote = deserializeVote(pb_vote, log)) {
+              votes.push_back(*std::move(vote));
+            }
+          }
+
+          return votes;
+        }
       };
     }  // namespace yac
   }    // namespace consensus
@@ -9,6 +9,7 @@
 #include "consensus/yac/transport/yac_network_interface.hpp"  // for YacNetworkNotifications
 #include "consensus/yac/yac_gate.hpp"                         // for HashGate
 
+#include <chrono>
 #include <memory>
 #include <mutex>
 
@@ -27,6 +28,7 @@ namespace iroha {
 
       class YacCryptoProvider;
       class Timer;
+      class VoteDelayEstimator;
 
       class Yac : public HashGate, public YacNetworkNotifications {
        public:
@@ -42,7 +44,9 @@ namespace iroha {
             ClusterOrdering order,
             Round round,
             rxcpp::observe_on_one_worker worker,
-            logger::LoggerPtr log);
+            logger::LoggerPtr log,
+            std::shared_ptr<VoteDelayEstimator> vote_delay_estimator =
+                nullptr);
 
         Yac(YacVoteStorage vote_storage,
             std::shared_ptr<YacNetwork> network,
@@ -51,7 +55,9 @@ namespace iroha {
             ClusterOrdering order,
             Round round,
             rxcpp::observe_on_one_worker worker,
-            logger::LoggerPtr log);
+            logger::LoggerPtr log,
+            std::shared_ptr<VoteDelayEstimator> vote_delay_estimator =
+                nullptr);
 
         ~Yac() override;
 
@@ -120,6 +126,8 @@ namespace iroha {
         ClusterOrdering cluster_order_;
         boost::optional<ClusterOrdering> alternative_order_;
         Round round_;
+        /// time of the own vote for round_
+        std::chrono::steady_clock::time_point round_start_;
 
         // ------|Fields|------
         rxcpp::observe_on_one_worker worker_;
@@ -129,6 +137,8 @@ namespace iroha {
         std::shared_ptr<YacNetwork> network_;
         std::shared_ptr<YacCryptoProvider> crypto_;
         std::shared_ptr<Timer> timer_;
+        /// Optional, notified about sent votes and outcomes
+        std::shared_ptr<VoteDelayEstimator> vote_delay_estimator_;
       };
     }  // namespace yac
   }    // namespace consensus
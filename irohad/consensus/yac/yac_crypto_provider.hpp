@@ -8,6 +8,10 @@
 
 #include "consensus/yac/yac_hash_provider.hpp"  // for YacHash (passed by copy)
 
+#include <vector>
+
+#include "cryptography/public_key.hpp"
+
 namespace iroha {
   namespace consensus {
     namespace yac {
@@ -30,6 +34,15 @@ namespace iroha {
          */
         virtual VoteMessage getVote(YacHash hash) = 0;
 
+        /**
+         * Notify about the round the peer votes in
+         * @param round - current round
+         * @param voters - keys of the ledger peers, which vote in the round
+         */
+        virtual void setVoting(
+            const Round &round,
+            const std::vector<shared_model::crypto::PublicKey> &voters) = 0;
+
         virtual ~YacCryptoProvider() = default;
       };
 
@@ -7,6 +7,7 @@
 
 #include <boost/filesystem.hpp>
 #include <rxcpp/operators/rx-map.hpp>
+#include "ametsuchi/impl/caching_block_storage.hpp"
 #include "ametsuchi/impl/flat_file_block_storage.hpp"
 #include "ametsuchi/impl/k_times_reconnection_strategy.hpp"
 #include "ametsuchi/impl/pool_wrapper.hpp"
@@ -23,6 +24,7 @@
 #include "common/bind.hpp"
 #include "common/files.hpp"
 #include "consensus/yac/consistency_model.hpp"
+#include "consensus/yac/impl/vote_delay_estimator.hpp"
 #include "cryptography/crypto_provider/crypto_model_signer.hpp"
 #include "generator/generator.hpp"
 #include "interfaces/iroha_internal/transaction_batch_factory_impl.hpp"
@@ -37,10 +39,14 @@
 #include "multi_sig_transactions/mst_processor_impl.hpp"
 #include "multi_sig_transactions/mst_propagation_strategy_stub.hpp"
 #include "multi_sig_transactions/mst_time_provider_impl.hpp"
+#include "multi_sig_transactions/storage/mst_state_log.hpp"
 #include "multi_sig_transactions/storage/mst_storage_impl.hpp"
 #include "multi_sig_transactions/transport/mst_transport_grpc.hpp"
 #include "multi_sig_transactions/transport/mst_transport_stub.hpp"
 #include "network/impl/block_loader_impl.hpp"
+#include "network/impl/channel_factory.hpp"
+#include "network/impl/channel_pool.hpp"
+#include "network/impl/generic_client_factory.hpp"
 #include "network/impl/peer_communication_service_impl.hpp"
 #include "network/impl/peer_tls_certificates_provider_root.hpp"
 #include "network/impl/peer_tls_certificates_provider_wsv.hpp"
@@ -82,6 +88,15 @@ using namespace std::chrono_literals;
 static constexpr iroha::consensus::yac::ConsistencyModel
     kConsensusConsistencyModel = iroha::consensus::yac::ConsistencyModel::kCft;
 
+/// Completion queues of the inter-peer asynchronous client
+static constexpr size_t kMaxAsyncClientQueues = 4;
+/// Calls to one peer, which may wait for response, before new are dropped
+static constexpr size_t kMaxAsyncCallsInFlightPerPeer = 1024;
+/// Peers, from which missing blocks are downloaded at once
+static constexpr size_t kMaxParallelSyncPeers = 4;
+/// Blocks requested from one peer at once during parallel synchronization
+static constexpr size_t kParallelSyncRangeSize = 100;
+
 /**
  * Configuring iroha daemon
  */
@@ -104,7 +119,11 @@ Irohad::Irohad(
     const boost::optional<GossipPropagationStrategyParams>
         &opt_mst_gossip_params,
     const boost::optional<iroha::torii::TlsParams> &torii_tls_params,
-    boost::optional<IrohadConfig::InterPeerTls> inter_peer_tls_config)
+    boost::optional<IrohadConfig::InterPeerTls> inter_peer_tls_config,
+    bool adaptive_vote_delay,
+    boost::optional<std::string> mst_state_path,
+    bool yac_commit_certificates,
+    boost::optional<IrohadConfig::MstStateLog> mst_state_log_config)
     : block_store_dir_(block_store_dir),
       listen_ip_(listen_ip),
       torii_port_(torii_port),
@@ -113,8 +132,12 @@ Irohad::Irohad(
       max_proposal_size_(max_proposal_size),
       proposal_delay_(proposal_delay),
       vote_delay_(vote_delay),
+      adaptive_vote_delay_(adaptive_vote_delay),
+      yac_commit_certificates_(yac_commit_certificates),
       is_mst_supported_(opt_mst_gossip_params),
       mst_expiration_time_(mst_expiration_time),
+      mst_state_path_(std::move(mst_state_path)),
+      mst_state_log_config_(std::move(mst_state_log_config)),
       max_rounds_delay_(max_rounds_delay),
       stale_stream_max_rounds_(stale_stream_max_rounds),
       opt_alternative_peers_(std::move(opt_alternative_peers)),
@@ -299,6 +322,10 @@ Irohad::RunResult Irohad::initStorage(
     persistent_block_storage = std::make_unique<PostgresBlockStorage>(
         pool_wrapper_, block_transport_factory, persistent_table, log_);
   }
+  // recently committed and queried blocks are kept decoded
+  const size_t kBlockCacheSize = 16;
+  persistent_block_storage = std::make_unique<CachingBlockStorage>(
+      std::move(persistent_block_storage), kBlockCacheSize);
   return StorageImpl::create(std::move(pg_opt),
                              pool_wrapper_,
                              perm_converter,
@@ -464,9 +491,79 @@ Irohad::RunResult Irohad::initValidators() {
  * Initializing network client
  */
 Irohad::RunResult Irohad::initNetworkClient() {
+  network::AsyncGrpcClient<google::protobuf::Empty>::Options async_options;
+  async_options.queues = std::max(
+      1u, std::min<unsigned>(kMaxAsyncClientQueues,
+                             std::thread::hardware_concurrency()));
+  async_options.max_in_flight_per_peer = kMaxAsyncCallsInFlightPerPeer;
   async_call_ =
       std::make_shared<network::AsyncGrpcClient<google::protobuf::Empty>>(
-          log_manager_->getChild("AsyncNetworkClient")->getLogger());
+          log_manager_->getChild("AsyncNetworkClient")->getLogger(),
+          async_options);
+  // a channel to a peer is shared by all of these services
+  std::set<std::string> inter_peer_services{
+      iroha::consensus::yac::proto::Yac::service_full_name(),
+      iroha::network::proto::Loader::service_full_name(),
+      iroha::network::transport::MstTransportGrpc::service_full_name(),
+      iroha::ordering::proto::OnDemandOrdering::service_full_name()};
+  inter_peer_channel_pool_ = std::make_shared<network::ChannelPool>(
+      std::make_unique<network::ChannelFactory>(
+          network::getDefaultChannelParams(), std::move(inter_peer_services)));
+  inter_peer_client_factory_ =
+      std::make_shared<network::GenericClientFactory>(inter_peer_channel_pool_);
+
+  auto &registry = metrics::defaultRegistry();
+  metrics_collectors_.push_back(registry.addCollector(
+      [async_call = async_call_](metrics::Writer &writer) {
+        const auto stats = async_call->metrics();
+        for (const auto &method : stats.methods) {
+          const metrics::Labels labels{{"method", method.first}};
+          writer.counter("iroha_grpc_client_calls_total",
+                         "Asynchronous calls to peers",
+                         labels,
+                         method.second.calls);
+          writer.counter("iroha_grpc_client_failures_total",
+                         "Asynchronous calls finished with not OK status",
+                         labels,
+                         method.second.failures);
+          writer.counter("iroha_grpc_client_rejected_total",
+                         "Calls not made because of the in-flight limit",
+                         labels,
+                         method.second.rejected);
+          writer.counter("iroha_grpc_client_latency_microseconds_total",
+                         "Total latency of asynchronous calls",
+                         labels,
+                         method.second.total_latency.count());
+        }
+        writer.gauge("iroha_grpc_client_in_flight",
+                     "Asynchronous calls waiting for response",
+                     {},
+                     stats.in_flight);
+      }));
+  metrics_collectors_.push_back(registry.addCollector(
+      [pool = inter_peer_channel_pool_](metrics::Writer &writer) {
+        const auto stats = pool->metrics();
+        writer.counter("iroha_channel_pool_created_total",
+                       "Channels to peers created",
+                       {},
+                       stats.created);
+        writer.counter("iroha_channel_pool_reused_total",
+                       "Requests served with an existing channel",
+                       {},
+                       stats.reused);
+        writer.counter("iroha_channel_pool_evicted_total",
+                       "Channels dropped after the idle timeout",
+                       {},
+                       stats.evicted);
+        writer.gauge("iroha_channel_pool_channels",
+                     "Channels in the pool",
+                     {},
+                     stats.channels);
+        writer.gauge("iroha_channel_pool_ready_channels",
+                     "Channels with an established connection",
+                     {},
+                     stats.ready);
+      }));
   return {};
 }
 
@@ -633,6 +730,7 @@ Irohad::RunResult Irohad::initOrderingGate() {
                                      batch_parser,
                                      transaction_batch_factory_,
                                      async_call_,
+                                     inter_peer_client_factory_,
                                      std::move(factory),
                                      proposal_factory,
                                      persistent_cache,
@@ -696,6 +794,7 @@ Irohad::RunResult Irohad::initBlockLoader() {
                                   storage,
                                   consensus_result_cache_,
                                   block_validators_config_,
+                                  inter_peer_client_factory_,
                                   log_manager_->getChild("BlockLoader"));
 
   log_->info("[Init] => block loader");
@@ -729,12 +828,26 @@ Irohad::RunResult Irohad::initConsensusGate() {
       keypair,
       consensus_result_cache_,
       vote_delay_,
+      adaptive_vote_delay_,
+      yac_commit_certificates_,
       async_call_,
+      inter_peer_client_factory_,
       kConsensusConsistencyModel,
       log_manager_->getChild("Consensus"));
   consensus_gate->onOutcome().subscribe(
       consensus_gate_events_subscription,
       consensus_gate_objects.get_subscriber());
+  if (auto estimator = yac_init->getVoteDelayEstimator()) {
+    metrics_collectors_.push_back(metrics::defaultRegistry().addCollector(
+        [estimator](metrics::Writer &writer) {
+          for (const auto &estimate : estimator->estimates()) {
+            writer.gauge("iroha_yac_peer_response_microseconds",
+                         "Estimated time between a vote and the outcome",
+                         {{"peer", estimate.peer}},
+                         estimate.response.latency.count());
+          }
+        }));
+  }
   log_->info("[Init] => consensus gate");
   return {};
 }
@@ -745,6 +858,9 @@ Irohad::RunResult Irohad::initConsensusGate() {
 Irohad::RunResult Irohad::initSynchronizer() {
   return storage->createCommandExecutor() |
              [this](auto &&command_executor) -> RunResult {
+    ParallelSyncOptions parallel_sync;
+    parallel_sync.max_peers = kMaxParallelSyncPeers;
+    parallel_sync.range_size = kParallelSyncRangeSize;
     synchronizer = std::make_shared<SynchronizerImpl>(
         std::move(command_executor),
         consensus_gate,
@@ -752,7 +868,8 @@ Irohad::RunResult Irohad::initSynchronizer() {
         storage,
         storage,
         block_loader,
-        log_manager_->getChild("Synchronizer")->getLogger());
+        log_manager_->getChild("Synchronizer")->getLogger(),
+        parallel_sync);
 
     log_->info("[Init] => synchronizer");
     return {};
@@ -807,12 +924,71 @@ Irohad::RunResult Irohad::initMstProcessor() {
       log_manager_->getChild("MultiSignatureTransactions");
   auto mst_state_logger = mst_logger_manager->getChild("State")->getLogger();
   auto mst_completer = std::make_shared<DefaultCompleter>(mst_expiration_time_);
+  std::shared_ptr<MstStateLog> mst_state_log;
+  if (mst_state_path_) {
+    MstStateLog::Options options;
+    if (mst_state_log_config_) {
+      if (mst_state_log_config_->group_commit_delay_ms) {
+        options.group_commit_delay = std::chrono::milliseconds(
+            *mst_state_log_config_->group_commit_delay_ms);
+      }
+      options.min_compaction_size =
+          mst_state_log_config_->min_compaction_size.value_or(
+              options.min_compaction_size);
+      options.compaction_ratio =
+          mst_state_log_config_->compaction_ratio.value_or(
+              options.compaction_ratio);
+    }
+    auto opened_log = MstStateLog::create(
+        *mst_state_path_,
+        options,
+        mst_logger_manager->getChild("StateLog")->getLogger());
+    if (auto e = expected::resultToOptionalError(opened_log)) {
+      return expected::makeError("Failed to open MST state log: " + *e);
+    }
+    mst_state_log = std::move(opened_log).assumeValue();
+    metrics_collectors_.push_back(metrics::defaultRegistry().addCollector(
+        [mst_state_log](metrics::Writer &writer) {
+          const auto stats = mst_state_log->metrics();
+          writer.counter("iroha_mst_state_log_writes_total",
+                         "Synced writes of the MST state log",
+                         {},
+                         stats.writes);
+          writer.counter("iroha_mst_state_log_failures_total",
+                         "Failed operations of the MST state log",
+                         {},
+                         stats.failures);
+          writer.gauge("iroha_mst_state_log_file_bytes",
+                       "Size of the MST state log file",
+                       {},
+                       stats.file_size);
+        }));
+  }
   auto mst_storage = std::make_shared<MstStorageStateImpl>(
       mst_completer,
       mst_state_logger,
-      mst_logger_manager->getChild("Storage")->getLogger());
+      mst_logger_manager->getChild("Storage")->getLogger(),
+      mst_state_log);
   std::shared_ptr<iroha::PropagationStrategy> mst_propagation;
   if (is_mst_supported_) {
+    auto mst_transport_logger =
+        mst_logger_manager->getChild("Transport")->getLogger();
+    MstTransportGrpc::SenderFactory sender_factory =
+        [client_factory = inter_peer_client_factory_,
+         log = mst_transport_logger](const shared_model::interface::Peer &peer) {
+          using StubPtr = std::unique_ptr<
+              network::transport::MstTransportGrpc::StubInterface>;
+          return client_factory
+              ->createClient<network::transport::MstTransportGrpc>(peer)
+              .match(
+                  [](auto &&stub) -> StubPtr { return std::move(stub.value); },
+                  [&](const auto &error) -> StubPtr {
+                    log->error("Failed to create client for {}: {}",
+                               peer.address(),
+                               error.error);
+                    return nullptr;
+                  });
+        };
     mst_transport = std::make_shared<iroha::network::MstTransportGrpc>(
         async_call_,
         transaction_factory,
@@ -822,7 +998,8 @@ Irohad::RunResult Irohad::initMstProcessor() {
         mst_completer,
         keypair.publicKey(),
         std::move(mst_state_logger),
-        mst_logger_manager->getChild("Transport")->getLogger());
+        std::move(mst_transport_logger),
+        std::move(sender_factory));
     mst_propagation = std::make_shared<GossipPropagationStrategy>(
         storage, rxcpp::observe_on_new_thread(), *opt_mst_gossip_params_);
   } else {
@@ -842,6 +1019,22 @@ Irohad::RunResult Irohad::initMstProcessor() {
 
   pending_txs_storage_init->setSubscriptions(*mst_processor);
 
+  if (mst_state_log) {
+    // restored batches reach the pending transactions storage as updates
+    auto batches = recoverBatches(*mst_state_log,
+                                  *transaction_factory,
+                                  *batch_parser,
+                                  *transaction_batch_factory_,
+                                  *persistent_cache,
+                                  *mst_completer,
+                                  mst_time->getCurrentTime(),
+                                  log_);
+    for (const auto &batch : batches) {
+      mst_processor->propagateBatch(batch);
+    }
+    log_->info("[Init] => restored {} MST batches", batches.size());
+  }
+
   log_->info("[Init] => MST processor");
   return {};
 }
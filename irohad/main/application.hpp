@@ -18,6 +18,7 @@
 #include "main/impl/on_demand_ordering_init.hpp"
 #include "main/iroha_conf_loader.hpp"
 #include "main/server_runner.hpp"
+#include "metrics/metrics.hpp"
 #include "multi_sig_transactions/gossip_propagation_strategy_params.hpp"
 #include "torii/tls_params.hpp"
 
@@ -40,10 +41,12 @@ namespace iroha {
   }    // namespace consensus
   namespace network {
     class BlockLoader;
+    class ChannelPool;
     class ConsensusGate;
     class MstTransport;
     class OrderingGate;
     class PeerCommunicationService;
+    class GenericClientFactory;
     class PeerTlsCertificatesProvider;
     struct TlsCredentials;
   }  // namespace network
@@ -109,6 +112,13 @@ class Irohad {
    * @param torii_tls_params - optional TLS params for torii.
    * @see iroha::torii::TlsParams
    * @param inter_peer_tls_config - set up TLS in peer-to-peer communication
+   * @param adaptive_vote_delay - derive the waiting time before sending vote
+   * to next peer from the observed latency of peers, starting from vote_delay
+   * @param mst_state_path - file to keep pending MST batches across restarts
+   * @param yac_commit_certificates - send votes for the same hash as a commit
+   * certificate, which peers of older versions do not understand
+   * @param mst_state_log_config - write and compaction options of the file at
+   * mst_state_path
    */
   Irohad(const boost::optional<std::string> &block_store_dir,
          std::unique_ptr<iroha::ametsuchi::PostgresOptions> pg_opt,
@@ -130,6 +140,11 @@ class Irohad {
          const boost::optional<iroha::torii::TlsParams> &torii_tls_params =
              boost::none,
          boost::optional<IrohadConfig::InterPeerTls> inter_peer_tls_config =
+             boost::none,
+         bool adaptive_vote_delay = false,
+         boost::optional<std::string> mst_state_path = boost::none,
+         bool yac_commit_certificates = false,
+         boost::optional<IrohadConfig::MstStateLog> mst_state_log_config =
              boost::none);
 
   /**
@@ -224,8 +239,12 @@ class Irohad {
   size_t max_proposal_size_;
   std::chrono::milliseconds proposal_delay_;
   std::chrono::milliseconds vote_delay_;
+  bool adaptive_vote_delay_;
+  bool yac_commit_certificates_;
   bool is_mst_supported_;
   std::chrono::minutes mst_expiration_time_;
+  boost::optional<std::string> mst_state_path_;
+  boost::optional<IrohadConfig::MstStateLog> mst_state_log_config_;
   std::chrono::milliseconds max_rounds_delay_;
   size_t stale_stream_max_rounds_;
   const boost::optional<shared_model::interface::types::PeerList>
@@ -293,6 +312,11 @@ class Irohad {
   std::shared_ptr<iroha::network::AsyncGrpcClient<google::protobuf::Empty>>
       async_call_;
 
+  // channels to other peers, shared by clients of all services
+  std::shared_ptr<iroha::network::ChannelPool> inter_peer_channel_pool_;
+  std::shared_ptr<iroha::network::GenericClientFactory>
+      inter_peer_client_factory_;
+
   // transaction batch factory
   std::shared_ptr<shared_model::interface::TransactionBatchFactory>
       transaction_batch_factory_;
@@ -372,6 +396,9 @@ class Irohad {
   logger::LoggerManagerTreePtr log_manager_;  ///< application root log manager
 
   logger::LoggerPtr log_;  ///< log for local messages
+
+  /// exporters of component metrics, removed before the components
+  std::vector<iroha::metrics::Registry::CollectorHandle> metrics_collectors_;
 };
 
 #endif  // IROHA_APPLICATION_HPP
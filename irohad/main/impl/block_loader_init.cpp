@@ -6,6 +6,7 @@
 #include "main/impl/block_loader_init.hpp"
 
 #include "logger/logger_manager.hpp"
+#include "network/impl/client_factory_impl.hpp"
 #include "validators/default_validator.hpp"
 #include "validators/protobuf/proto_block_validator.hpp"
 
@@ -27,13 +28,18 @@ auto BlockLoaderInit::createLoader(
     std::shared_ptr<PeerQueryFactory> peer_query_factory,
     std::shared_ptr<shared_model::validation::ValidatorsConfig>
         validators_config,
+    std::shared_ptr<GenericClientFactory> client_factory,
     logger::LoggerPtr loader_log) {
   shared_model::proto::ProtoBlockFactory factory(
       std::make_unique<shared_model::validation::DefaultSignedBlockValidator>(
           validators_config),
       std::make_unique<shared_model::validation::ProtoBlockValidator>());
   return std::make_shared<BlockLoaderImpl>(
-      std::move(peer_query_factory), std::move(factory), std::move(loader_log));
+      std::move(peer_query_factory),
+      std::move(factory),
+      std::move(loader_log),
+      std::make_shared<ClientFactoryImpl<proto::Loader>>(
+          std::move(client_factory)));
 }
 
 std::shared_ptr<BlockLoader> BlockLoaderInit::initBlockLoader(
@@ -42,12 +48,14 @@ std::shared_ptr<BlockLoader> BlockLoaderInit::initBlockLoader(
     std::shared_ptr<consensus::ConsensusResultCache> consensus_result_cache,
     std::shared_ptr<shared_model::validation::ValidatorsConfig>
         validators_config,
+    std::shared_ptr<GenericClientFactory> client_factory,
     const logger::LoggerManagerTreePtr &loader_log_manager) {
   service = createService(std::move(block_query_factory),
                           std::move(consensus_result_cache),
                           loader_log_manager);
   loader = createLoader(std::move(peer_query_factory),
                         std::move(validators_config),
+                        std::move(client_factory),
                         loader_log_manager->getLogger());
   return loader;
 }
@@ -12,6 +12,7 @@
 #include "logger/logger_manager_fwd.hpp"
 #include "network/impl/block_loader_impl.hpp"
 #include "network/impl/block_loader_service.hpp"
+#include "network/impl/generic_client_factory.hpp"
 #include "validators/validators_common.hpp"
 
 namespace iroha {
@@ -38,6 +39,7 @@ namespace iroha {
        * block
        * @param peer_query_factory - factory for peer query component creation
        * @param validators_config - a config for underlying validators
+       * @param client_factory - factory of clients of other peers
        * @param loader_log - the log of the loader subsystem
        * @return initialized loader
        */
@@ -45,6 +47,7 @@ namespace iroha {
           std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory,
           std::shared_ptr<shared_model::validation::ValidatorsConfig>
               validators_config,
+          std::shared_ptr<GenericClientFactory> client_factory,
           logger::LoggerPtr loader_log);
 
      public:
@@ -54,6 +57,7 @@ namespace iroha {
        * @param block_query_factory - factory to block query component
        * @param block_cache used to retrieve last block put by consensus
        * @param validators_config - a config for underlying validators
+       * @param client_factory - factory of clients of other peers
        * @param loader_log - the log of the loader subsystem
        * @return initialized service
        */
@@ -64,6 +68,7 @@ namespace iroha {
           std::shared_ptr<consensus::ConsensusResultCache> block_cache,
           std::shared_ptr<shared_model::validation::ValidatorsConfig>
               validators_config,
+          std::shared_ptr<GenericClientFactory> client_factory,
           const logger::LoggerManagerTreePtr &loader_log_manager);
 
       std::shared_ptr<BlockLoaderImpl> loader;
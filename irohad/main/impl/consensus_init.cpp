@@ -9,6 +9,7 @@
 #include "consensus/yac/consistency_model.hpp"
 #include "consensus/yac/impl/peer_orderer_impl.hpp"
 #include "consensus/yac/impl/timer_impl.hpp"
+#include "consensus/yac/impl/vote_delay_estimator.hpp"
 #include "consensus/yac/impl/yac_crypto_provider_impl.hpp"
 #include "consensus/yac/impl/yac_gate_impl.hpp"
 #include "consensus/yac/impl/yac_hash_provider_impl.hpp"
@@ -16,8 +17,8 @@
 #include "consensus/yac/storage/yac_proposal_storage.hpp"
 #include "consensus/yac/transport/impl/network_impl.hpp"
 #include "consensus/yac/yac.hpp"
+#include "logger/logger.hpp"
 #include "logger/logger_manager.hpp"
-#include "network/impl/grpc_channel_builder.hpp"
 
 using namespace iroha::consensus;
 using namespace iroha::consensus::yac;
@@ -46,7 +47,8 @@ namespace {
       std::shared_ptr<YacNetwork> network,
       ConsistencyModel consistency_model,
       rxcpp::observe_on_one_worker coordination,
-      const logger::LoggerManagerTreePtr &consensus_log_manager) {
+      const logger::LoggerManagerTreePtr &consensus_log_manager,
+      std::shared_ptr<VoteDelayEstimator> vote_delay_estimator) {
     std::shared_ptr<iroha::consensus::yac::CleanupStrategy> cleanup_strategy =
         std::make_shared<iroha::consensus::yac::BufferedCleanupStrategy>();
     return Yac::create(
@@ -59,8 +61,13 @@ namespace {
         initial_order,
         initial_round,
         coordination,
-        consensus_log_manager->getChild("HashGate")->getLogger());
+        consensus_log_manager->getChild("HashGate")->getLogger(),
+        std::move(vote_delay_estimator));
   }
+
+  /// Bounds of the adaptive vote delay relative to the configured one
+  const size_t kMinVoteDelayDivisor = 10;
+  const size_t kMaxVoteDelayMultiplier = 4;
 }  // namespace
 
 namespace iroha {
@@ -74,11 +81,22 @@ namespace iroha {
         return consensus_network_;
       }
 
+      std::shared_ptr<VoteDelayEstimator> YacInit::getVoteDelayEstimator()
+          const {
+        return vote_delay_estimator_;
+      }
+
       auto YacInit::createTimer(std::chrono::milliseconds delay_milliseconds) {
-        return std::make_shared<TimerImpl>(
-            delay_milliseconds,
-            // TODO 2019-04-10 andrei: IR-441 Share a thread between MST and YAC
-            rxcpp::observe_on_new_thread());
+        // TODO 2019-04-10 andrei: IR-441 Share a thread between MST and YAC
+        if (vote_delay_estimator_) {
+          return std::make_shared<TimerImpl>(
+              [estimator = vote_delay_estimator_] {
+                return estimator->voteDelay();
+              },
+              rxcpp::observe_on_new_thread());
+        }
+        return std::make_shared<TimerImpl>(delay_milliseconds,
+                                           rxcpp::observe_on_new_thread());
       }
 
       std::shared_ptr<YacGate> YacInit::initConsensusGate(
@@ -93,21 +111,44 @@ namespace iroha {
           std::shared_ptr<consensus::ConsensusResultCache>
               consensus_result_cache,
           std::chrono::milliseconds vote_delay_milliseconds,
+          bool adaptive_vote_delay,
+          bool send_certificates,
           std::shared_ptr<
               iroha::network::AsyncGrpcClient<google::protobuf::Empty>>
               async_call,
+          std::shared_ptr<network::GenericClientFactory> client_factory,
           ConsistencyModel consistency_model,
           const logger::LoggerManagerTreePtr &consensus_log_manager) {
         auto peer_orderer = createPeerOrderer(peer_query_factory);
         auto peers = peer_query_factory->createPeerQuery() |
             [](auto &&peer_query) { return peer_query->getLedgerPeers(); };
 
+        auto network_log =
+            consensus_log_manager->getChild("Network")->getLogger();
         consensus_network_ = std::make_shared<NetworkImpl>(
             async_call,
-            [](const shared_model::interface::Peer &peer) {
-              return network::createClient<proto::Yac>(peer.address());
+            [client_factory = std::move(client_factory), network_log](
+                const shared_model::interface::Peer &peer) {
+              using StubPtr = std::unique_ptr<proto::Yac::StubInterface>;
+              return client_factory->createClient<proto::Yac>(peer).match(
+                  [](auto &&stub) -> StubPtr { return std::move(stub.value); },
+                  [&](const auto &error) -> StubPtr {
+                    network_log->error("Failed to create client for {}: {}",
+                                       peer.address(),
+                                       error.error);
+                    return nullptr;
+                  });
             },
-            consensus_log_manager->getChild("Network")->getLogger());
+            network_log,
+            send_certificates);
+
+        if (adaptive_vote_delay) {
+          vote_delay_estimator_ = std::make_shared<VoteDelayEstimator>(
+              vote_delay_milliseconds,
+              vote_delay_milliseconds / kMinVoteDelayDivisor,
+              vote_delay_milliseconds * kMaxVoteDelayMultiplier,
+              consensus_log_manager->getChild("VoteDelay")->getLogger());
+        }
 
         auto yac = createYac(*ClusterOrdering::create(peers.value()),
                              initial_round,
@@ -116,7 +157,8 @@ namespace iroha {
                              consensus_network_,
                              consistency_model,
                              rxcpp::observe_on_new_thread(),
-                             consensus_log_manager);
+                             consensus_log_manager,
+                             vote_delay_estimator_);
         consensus_network_->subscribe(yac);
 
         auto hash_provider = createHashProvider();
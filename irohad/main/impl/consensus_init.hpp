@@ -21,12 +21,15 @@
 #include "logger/logger_manager_fwd.hpp"
 #include "network/block_loader.hpp"
 #include "network/impl/async_grpc_client.hpp"
+#include "network/impl/generic_client_factory.hpp"
 #include "simulator/block_creator.hpp"
 
 namespace iroha {
   namespace consensus {
     namespace yac {
 
+      class VoteDelayEstimator;
+
       class YacInit {
        public:
         std::shared_ptr<YacGate> initConsensusGate(
@@ -40,19 +43,26 @@ namespace iroha {
             const shared_model::crypto::Keypair &keypair,
             std::shared_ptr<consensus::ConsensusResultCache> block_cache,
             std::chrono::milliseconds vote_delay_milliseconds,
+            bool adaptive_vote_delay,
+            bool send_certificates,
             std::shared_ptr<
                 iroha::network::AsyncGrpcClient<google::protobuf::Empty>>
                 async_call,
+            std::shared_ptr<network::GenericClientFactory> client_factory,
             ConsistencyModel consistency_model,
             const logger::LoggerManagerTreePtr &consensus_log_manager);
 
         std::shared_ptr<NetworkImpl> getConsensusNetwork() const;
 
+        /// @return estimator of the adaptive vote delay, if it is enabled
+        std::shared_ptr<VoteDelayEstimator> getVoteDelayEstimator() const;
+
        private:
         auto createTimer(std::chrono::milliseconds delay_milliseconds);
 
         bool initialized_{false};
         std::shared_ptr<NetworkImpl> consensus_network_;
+        std::shared_ptr<VoteDelayEstimator> vote_delay_estimator_;
       };
     }  // namespace yac
   }    // namespace consensus
@@ -22,6 +22,7 @@
 #include "interfaces/common_objects/types.hpp"
 #include "logger/logger.hpp"
 #include "logger/logger_manager.hpp"
+#include "network/impl/client_factory_impl.hpp"
 #include "ordering/impl/on_demand_common.hpp"
 #include "ordering/impl/on_demand_connection_manager.hpp"
 #include "ordering/impl/on_demand_ordering_gate.hpp"
@@ -41,6 +42,7 @@ namespace iroha {
     auto OnDemandOrderingInit::createNotificationFactory(
         std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
             async_call,
+        std::shared_ptr<GenericClientFactory> client_factory,
         std::shared_ptr<TransportFactoryType> proposal_transport_factory,
         std::chrono::milliseconds delay,
         const logger::LoggerManagerTreePtr &ordering_log_manager) {
@@ -49,12 +51,16 @@ namespace iroha {
           std::move(proposal_transport_factory),
           [] { return std::chrono::system_clock::now(); },
           delay,
-          ordering_log_manager->getChild("NetworkClient")->getLogger());
+          ordering_log_manager->getChild("NetworkClient")->getLogger(),
+          std::make_shared<
+              ClientFactoryImpl<ordering::proto::OnDemandOrdering>>(
+              std::move(client_factory)));
     }
 
     auto OnDemandOrderingInit::createConnectionManager(
         std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
             async_call,
+        std::shared_ptr<GenericClientFactory> client_factory,
         std::shared_ptr<TransportFactoryType> proposal_transport_factory,
         std::chrono::milliseconds delay,
         std::vector<shared_model::interface::types::HashType> initial_hashes,
@@ -176,6 +182,7 @@ namespace iroha {
 
       return std::make_shared<ordering::OnDemandConnectionManager>(
           createNotificationFactory(std::move(async_call),
+                                    std::move(client_factory),
                                     std::move(proposal_transport_factory),
                                     delay,
                                     ordering_log_manager),
@@ -319,6 +326,7 @@ namespace iroha {
             transaction_batch_factory,
         std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
             async_call,
+        std::shared_ptr<GenericClientFactory> client_factory,
         std::shared_ptr<shared_model::interface::UnsafeProposalFactory>
             proposal_factory,
         std::shared_ptr<TransportFactoryType> proposal_transport_factory,
@@ -341,6 +349,7 @@ namespace iroha {
       return createGate(
           ordering_service,
           createConnectionManager(std::move(async_call),
+                                  std::move(client_factory),
                                   std::move(proposal_transport_factory),
                                   delay,
                                   std::move(initial_hashes),
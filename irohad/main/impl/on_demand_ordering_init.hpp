@@ -15,6 +15,7 @@
 #include "logger/logger_fwd.hpp"
 #include "logger/logger_manager_fwd.hpp"
 #include "network/impl/async_grpc_client.hpp"
+#include "network/impl/generic_client_factory.hpp"
 #include "network/ordering_gate.hpp"
 #include "network/peer_communication_service.hpp"
 #include "ordering.grpc.pb.h"
@@ -44,6 +45,7 @@ namespace iroha {
       auto createNotificationFactory(
           std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
               async_call,
+          std::shared_ptr<GenericClientFactory> client_factory,
           std::shared_ptr<TransportFactoryType> proposal_transport_factory,
           std::chrono::milliseconds delay,
           const logger::LoggerManagerTreePtr &ordering_log_manager);
@@ -56,6 +58,7 @@ namespace iroha {
       auto createConnectionManager(
           std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
               async_call,
+          std::shared_ptr<GenericClientFactory> client_factory,
           std::shared_ptr<TransportFactoryType> proposal_transport_factory,
           std::chrono::milliseconds delay,
           std::vector<shared_model::interface::types::HashType> initial_hashes,
@@ -116,6 +119,8 @@ namespace iroha {
        * batch candidates produced by parser
        * @param async_call asynchronous gRPC client required for sending batches
        * requests to ordering service and processing responses
+       * @param client_factory factory of clients of ordering services of
+       * other peers
        * @param proposal_factory factory required by ordering service to produce
        * proposals
        * @param creation_strategy - provides a strategy for creating proposals
@@ -135,6 +140,7 @@ namespace iroha {
               transaction_batch_factory,
           std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
               async_call,
+          std::shared_ptr<GenericClientFactory> client_factory,
           std::shared_ptr<shared_model::interface::UnsafeProposalFactory>
               proposal_factory,
           std::shared_ptr<TransportFactoryType> proposal_transport_factory,
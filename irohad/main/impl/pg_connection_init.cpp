@@ -10,6 +10,9 @@
 #include "logger/logger_manager.hpp"
 
 namespace {
+  /// Version of the schema, which prepareTables creates or upgrades to
+  const int kSchemaVersion = 1;
+
   std::string formatPostgresMessage(const char *message) {
     std::string formatted_message(message);
     boost::replace_if(formatted_message, boost::is_any_of("\r\n"), ' ');
@@ -80,12 +83,24 @@ PgConnectionInit::prepareConnectionPool(
                              *failover_callback_factory,
                              reconnection_strategy_factory,
                              options.maintenanceConnectionString(),
+                             options.amountStorageMode(),
                              log_manager);
 
+    const auto amount_storage_mode = getAmountStorageMode(sql);
+    if (amount_storage_mode != options.amountStorageMode()) {
+      log_manager->getLogger()->warn(
+          "Working database keeps balances as {} amounts, the configured "
+          "representation only applies to new databases.",
+          amount_storage_mode == AmountStorageMode::kScaledInteger
+              ? "scaled integer"
+              : "decimal");
+    }
+
     return expected::makeValue<std::shared_ptr<PoolWrapper>>(
         std::make_shared<PoolWrapper>(std::move(connection),
                                       std::move(failover_callback_factory),
-                                      enable_prepared_transactions));
+                                      enable_prepared_transactions,
+                                      amount_storage_mode));
 
   } catch (const std::exception &e) {
     return expected::makeError(e.what());
@@ -102,6 +117,18 @@ bool PgConnectionInit::preparedTransactionsAvailable(soci::session &sql) {
   }
 }
 
+AmountStorageMode PgConnectionInit::getAmountStorageMode(soci::session &sql) {
+  // unconstrained decimal has no scale, while scaled integers are numeric(78)
+  int scaled_integer_columns = 0;
+  sql << "SELECT count(1) FROM information_schema.columns "
+         "WHERE table_schema = current_schema() "
+         "AND table_name = 'account_has_asset' AND column_name = 'amount' "
+         "AND numeric_scale = 0",
+      soci::into(scaled_integer_columns);
+  return scaled_integer_columns == 0 ? AmountStorageMode::kDecimal
+                                     : AmountStorageMode::kScaledInteger;
+}
+
 iroha::expected::Result<void, std::string> PgConnectionInit::rollbackPrepared(
     soci::session &sql, const std::string &prepared_block_name) {
   try {
@@ -162,6 +189,7 @@ void PgConnectionInit::initializeConnectionPool(
     FailoverCallbackHolder &callback_factory,
     const ReconnectionStrategyFactory &reconnection_strategy_factory,
     const std::string &pg_reconnection_options,
+    AmountStorageMode amount_storage_mode,
     logger::LoggerManagerTreePtr log_manager) {
   auto log = log_manager->getLogger();
   auto initialize_session = [&](soci::session &session,
@@ -182,7 +210,7 @@ void PgConnectionInit::initializeConnectionPool(
     // rollback current prepared transaction
     // if there exists any since last session
     try_rollback(session);
-    prepareTables(session);
+    prepareTables(session, amount_storage_mode);
   };
 
   /// lambda contains actions which should be invoked once for each
@@ -214,8 +242,13 @@ void PgConnectionInit::initializeConnectionPool(
   }
 }
 
-void PgConnectionInit::prepareTables(soci::session &session) {
-  static const std::string prepare_tables_sql = R"(
+void PgConnectionInit::prepareTables(soci::session &session,
+                                     AmountStorageMode amount_storage_mode) {
+  // 2 ^ 256 has 78 decimal digits
+  const std::string amount_type =
+      amount_storage_mode == AmountStorageMode::kScaledInteger ? "numeric(78)"
+                                                               : "decimal";
+  const std::string prepare_tables_sql = R"(
 CREATE TABLE IF NOT EXISTS role (
     role_id character varying(32),
     PRIMARY KEY (role_id)
@@ -256,7 +289,8 @@ CREATE TABLE IF NOT EXISTS asset (
 CREATE TABLE IF NOT EXISTS account_has_asset (
     account_id character varying(288) NOT NULL REFERENCES account,
     asset_id character varying(288) NOT NULL REFERENCES asset,
-    amount decimal NOT NULL,
+    amount )" + amount_type
+      + R"( NOT NULL,
     PRIMARY KEY (account_id, asset_id)
 );
 CREATE TABLE IF NOT EXISTS role_has_permissions (
@@ -301,6 +335,14 @@ CREATE TABLE IF NOT EXISTS tx_position_by_creator (
     height bigint,
     index bigint
 );
+CREATE INDEX IF NOT EXISTS tx_position_by_creator_index
+    ON tx_position_by_creator
+    USING btree
+    (creator_id, height, index ASC);
+CREATE TABLE IF NOT EXISTS tx_count_by_creator (
+    creator_id text PRIMARY KEY,
+    count bigint NOT NULL
+);
 CREATE TABLE IF NOT EXISTS position_by_account_asset (
     account_id text,
     asset_id text,
@@ -315,9 +357,38 @@ CREATE TABLE IF NOT EXISTS setting(
     setting_key text,
     setting_value text,
     PRIMARY KEY (setting_key)
+);
+CREATE TABLE IF NOT EXISTS schema_version (
+    version integer NOT NULL
 );)";
 
   session << prepare_tables_sql;
+  upgradeSchema(session);
+}
+
+void PgConnectionInit::upgradeSchema(soci::session &session) {
+  soci::transaction transaction(session);
+  session << "LOCK TABLE schema_version IN EXCLUSIVE MODE";
+  int version = 0;
+  session << "SELECT COALESCE(MAX(version), 0) FROM schema_version",
+      soci::into(version);
+  if (version >= kSchemaVersion) {
+    return;
+  }
+
+  if (version < 1) {
+    // tx_count_by_creator is added in version 1
+    session << R"(
+INSERT INTO tx_count_by_creator(creator_id, count)
+    SELECT creator_id, COUNT(*) FROM tx_position_by_creator
+    GROUP BY creator_id
+ON CONFLICT (creator_id) DO UPDATE SET count = EXCLUDED.count)";
+  }
+
+  session << "DELETE FROM schema_version";
+  session << "INSERT INTO schema_version(version) VALUES (:version)",
+      soci::use(kSchemaVersion);
+  transaction.commit();
 }
 
 iroha::expected::Result<void, std::string> PgConnectionInit::resetWsv(
@@ -338,6 +409,7 @@ iroha::expected::Result<void, std::string> PgConnectionInit::resetWsv(
       TRUNCATE TABLE position_by_hash RESTART IDENTITY CASCADE;
       TRUNCATE TABLE tx_status_by_hash RESTART IDENTITY CASCADE;
       TRUNCATE TABLE tx_position_by_creator RESTART IDENTITY CASCADE;
+      TRUNCATE TABLE tx_count_by_creator RESTART IDENTITY CASCADE;
       TRUNCATE TABLE position_by_account_asset RESTART IDENTITY CASCADE;
       TRUNCATE TABLE setting RESTART IDENTITY CASCADE;
     )";
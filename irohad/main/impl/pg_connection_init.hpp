@@ -13,6 +13,7 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/range/algorithm/replace_if.hpp>
 
+#include "ametsuchi/impl/amount_storage_mode.hpp"
 #include "ametsuchi/impl/failover_callback_holder.hpp"
 #include "ametsuchi/impl/postgres_command_executor.hpp"
 #include "ametsuchi/impl/postgres_options.hpp"
@@ -45,6 +46,12 @@ namespace iroha {
        */
       static bool preparedTransactionsAvailable(soci::session &sql);
 
+      /**
+       * Get the balance representation of account_has_asset table.
+       * @param sql - session to the working database with prepared tables
+       */
+      static AmountStorageMode getAmountStorageMode(soci::session &sql);
+
       static iroha::expected::Result<void, std::string> rollbackPrepared(
           soci::session &sql, const std::string &prepared_block_name);
 
@@ -85,10 +92,23 @@ namespace iroha {
        */
       static expected::Result<void, std::string> resetPeers(soci::session &sql);
 
-      /// Create tables in the given session. Left public for tests.
-      static void prepareTables(soci::session &session);
+      /**
+       * Create tables in the given session and upgrade the existing ones to
+       * the current schema version. Left public for tests.
+       * @param amount_storage_mode - balance representation used if the
+       * tables do not exist yet
+       */
+      static void prepareTables(
+          soci::session &session,
+          AmountStorageMode amount_storage_mode = AmountStorageMode::kDecimal);
 
      private:
+      /**
+       * Fill the tables added since the schema version of the database. Runs
+       * once per version, since the version is stored in schema_version.
+       */
+      static void upgradeSchema(soci::session &session);
+
       /**
        * Function initializes existing connection pool
        * @param connection_pool - pool with connections
@@ -100,6 +120,7 @@ namespace iroha {
        * for each connection
        * @param pg_reconnection_options - parameter of connection startup on
        * reconnect
+       * @param amount_storage_mode - balance representation for new tables
        * @param log_manager - log manager of storage
        * @tparam RollbackFunction - type of rollback function
        */
@@ -111,6 +132,7 @@ namespace iroha {
           FailoverCallbackHolder &callback_factory,
           const ReconnectionStrategyFactory &reconnection_strategy_factory,
           const std::string &pg_reconnection_options,
+          AmountStorageMode amount_storage_mode,
           logger::LoggerManagerTreePtr log_manager);
     };
   }  // namespace ametsuchi
@@ -25,17 +25,28 @@ namespace config_members {
   const char *Password = "password";
   const char *WorkingDbName = "working database";
   const char *MaintenanceDbName = "maintenance database";
+  const char *IntegerAmounts = "integer amounts";
   const char *MaxProposalSize = "max_proposal_size";
   const char *ProposalDelay = "proposal_delay";
   const char *VoteDelay = "vote_delay";
+  const char *AdaptiveVoteDelay = "adaptive_vote_delay";
+  const char *YacCommitCertificates = "yac_commit_certificates";
   const char *MstSupport = "mst_enable";
   const char *MstExpirationTime = "mst_expiration_time";
+  const char *MstStatePath = "mst_state_path";
+  const char *MstStateLog = "mst_state_log";
+  const char *GroupCommitDelay = "group_commit_delay_ms";
+  const char *MinCompactionSize = "min_compaction_bytes";
+  const char *CompactionRatio = "compaction_ratio";
   const char *MaxRoundsDelay = "max_rounds_delay";
   const char *StaleStreamMaxRounds = "stale_stream_max_rounds";
   const char *LogSection = "log";
   const char *LogLevel = "level";
   const char *LogPatternsSection = "patterns";
   const char *LogChildrenSection = "children";
+  const char *LogAsyncSection = "async";
+  const char *QueueSize = "queue_size";
+  const char *Overflow = "overflow";
   const std::unordered_map<std::string, logger::LogLevel> LogLevels{
       {"trace", logger::LogLevel::kTrace},
       {"debug", logger::LogLevel::kDebug},
@@ -46,5 +57,13 @@ namespace config_members {
   const char *Address = "address";
   const char *PublicKey = "public_key";
   const char *InitialPeers = "initial_peers";
+  const char *Metrics = "metrics";
+  const char *TxTracing = "tx_tracing";
+  const char *SampleRate = "sample_rate";
+  const char *Format = "format";
+  const char *HotKeys = "hot_keys";
+  const char *TopK = "top_k";
+  const char *SketchWidth = "sketch_width";
+  const char *SketchDepth = "sketch_depth";
   const char *TlsCertificatePath = "tls_certificate_path";
 }  // namespace config_members
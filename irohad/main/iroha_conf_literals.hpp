@@ -31,19 +31,38 @@ namespace config_members {
   extern const char *Password;
   extern const char *WorkingDbName;
   extern const char *MaintenanceDbName;
+  extern const char *IntegerAmounts;
   extern const char *MaxProposalSize;
   extern const char *ProposalDelay;
   extern const char *VoteDelay;
+  extern const char *AdaptiveVoteDelay;
+  extern const char *YacCommitCertificates;
   extern const char *MstSupport;
   extern const char *MstExpirationTime;
+  extern const char *MstStatePath;
+  extern const char *MstStateLog;
+  extern const char *GroupCommitDelay;
+  extern const char *MinCompactionSize;
+  extern const char *CompactionRatio;
   extern const char *MaxRoundsDelay;
   extern const char *StaleStreamMaxRounds;
   extern const char *LogSection;
   extern const char *LogLevel;
   extern const char *LogPatternsSection;
   extern const char *LogChildrenSection;
+  extern const char *LogAsyncSection;
+  extern const char *QueueSize;
+  extern const char *Overflow;
   extern const std::unordered_map<std::string, logger::LogLevel> LogLevels;
   extern const char *InitialPeers;
+  extern const char *Metrics;
+  extern const char *TxTracing;
+  extern const char *SampleRate;
+  extern const char *Format;
+  extern const char *HotKeys;
+  extern const char *TopK;
+  extern const char *SketchWidth;
+  extern const char *SketchDepth;
   extern const char *Address;
   extern const char *PublicKey;
   extern const char *TlsCertificatePath;
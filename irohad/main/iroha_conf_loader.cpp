@@ -17,6 +17,7 @@
 #include "common/files.hpp"
 #include "common/result.hpp"
 #include "cryptography/public_key.hpp"
+#include "logger/async_log_writer.hpp"
 #include "main/iroha_conf_literals.hpp"
 #include "torii/tls_params.hpp"
 
@@ -314,6 +315,28 @@ inline void JsonDeserializerImpl::getVal<logger::LogPatterns>(
   }
 }
 
+template <>
+inline void JsonDeserializerImpl::getVal<logger::AsyncLogWriter::Options>(
+    const std::string &path,
+    logger::AsyncLogWriter::Options &dest,
+    const rapidjson::Value &src) {
+  assert_fatal(src.IsObject(), path + " must be a dictionary");
+  const auto obj = src.GetObject();
+  tryGetValByKey(path, dest.capacity, obj, config_members::QueueSize);
+  assert_fatal(dest.capacity > 0,
+               sublevelPath(path, config_members::QueueSize)
+                   + " must be positive");
+  std::string overflow;
+  if (tryGetValByKey(path, overflow, obj, config_members::Overflow)) {
+    assert_fatal(overflow == "block" or overflow == "drop",
+                 sublevelPath(path, config_members::Overflow)
+                     + " must be either 'block' or 'drop'");
+    dest.overflow = overflow == "block"
+        ? logger::AsyncLogWriter::OverflowPolicy::kBlock
+        : logger::AsyncLogWriter::OverflowPolicy::kDrop;
+  }
+}
+
 template <>
 inline void
 JsonDeserializerImpl::getVal<std::unique_ptr<logger::LoggerManagerTree>>(
@@ -324,6 +347,12 @@ JsonDeserializerImpl::getVal<std::unique_ptr<logger::LoggerManagerTree>>(
   logger::LoggerConfig root_config{logger::kDefaultLogLevel,
                                    logger::LogPatterns{}};
   updateLoggerConfig(path, root_config, src.GetObject());
+  // the writer thread is shared by the whole tree
+  if (auto async_options = getOptValByKey<logger::AsyncLogWriter::Options>(
+          path, src.GetObject(), config_members::LogAsyncSection)) {
+    root_config.async_writer =
+        std::make_shared<logger::AsyncLogWriter>(*async_options);
+  }
   dest = std::make_unique<logger::LoggerManagerTree>(
       std::make_shared<const logger::LoggerConfig>(std::move(root_config)));
   addChildrenLoggerConfigs(path, *dest, src.GetObject());
@@ -415,6 +444,58 @@ JsonDeserializerImpl::getVal<IrohadConfig::InterPeerTls::PeerCertProvider>(
   }
 }
 
+template <>
+inline void JsonDeserializerImpl::getVal<IrohadConfig::TxTracing>(
+    const std::string &path,
+    IrohadConfig::TxTracing &dest,
+    const rapidjson::Value &src) {
+  assert_fatal(src.IsObject(), path + " must be a dictionary");
+  const auto obj = src.GetObject();
+  getValByKey(path, dest.sample_rate, obj, config_members::SampleRate);
+  getValByKey(path, dest.path, obj, config_members::Path);
+  getValByKey(path, dest.format, obj, config_members::Format);
+}
+
+template <>
+inline void JsonDeserializerImpl::getVal<IrohadConfig::MstStateLog>(
+    const std::string &path,
+    IrohadConfig::MstStateLog &dest,
+    const rapidjson::Value &src) {
+  assert_fatal(src.IsObject(), path + " must be a dictionary");
+  const auto obj = src.GetObject();
+  getValByKey(path,
+              dest.group_commit_delay_ms,
+              obj,
+              config_members::GroupCommitDelay);
+  getValByKey(path,
+              dest.min_compaction_size,
+              obj,
+              config_members::MinCompactionSize);
+  getValByKey(
+      path, dest.compaction_ratio, obj, config_members::CompactionRatio);
+  assert_fatal(not dest.compaction_ratio or *dest.compaction_ratio > 0,
+               sublevelPath(path, config_members::CompactionRatio)
+                   + " must be positive");
+}
+
+template <>
+inline void JsonDeserializerImpl::getVal<IrohadConfig::HotKeys>(
+    const std::string &path,
+    IrohadConfig::HotKeys &dest,
+    const rapidjson::Value &src) {
+  assert_fatal(src.IsObject(), path + " must be a dictionary");
+  const auto obj = src.GetObject();
+  getValByKey(path, dest.top_k, obj, config_members::TopK);
+  getValByKey(path, dest.sketch_width, obj, config_members::SketchWidth);
+  assert_fatal(not dest.sketch_width or *dest.sketch_width > 0,
+               sublevelPath(path, config_members::SketchWidth)
+                   + " must be positive");
+  getValByKey(path, dest.sketch_depth, obj, config_members::SketchDepth);
+  assert_fatal(not dest.sketch_depth or *dest.sketch_depth > 0,
+               sublevelPath(path, config_members::SketchDepth)
+                   + " must be positive");
+}
+
 template <>
 inline void JsonDeserializerImpl::getVal<IrohadConfig::DbConfig>(
     const std::string &path,
@@ -430,6 +511,8 @@ inline void JsonDeserializerImpl::getVal<IrohadConfig::DbConfig>(
   getValByKey(path, dest.working_dbname, obj, config_members::WorkingDbName);
   getValByKey(
       path, dest.maintenance_dbname, obj, config_members::MaintenanceDbName);
+  getValByKey(
+      path, dest.integer_amounts, obj, config_members::IntegerAmounts);
 }
 
 template <>
@@ -449,9 +532,17 @@ inline void JsonDeserializerImpl::getVal<IrohadConfig>(
       path, dest.max_proposal_size, obj, config_members::MaxProposalSize);
   getValByKey(path, dest.proposal_delay, obj, config_members::ProposalDelay);
   getValByKey(path, dest.vote_delay, obj, config_members::VoteDelay);
+  getValByKey(
+      path, dest.adaptive_vote_delay, obj, config_members::AdaptiveVoteDelay);
+  getValByKey(path,
+              dest.yac_commit_certificates,
+              obj,
+              config_members::YacCommitCertificates);
   getValByKey(path, dest.mst_support, obj, config_members::MstSupport);
   getValByKey(
       path, dest.mst_expiration_time, obj, config_members::MstExpirationTime);
+  getValByKey(path, dest.mst_state_path, obj, config_members::MstStatePath);
+  getValByKey(path, dest.mst_state_log, obj, config_members::MstStateLog);
   getValByKey(
       path, dest.max_round_delay_ms, obj, config_members::MaxRoundsDelay);
   getValByKey(path,
@@ -460,6 +551,9 @@ inline void JsonDeserializerImpl::getVal<IrohadConfig>(
               config_members::StaleStreamMaxRounds);
   getValByKey(path, dest.logger_manager, obj, config_members::LogSection);
   getValByKey(path, dest.initial_peers, obj, config_members::InitialPeers);
+  getValByKey(path, dest.metrics, obj, config_members::Metrics);
+  getValByKey(path, dest.tx_tracing, obj, config_members::TxTracing);
+  getValByKey(path, dest.hot_keys, obj, config_members::HotKeys);
 }
 
 // ------------ end of getVal(path, dst, src) specializations ------------
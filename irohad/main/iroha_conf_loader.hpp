@@ -23,6 +23,7 @@ struct IrohadConfig {
     std::string password;
     std::string working_dbname;
     std::string maintenance_dbname;
+    boost::optional<bool> integer_amounts;
   };
 
   struct InterPeerTls {
@@ -37,6 +38,33 @@ struct IrohadConfig {
     PeerCertProvider peer_certificates;
   };
 
+  struct TxTracing {
+    uint32_t sample_rate;
+    /// file the traces are written to on shutdown
+    std::string path;
+    /// "chrome" for Chrome trace event format, "json" for plain JSON
+    boost::optional<std::string> format;
+  };
+
+  struct MstStateLog {
+    /// how long the writer waits for more records before a write
+    boost::optional<uint32_t> group_commit_delay_ms;
+    /// file size, below which the file is not compacted
+    boost::optional<size_t> min_compaction_size;
+    /// the file is compacted when it is that many times larger than the
+    /// live records
+    boost::optional<size_t> compaction_ratio;
+  };
+
+  struct HotKeys {
+    /// most accessed keys kept for each phase, access and kind of key
+    size_t top_k;
+    /// counters in each row of the count-min sketch
+    boost::optional<size_t> sketch_width;
+    /// rows of the count-min sketch, each with an own hash
+    boost::optional<size_t> sketch_depth;
+  };
+
   // TODO: block_store_path is now optional, change docs IR-576
   // luckychess 29.06.2019
   boost::optional<std::string> block_store_path;
@@ -51,12 +79,19 @@ struct IrohadConfig {
   uint32_t max_proposal_size;
   uint32_t proposal_delay;
   uint32_t vote_delay;
+  boost::optional<bool> adaptive_vote_delay;
+  boost::optional<bool> yac_commit_certificates;
   bool mst_support;
   boost::optional<uint32_t> mst_expiration_time;
+  boost::optional<std::string> mst_state_path;
+  boost::optional<MstStateLog> mst_state_log;
   boost::optional<uint32_t> max_round_delay_ms;
   boost::optional<uint32_t> stale_stream_max_rounds;
   boost::optional<logger::LoggerManagerTreePtr> logger_manager;
   boost::optional<shared_model::interface::types::PeerList> initial_peers;
+  boost::optional<std::string> metrics;
+  boost::optional<TxTracing> tx_tracing;
+  boost::optional<HotKeys> hot_keys;
 };
 
 /**
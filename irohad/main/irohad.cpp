@@ -23,6 +23,10 @@
 #include "main/iroha_conf_literals.hpp"
 #include "main/iroha_conf_loader.hpp"
 #include "main/raw_block_loader.hpp"
+#include "metrics/metrics.hpp"
+#include "metrics/metrics_server.hpp"
+#include "tracing/hot_key_tracker.hpp"
+#include "tracing/tx_tracer.hpp"
 #include "validators/field_validator.hpp"
 
 static const std::string kListenIp = "0.0.0.0";
@@ -192,7 +196,10 @@ int main(int argc, char *argv[]) {
         config.database_config->password,
         config.database_config->working_dbname,
         config.database_config->maintenance_dbname,
-        log);
+        log,
+        config.database_config->integer_amounts.value_or(false)
+            ? iroha::ametsuchi::AmountStorageMode::kScaledInteger
+            : iroha::ametsuchi::AmountStorageMode::kDecimal);
   } else if (config.pg_opt) {
     log->warn("Using deprecated database connection string!");
     pg_opt = std::make_unique<iroha::ametsuchi::PostgresOptions>(
@@ -202,6 +209,37 @@ int main(int argc, char *argv[]) {
     return EXIT_FAILURE;
   }
 
+  bool chrome_trace_format = true;
+  if (config.tx_tracing) {
+    const auto format = config.tx_tracing->format.value_or("chrome");
+    if (format != "chrome" and format != "json") {
+      log->critical("Unknown transaction trace format '{}'", format);
+      return EXIT_FAILURE;
+    }
+    chrome_trace_format = format == "chrome";
+    iroha::tracing::TxTracer::Options tracing_options;
+    tracing_options.sample_rate = config.tx_tracing->sample_rate;
+    iroha::tracing::defaultTracer().configure(tracing_options);
+  }
+
+  iroha::metrics::Registry::CollectorHandle hot_keys_collector;
+  iroha::metrics::MetricsServer::JsonPages metrics_pages;
+  if (config.hot_keys) {
+    iroha::tracing::HotKeyTracker::Options hot_keys_options;
+    hot_keys_options.top_k = config.hot_keys->top_k;
+    hot_keys_options.sketch_width = config.hot_keys->sketch_width.value_or(
+        hot_keys_options.sketch_width);
+    hot_keys_options.sketch_depth = config.hot_keys->sketch_depth.value_or(
+        hot_keys_options.sketch_depth);
+    auto &tracker = iroha::tracing::defaultHotKeyTracker();
+    tracker.configure(hot_keys_options);
+    hot_keys_collector = iroha::metrics::defaultRegistry().addCollector(
+        [&tracker](iroha::metrics::Writer &writer) {
+          tracker.collect(writer);
+        });
+    metrics_pages.emplace("/hot_keys", [&tracker] { return tracker.toJson(); });
+  }
+
   // Configuring iroha daemon
   Irohad irohad(
       config.block_store_path,
@@ -223,7 +261,12 @@ int main(int argc, char *argv[]) {
       log_manager->getChild("Irohad"),
       boost::make_optional(config.mst_support,
                            iroha::GossipPropagationStrategyParams{}),
-      config.torii_tls_params);
+      config.torii_tls_params,
+      boost::none,
+      config.adaptive_vote_delay.value_or(false),
+      config.mst_state_path,
+      config.yac_commit_certificates.value_or(false),
+      config.mst_state_log);
 
   // Check if iroha daemon storage was successfully initialized
   if (not irohad.storage) {
@@ -337,6 +380,21 @@ int main(int argc, char *argv[]) {
     return EXIT_FAILURE;
   }
 
+  // serve metrics, declared after irohad to stop before its components
+  std::unique_ptr<iroha::metrics::MetricsServer> metrics_server;
+  if (config.metrics) {
+    auto server = iroha::metrics::MetricsServer::create(
+        *config.metrics,
+        iroha::metrics::defaultRegistry(),
+        log_manager->getChild("Metrics")->getLogger(),
+        std::move(metrics_pages));
+    if (auto error = iroha::expected::resultToOptionalError(server)) {
+      log->critical("Irohad startup failed: {}", *error);
+      return EXIT_FAILURE;
+    }
+    metrics_server = std::move(server).assumeValue();
+  }
+
   auto handler = [](int s) { exit_requested.set_value(); };
   std::signal(SIGINT, handler);
   std::signal(SIGTERM, handler);
@@ -358,6 +416,17 @@ int main(int argc, char *argv[]) {
   // They do all necessary work in their destructors
   log->info("shutting down...");
 
+  if (config.tx_tracing) {
+    const auto &tracer = iroha::tracing::defaultTracer();
+    std::ofstream trace_file(config.tx_tracing->path);
+    trace_file << (chrome_trace_format ? tracer.toChromeTrace()
+                                       : tracer.toJson());
+    if (not trace_file) {
+      log->error("Failed to write transaction traces to {}",
+                 config.tx_tracing->path);
+    }
+  }
+
   gflags::ShutDownCommandLineFlags();
 
   return 0;
@@ -86,13 +86,13 @@ namespace iroha {
   // -------------------| MstTransportNotification override |-------------------
 
   void FairMstProcessor::onNewState(const shared_model::crypto::PublicKey &from,
-                                    MstState new_state) {
+                                    MstGossip gossip) {
     log_->info("Applying new state");
     auto current_time = time_provider_->getCurrentTime();
 
     // no need to add already expired batches to local state
-    new_state.eraseExpired(current_time);
-    auto state_update = storage_->apply(from, new_state);
+    gossip.batches.eraseExpired(current_time);
+    auto state_update = storage_->apply(from, gossip);
 
     // updated batches
     updatedBatchesNotify(*state_update.updated_state_);
@@ -116,11 +116,19 @@ namespace iroha {
     std::for_each(data.begin(),
                   data.end(),
                   [this, &current_time, size](const auto &dst_peer) {
-                    auto diff = storage_->getDiffState(dst_peer->pubkey(),
-                                                       current_time);
-                    if (not diff.isEmpty()) {
+                    auto diff = std::make_shared<MstGossip>(
+                        storage_->getDiffState(dst_peer->pubkey(),
+                                               current_time));
+                    if (not diff->isEmpty()) {
                       log_->info("Propagate new data[{}]", size);
-                      transport_->sendState(*dst_peer, diff);
+                      transport_->sendState(
+                          *dst_peer,
+                          *diff,
+                          [storage = storage_,
+                           key = dst_peer->pubkey(),
+                           diff](bool delivered) {
+                            storage->gossipSent(key, *diff, delivered);
+                          });
                     }
                   });
   }
@@ -0,0 +1,60 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "multi_sig_transactions/state/mst_gossip.hpp"
+
+#include <algorithm>
+
+#include "interfaces/transaction.hpp"
+
+namespace iroha {
+
+  SignerKey signerKey(const shared_model::crypto::PublicKey &public_key) {
+    return shared_model::crypto::toBinaryString(public_key);
+  }
+
+  BatchSigners batchSigners(
+      const shared_model::interface::TransactionBatch &batch) {
+    BatchSigners signers;
+    signers.reserve(boost::size(batch.transactions()));
+    for (const auto &tx : batch.transactions()) {
+      signers.emplace_back();
+      for (const auto &signature : tx->signatures()) {
+        signers.back().insert(signerKey(signature.publicKey()));
+      }
+    }
+    return signers;
+  }
+
+  bool mergeSigners(BatchSigners &target, const BatchSigners &source) {
+    if (target.size() < source.size()) {
+      target.resize(source.size());
+    }
+    auto inserted = false;
+    for (size_t i = 0; i < source.size(); ++i) {
+      for (const auto &signer : source[i]) {
+        inserted = target[i].insert(signer).second or inserted;
+      }
+    }
+    return inserted;
+  }
+
+  BatchSigners BatchSignatures::signers() const {
+    BatchSigners signers(transactions.size());
+    for (size_t i = 0; i < transactions.size(); ++i) {
+      for (const auto &signature : transactions[i]) {
+        signers[i].insert(signerKey(signature.public_key));
+      }
+    }
+    return signers;
+  }
+
+  MstGossip::MstGossip(MstState batches) : batches(std::move(batches)) {}
+
+  bool MstGossip::isEmpty() const {
+    return batches.isEmpty() and signatures.empty();
+  }
+
+}  // namespace iroha
@@ -6,6 +6,7 @@
 #include "multi_sig_transactions/state/mst_state.hpp"
 
 #include <numeric>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -15,12 +16,58 @@
 #include <boost/range/algorithm/find.hpp>
 #include <boost/range/combine.hpp>
 #include "common/set.hpp"
+#include "cryptography/blob_hasher.hpp"
+#include "cryptography/crypto_provider/crypto_verifier.hpp"
 #include "interfaces/transaction.hpp"
 #include "logger/logger.hpp"
+#include "multi_sig_transactions/state/mst_gossip.hpp"
 
 namespace {
-  shared_model::interface::types::TimestampType oldestTimestamp(
-      const iroha::BatchPtr &batch) {
+  /**
+   * Verify signatures and add them to the transactions of the batch
+   * @param target - batch for inserting
+   * @param signatures - signatures of the batch transactions
+   * @param log - logger for rejected signatures
+   * @return true if at least one new signature was inserted
+   */
+  bool addSignaturesToBatch(const iroha::DataType &target,
+                            const iroha::BatchSignatures &signatures,
+                            const logger::LoggerPtr &log) {
+    auto inserted_new_signatures = false;
+    const auto &transactions = target->transactions();
+    const auto size =
+        std::min(transactions.size(), signatures.transactions.size());
+    for (size_t i = 0; i < size; ++i) {
+      const auto &tx = transactions[i];
+      for (const auto &signature : signatures.transactions[i]) {
+        const auto has_signature = std::any_of(
+            tx->signatures().begin(),
+            tx->signatures().end(),
+            [&signature](const auto &tx_signature) {
+              return tx_signature.publicKey() == signature.public_key;
+            });
+        if (has_signature) {
+          continue;
+        }
+        if (not shared_model::crypto::CryptoVerifier<>::verify(
+                signature.signed_data, tx->payload(), signature.public_key)) {
+          log->warn("Rejected signature of transaction {} by {}",
+                    tx->hash().hex(),
+                    signature.public_key.hex());
+          continue;
+        }
+        inserted_new_signatures =
+            tx->addSignature(signature.signed_data, signature.public_key)
+            or inserted_new_signatures;
+      }
+    }
+    return inserted_new_signatures;
+  }
+}  // namespace
+
+namespace iroha {
+
+  TimeType oldestTimestamp(const DataType &batch) {
     const bool batch_is_empty = boost::empty(batch->transactions());
     assert(not batch_is_empty);
     if (batch_is_empty) {
@@ -36,9 +83,6 @@ namespace {
     assert(min_it != timestamps.end());
     return min_it == timestamps.end() ? 0 : *min_it;
   }
-}  // namespace
-
-namespace iroha {
 
   bool BatchHashEquality::operator()(const DataType &left_tx,
                                      const DataType &right_tx) const {
@@ -56,11 +100,9 @@ namespace iroha {
                        });
   }
 
-  bool DefaultCompleter::isExpired(const DataType &batch,
-                                   const TimeType &current_time) const {
-    return oldestTimestamp(batch)
-        + expiration_time_ / std::chrono::milliseconds(1)
-        < current_time;
+  TimeType DefaultCompleter::expirationTime(
+      const TimeType &oldest_timestamp) const {
+    return oldest_timestamp + expiration_time_ / std::chrono::milliseconds(1);
   }
 
   // ------------------------------| public api |-------------------------------
@@ -88,6 +130,51 @@ namespace iroha {
     return state_update;
   }
 
+  void MstState::addSignatures(const std::vector<BatchSignatures> &signatures,
+                               StateUpdateResult &state_update) {
+    if (signatures.empty()) {
+      return;
+    }
+    std::unordered_map<shared_model::interface::types::HashType,
+                       DataType,
+                       shared_model::crypto::BlobHasher>
+        batches_by_hash;
+    for (const auto &batch : batches_.right | boost::adaptors::map_keys) {
+      batches_by_hash.emplace(batch->reducedHash(), batch);
+    }
+
+    for (const auto &batch_signatures : signatures) {
+      auto it = batches_by_hash.find(batch_signatures.reduced_hash);
+      if (it == batches_by_hash.end()) {
+        // the batch was completed or has expired since the sender saw it
+        log_->debug("No batch {} for received signatures",
+                    batch_signatures.reduced_hash.hex());
+        continue;
+      }
+      addSignatures(it->second, batch_signatures, state_update);
+      if (not contains(it->second)) {
+        batches_by_hash.erase(it);
+      }
+    }
+  }
+
+  void MstState::addSignatures(const DataType &batch,
+                               const BatchSignatures &signatures,
+                               StateUpdateResult &state_update) {
+    if (not contains(batch)
+        or not addSignaturesToBatch(batch, signatures, log_)) {
+      return;
+    }
+
+    if (completer_->isCompleted(batch)) {
+      batches_.right.erase(batch);
+      state_update.updated_state_->batches_.right.erase(batch);
+      state_update.completed_state_->rawInsert(batch);
+    } else {
+      state_update.updated_state_->rawInsert(batch);
+    }
+  }
+
   MstState MstState::operator-(const MstState &rhs) const {
     const auto &my_batches = batches_.right | boost::adaptors::map_keys;
     std::vector<DataType> difference;
@@ -199,12 +286,23 @@ namespace iroha {
     return batches_.right.find(element) != batches_.right.end();
   }
 
+  boost::optional<TimeType> MstState::expirationTime(
+      const DataType &batch) const {
+    auto it = batches_.right.find(batch);
+    if (it == batches_.right.end()) {
+      return boost::none;
+    }
+    return completer_->expirationTime(it->second);
+  }
+
   void MstState::extractExpiredImpl(const TimeType &current_time,
                                     boost::optional<MstState &> extracted) {
+    // batches are ordered by the oldest timestamp, so only the expired ones
+    // are visited, and their timestamps are taken from the index
     for (auto it = batches_.left.begin(); it != batches_.left.end()
-         and completer_->isExpired(it->second, current_time);) {
+         and completer_->expirationTime(it->first) < current_time;) {
       if (extracted) {
-        *extracted += it->second;
+        extracted->batches_.insert({it->first, it->second});
       }
       it = batches_.left.erase(it);
       assert(it == batches_.left.begin());
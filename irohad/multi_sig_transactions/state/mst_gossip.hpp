@@ -0,0 +1,102 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_MST_GOSSIP_HPP
+#define IROHA_MST_GOSSIP_HPP
+
+#include <cstdint>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "cryptography/public_key.hpp"
+#include "cryptography/signed.hpp"
+#include "interfaces/common_objects/types.hpp"
+#include "multi_sig_transactions/state/mst_state.hpp"
+
+namespace iroha {
+
+  /**
+   * Signatory of a transaction: its public key in binary form. It is used to
+   * tell the signatures, which peers have, without sending the signatures.
+   * The whole key is used, so that signers are never mistaken for each other
+   * and a signature is never withheld from a peer which lacks it.
+   */
+  using SignerKey = std::string;
+
+  SignerKey signerKey(const shared_model::crypto::PublicKey &public_key);
+
+  /// Signers of each transaction of a batch, in the order of the batch
+  using BatchSigners = std::vector<std::set<SignerKey>>;
+
+  /// @return signers of the batch transactions
+  BatchSigners batchSigners(
+      const shared_model::interface::TransactionBatch &batch);
+
+  /**
+   * Add signers to the target
+   * @return true, if at least one of them was not in the target
+   */
+  bool mergeSigners(BatchSigners &target, const BatchSigners &source);
+
+  /// Signature which is not attached to a transaction
+  struct DetachedSignature {
+    shared_model::crypto::PublicKey public_key;
+    shared_model::crypto::Signed signed_data;
+  };
+
+  /// Signatures of the transactions of a batch, which the recipient has
+  struct BatchSignatures {
+    shared_model::interface::types::HashType reduced_hash;
+    /// signatures of each transaction, in the order of the batch
+    std::vector<std::vector<DetachedSignature>> transactions;
+
+    /// @return signers of the signatures
+    BatchSigners signers() const;
+  };
+
+  /// Signers of a batch, which are not sent as signatures
+  struct BatchSummary {
+    shared_model::interface::types::HashType reduced_hash;
+    BatchSigners signers;
+  };
+
+  /**
+   * Message of MST propagation. A peer gets full batches only when it has
+   * not seen them, otherwise it gets only the signatures which it lacks.
+   * Summaries tell the peer about the signatures of the sender, so that the
+   * peer does not send them back.
+   */
+  struct MstGossip {
+    explicit MstGossip(MstState batches);
+
+    /// batches which the recipient has not seen
+    MstState batches;
+    /// new signatures of batches which the recipient has
+    std::vector<BatchSignatures> signatures;
+    /// signatures of the sender, which the recipient does not know about
+    std::vector<BatchSummary> summaries;
+    /**
+     * signers of the batches as of making the gossip, which stay what the
+     * recipient gets, while the batches get more signatures in place. They
+     * are not sent.
+     */
+    std::vector<BatchSummary> batch_signers;
+    /**
+     * whether the sender reads signatures and summaries. Peers, which do
+     * not, get whole batches.
+     */
+    bool compact_sender = false;
+
+    /**
+     * @return true, if there are neither batches nor signatures. Summaries
+     * alone are not worth sending.
+     */
+    bool isEmpty() const;
+  };
+
+}  // namespace iroha
+
+#endif  // IROHA_MST_GOSSIP_HPP
@@ -39,17 +39,22 @@ namespace iroha {
     virtual bool isCompleted(const DataType &batch) const = 0;
 
     /**
-     * Check whether the batch has expired
-     * @param batch - object for validation
-     * @param current_time - current time
-     * @return true, if the batch has expired
+     * Get the time after which batches expire
+     * @param oldest_timestamp - creation time of the oldest transaction of
+     * the batch
+     * @return expiration time, which is monotonic in the oldest timestamp
      */
-    virtual bool isExpired(const DataType &batch,
-                           const TimeType &current_time) const = 0;
+    virtual TimeType expirationTime(const TimeType &oldest_timestamp) const = 0;
 
     virtual ~Completer() = default;
   };
 
+  /**
+   * @param batch - batch with at least one transaction
+   * @return creation time of the oldest transaction of the batch
+   */
+  TimeType oldestTimestamp(const DataType &batch);
+
   /**
    * Class provides operator() for batch comparison
    */
@@ -77,8 +82,7 @@ namespace iroha {
 
     bool isCompleted(const DataType &batch) const override;
 
-    bool isExpired(const DataType &tx,
-                   const TimeType &current_time) const override;
+    TimeType expirationTime(const TimeType &oldest_timestamp) const override;
 
    private:
     std::chrono::minutes expiration_time_;
@@ -86,6 +90,8 @@ namespace iroha {
 
   using CompleterType = std::shared_ptr<const Completer>;
 
+  struct BatchSignatures;
+
   class MstState {
    public:
     // -----------------------------| public api |------------------------------
@@ -113,6 +119,29 @@ namespace iroha {
      */
     StateUpdateResult operator+=(const MstState &rhs);
 
+    /**
+     * Add signatures to the batches of the state. Signatures of batches
+     * which are not in the state and signatures which fail verification are
+     * skipped.
+     * @param signatures - signatures of batches
+     * @param state_update - states where completed and updated batches are
+     * put
+     */
+    void addSignatures(const std::vector<BatchSignatures> &signatures,
+                       StateUpdateResult &state_update);
+
+    /**
+     * Add signatures to a batch of the state, which the caller has already
+     * found by the hash of the signatures
+     * @param batch - batch of the state
+     * @param signatures - signatures of the batch
+     * @param state_update - states where completed and updated batches are
+     * put
+     */
+    void addSignatures(const DataType &batch,
+                       const BatchSignatures &signatures,
+                       StateUpdateResult &state_update);
+
     /**
      * Operator provide difference between this and rhs operator
      * @param rhs, state for removing
@@ -156,6 +185,13 @@ namespace iroha {
      */
     bool contains(const DataType &element) const;
 
+    /**
+     * Get expiration time of a batch from the index of the state
+     * @param batch - batch of the state
+     * @return expiration time, or none if the state does not contain the batch
+     */
+    boost::optional<TimeType> expirationTime(const DataType &batch) const;
+
     /// Apply visitor to all batches.
     template <typename Visitor>
     inline void iterateBatches(const Visitor &visitor) const {
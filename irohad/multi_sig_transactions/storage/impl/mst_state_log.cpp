@@ -0,0 +1,581 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "multi_sig_transactions/storage/mst_state_log.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include <fmt/core.h>
+#include <boost/crc.hpp>
+#include <boost/filesystem.hpp>
+#include "ametsuchi/tx_presence_cache.hpp"
+#include "backend/protobuf/transaction.hpp"
+#include "common/files.hpp"
+#include "common/visitor.hpp"
+#include "endpoint.pb.h"
+#include "interfaces/iroha_internal/parse_and_create_batches.hpp"
+#include "interfaces/iroha_internal/transaction_batch.hpp"
+#include "logger/logger.hpp"
+#include "multi_sig_transactions/state/mst_state.hpp"
+
+using namespace iroha;
+
+namespace {
+  /**
+   * Record frame: the marker, body size, CRC-32 of the body and CRC-32 of
+   * the preceding header fields, all 4 bytes little endian, followed by the
+   * body. Body is the record type, the size of the reduced hash in one byte,
+   * the hash and, for updates, serialized TxList.
+   *
+   * The marker lets the load find the next record after a corrupted one
+   * without probing every byte, and the header checksum rejects a bogus
+   * body size before the body is read.
+   */
+  const std::string kFrameMarker = "MSL1";
+  const size_t kHeaderSize = 16;
+
+  enum RecordType : uint8_t { kUpdate = 1, kRemove = 2 };
+
+  void putUint32(std::string &buffer, uint32_t value) {
+    for (size_t i = 0; i < 4; ++i) {
+      buffer.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
+  }
+
+  uint32_t getUint32(const uint8_t *data) {
+    uint32_t value = 0;
+    for (size_t i = 0; i < 4; ++i) {
+      value |= static_cast<uint32_t>(data[i]) << (8 * i);
+    }
+    return value;
+  }
+
+  uint32_t checksum(const char *data, size_t size) {
+    boost::crc_32_type crc;
+    crc.process_bytes(data, size);
+    return crc.checksum();
+  }
+
+  std::string makeFrame(RecordType type,
+                        const shared_model::interface::types::HashType &hash,
+                        const std::string &payload) {
+    std::string body;
+    body.reserve(2 + hash.size() + payload.size());
+    body.push_back(static_cast<char>(type));
+    body.push_back(static_cast<char>(hash.size()));
+    body.append(reinterpret_cast<const char *>(hash.blob().data()),
+                hash.size());
+    body.append(payload);
+
+    std::string frame;
+    frame.reserve(kHeaderSize + body.size());
+    frame.append(kFrameMarker);
+    putUint32(frame, body.size());
+    putUint32(frame, checksum(body.data(), body.size()));
+    putUint32(frame, checksum(frame.data(), frame.size()));
+    frame.append(body);
+    return frame;
+  }
+
+  /**
+   * @return size of the frame with the header, which starts at the offset,
+   * or none if there is no valid frame
+   */
+  boost::optional<size_t> frameSize(const std::vector<uint8_t> &contents,
+                                    size_t offset) {
+    if (contents.size() - offset < kHeaderSize) {
+      return boost::none;
+    }
+    const auto header = contents.data() + offset;
+    if (not std::equal(kFrameMarker.begin(), kFrameMarker.end(), header)
+        or checksum(reinterpret_cast<const char *>(header), 12)
+            != getUint32(header + 12)) {
+      return boost::none;
+    }
+    const auto body_size = getUint32(header + 4);
+    const auto body = header + kHeaderSize;
+    if (body_size < 2 or contents.size() - offset - kHeaderSize < body_size
+        or body[1] + 2u > body_size
+        or (body[0] != kUpdate and body[0] != kRemove)
+        or checksum(reinterpret_cast<const char *>(body), body_size)
+            != getUint32(header + 8)) {
+      return boost::none;
+    }
+    return kHeaderSize + body_size;
+  }
+
+  /// @return offset of the next frame marker after the offset, or the size
+  /// of the contents if there is none
+  size_t nextMarker(const std::vector<uint8_t> &contents, size_t offset) {
+    return std::search(contents.begin() + offset + 1,
+                       contents.end(),
+                       kFrameMarker.begin(),
+                       kFrameMarker.end())
+        - contents.begin();
+  }
+
+  /// @return offset of the payload in the frame
+  size_t payloadOffset(const std::string &frame) {
+    return kHeaderSize + 2 + static_cast<uint8_t>(frame[kHeaderSize + 1]);
+  }
+
+  /// @return false if the data could not be written entirely
+  bool writeAll(int fd, const std::string &data) {
+    size_t written = 0;
+    while (written < data.size()) {
+      auto result = ::write(fd, data.data() + written, data.size() - written);
+      if (result < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        return false;
+      }
+      written += result;
+    }
+    return true;
+  }
+
+  /// Make the rename of the file durable
+  void syncDirectory(const std::string &path) {
+    auto directory = boost::filesystem::path(path).parent_path();
+    if (directory.empty()) {
+      directory = ".";
+    }
+    int fd = ::open(directory.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd >= 0) {
+      ::fsync(fd);
+      ::close(fd);
+    }
+  }
+
+  /// @return the batch, or none if the record is not a valid batch
+  boost::optional<DataType> parseBatch(
+      const MstStateLog::Record &record,
+      const shared_model::proto::TransactionFactoryType &transaction_factory,
+      const shared_model::interface::TransactionBatchParser &batch_parser,
+      const shared_model::interface::TransactionBatchFactory &batch_factory,
+      const logger::LoggerPtr &log) {
+    iroha::protocol::TxList list;
+    if (not list.ParseFromString(record.transactions)) {
+      log->warn("Malformed MST state log record of batch {}",
+                record.reduced_hash.hex());
+      return boost::none;
+    }
+    auto transactions = shared_model::proto::deserializeTransactions(
+        transaction_factory, list.transactions());
+    if (auto e = expected::resultToOptionalError(transactions)) {
+      log->warn("Transaction deserialization failed: hash {}, {}",
+                e->hash,
+                e->error);
+      return boost::none;
+    }
+    auto batches = shared_model::interface::parseAndCreateBatches(
+        batch_parser, batch_factory, std::move(transactions).assumeValue());
+    if (auto e = expected::resultToOptionalError(batches)) {
+      log->warn("Batch deserialization failed: {}", *e);
+      return boost::none;
+    }
+    auto parsed = std::move(batches).assumeValue();
+    if (parsed.size() != 1
+        or parsed.front()->reducedHash() != record.reduced_hash) {
+      log->warn("MST state log record of batch {} has other transactions",
+                record.reduced_hash.hex());
+      return boost::none;
+    }
+    return DataType(std::move(parsed.front()));
+  }
+}  // namespace
+
+expected::Result<std::unique_ptr<MstStateLog>, std::string>
+MstStateLog::create(const std::string &path,
+                    Options options,
+                    logger::LoggerPtr log) {
+  std::vector<uint8_t> contents;
+  boost::system::error_code error_code;
+  if (boost::filesystem::exists(path, error_code)) {
+    auto read = readBinaryFile(path);
+    if (auto e = expected::resultToOptionalError(read)) {
+      return expected::makeError(*e);
+    }
+    contents = std::move(read).assumeValue();
+  }
+
+  LiveRecords live;
+  size_t offset = 0;
+  size_t skipped = 0;
+  while (offset < contents.size()) {
+    auto size = frameSize(contents, offset);
+    if (not size) {
+      // skip a corrupted record up to the next valid one
+      auto next = nextMarker(contents, offset);
+      while (next < contents.size() and not frameSize(contents, next)) {
+        next = nextMarker(contents, next);
+      }
+      if (next == contents.size()) {
+        break;
+      }
+      skipped += next - offset;
+      offset = next;
+      continue;
+    }
+    const auto body = contents.data() + offset + kHeaderSize;
+    shared_model::interface::types::HashType hash(
+        std::string(reinterpret_cast<const char *>(body) + 2, body[1]));
+    if (body[0] == kUpdate) {
+      live[hash] = std::string(
+          reinterpret_cast<const char *>(contents.data()) + offset, *size);
+    } else {
+      live.erase(hash);
+    }
+    offset += *size;
+  }
+  if (skipped > 0) {
+    log->warn("Skipped {} bytes of corrupted records of MST state log {}",
+              skipped,
+              path);
+  }
+  if (offset < contents.size()) {
+    // the tail was being written when the peer stopped
+    log->warn("Dropping {} bytes of incomplete records of MST state log {}",
+              contents.size() - offset,
+              path);
+    if (::truncate(path.c_str(), offset) != 0) {
+      return expected::makeError(fmt::format(
+          "Cannot truncate {}: {}", path, std::strerror(errno)));
+    }
+  }
+
+  int fd =
+      ::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+  if (fd < 0) {
+    return expected::makeError(
+        fmt::format("Cannot open {}: {}", path, std::strerror(errno)));
+  }
+  log->info("Loaded {} pending batches from MST state log {}",
+            live.size(),
+            path);
+  return std::unique_ptr<MstStateLog>(new MstStateLog(
+      path, fd, options, std::move(live), offset, std::move(log)));
+}
+
+MstStateLog::MstStateLog(std::string path,
+                         int fd,
+                         Options options,
+                         LiveRecords live,
+                         size_t file_size,
+                         logger::LoggerPtr log)
+    : path_(std::move(path)),
+      fd_(fd),
+      options_(options),
+      live_(std::move(live)),
+      live_size_(0),
+      file_size_(file_size),
+      log_(std::move(log)) {
+  for (const auto &record : live_) {
+    live_size_ += record.second.size();
+    recovered_.push_back(
+        Record{record.first,
+               record.second.substr(payloadOffset(record.second))});
+  }
+  metrics_.file_size = file_size_;
+  metrics_.live_size = live_size_;
+  writer_ = std::thread([this] { run(); });
+}
+
+MstStateLog::~MstStateLog() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  pending_cv_.notify_one();
+  writer_.join();
+  ::close(fd_);
+}
+
+const std::vector<MstStateLog::Record> &MstStateLog::recovered() const {
+  return recovered_;
+}
+
+void MstStateLog::update(const DataType &batch) {
+  iroha::protocol::TxList list;
+  for (const auto &tx : batch->transactions()) {
+    *list.add_transactions() =
+        static_cast<const shared_model::proto::Transaction &>(*tx)
+            .getTransport();
+  }
+  const auto &hash = batch->reducedHash();
+  enqueue(Pending{hash, makeFrame(kUpdate, hash, list.SerializeAsString())});
+}
+
+void MstStateLog::remove(
+    const shared_model::interface::types::HashType &reduced_hash) {
+  enqueue(Pending{reduced_hash, {}});
+}
+
+void MstStateLog::apply(const StateUpdateResult &state_update) {
+  state_update.completed_state_->iterateBatches(
+      [this](const auto &batch) { this->remove(batch->reducedHash()); });
+  state_update.updated_state_->iterateBatches(
+      [this](const auto &batch) { this->update(batch); });
+}
+
+expected::Result<void, std::string> MstStateLog::flush() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  const auto target = enqueued_;
+  const auto failures = metrics_.failures;
+  ++flush_waiters_;
+  pending_cv_.notify_one();
+  written_cv_.wait(lock, [this, target, failures] {
+    return written_ >= target or metrics_.failures != failures;
+  });
+  --flush_waiters_;
+  if (written_ < target) {
+    return expected::makeError(
+        fmt::format("{} records of MST state log {} are not written: {}",
+                    target - written_,
+                    path_,
+                    last_error_));
+  }
+  return {};
+}
+
+MstStateLog::Metrics MstStateLog::metrics() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return metrics_;
+}
+
+void MstStateLog::enqueue(Pending record) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending_.push_back(std::move(record));
+    ++enqueued_;
+    ++metrics_.records;
+  }
+  pending_cv_.notify_one();
+}
+
+void MstStateLog::run() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  auto retry_delay = options_.retry_delay;
+  while (true) {
+    auto has_records = [this] { return stop_ or not pending_.empty(); };
+    if (failed_.empty()) {
+      pending_cv_.wait(lock, has_records);
+    } else {
+      // the failed records are retried even if no new records arrive
+      pending_cv_.wait_for(lock, retry_delay, has_records);
+    }
+    if (pending_.empty() and failed_.empty()) {
+      return;
+    }
+    if (not pending_.empty()) {
+      // let the records of concurrent updates join the write
+      pending_cv_.wait_for(lock, options_.group_commit_delay, [this] {
+        return stop_ or flush_waiters_ > 0;
+      });
+    }
+    auto records = std::move(pending_);
+    pending_.clear();
+    const auto enqueued = enqueued_;
+    const auto stopping = stop_;
+    lock.unlock();
+
+    const auto written = write(std::move(records));
+
+    lock.lock();
+    if (written) {
+      written_ = enqueued;
+      retry_delay = options_.retry_delay;
+    } else {
+      retry_delay = std::min(retry_delay * 2, options_.max_retry_delay);
+    }
+    written_cv_.notify_all();
+    if (stopping and not written) {
+      log_->error("Dropping {} unwritten records of MST state log {}: {}",
+                  enqueued - written_,
+                  path_,
+                  last_error_);
+      return;
+    }
+  }
+}
+
+bool MstStateLog::write(std::vector<Pending> records) {
+  if (not failed_.empty()) {
+    records.insert(records.begin(),
+                   std::make_move_iterator(failed_.begin()),
+                   std::make_move_iterator(failed_.end()));
+    failed_.clear();
+  }
+
+  // whether the batches are live after the preceding records of this write
+  std::unordered_map<shared_model::interface::types::HashType,
+                     bool,
+                     shared_model::crypto::BlobHasher>
+      written_live;
+  auto is_live = [&](const auto &hash) {
+    auto it = written_live.find(hash);
+    return it != written_live.end() ? it->second : live_.count(hash) > 0;
+  };
+  std::string buffer;
+  for (const auto &record : records) {
+    if (record.frame.empty()) {
+      if (is_live(record.reduced_hash)) {
+        buffer.append(makeFrame(kRemove, record.reduced_hash, {}));
+        written_live[record.reduced_hash] = false;
+      }
+      continue;
+    }
+    buffer.append(record.frame);
+    written_live[record.reduced_hash] = true;
+  }
+  if (buffer.empty()) {
+    return true;
+  }
+
+  const auto written = writeAll(fd_, buffer) and ::fsync(fd_) == 0;
+  const auto error = written ? std::string{} : std::strerror(errno);
+  auto compacted = false;
+  if (written) {
+    for (auto &record : records) {
+      auto live = live_.find(record.reduced_hash);
+      if (live != live_.end()) {
+        live_size_ -= live->second.size();
+      }
+      if (record.frame.empty()) {
+        if (live != live_.end()) {
+          live_.erase(live);
+        }
+        continue;
+      }
+      live_size_ += record.frame.size();
+      if (live != live_.end()) {
+        live->second = std::move(record.frame);
+      } else {
+        live_.emplace(record.reduced_hash, std::move(record.frame));
+      }
+    }
+    file_size_ += buffer.size();
+    if (file_size_ >= options_.min_compaction_size
+        and file_size_ > options_.compaction_ratio * live_size_) {
+      compacted = compact();
+    }
+  } else {
+    log_->error("Cannot write MST state log {}: {}", path_, error);
+    // drop the partially written records and retry them with the next write
+    if (::ftruncate(fd_, file_size_) != 0) {
+      log_->error("Cannot truncate MST state log {}: {}",
+                  path_,
+                  std::strerror(errno));
+    }
+    failed_ = std::move(records);
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  ++metrics_.writes;
+  metrics_.failures += written ? 0 : 1;
+  metrics_.compactions += compacted ? 1 : 0;
+  metrics_.file_size = file_size_;
+  metrics_.live_size = live_size_;
+  if (not written) {
+    last_error_ = error;
+  }
+  return written;
+}
+
+bool MstStateLog::compact() {
+  const auto temporary_path = path_ + ".tmp";
+  int fd = ::open(temporary_path.c_str(),
+                  O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC,
+                  0644);
+  if (fd < 0) {
+    log_->error("Cannot create {}: {}", temporary_path, std::strerror(errno));
+    return false;
+  }
+  std::string buffer;
+  buffer.reserve(live_size_);
+  for (const auto &record : live_) {
+    buffer.append(record.second);
+  }
+  const auto written = writeAll(fd, buffer) and ::fsync(fd) == 0;
+  ::close(fd);
+  if (not written
+      or ::rename(temporary_path.c_str(), path_.c_str()) != 0) {
+    log_->error("Cannot compact MST state log {}: {}",
+                path_,
+                std::strerror(errno));
+    ::unlink(temporary_path.c_str());
+    return false;
+  }
+  syncDirectory(path_);
+
+  int new_fd = ::open(path_.c_str(), O_WRONLY | O_APPEND | O_CLOEXEC);
+  if (new_fd < 0) {
+    log_->error("Cannot reopen MST state log {}: {}",
+                path_,
+                std::strerror(errno));
+    return false;
+  }
+  ::close(fd_);
+  fd_ = new_fd;
+  log_->debug("Compacted MST state log from {} to {} bytes",
+              file_size_,
+              buffer.size());
+  file_size_ = buffer.size();
+  return true;
+}
+
+namespace iroha {
+
+  std::vector<DataType> recoverBatches(
+      MstStateLog &state_log,
+      const shared_model::proto::TransactionFactoryType &transaction_factory,
+      const shared_model::interface::TransactionBatchParser &batch_parser,
+      const shared_model::interface::TransactionBatchFactory &batch_factory,
+      const ametsuchi::TxPresenceCache &tx_presence_cache,
+      const Completer &completer,
+      TimeType current_time,
+      const logger::LoggerPtr &log) {
+    std::vector<DataType> batches;
+    for (const auto &record : state_log.recovered()) {
+      auto batch = parseBatch(
+          record, transaction_factory, batch_parser, batch_factory, log);
+      if (not batch
+          or completer.expirationTime(oldestTimestamp(*batch))
+              < current_time) {
+        state_log.remove(record.reduced_hash);
+        continue;
+      }
+
+      auto cache_presence = tx_presence_cache.check(**batch);
+      if (not cache_presence) {
+        // the batch stays in the log to be checked on the next start
+        log->warn("Check tx presence database error. Batch: {}", **batch);
+        continue;
+      }
+      auto is_replay = std::any_of(
+          cache_presence->begin(),
+          cache_presence->end(),
+          [](const auto &tx_status) {
+            return iroha::visit_in_place(
+                tx_status,
+                [](const iroha::ametsuchi::tx_cache_status_responses::Missing
+                       &) { return false; },
+                [](const auto &) { return true; });
+          });
+      if (is_replay) {
+        state_log.remove(record.reduced_hash);
+        continue;
+      }
+      batches.push_back(std::move(*batch));
+    }
+    return batches;
+  }
+
+}  // namespace iroha
@@ -12,9 +12,15 @@ namespace iroha {
 
   StateUpdateResult MstStorage::apply(
       const shared_model::crypto::PublicKey &target_peer_key,
-      const MstState &new_state) {
+      const MstGossip &gossip) {
     std::lock_guard<std::mutex> lock{this->mutex_};
-    return applyImpl(target_peer_key, new_state);
+    return applyImpl(target_peer_key, gossip);
+  }
+
+  StateUpdateResult MstStorage::apply(
+      const shared_model::crypto::PublicKey &target_peer_key,
+      const MstState &new_state) {
+    return apply(target_peer_key, MstGossip{new_state});
   }
 
   StateUpdateResult MstStorage::updateOwnState(const DataType &tx) {
@@ -28,13 +34,21 @@ namespace iroha {
     return extractExpiredTransactionsImpl(current_time);
   }
 
-  MstState MstStorage::getDiffState(
+  MstGossip MstStorage::getDiffState(
       const shared_model::crypto::PublicKey &target_peer_key,
       const TimeType &current_time) {
     std::lock_guard<std::mutex> lock{this->mutex_};
     return getDiffStateImpl(target_peer_key, current_time);
   }
 
+  void MstStorage::gossipSent(
+      const shared_model::crypto::PublicKey &target_peer_key,
+      const MstGossip &gossip,
+      bool delivered) {
+    std::lock_guard<std::mutex> lock{this->mutex_};
+    gossipSentImpl(target_peer_key, gossip, delivered);
+  }
+
   MstState MstStorage::whatsNew(ConstRefState new_state) const {
     std::lock_guard<std::mutex> lock{this->mutex_};
     return whatsNewImpl(new_state);
@@ -5,61 +5,237 @@
 
 #include "multi_sig_transactions/storage/mst_storage_impl.hpp"
 
-namespace iroha {
-  // ------------------------------| private API |------------------------------
+#include <algorithm>
+
+#include "interfaces/iroha_internal/transaction_batch.hpp"
+#include "interfaces/transaction.hpp"
+#include "metrics/metrics.hpp"
+
+namespace {
+  /// @return true, if the transaction signers contain the key
+  bool hasSigner(const iroha::BatchSigners &signers,
+                 size_t transaction,
+                 const iroha::SignerKey &key) {
+    return transaction < signers.size()
+        and signers[transaction].count(key) != 0;
+  }
 
-  auto MstStorageStateImpl::getState(
-      const shared_model::crypto::PublicKey &target_peer_key) {
-    auto target_state_iter = peer_states_.find(target_peer_key);
-    if (target_state_iter == peer_states_.end()) {
-      return peer_states_
-          .insert(
-              {target_peer_key, MstState::empty(mst_state_logger_, completer_)})
-          .first;
+  /// @return key of the batch record, none for hashes of unexpected size
+  boost::optional<shared_model::crypto::HashBytes> recordKey(
+      const shared_model::interface::types::HashType &reduced_hash) {
+    return shared_model::crypto::HashBytes::fromBlob(reduced_hash);
+  }
+
+  /// Signers of batches by their reduced hashes
+  using GossipSigners =
+      std::unordered_map<shared_model::crypto::HashBytes,
+                         iroha::BatchSigners,
+                         shared_model::crypto::HashBytes::Hasher>;
+
+  /// @return signers of the batches and the signatures of the gossip
+  GossipSigners sentSigners(const iroha::MstGossip &gossip) {
+    GossipSigners sent_signers;
+    gossip.batches.iterateBatches([&sent_signers](const auto &batch) {
+      if (auto key = recordKey(batch->reducedHash())) {
+        iroha::mergeSigners(sent_signers[*key], iroha::batchSigners(*batch));
+      }
+    });
+    for (const auto &signatures : gossip.signatures) {
+      if (auto key = recordKey(signatures.reduced_hash)) {
+        iroha::mergeSigners(sent_signers[*key], signatures.signers());
+      }
     }
-    return target_state_iter;
+    return sent_signers;
   }
-  // -----------------------------| interface API |-----------------------------
 
-  MstStorageStateImpl::MstStorageStateImpl(const CompleterType &completer,
-                                           logger::LoggerPtr mst_state_logger,
-                                           logger::LoggerPtr log)
+  /// @return gauge of batches in the own state
+  iroha::metrics::Gauge &pendingBatches() {
+    static auto &gauge = iroha::metrics::defaultRegistry().gauge(
+        "iroha_mst_pending_batches",
+        "Batches waiting for signatures in the MST state");
+    return gauge;
+  }
+}  // namespace
+
+namespace iroha {
+  bool MstStorageStateImpl::Signer::operator==(const Signer &other) const {
+    return transaction == other.transaction
+        and key == other.key;
+  }
+
+  MstStorageStateImpl::MstStorageStateImpl(
+      const CompleterType &completer,
+      logger::LoggerPtr mst_state_logger,
+      logger::LoggerPtr log,
+      std::shared_ptr<MstStateLog> state_log)
       : MstStorage(log),
         completer_(completer),
         own_state_(MstState::empty(mst_state_logger, completer_)),
+        state_log_(std::move(state_log)),
         mst_state_logger_(std::move(mst_state_logger)) {}
 
   auto MstStorageStateImpl::applyImpl(
       const shared_model::crypto::PublicKey &target_peer_key,
-      const MstState &new_state)
-      -> decltype(apply(target_peer_key, new_state)) {
-    auto target_state_iter = getState(target_peer_key);
-    target_state_iter->second += new_state;
-    return own_state_ += new_state;
+      const MstGossip &gossip)
+      -> decltype(apply(target_peer_key, gossip)) {
+    const auto peer = peerIndex(target_peer_key);
+    peers_[peer].compact = gossip.compact_sender;
+    // the sender has the data it sends, and knows that we have it now
+    const auto sent_signers = sentSigners(gossip);
+
+    auto state_update = own_state_ += gossip.batches;
+    for (const auto &signatures : gossip.signatures) {
+      auto record = findRecord(signatures.reduced_hash);
+      if (record == records_.end()) {
+        // the batch was completed or has expired since the sender saw it
+        continue;
+      }
+      own_state_.addSignatures(record->second.batch, signatures, state_update);
+    }
+    recordChanges(state_update);
+
+    for (const auto &sent : sent_signers) {
+      auto record = records_.find(sent.first);
+      if (record != records_.end()) {
+        addKnownSigners(record->second, peer, sent.second, true);
+      }
+    }
+    for (const auto &summary : gossip.summaries) {
+      auto record = findRecord(summary.reduced_hash);
+      if (record != records_.end()) {
+        addKnownSigners(record->second, peer, summary.signers, false);
+      }
+    }
+    pendingBatches().set(records_.size());
+    return state_update;
   }
 
   auto MstStorageStateImpl::updateOwnStateImpl(const DataType &tx)
       -> decltype(updateOwnState(tx)) {
-    return own_state_ += tx;
+    auto state_update = own_state_ += tx;
+    recordChanges(state_update);
+    pendingBatches().set(records_.size());
+    return state_update;
   }
 
   auto MstStorageStateImpl::extractExpiredTransactionsImpl(
       const TimeType &current_time)
       -> decltype(extractExpiredTransactions(current_time)) {
-    for (auto &peer_and_state : peer_states_) {
-      peer_and_state.second.eraseExpired(current_time);
-    }
-    return own_state_.extractExpired(current_time);
+    auto expired = own_state_.extractExpired(current_time);
+    expired.iterateBatches([this](const auto &batch) {
+      this->eraseRecord(batch);
+      if (state_log_) {
+        state_log_->remove(batch->reducedHash());
+      }
+    });
+    pendingBatches().set(records_.size());
+    return expired;
   }
 
   auto MstStorageStateImpl::getDiffStateImpl(
       const shared_model::crypto::PublicKey &target_peer_key,
       const TimeType &current_time)
       -> decltype(getDiffState(target_peer_key, current_time)) {
-    auto target_current_state_iter = getState(target_peer_key);
-    auto new_diff_state = own_state_ - target_current_state_iter->second;
-    new_diff_state.eraseExpired(current_time);
-    return new_diff_state;
+    const auto peer = peerIndex(target_peer_key);
+    const auto compact = peers_[peer].compact;
+    MstGossip gossip{MstState::empty(mst_state_logger_, completer_)};
+
+    // only the batches changed since the previous gossip to the peer
+    for (auto change = changes_.upper_bound(peers_[peer].synced_version);
+         change != changes_.end();
+         ++change) {
+      auto &record = findRecord(change->second->reducedHash())->second;
+      if (record.expiration_time < current_time) {
+        continue;
+      }
+      const auto &knowledge = peerKnowledge(record, peer);
+      const auto total = record.additions.size();
+      const auto &hash = record.batch->reducedHash();
+      if (not knowledge.has_batch
+          or (not compact and knowledge.known < total)) {
+        gossip.batches += record.batch;
+        gossip.batch_signers.push_back(
+            BatchSummary{hash, additionSigners(record, 0, total)});
+        continue;
+      }
+      if (not compact) {
+        continue;
+      }
+
+      if (knowledge.reported < knowledge.known) {
+        gossip.summaries.push_back(BatchSummary{
+            hash,
+            additionSigners(record, knowledge.reported, knowledge.known)});
+      }
+      if (knowledge.known == total) {
+        continue;
+      }
+
+      BatchSignatures signatures{hash, {}};
+      const auto &transactions = record.batch->transactions();
+      signatures.transactions.resize(transactions.size());
+      for (auto i = knowledge.known; i < total; ++i) {
+        const auto &signer = record.additions[i];
+        const auto peer_signer = std::make_pair(peer, signer);
+        if (std::find(record.peer_signers.begin(),
+                      record.peer_signers.end(),
+                      peer_signer)
+            != record.peer_signers.end()) {
+          continue;
+        }
+        for (const auto &signature :
+             transactions[signer.transaction]->signatures()) {
+          if (signerKey(signature.publicKey()) == signer.key) {
+            signatures.transactions[signer.transaction].push_back(
+                DetachedSignature{signature.publicKey(),
+                                  signature.signedData()});
+            break;
+          }
+        }
+      }
+      gossip.signatures.push_back(std::move(signatures));
+    }
+
+    if (gossip.isEmpty()) {
+      gossip.summaries.clear();
+    }
+    // the knowledge of the peer is updated, when the gossip is delivered
+    peers_[peer].synced_version = version_;
+    return gossip;
+  }
+
+  void MstStorageStateImpl::gossipSentImpl(
+      const shared_model::crypto::PublicKey &target_peer_key,
+      const MstGossip &gossip,
+      bool delivered) {
+    const auto peer = peerIndex(target_peer_key);
+    if (not delivered) {
+      // batches, which the gossip carried, are visited again
+      peers_[peer].synced_version = 0;
+      return;
+    }
+
+    // the peer has the sent data, and knows that we have it and the
+    // summarized signatures
+    GossipSigners sent_signers;
+    for (const auto &signatures : gossip.signatures) {
+      if (auto key = recordKey(signatures.reduced_hash)) {
+        mergeSigners(sent_signers[*key], signatures.signers());
+      }
+    }
+    for (auto summaries : {&gossip.batch_signers, &gossip.summaries}) {
+      for (const auto &summary : *summaries) {
+        if (auto key = recordKey(summary.reduced_hash)) {
+          mergeSigners(sent_signers[*key], summary.signers);
+        }
+      }
+    }
+    for (const auto &sent : sent_signers) {
+      auto record = records_.find(sent.first);
+      if (record != records_.end()) {
+        addKnownSigners(record->second, peer, sent.second, true);
+      }
+    }
   }
 
   auto MstStorageStateImpl::whatsNewImpl(ConstRefState new_state) const
@@ -71,4 +247,141 @@ namespace iroha {
     return own_state_.contains(batch);
   }
 
+  auto MstStorageStateImpl::findRecord(
+      const shared_model::interface::types::HashType &reduced_hash)
+      -> Records::iterator {
+    auto key = recordKey(reduced_hash);
+    return key ? records_.find(*key) : records_.end();
+  }
+
+  size_t MstStorageStateImpl::peerIndex(
+      const shared_model::crypto::PublicKey &peer_key) {
+    auto inserted = peer_indices_.emplace(peer_key, peers_.size());
+    if (inserted.second) {
+      peers_.emplace_back();
+    }
+    return inserted.first->second;
+  }
+
+  MstStorageStateImpl::PeerKnowledge &MstStorageStateImpl::peerKnowledge(
+      BatchRecord &record, size_t peer) {
+    if (record.peers.size() <= peer) {
+      record.peers.resize(peer + 1);
+    }
+    return record.peers[peer];
+  }
+
+  void MstStorageStateImpl::recordChanges(
+      const StateUpdateResult &state_update) {
+    if (state_log_) {
+      state_log_->apply(state_update);
+    }
+    state_update.completed_state_->iterateBatches(
+        [this](const auto &batch) { eraseRecord(batch); });
+    state_update.updated_state_->iterateBatches([this](const auto &batch) {
+      // reduced hashes of the batches in own state have the default size
+      auto &record = records_[*recordKey(batch->reducedHash())];
+      if (record.batch) {
+        changes_.erase(record.version);
+      } else {
+        record.batch = batch;
+        // updated batches are in own state
+        record.expiration_time = *own_state_.expirationTime(batch);
+      }
+      record.version = ++version_;
+      changes_.emplace(record.version, record.batch);
+
+      const auto signers = batchSigners(*batch);
+      for (size_t i = 0; i < signers.size(); ++i) {
+        for (const auto &key : signers[i]) {
+          Signer signer{i, key};
+          if (std::find(
+                  record.additions.begin(), record.additions.end(), signer)
+              == record.additions.end()) {
+            record.additions.push_back(signer);
+          }
+        }
+      }
+      for (size_t peer = 0; peer < record.peers.size(); ++peer) {
+        advanceKnown(record, peer);
+      }
+    });
+  }
+
+  BatchSigners MstStorageStateImpl::additionSigners(const BatchRecord &record,
+                                                   size_t from,
+                                                   size_t to) {
+    BatchSigners signers;
+    for (auto i = from; i < to; ++i) {
+      const auto &signer = record.additions[i];
+      if (signers.size() <= signer.transaction) {
+        signers.resize(signer.transaction + 1);
+      }
+      signers[signer.transaction].insert(signer.key);
+    }
+    return signers;
+  }
+
+  void MstStorageStateImpl::eraseRecord(const DataType &batch) {
+    auto record = findRecord(batch->reducedHash());
+    if (record == records_.end()) {
+      return;
+    }
+    changes_.erase(record->second.version);
+    records_.erase(record);
+  }
+
+  void MstStorageStateImpl::addKnownSigners(BatchRecord &record,
+                                            size_t peer,
+                                            const BatchSigners &signers,
+                                            bool reported) {
+    auto &knowledge = peerKnowledge(record, peer);
+    knowledge.has_batch = true;
+    for (size_t i = 0; i < signers.size(); ++i) {
+      for (const auto &key : signers[i]) {
+        const Signer signer{i, key};
+        const auto addition = std::find(
+            record.additions.begin(), record.additions.end(), signer);
+        if (static_cast<size_t>(addition - record.additions.begin())
+            < knowledge.known) {
+          continue;
+        }
+        const auto peer_signer = std::make_pair(peer, signer);
+        if (std::find(record.peer_signers.begin(),
+                      record.peer_signers.end(),
+                      peer_signer)
+            == record.peer_signers.end()) {
+          record.peer_signers.push_back(peer_signer);
+        }
+      }
+    }
+    advanceKnown(record, peer);
+
+    if (reported) {
+      while (knowledge.reported < record.additions.size()) {
+        const auto &signer = record.additions[knowledge.reported];
+        if (not hasSigner(signers, signer.transaction, signer.key)) {
+          break;
+        }
+        ++knowledge.reported;
+      }
+    }
+  }
+
+  void MstStorageStateImpl::advanceKnown(BatchRecord &record, size_t peer) {
+    auto &knowledge = record.peers[peer];
+    while (knowledge.known < record.additions.size()) {
+      const auto peer_signer =
+          std::make_pair(peer, record.additions[knowledge.known]);
+      auto found = std::find(record.peer_signers.begin(),
+                             record.peer_signers.end(),
+                             peer_signer);
+      if (found == record.peer_signers.end()) {
+        break;
+      }
+      record.peer_signers.erase(found);
+      ++knowledge.known;
+    }
+  }
+
 }  // namespace iroha
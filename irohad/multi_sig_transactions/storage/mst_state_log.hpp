@@ -0,0 +1,210 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_MST_STATE_LOG_HPP
+#define IROHA_MST_STATE_LOG_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "backend/protobuf/deserialize_repeated_transactions.hpp"
+#include "common/result.hpp"
+#include "cryptography/blob_hasher.hpp"
+#include "interfaces/common_objects/types.hpp"
+#include "logger/logger_fwd.hpp"
+#include "multi_sig_transactions/mst_types.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+    class TxPresenceCache;
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+namespace shared_model {
+  namespace interface {
+    class TransactionBatchFactory;
+    class TransactionBatchParser;
+  }  // namespace interface
+}  // namespace shared_model
+
+namespace iroha {
+
+  class Completer;
+
+  /**
+   * Append-only file of MST state updates, which keeps the pending batches
+   * with their signatures across restarts.
+   *
+   * Each update of a batch is logged with all its signatures, and batches
+   * which leave the state are logged as removed. Records are framed with
+   * a marker, their size and checksums, so a torn tail left by a crash is
+   * dropped on load, and corrupted records are skipped.
+   *
+   * Callers only encode records; a background thread writes them. Records
+   * which arrive while the previous write is synced are written and synced
+   * together (group commit). Records of a failed write are retried with
+   * an increasing delay. When the file grows too large relative to the
+   * live records, it is rewritten with only them.
+   */
+  class MstStateLog {
+   public:
+    struct Options {
+      /// how long the writer waits for more records before a write
+      std::chrono::milliseconds group_commit_delay{10};
+      /// file size, below which the file is not compacted
+      size_t min_compaction_size = 1 << 20;
+      /// the file is compacted when it is that many times larger than the
+      /// live records
+      size_t compaction_ratio = 4;
+      /// delay before the first retry of a failed write, which doubles with
+      /// each failure up to max_retry_delay
+      std::chrono::milliseconds retry_delay{100};
+      std::chrono::milliseconds max_retry_delay{5000};
+    };
+
+    /// Batch which was pending when the log was written last time
+    struct Record {
+      shared_model::interface::types::HashType reduced_hash;
+      /// serialized iroha::protocol::TxList with the batch transactions
+      std::string transactions;
+    };
+
+    struct Metrics {
+      /// records passed to the writer
+      size_t records;
+      /// writes, each of which is followed by a sync
+      size_t writes;
+      size_t compactions;
+      size_t failures;
+      /// size of the file
+      size_t file_size;
+      /// size of the live records in the file
+      size_t live_size;
+    };
+
+    /**
+     * Open the log and load its records. The file is created if it does not
+     * exist.
+     * @param path - path to the file
+     * @param options - write and compaction options
+     * @param log - logger
+     * @return the log or error if the file can not be opened
+     */
+    static expected::Result<std::unique_ptr<MstStateLog>, std::string> create(
+        const std::string &path, Options options, logger::LoggerPtr log);
+
+    /// Writes the remaining records, logs an error if they can not be written
+    ~MstStateLog();
+
+    /// @return batches which were pending when the log was opened
+    const std::vector<Record> &recovered() const;
+
+    /// Log the batch with its current signatures
+    void update(const DataType &batch);
+
+    /// Log that the batch has left the state
+    void remove(const shared_model::interface::types::HashType &reduced_hash);
+
+    /// Log the updated batches and remove the completed ones
+    void apply(const StateUpdateResult &state_update);
+
+    /**
+     * Wait until the records, which were logged before, are written
+     * @return error if a write of the records failed, then they are retried
+     * in background
+     */
+    expected::Result<void, std::string> flush();
+
+    Metrics metrics() const;
+
+   private:
+    using LiveRecords =
+        std::unordered_map<shared_model::interface::types::HashType,
+                           std::string,
+                           shared_model::crypto::BlobHasher>;
+
+    /// Record encoded by the caller
+    struct Pending {
+      shared_model::interface::types::HashType reduced_hash;
+      /// record with framing, empty for removal records
+      std::string frame;
+    };
+
+    MstStateLog(std::string path,
+                int fd,
+                Options options,
+                LiveRecords live,
+                size_t file_size,
+                logger::LoggerPtr log);
+
+    void enqueue(Pending record);
+
+    /// Writer thread loop
+    void run();
+
+    /**
+     * Write and sync the records, then compact the file if needed. The
+     * records which could not be written are retried with the next write.
+     * @return true if the records and the failed ones before are written
+     */
+    bool write(std::vector<Pending> records);
+
+    /// Rewrite the file with only the live records
+    bool compact();
+
+    const std::string path_;
+    int fd_;
+    const Options options_;
+    std::vector<Record> recovered_;
+
+    // touched only by the writer thread after construction
+    LiveRecords live_;
+    size_t live_size_;
+    size_t file_size_;
+    /// records of the last failed write
+    std::vector<Pending> failed_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable pending_cv_;
+    std::condition_variable written_cv_;
+    std::vector<Pending> pending_;
+    uint64_t enqueued_ = 0;
+    uint64_t written_ = 0;
+    /// callers waiting in flush(), for whom the writer does not delay
+    size_t flush_waiters_ = 0;
+    bool stop_ = false;
+    Metrics metrics_{};
+    /// reason of the last failed write
+    std::string last_error_;
+
+    logger::LoggerPtr log_;
+    std::thread writer_;
+  };
+
+  /**
+   * Parse the batches recovered by the log. Batches which have expired,
+   * which have transactions in the ledger or which can not be parsed are
+   * logged as removed and skipped.
+   * @return batches to be put back to the MST state
+   */
+  std::vector<DataType> recoverBatches(
+      MstStateLog &state_log,
+      const shared_model::proto::TransactionFactoryType &transaction_factory,
+      const shared_model::interface::TransactionBatchParser &batch_parser,
+      const shared_model::interface::TransactionBatchFactory &batch_factory,
+      const ametsuchi::TxPresenceCache &tx_presence_cache,
+      const Completer &completer,
+      TimeType current_time,
+      const logger::LoggerPtr &log);
+
+}  // namespace iroha
+
+#endif  // IROHA_MST_STATE_LOG_HPP
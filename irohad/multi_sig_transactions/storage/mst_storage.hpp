@@ -11,6 +11,7 @@
 #include "cryptography/public_key.hpp"
 #include "logger/logger_fwd.hpp"
 #include "multi_sig_transactions/mst_types.hpp"
+#include "multi_sig_transactions/state/mst_gossip.hpp"
 #include "multi_sig_transactions/state/mst_state.hpp"
 
 namespace iroha {
@@ -24,6 +25,17 @@ namespace iroha {
    public:
     // ------------------------------| user API |-------------------------------
 
+    /**
+     * Apply gossip received from peer
+     * @param target_peer_key - key of the sender
+     * @param gossip - batches, signatures and summaries of the sender
+     * @return State with completed or updated batches
+     * General note: implementation of method covered by lock
+     */
+    StateUpdateResult apply(
+        const shared_model::crypto::PublicKey &target_peer_key,
+        const MstGossip &gossip);
+
     /**
      * Apply new state for peer
      * @param target_peer_key - key for for updating state
@@ -51,15 +63,30 @@ namespace iroha {
     MstState extractExpiredTransactions(const TimeType &current_time);
 
     /**
-     * Make state based on diff of own and target states.
-     * All expired transactions will be removed from diff.
-     * @return difference between own and target state
+     * Make gossip with the data of own state which the target peer lacks:
+     * batches it has not seen and signatures of batches it has. Peers, which
+     * have not shown that they read signatures, get whole batches instead.
+     * Expired batches are not included. The data is included again, until
+     * its delivery is reported by gossipSent or by the peer itself.
+     * @return gossip for the target peer
      * General note: implementation of method covered by lock
      */
-    MstState getDiffState(
+    MstGossip getDiffState(
         const shared_model::crypto::PublicKey &target_peer_key,
         const TimeType &current_time);
 
+    /**
+     * Report the outcome of sending the gossip made by getDiffState
+     * @param target_peer_key - key of the recipient
+     * @param gossip - the sent gossip
+     * @param delivered - true if the peer has received the gossip, false if
+     * it is lost, then the changes it carried are sent again
+     * General note: implementation of method covered by lock
+     */
+    void gossipSent(const shared_model::crypto::PublicKey &target_peer_key,
+                    const MstGossip &gossip,
+                    bool delivered);
+
     /**
      * Return diff between own and new state
      * @param new_state - state with new data
@@ -88,8 +115,8 @@ namespace iroha {
    private:
     virtual auto applyImpl(
         const shared_model::crypto::PublicKey &target_peer_key,
-        const MstState &new_state)
-        -> decltype(apply(target_peer_key, new_state)) = 0;
+        const MstGossip &gossip)
+        -> decltype(apply(target_peer_key, gossip)) = 0;
 
     virtual auto updateOwnStateImpl(const DataType &tx)
         -> decltype(updateOwnState(tx)) = 0;
@@ -102,6 +129,11 @@ namespace iroha {
         const TimeType &current_time)
         -> decltype(getDiffState(target_peer_key, current_time)) = 0;
 
+    virtual void gossipSentImpl(
+        const shared_model::crypto::PublicKey &target_peer_key,
+        const MstGossip &gossip,
+        bool delivered) = 0;
+
     virtual auto whatsNewImpl(ConstRefState new_state) const
         -> decltype(whatsNew(new_state)) = 0;
 
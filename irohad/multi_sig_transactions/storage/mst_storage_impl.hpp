@@ -6,34 +6,34 @@
 #ifndef IROHA_MST_STORAGE_IMPL_HPP
 #define IROHA_MST_STORAGE_IMPL_HPP
 
+#include <map>
 #include <unordered_map>
 #include "cryptography/blob_hasher.hpp"
+#include "cryptography/fixed_blob.hpp"
 #include "logger/logger_fwd.hpp"
 #include "multi_sig_transactions/hash.hpp"
+#include "multi_sig_transactions/state/mst_gossip.hpp"
+#include "multi_sig_transactions/storage/mst_state_log.hpp"
 #include "multi_sig_transactions/storage/mst_storage.hpp"
 
 namespace iroha {
   class MstStorageStateImpl : public MstStorage {
-   private:
-    // -----------------------------| private API |-----------------------------
-
-    /**
-     * Return state of a peer by its public key. If state doesn't exist, create
-     * new empty state and return it.
-     * @param target_peer_key - public key of the peer for searching
-     * @return valid iterator for state of peer
-     */
-    auto getState(const shared_model::crypto::PublicKey &target_peer_key);
-
    public:
     // ----------------------------| interface API |----------------------------
+    /**
+     * @param completer - strategy for completed and expired batches
+     * @param mst_state_logger - logger for created MstState objects
+     * @param log - logger
+     * @param state_log - optional log, which persists own state
+     */
     MstStorageStateImpl(const CompleterType &completer,
                         logger::LoggerPtr mst_state_logger,
-                        logger::LoggerPtr log);
+                        logger::LoggerPtr log,
+                        std::shared_ptr<MstStateLog> state_log = nullptr);
 
     auto applyImpl(const shared_model::crypto::PublicKey &target_peer_key,
-                   const MstState &new_state)
-        -> decltype(apply(target_peer_key, new_state)) override;
+                   const MstGossip &gossip)
+        -> decltype(apply(target_peer_key, gossip)) override;
 
     auto updateOwnStateImpl(const DataType &tx)
         -> decltype(updateOwnState(tx)) override;
@@ -46,20 +46,109 @@ namespace iroha {
         const TimeType &current_time)
         -> decltype(getDiffState(target_peer_key, current_time)) override;
 
+    void gossipSentImpl(const shared_model::crypto::PublicKey &target_peer_key,
+                        const MstGossip &gossip,
+                        bool delivered) override;
+
     auto whatsNewImpl(ConstRefState new_state) const
         -> decltype(whatsNew(new_state)) override;
 
     bool batchInStorageImpl(const DataType &batch) const override;
 
    private:
+    /**
+     * What a peer is known to have of a batch of own state, as prefixes of
+     * the signature additions of the batch
+     */
+    struct PeerKnowledge {
+      /// number of leading additions, which the peer has
+      size_t known = 0;
+      /// number of leading additions, which the peer knows that we have
+      size_t reported = 0;
+      /// whether the peer has the batch
+      bool has_batch = false;
+    };
+
+    /// Signer of a transaction of a batch
+    struct Signer {
+      size_t transaction;
+      SignerKey key;
+
+      bool operator==(const Signer &other) const;
+    };
+
+    /// Batch of own state with its propagation to peers
+    struct BatchRecord {
+      DataType batch;
+      TimeType expiration_time = 0;
+      /// version of own state, when the batch changed last time
+      uint64_t version = 0;
+      /// signers of the batch, in the order in which we got them
+      std::vector<Signer> additions;
+      /// knowledge of each peer by its index
+      std::vector<PeerKnowledge> peers;
+      /// signers beyond the known prefix, which peers have, by peer index
+      std::vector<std::pair<size_t, Signer>> peer_signers;
+    };
+
+    /// Propagation to a peer
+    struct PeerState {
+      /// version of own state, which the peer was sent
+      uint64_t synced_version = 0;
+      /// whether the peer reads signatures and summaries
+      bool compact = false;
+    };
+
+    /// Records by reduced hashes of their batches
+    using Records = std::unordered_map<shared_model::crypto::HashBytes,
+                                       BatchRecord,
+                                       shared_model::crypto::HashBytes::Hasher>;
+
+    /// @return record of the batch with the reduced hash or end of records
+    Records::iterator findRecord(
+        const shared_model::interface::types::HashType &reduced_hash);
+
+    /// @return index of the peer in records, which is assigned on first use
+    size_t peerIndex(const shared_model::crypto::PublicKey &peer_key);
+
+    /// @return knowledge of the peer about the batch
+    PeerKnowledge &peerKnowledge(BatchRecord &record, size_t peer);
+
+    /// Update the records of batches, which are changed in own state
+    void recordChanges(const StateUpdateResult &state_update);
+
+    /// @return signers of the additions of the record in the range
+    static BatchSigners additionSigners(const BatchRecord &record,
+                                        size_t from,
+                                        size_t to);
+
+    /// Erase the record of a batch, which is not in own state any more
+    void eraseRecord(const DataType &batch);
+
+    /// Mark the signers as known to the peer
+    void addKnownSigners(BatchRecord &record,
+                         size_t peer,
+                         const BatchSigners &signers,
+                         bool reported);
+
+    /// Extend the known prefix of the peer by its signers beyond the prefix
+    void advanceKnown(BatchRecord &record, size_t peer);
+
     // ---------------------------| private fields |----------------------------
 
     const CompleterType completer_;
+    Records records_;
+    /// batches of own state by the version of their last change
+    std::map<uint64_t, DataType> changes_;
+    uint64_t version_ = 0;
     std::unordered_map<shared_model::crypto::PublicKey,
-                       MstState,
+                       size_t,
                        shared_model::crypto::BlobHasher>
-        peer_states_;
+        peer_indices_;
+    /// propagation to each peer by its index
+    std::vector<PeerState> peers_;
     MstState own_state_;
+    std::shared_ptr<MstStateLog> state_log_;
 
     logger::LoggerPtr mst_state_logger_;  ///< Logger for created MstState
                                           ///< objects.
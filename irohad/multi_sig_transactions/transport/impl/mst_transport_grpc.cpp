@@ -16,6 +16,7 @@
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "interfaces/transaction.hpp"
 #include "logger/logger.hpp"
+#include "metrics/metrics.hpp"
 #include "network/impl/grpc_channel_builder.hpp"
 #include "validators/field_validator.hpp"
 
@@ -27,12 +28,33 @@ namespace {
   auto default_sender_factory = [](const shared_model::interface::Peer &to) {
     return createClient<transport::MstTransportGrpc>(to.address());
   };
+
+  /// @return counter of serialized MST states in the direction
+  metrics::Counter &gossipBytes(const char *direction) {
+    return metrics::defaultRegistry().counter(
+        "iroha_mst_gossip_bytes_total",
+        "Size of MST states exchanged with peers",
+        {{"direction", direction}});
+  }
+
+  metrics::Counter &gossipBytesSent() {
+    static auto &counter = gossipBytes("sent");
+    return counter;
+  }
+
+  metrics::Counter &gossipBytesReceived() {
+    static auto &counter = gossipBytes("received");
+    return counter;
+  }
 }
-void sendStateAsyncImpl(
+/// @return false if the client for the peer could not be created or the
+/// peer has too many states in flight, then on_sent is not called
+bool sendStateAsyncImpl(
     const shared_model::interface::Peer &to,
-    ConstRefState state,
+    const MstGossip &gossip,
     const std::string &sender_key,
     AsyncGrpcClient<google::protobuf::Empty> &async_call,
+    MstTransport::SentCallback on_sent,
     MstTransportGrpc::SenderFactory sender_factory = default_sender_factory);
 
 MstTransportGrpc::MstTransportGrpc(
@@ -64,6 +86,7 @@ grpc::Status MstTransportGrpc::SendState(
     const ::iroha::network::transport::MstState *request,
     ::google::protobuf::Empty *response) {
   log_->info("MstState Received");
+  gossipBytesReceived().increment(request->ByteSizeLong());
 
   auto transactions = shared_model::proto::deserializeTransactions(
       *transaction_factory_, request->transactions());
@@ -79,7 +102,7 @@ grpc::Status MstTransportGrpc::SendState(
     log_->warn("Batch deserialization failed: {}", *e);
     return ::grpc::Status::OK;
   }
-  MstState new_state = MstState::empty(mst_state_logger_, mst_completer_);
+  MstGossip gossip{MstState::empty(mst_state_logger_, mst_completer_)};
   auto opt_batches = expected::resultToOptionalValue(std::move(batches));
   for (auto &batch : *opt_batches) {
     auto cache_presence = tx_presence_cache_->check(*batch);
@@ -101,11 +124,39 @@ grpc::Status MstTransportGrpc::SendState(
         });
 
     if (not is_replay) {
-      new_state += std::move(batch);
+      gossip.batches += std::move(batch);
     }
   }
 
-  log_->info("batches in MstState: {}", new_state.getBatches().size());
+  for (const auto &proto_batch : request->signatures()) {
+    gossip.signatures.push_back(BatchSignatures{
+        shared_model::crypto::Hash(proto_batch.reduced_hash()), {}});
+    auto &transactions = gossip.signatures.back().transactions;
+    for (const auto &proto_tx : proto_batch.transactions()) {
+      transactions.emplace_back();
+      for (const auto &signature : proto_tx.signatures()) {
+        transactions.back().push_back(DetachedSignature{
+            shared_model::crypto::PublicKey(signature.public_key()),
+            shared_model::crypto::Signed(signature.signature())});
+      }
+    }
+  }
+
+  for (const auto &proto_summary : request->summaries()) {
+    gossip.summaries.push_back(BatchSummary{
+        shared_model::crypto::Hash(proto_summary.reduced_hash()), {}});
+    auto &signers = gossip.summaries.back().signers;
+    for (const auto &proto_tx : proto_summary.transactions()) {
+      signers.emplace_back(proto_tx.signers().begin(),
+                           proto_tx.signers().end());
+    }
+  }
+
+  gossip.compact_sender = request->compact_gossip();
+
+  log_->info("batches in MstState: {}, batches with signatures: {}",
+             gossip.batches.getBatches().size(),
+             gossip.signatures.size());
 
   shared_model::crypto::PublicKey source_key(request->source_peer_key());
   auto key_invalid_reason =
@@ -116,7 +167,7 @@ grpc::Status MstTransportGrpc::SendState(
     return grpc::Status::OK;
   }
 
-  if (new_state.isEmpty()) {
+  if (gossip.isEmpty() and gossip.summaries.empty()) {
     log_->info(
         "All transactions from received MST state have been processed already, "
         "nothing to propagate to MST processor");
@@ -124,7 +175,7 @@ grpc::Status MstTransportGrpc::SendState(
   }
 
   if (auto subscriber = subscriber_.lock()) {
-    subscriber->onNewState(source_key, std::move(new_state));
+    subscriber->onNewState(source_key, std::move(gossip));
   } else {
     log_->warn("No subscriber for MST SendState event is set");
   }
@@ -138,13 +189,19 @@ void MstTransportGrpc::subscribe(
 }
 
 void MstTransportGrpc::sendState(const shared_model::interface::Peer &to,
-                                 ConstRefState providing_state) {
+                                 const MstGossip &gossip,
+                                 SentCallback on_sent) {
   log_->info("Propagate MstState to peer {}", to.address());
-  sendStateAsyncImpl(to,
-                     providing_state,
-                     my_key_,
-                     *async_call_,
-                     sender_factory_.value_or(default_sender_factory));
+  if (not sendStateAsyncImpl(
+          to,
+          gossip,
+          my_key_,
+          *async_call_,
+          on_sent,
+          sender_factory_.value_or(default_sender_factory))) {
+    log_->warn("Failed to send to peer {}, MstState dropped", to.address());
+    on_sent(false);
+  }
 }
 
 void iroha::network::sendStateAsync(
@@ -152,25 +209,76 @@ void iroha::network::sendStateAsync(
     ConstRefState state,
     const shared_model::crypto::PublicKey &sender_key,
     AsyncGrpcClient<google::protobuf::Empty> &async_call) {
-  sendStateAsyncImpl(
-      to, state, shared_model::crypto::toBinaryString(sender_key), async_call);
+  sendStateAsyncImpl(to,
+                     MstGossip{state},
+                     shared_model::crypto::toBinaryString(sender_key),
+                     async_call,
+                     nullptr);
 }
 
-void sendStateAsyncImpl(const shared_model::interface::Peer &to,
-                        ConstRefState state,
-                        const std::string &sender_key,
-                        AsyncGrpcClient<google::protobuf::Empty> &async_call,
-                        MstTransportGrpc::SenderFactory sender_factory) {
-  auto client = sender_factory(to);
-  transport::MstState protoState;
-  protoState.set_source_peer_key(sender_key);
-  state.iterateTransactions([&protoState](const auto &tx) {
+transport::MstState iroha::network::makeMstStateMessage(
+    const MstGossip &gossip, const std::string &sender_key) {
+  transport::MstState message;
+  message.set_source_peer_key(sender_key);
+  message.set_compact_gossip(true);
+  gossip.batches.iterateTransactions([&message](const auto &tx) {
     // TODO (@l4l) 04/03/18 simplify with IR-1040
-    *protoState.add_transactions() =
+    *message.add_transactions() =
         std::static_pointer_cast<shared_model::proto::Transaction>(tx)
             ->getTransport();
   });
-  async_call.Call([&](auto context, auto cq) {
-    return client->AsyncSendState(context, protoState, cq);
-  });
+  for (const auto &batch : gossip.signatures) {
+    auto proto_batch = message.add_signatures();
+    proto_batch->set_reduced_hash(
+        shared_model::crypto::toBinaryString(batch.reduced_hash));
+    for (const auto &tx : batch.transactions) {
+      auto proto_tx = proto_batch->add_transactions();
+      for (const auto &signature : tx) {
+        auto proto_signature = proto_tx->add_signatures();
+        proto_signature->set_public_key(
+            shared_model::crypto::toBinaryString(signature.public_key));
+        proto_signature->set_signature(
+            shared_model::crypto::toBinaryString(signature.signed_data));
+      }
+    }
+  }
+  for (const auto &summary : gossip.summaries) {
+    auto proto_summary = message.add_summaries();
+    proto_summary->set_reduced_hash(
+        shared_model::crypto::toBinaryString(summary.reduced_hash));
+    for (const auto &signers : summary.signers) {
+      auto proto_tx = proto_summary->add_transactions();
+      for (const auto &signer : signers) {
+        proto_tx->add_signers(signer);
+      }
+    }
+  }
+  return message;
+}
+
+bool sendStateAsyncImpl(const shared_model::interface::Peer &to,
+                        const MstGossip &gossip,
+                        const std::string &sender_key,
+                        AsyncGrpcClient<google::protobuf::Empty> &async_call,
+                        MstTransport::SentCallback on_sent,
+                        MstTransportGrpc::SenderFactory sender_factory) {
+  auto client = sender_factory(to);
+  if (client == nullptr) {
+    return false;
+  }
+  auto protoState = makeMstStateMessage(gossip, sender_key);
+  gossipBytesSent().increment(protoState.ByteSizeLong());
+  std::function<void(const grpc::Status &)> on_finish;
+  if (on_sent) {
+    on_finish = [on_sent = std::move(on_sent)](const grpc::Status &status) {
+      on_sent(status.ok());
+    };
+  }
+  return async_call.Call(
+      to.address(),
+      "MstTransport.SendState",
+      [&](auto context, auto cq) {
+        return client->AsyncSendState(context, protoState, cq);
+      },
+      std::move(on_finish));
 }
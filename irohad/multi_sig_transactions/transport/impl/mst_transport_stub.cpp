@@ -12,6 +12,9 @@ namespace iroha {
         std::shared_ptr<MstTransportNotification>) {}
 
     void MstTransportStub::sendState(const shared_model::interface::Peer &,
-                                     ConstRefState) {}
+                                     const MstGossip &,
+                                     SentCallback on_sent) {
+      on_sent(false);
+    }
   }  // namespace network
 }  // namespace iroha
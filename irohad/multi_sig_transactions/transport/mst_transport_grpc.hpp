@@ -28,6 +28,7 @@ namespace iroha {
     class MstTransportGrpc : public MstTransport,
                              public transport::MstTransportGrpc::Service {
      public:
+      /// Creates stubs for the peers, returns nullptr if it fails
       using SenderFactory = std::function<
           std::unique_ptr<transport::MstTransportGrpc::StubInterface>(
               const shared_model::interface::Peer &)>;
@@ -67,7 +68,8 @@ namespace iroha {
           std::shared_ptr<MstTransportNotification> notification) override;
 
       void sendState(const shared_model::interface::Peer &to,
-                     ConstRefState providing_state) override;
+                     const MstGossip &gossip,
+                     SentCallback on_sent) override;
 
      private:
       std::weak_ptr<MstTransportNotification> subscriber_;
@@ -90,6 +92,14 @@ namespace iroha {
       boost::optional<SenderFactory> sender_factory_;
     };
 
+    /**
+     * Make the message of MST gossip
+     * @param gossip - batches, signatures and summaries to send
+     * @param sender_key - binary public key of the sender
+     */
+    transport::MstState makeMstStateMessage(const MstGossip &gossip,
+                                            const std::string &sender_key);
+
     void sendStateAsync(const shared_model::interface::Peer &to,
                         iroha::ConstRefState state,
                         const shared_model::crypto::PublicKey &sender_key,
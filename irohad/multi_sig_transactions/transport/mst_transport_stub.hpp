@@ -15,7 +15,8 @@ namespace iroha {
       void subscribe(std::shared_ptr<MstTransportNotification>) override;
 
       void sendState(const shared_model::interface::Peer &,
-                     ConstRefState) override;
+                     const MstGossip &,
+                     SentCallback on_sent) override;
     };
   }  // namespace network
 }  // namespace iroha
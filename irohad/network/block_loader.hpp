@@ -30,6 +30,19 @@ namespace iroha {
       retrieveBlocks(const shared_model::interface::types::HeightType height,
                      const shared_model::crypto::PublicKey &peer_pubkey) = 0;
 
+      /**
+       * Retrieve a range of blocks from given peer
+       * @param peer_pubkey - peer for requesting blocks
+       * @param first_height - height of the first requested block
+       * @param count - number of requested blocks
+       * @return blocks of the range, which the peer has sent in time
+       */
+      virtual rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
+      retrieveBlockRange(
+          const shared_model::crypto::PublicKey &peer_pubkey,
+          shared_model::interface::types::HeightType first_height,
+          shared_model::interface::types::HeightType count) = 0;
+
       /**
        * Retrieve block by its block_height from given peer
        * @param peer_pubkey - peer for requesting blocks
@@ -6,12 +6,21 @@
 #ifndef IROHA_ASYNC_GRPC_CLIENT_HPP
 #define IROHA_ASYNC_GRPC_CLIENT_HPP
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <ciso646>
+#include <functional>
+#include <mutex>
+#include <string>
 #include <thread>
+#include <unordered_map>
+#include <vector>
 
 #include <google/protobuf/empty.pb.h>
 #include <grpc++/grpc++.h>
 #include <grpcpp/impl/codegen/async_unary_call.h>
+#include <boost/optional.hpp>
 #include "logger/logger.hpp"
 
 namespace iroha {
@@ -19,67 +28,275 @@ namespace iroha {
 
     /**
      * Asynchronous gRPC client which does no processing of server responses
+     *
+     * Calls are spread over several completion queues, each of which is
+     * drained by its own thread. Calls of the same peer go to the same
+     * queue, so the calls in flight and method metrics are kept by each
+     * queue under its own lock. Finished call objects are kept for reuse,
+     * so a call does not allocate its reply and reader state anew.
+     *
+     * Calls made with a peer are limited by the number of calls to that peer
+     * which wait for a response, so a slow peer does not collect an unbounded
+     * backlog: calls over the limit are rejected.
      * @tparam Response type of server response
      */
     template <typename Response>
     class AsyncGrpcClient {
      public:
+      struct Options {
+        /// completion queues, each drained by its own thread
+        size_t queues = 1;
+        /// calls to one peer waiting for response, 0 for no limit
+        size_t max_in_flight_per_peer = 0;
+        /// finished call objects kept for reuse by each queue
+        size_t max_pooled_calls = 256;
+      };
+
+      struct MethodMetrics {
+        size_t calls;
+        /// calls finished with not OK status
+        size_t failures;
+        /// calls not made because of the peer in-flight limit
+        size_t rejected;
+        std::chrono::microseconds total_latency;
+        std::chrono::microseconds max_latency;
+      };
+
+      struct Metrics {
+        std::unordered_map<std::string, MethodMetrics> methods;
+        /// calls waiting for response
+        size_t in_flight;
+        /// calls made with a reused call object
+        size_t reused;
+      };
+
       explicit AsyncGrpcClient(logger::LoggerPtr log)
-          : thread_(&AsyncGrpcClient::asyncCompleteRpc, this),
-            log_(std::move(log)) {}
+          : AsyncGrpcClient(std::move(log), Options{}) {}
+
+      AsyncGrpcClient(logger::LoggerPtr log, Options options)
+          : options_(std::move(options)),
+            queues_(std::max<size_t>(options_.queues, 1)),
+            log_(std::move(log)) {
+        for (auto &queue : queues_) {
+          queue.thread =
+              std::thread(&AsyncGrpcClient::asyncCompleteRpc, this, &queue);
+        }
+      }
+
+      ~AsyncGrpcClient() {
+        for (auto &queue : queues_) {
+          queue.cq.Shutdown();
+        }
+        for (auto &queue : queues_) {
+          if (queue.thread.joinable()) {
+            queue.thread.join();
+          }
+        }
+      }
 
       /**
-       * Listen to gRPC server responses
+       * Universal method to perform all needed sends
+       * @tparam lambda which must return unique pointer to
+       * ClientAsyncResponseReader<Response> object
        */
-      void asyncCompleteRpc() {
-        void *got_tag;
-        auto ok = false;
-        while (cq_.Next(&got_tag, &ok)) {
-          auto call = static_cast<AsyncClientCall *>(got_tag);
-          if (not call->status.ok()) {
-            log_->warn("RPC failed: {}", call->status.error_message());
+      template <typename F>
+      void Call(F &&lambda) {
+        auto &queue = queues_[next_queue_++ % queues_.size()];
+        start(queue, acquire(queue), std::forward<F>(lambda));
+      }
+
+      /**
+       * Send to the peer, unless it has too many calls waiting for response
+       * @param peer - address of the peer, which the call is limited by, or
+       * empty string for a call without the limit
+       * @param method - name of the call in metrics
+       * @param lambda - the same as in Call(lambda)
+       * @return false if the call was rejected
+       */
+      template <typename F>
+      bool Call(const std::string &peer, const char *method, F &&lambda) {
+        return Call(peer, method, std::forward<F>(lambda), nullptr);
+      }
+
+      /**
+       * The same as Call(peer, method, lambda), and reports the outcome
+       * @param on_finish - called with the status of the call, when it
+       * finishes, unless the call is rejected
+       */
+      template <typename F>
+      bool Call(const std::string &peer,
+                const char *method,
+                F &&lambda,
+                std::function<void(const grpc::Status &)> on_finish) {
+        // calls without a peer have no limit to share, so they are spread
+        auto &queue = queues_[(peer.empty() ? next_queue_++
+                                            : std::hash<std::string>{}(peer))
+                              % queues_.size()];
+        if (not peer.empty()) {
+          std::lock_guard<std::mutex> lock(queue.mutex);
+          auto &in_flight = queue.in_flight[peer];
+          if (options_.max_in_flight_per_peer != 0
+              and in_flight >= options_.max_in_flight_per_peer) {
+            ++queue.methods[method].rejected;
+            log_->warn("{} to {} rejected: {} calls in flight",
+                       method,
+                       peer,
+                       in_flight);
+            return false;
           }
-          delete call;
+          ++in_flight;
         }
+        auto call = acquire(queue);
+        call->peer = peer;
+        call->method = method;
+        call->on_finish = std::move(on_finish);
+        start(queue, call, std::forward<F>(lambda));
+        return true;
       }
 
-      ~AsyncGrpcClient() {
-        cq_.Shutdown();
-        if (thread_.joinable()) {
-          thread_.join();
+      Metrics metrics() const {
+        Metrics result{{}, in_flight_total_.load(), reused_.load()};
+        for (const auto &queue : queues_) {
+          std::lock_guard<std::mutex> lock(queue.mutex);
+          for (const auto &method : queue.methods) {
+            auto &total = result.methods[method.first];
+            total.calls += method.second.calls;
+            total.failures += method.second.failures;
+            total.rejected += method.second.rejected;
+            total.total_latency += method.second.total_latency;
+            total.max_latency =
+                std::max(total.max_latency, method.second.max_latency);
+          }
         }
+        return result;
       }
 
-      grpc::CompletionQueue cq_;
-      std::thread thread_;
-
+     private:
       /**
        * State and data information of gRPC call
        */
       struct AsyncClientCall {
         Response reply;
 
-        grpc::ClientContext context;
+        /// contexts can not be reused, so it is created for each call
+        boost::optional<grpc::ClientContext> context;
 
         grpc::Status status;
 
         std::unique_ptr<grpc::ClientAsyncResponseReaderInterface<Response>>
             response_reader;
+
+        /// empty for calls made without peer
+        std::string peer;
+        const char *method = nullptr;
+        std::function<void(const grpc::Status &)> on_finish;
+        std::chrono::steady_clock::time_point started;
       };
 
-      /**
-       * Universal method to perform all needed sends
-       * @tparam lambda which must return unique pointer to
-       * ClientAsyncResponseReader<Response> object
-       */
+      struct Queue {
+        grpc::CompletionQueue cq;
+        std::thread thread;
+        mutable std::mutex mutex;
+        std::vector<std::unique_ptr<AsyncClientCall>> pool;
+        /// calls waiting for response of the peers of this queue
+        std::unordered_map<std::string, size_t> in_flight;
+        std::unordered_map<std::string, MethodMetrics> methods;
+      };
+
+      AsyncClientCall *acquire(Queue &queue) {
+        std::unique_ptr<AsyncClientCall> call;
+        {
+          std::lock_guard<std::mutex> lock(queue.mutex);
+          if (not queue.pool.empty()) {
+            call = std::move(queue.pool.back());
+            queue.pool.pop_back();
+          }
+        }
+        in_flight_total_.fetch_add(1, std::memory_order_relaxed);
+        if (call) {
+          reused_.fetch_add(1, std::memory_order_relaxed);
+          return call.release();
+        }
+        return new AsyncClientCall;
+      }
+
+      /// Reset the finished call and keep it for reuse if the pool has room
+      void release(Queue &queue, AsyncClientCall *finished) {
+        std::unique_ptr<AsyncClientCall> call(finished);
+        call->response_reader.reset();
+        call->context = boost::none;
+        call->reply.Clear();
+        call->status = grpc::Status();
+        call->peer.clear();
+        call->method = nullptr;
+        call->on_finish = nullptr;
+        {
+          std::lock_guard<std::mutex> lock(queue.mutex);
+          if (queue.pool.size() < options_.max_pooled_calls) {
+            queue.pool.push_back(std::move(call));
+          }
+        }
+        in_flight_total_.fetch_sub(1, std::memory_order_relaxed);
+      }
+
       template <typename F>
-      void Call(F &&lambda) {
-        auto call = new AsyncClientCall;
-        call->response_reader = lambda(&call->context, &cq_);
+      void start(Queue &queue, AsyncClientCall *call, F &&lambda) {
+        call->context.emplace();
+        call->started = std::chrono::steady_clock::now();
+        call->response_reader = lambda(&*call->context, &queue.cq);
         call->response_reader->Finish(&call->reply, &call->status, call);
       }
 
-     private:
+      void finish(Queue &queue, const AsyncClientCall &call) {
+        auto latency = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - call.started);
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (not call.peer.empty()) {
+          auto it = queue.in_flight.find(call.peer);
+          if (--it->second == 0) {
+            queue.in_flight.erase(it);
+          }
+        }
+        if (call.method != nullptr) {
+          auto &method = queue.methods[call.method];
+          ++method.calls;
+          method.total_latency += latency;
+          method.max_latency = std::max(method.max_latency, latency);
+          if (not call.status.ok()) {
+            ++method.failures;
+          }
+        }
+      }
+
+      /**
+       * Listen to gRPC server responses
+       */
+      void asyncCompleteRpc(Queue *queue) {
+        void *got_tag;
+        auto ok = false;
+        while (queue->cq.Next(&got_tag, &ok)) {
+          auto call = static_cast<AsyncClientCall *>(got_tag);
+          if (not call->status.ok()) {
+            log_->warn("RPC {} to {} failed: {}",
+                       call->method ? call->method : "call",
+                       call->peer,
+                       call->status.error_message());
+          }
+          finish(*queue, *call);
+          if (call->on_finish) {
+            call->on_finish(call->status);
+          }
+          release(*queue, call);
+        }
+      }
+
+      const Options options_;
+      std::vector<Queue> queues_;
+      std::atomic<size_t> next_queue_{0};
+
+      std::atomic<size_t> in_flight_total_{0};
+      std::atomic<size_t> reused_{0};
+
       logger::LoggerPtr log_;
     };
   }  // namespace network
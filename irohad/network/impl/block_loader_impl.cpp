@@ -7,14 +7,12 @@
 
 #include <chrono>
 
-#include <grpc++/create_channel.h>
 #include <rxcpp/rx-lite.hpp>
 #include "backend/protobuf/block.hpp"
 #include "builders/protobuf/transport_builder.hpp"
 #include "common/bind.hpp"
 #include "interfaces/common_objects/peer.hpp"
 #include "logger/logger.hpp"
-#include "network/impl/grpc_channel_builder.hpp"
 
 using namespace iroha::ametsuchi;
 using namespace iroha::network;
@@ -26,21 +24,41 @@ namespace {
   const char *kPeerRetrieveFail = "Failed to retrieve peers";
   const char *kPeerFindFail = "Failed to find requested peer";
   const std::chrono::seconds kBlocksRequestTimeout{5};
+  /// added to the timeout of a range request for each block of the range
+  const std::chrono::milliseconds kBlockRequestTimeoutPerBlock{50};
 }  // namespace
 
 BlockLoaderImpl::BlockLoaderImpl(
     std::shared_ptr<PeerQueryFactory> peer_query_factory,
     shared_model::proto::ProtoBlockFactory factory,
-    logger::LoggerPtr log)
+    logger::LoggerPtr log,
+    std::shared_ptr<ClientFactory> client_factory)
     : peer_query_factory_(std::move(peer_query_factory)),
       block_factory_(std::move(factory)),
+      client_factory_(std::move(client_factory)),
       log_(std::move(log)) {}
 
 rxcpp::observable<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlocks(
     const shared_model::interface::types::HeightType height,
     const PublicKey &peer_pubkey) {
+  // request next block to our top
+  return streamBlocks(peer_pubkey, height + 1, 0);
+}
+
+rxcpp::observable<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlockRange(
+    const PublicKey &peer_pubkey,
+    types::HeightType first_height,
+    types::HeightType count) {
+  return streamBlocks(peer_pubkey, first_height, count);
+}
+
+rxcpp::observable<std::shared_ptr<Block>> BlockLoaderImpl::streamBlocks(
+    PublicKey peer_pubkey,
+    types::HeightType first_height,
+    types::HeightType count) {
   return rxcpp::observable<>::create<std::shared_ptr<Block>>(
-      [this, height, &peer_pubkey](auto subscriber) {
+      [this, first_height, count, peer_pubkey = std::move(peer_pubkey)](
+          auto subscriber) {
         auto peer = this->findPeer(peer_pubkey);
         if (not peer) {
           log_->error("{}", kPeerNotFound);
@@ -48,19 +66,30 @@ rxcpp::observable<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlocks(
           return;
         }
 
+        auto client = client_factory_->createClient(**peer);
+        if (auto e = iroha::expected::resultToOptionalError(client)) {
+          log_->error("Failed to create client for peer {}: {}",
+                      (*peer)->address(),
+                      e.value());
+          subscriber.on_completed();
+          return;
+        }
+
         proto::BlockRequest request;
         grpc::ClientContext context;
         protocol::Block block;
 
-        // set a timeout to avoid being hung
-        context.set_deadline(std::chrono::system_clock::now()
-                             + kBlocksRequestTimeout);
+        // set a timeout to avoid being hung, larger ranges take longer
+        const auto timeout = kBlocksRequestTimeout
+            + kBlockRequestTimeoutPerBlock
+                * static_cast<std::chrono::milliseconds::rep>(count);
+        context.set_deadline(std::chrono::system_clock::now() + timeout);
 
-        // request next block to our top
-        request.set_height(height + 1);
+        request.set_height(first_height);
+        request.set_count(count);
 
         auto reader =
-            this->getPeerStub(**peer).retrieveBlocks(&context, request);
+            client.assumeValue()->retrieveBlocks(&context, request);
         while (subscriber.is_subscribed() and reader->Read(&block)) {
           block_factory_.createBlock(std::move(block))
               .match(
@@ -85,6 +114,14 @@ boost::optional<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlock(
     return boost::none;
   }
 
+  auto client = client_factory_->createClient(**peer);
+  if (auto e = iroha::expected::resultToOptionalError(client)) {
+    log_->error("Failed to create client for peer {}: {}",
+                (*peer)->address(),
+                e.value());
+    return boost::none;
+  }
+
   proto::BlockRequest request;
   grpc::ClientContext context;
   protocol::Block block;
@@ -92,7 +129,8 @@ boost::optional<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlock(
   // request block with specified height
   request.set_height(block_height);
 
-  auto status = getPeerStub(**peer).retrieveBlock(&context, request, &block);
+  auto status =
+      client.assumeValue()->retrieveBlock(&context, request, &block);
   if (not status.ok()) {
     log_->warn("{}", status.error_message());
     return boost::none;
@@ -130,16 +168,3 @@ BlockLoaderImpl::findPeer(const shared_model::crypto::PublicKey &pubkey) {
   }
   return *it;
 }
-
-proto::Loader::StubInterface &BlockLoaderImpl::getPeerStub(
-    const shared_model::interface::Peer &peer) {
-  auto it = peer_connections_.find(peer.address());
-  if (it == peer_connections_.end()) {
-    it = peer_connections_
-             .insert(std::make_pair(
-                 peer.address(),
-                 network::createClient<proto::Loader>(peer.address())))
-             .first;
-  }
-  return *it->second;
-}
@@ -8,34 +8,52 @@
 
 #include "network/block_loader.hpp"
 
-#include <unordered_map>
-
 #include "ametsuchi/peer_query_factory.hpp"
 #include "backend/protobuf/proto_block_factory.hpp"
 #include "loader.grpc.pb.h"
 #include "logger/logger_fwd.hpp"
+#include "network/impl/client_factory.hpp"
 
 namespace iroha {
   namespace network {
     class BlockLoaderImpl : public BlockLoader {
      public:
+      using ClientFactory = network::ClientFactory<proto::Loader>;
+
       // TODO 30.01.2019 lebdron: IR-264 Remove PeerQueryFactory
       BlockLoaderImpl(
           std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory,
           shared_model::proto::ProtoBlockFactory factory,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          std::shared_ptr<ClientFactory> client_factory);
 
       rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
       retrieveBlocks(
           const shared_model::interface::types::HeightType height,
           const shared_model::crypto::PublicKey &peer_pubkey) override;
 
+      rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
+      retrieveBlockRange(
+          const shared_model::crypto::PublicKey &peer_pubkey,
+          shared_model::interface::types::HeightType first_height,
+          shared_model::interface::types::HeightType count) override;
+
       boost::optional<std::shared_ptr<shared_model::interface::Block>>
       retrieveBlock(
           const shared_model::crypto::PublicKey &peer_pubkey,
           shared_model::interface::types::HeightType block_height) override;
 
      private:
+      /**
+       * Stream blocks from the peer
+       * @param first_height - height of the first requested block
+       * @param count - number of requested blocks, 0 for all up to the top
+       */
+      rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
+      streamBlocks(shared_model::crypto::PublicKey peer_pubkey,
+                   shared_model::interface::types::HeightType first_height,
+                   shared_model::interface::types::HeightType count);
+
       /**
        * Retrieve peers from database, and find the requested peer by pubkey
        * @param pubkey - public key of requested peer
@@ -44,19 +62,9 @@ namespace iroha {
        */
       boost::optional<std::shared_ptr<shared_model::interface::Peer>> findPeer(
           const shared_model::crypto::PublicKey &pubkey);
-      /**
-       * Get or create a RPC stub for connecting to peer
-       * @param peer for connecting
-       * @return RPC stub
-       */
-      proto::Loader::StubInterface &getPeerStub(
-          const shared_model::interface::Peer &peer);
-
-      std::unordered_map<shared_model::interface::types::AddressType,
-                         std::unique_ptr<proto::Loader::StubInterface>>
-          peer_connections_;
       std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory_;
       shared_model::proto::ProtoBlockFactory block_factory_;
+      std::shared_ptr<ClientFactory> client_factory_;
 
       logger::LoggerPtr log_;
     };
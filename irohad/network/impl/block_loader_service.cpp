@@ -5,6 +5,8 @@
 
 #include "network/impl/block_loader_service.hpp"
 
+#include <algorithm>
+
 #include "backend/protobuf/block.hpp"
 #include "common/bind.hpp"
 #include "logger/logger.hpp"
@@ -51,8 +53,12 @@ grpc::Status BlockLoaderService::retrieveBlocks(
     return grpc::Status(grpc::StatusCode::INTERNAL, "internal error happened");
   }
 
-  auto top_height = (*block_query)->getTopBlockHeight();
-  for (decltype(top_height) i = request->height(); i <= top_height; ++i) {
+  auto last_height = (*block_query)->getTopBlockHeight();
+  if (request->count() != 0) {
+    last_height =
+        std::min(last_height, request->height() + request->count() - 1);
+  }
+  for (auto i = request->height(); i <= last_height; ++i) {
     auto block_result = (*block_query)->getBlock(i);
 
     if (auto e = expected::resultToOptionalError(block_result)) {
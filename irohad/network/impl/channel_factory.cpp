@@ -6,6 +6,7 @@
 #include "network/impl/channel_factory.hpp"
 
 #include <limits>
+#include <mutex>
 
 #include <fmt/core.h>
 #include <boost/algorithm/string/join.hpp>
@@ -107,10 +108,16 @@ std::shared_ptr<grpc::Channel> iroha::network::createInsecureChannel(
 
 class ChannelFactory::ChannelArgumentsProvider {
  public:
-  ChannelArgumentsProvider(std::shared_ptr<const GrpcChannelParams> params)
-      : params_(std::move(params)) {}
+  ChannelArgumentsProvider(std::shared_ptr<const GrpcChannelParams> params,
+                           std::set<std::string> service_names)
+      : params_(std::move(params)), service_names_(std::move(service_names)) {
+    if (not service_names_.empty()) {
+      args_ = makeChannelArguments(service_names_, *params_);
+    }
+  }
 
-  const grpc::ChannelArguments &get(const std::string &service_full_name) {
+  grpc::ChannelArguments get(const std::string &service_full_name) {
+    std::lock_guard<std::mutex> lock(mutex_);
     if (service_names_.count(service_full_name) == 0) {
       service_names_.emplace(service_full_name);
       args_ = makeChannelArguments(service_names_, *params_);
@@ -120,12 +127,15 @@ class ChannelFactory::ChannelArgumentsProvider {
 
  private:
   std::shared_ptr<const GrpcChannelParams> params_;
+  std::mutex mutex_;
   std::set<std::string> service_names_;
   grpc::ChannelArguments args_;
 };
 
-ChannelFactory::ChannelFactory(std::shared_ptr<const GrpcChannelParams> params)
-    : args_(std::make_unique<ChannelArgumentsProvider>(std::move(params))) {}
+ChannelFactory::ChannelFactory(std::shared_ptr<const GrpcChannelParams> params,
+                               std::set<std::string> service_names)
+    : args_(std::make_unique<ChannelArgumentsProvider>(
+          std::move(params), std::move(service_names))) {}
 
 ChannelFactory::~ChannelFactory() = default;
 
@@ -87,8 +87,14 @@ namespace iroha {
 
     class ChannelFactory : public ChannelProvider {
      public:
-      /// @param params grpc channel params
-      ChannelFactory(std::shared_ptr<const GrpcChannelParams> params);
+      /**
+       * @param params grpc channel params
+       * @param service_names - services configured in every created channel,
+       *  in addition to the requested one, so that a channel can be shared
+       *  by clients of these services
+       */
+      ChannelFactory(std::shared_ptr<const GrpcChannelParams> params,
+                     std::set<std::string> service_names = {});
 
       ~ChannelFactory() override;
 
@@ -5,7 +5,7 @@
 
 #include "network/impl/channel_pool.hpp"
 
-#include <shared_mutex>
+#include <mutex>
 #include <unordered_map>
 
 #include "cryptography/blob_hasher.hpp"
@@ -17,41 +17,135 @@
 using namespace iroha::expected;
 using namespace iroha::network;
 
+constexpr std::chrono::minutes ChannelPool::kDefaultIdleTimeout;
+
 class ChannelPool::Impl {
  public:
-  Impl(std::unique_ptr<ChannelProvider> channel_provider)
-      : channel_provider_(std::move(channel_provider)) {}
+  Impl(std::unique_ptr<ChannelProvider> channel_provider,
+       std::chrono::milliseconds idle_timeout,
+       std::function<Clock::time_point()> now)
+      : channel_provider_(std::move(channel_provider)),
+        idle_timeout_(idle_timeout),
+        now_(std::move(now)),
+        next_eviction_(now_() + idle_timeout_) {}
 
   Result<std::shared_ptr<grpc::Channel>, std::string> getOrCreate(
       const std::string &service_full_name,
       const shared_model::interface::Peer &peer) {
-    std::shared_lock<std::shared_timed_mutex> read_lock(mutex_);
+    const auto now = now_();
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (now >= next_eviction_) {
+      evictIdle(now);
+    }
     auto i = channels_.find(peer.pubkey());
     if (i != channels_.end()) {
-      return i->second;
+      if (isHealthy(i->second, peer)) {
+        ++metrics_.reused;
+        i->second.last_used = now;
+        return i->second.channel;
+      }
+      ++metrics_.replaced;
+      channels_.erase(i);
+    }
+    lock.unlock();
+
+    auto result = channel_provider_->getChannel(service_full_name, peer);
+
+    lock.lock();
+    if (hasError(result)) {
+      ++metrics_.failed;
+      return result;
+    }
+    // the channel could be created concurrently for the same peer
+    auto inserted = channels_.emplace(
+        peer.pubkey(), Entry{result.assumeValue(), peer.address(), now});
+    if (inserted.second) {
+      ++metrics_.created;
+    } else {
+      ++metrics_.reused;
+      inserted.first->second.last_used = now;
+    }
+    return inserted.first->second.channel;
+  }
+
+  size_t evictIdle() {
+    const auto now = now_();
+    std::lock_guard<std::mutex> lock(mutex_);
+    return evictIdle(now);
+  }
+
+  Metrics metrics() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto metrics = metrics_;
+    metrics.channels = channels_.size();
+    for (const auto &entry : channels_) {
+      switch (entry.second.channel->GetState(false)) {
+        case GRPC_CHANNEL_READY:
+          ++metrics.ready;
+          break;
+        case GRPC_CHANNEL_TRANSIENT_FAILURE:
+          ++metrics.transient_failures;
+          break;
+        default:
+          break;
+      }
     }
-    read_lock.unlock();
-
-    return channel_provider_->getChannel(service_full_name, peer) |
-        [this, &peer](auto &&new_channel) {
-          std::unique_lock<std::shared_timed_mutex> write_lock(mutex_);
-          channels_[peer.pubkey()] = new_channel;
-          return std::move(new_channel);
-        };
+    return metrics;
   }
 
  private:
+  struct Entry {
+    std::shared_ptr<grpc::Channel> channel;
+    shared_model::interface::types::AddressType address;
+    Clock::time_point last_used;
+  };
+
+  /**
+   * A channel can serve the peer while its address is the same and the
+   * channel is not shut down. Transient failures are handled by gRPC, which
+   * reconnects with backoff.
+   */
+  static bool isHealthy(const Entry &entry,
+                        const shared_model::interface::Peer &peer) {
+    return entry.address == peer.address()
+        and entry.channel->GetState(false) != GRPC_CHANNEL_SHUTDOWN;
+  }
+
+  size_t evictIdle(Clock::time_point now) {
+    next_eviction_ = now + idle_timeout_;
+    size_t evicted = 0;
+    for (auto i = channels_.begin(); i != channels_.end();) {
+      // clients keep their stubs, and so the channel, while they use it
+      if (now - i->second.last_used >= idle_timeout_
+          and i->second.channel.use_count() == 1) {
+        i = channels_.erase(i);
+        ++evicted;
+      } else {
+        ++i;
+      }
+    }
+    metrics_.evicted += evicted;
+    return evicted;
+  }
+
   std::unique_ptr<ChannelProvider> channel_provider_;
+  const std::chrono::milliseconds idle_timeout_;
+  std::function<Clock::time_point()> now_;
 
-  std::shared_timed_mutex mutex_;
+  mutable std::mutex mutex_;
   std::unordered_map<shared_model::crypto::PublicKey,
-                     std::shared_ptr<grpc::Channel>,
+                     Entry,
                      shared_model::crypto::BlobHasher>
       channels_;
+  Clock::time_point next_eviction_;
+  Metrics metrics_{};
 };
 
-ChannelPool::ChannelPool(std::unique_ptr<ChannelProvider> channel_provider)
-    : impl_(std::make_unique<Impl>(std::move(channel_provider))) {}
+ChannelPool::ChannelPool(std::unique_ptr<ChannelProvider> channel_provider,
+                         std::chrono::milliseconds idle_timeout,
+                         std::function<Clock::time_point()> now)
+    : impl_(std::make_unique<Impl>(
+          std::move(channel_provider), idle_timeout, std::move(now))) {}
 
 ChannelPool::~ChannelPool() = default;
 
@@ -60,3 +154,11 @@ Result<std::shared_ptr<grpc::Channel>, std::string> ChannelPool::getChannel(
     const shared_model::interface::Peer &peer) {
   return impl_->getOrCreate(service_full_name, peer);
 }
+
+size_t ChannelPool::evictIdle() {
+  return impl_->evictIdle();
+}
+
+ChannelPool::Metrics ChannelPool::metrics() const {
+  return impl_->metrics();
+}
@@ -8,16 +8,62 @@
 
 #include "network/impl/channel_provider.hpp"
 
+#include <chrono>
+#include <functional>
+
 namespace iroha {
   namespace network {
 
+    /**
+     * Keeps one channel per peer, shared by the clients of all services.
+     * A channel is replaced when the peer address changes or the channel is
+     * shut down, and dropped when it was neither requested nor referenced by
+     * any client for the idle timeout.
+     *
+     * Channels are created with the arguments of the service requested
+     * first, so the underlying provider should configure them for all
+     * services which are requested through the pool.
+     */
     class ChannelPool : public ChannelProvider {
      public:
+      using Clock = std::chrono::steady_clock;
+
+      /// Connection counters of the pool
+      struct Metrics {
+        /// channels created by the underlying provider
+        size_t created;
+        /// requests served with an existing channel
+        size_t reused;
+        /// channels dropped after the idle timeout
+        size_t evicted;
+        /// channels replaced after failed health check
+        size_t replaced;
+        /// errors of the underlying provider
+        size_t failed;
+
+        /// channels in the pool
+        size_t channels;
+        /// channels with an established connection
+        size_t ready;
+        /// channels which failed to connect and wait for reconnection
+        size_t transient_failures;
+      };
+
+      static constexpr std::chrono::minutes kDefaultIdleTimeout{5};
+
       /**
        * @param channel_provider - Factory that is used to create missing
        * channels.
+       * @param idle_timeout - time after the last request of a channel, when
+       * it is dropped if no client references it
+       * @param now - source of current time
        */
-      explicit ChannelPool(std::unique_ptr<ChannelProvider> channel_provider);
+      explicit ChannelPool(
+          std::unique_ptr<ChannelProvider> channel_provider,
+          std::chrono::milliseconds idle_timeout = kDefaultIdleTimeout,
+          std::function<Clock::time_point()> now = [] {
+            return Clock::now();
+          });
 
       ~ChannelPool();
 
@@ -25,6 +71,14 @@ namespace iroha {
       getChannel(const std::string &service_full_name,
                  const shared_model::interface::Peer &peer) override;
 
+      /**
+       * Drop idle channels. It is also done periodically by getChannel.
+       * @return number of dropped channels
+       */
+      size_t evictIdle();
+
+      Metrics metrics() const;
+
      private:
       class Impl;
       std::unique_ptr<Impl> impl_;
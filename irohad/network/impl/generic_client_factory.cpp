@@ -8,5 +8,5 @@
 using namespace iroha::network;
 
 GenericClientFactory::GenericClientFactory(
-    std::unique_ptr<ChannelProvider> channel_provider)
+    std::shared_ptr<ChannelProvider> channel_provider)
     : channel_provider_(std::move(channel_provider)) {}
@@ -16,7 +16,7 @@ namespace iroha {
 
     class GenericClientFactory {
      public:
-      GenericClientFactory(std::unique_ptr<ChannelProvider> channel_provider);
+      GenericClientFactory(std::shared_ptr<ChannelProvider> channel_provider);
 
       /**
        * Creates client which is capable of sending and receiving
@@ -35,7 +35,7 @@ namespace iroha {
       }
 
      private:
-      std::unique_ptr<ChannelProvider> channel_provider_;
+      std::shared_ptr<ChannelProvider> channel_provider_;
     };
 
   }  // namespace network
@@ -6,9 +6,10 @@
 #ifndef IROHA_MST_TRANSPORT_HPP
 #define IROHA_MST_TRANSPORT_HPP
 
+#include <functional>
 #include <memory>
 #include "interfaces/common_objects/peer.hpp"
-#include "multi_sig_transactions/state/mst_state.hpp"
+#include "multi_sig_transactions/state/mst_gossip.hpp"
 
 namespace iroha {
   namespace network {
@@ -21,10 +22,10 @@ namespace iroha {
       /**
        * Handler method for updating state, when new data received
        * @param from - key of the peer emitted the state
-       * @param new_state - state propagated from peer
+       * @param gossip - batches and signatures propagated from peer
        */
       virtual void onNewState(const shared_model::crypto::PublicKey &from,
-                              MstState new_state) = 0;
+                              MstGossip gossip) = 0;
 
       virtual ~MstTransportNotification() = default;
     };
@@ -35,6 +36,9 @@ namespace iroha {
      */
     class MstTransport {
      public:
+      /// Called once with whether the recipient has received the gossip
+      using SentCallback = std::function<void(bool delivered)>;
+
       /**
        * Subscribe object for receiving notifications
        * @param notification - object that will be notified on updates
@@ -45,10 +49,12 @@ namespace iroha {
       /**
        * Share state with other peer
        * @param to - peer recipient of message
-       * @param providing_state - state for transmitting
+       * @param gossip - batches and signatures for transmitting
+       * @param on_sent - called when the gossip is delivered or lost
        */
       virtual void sendState(const shared_model::interface::Peer &to,
-                             const MstState &providing_state) = 0;
+                             const MstGossip &gossip,
+                             SentCallback on_sent) = 0;
 
       virtual ~MstTransport() = default;
     };
@@ -110,24 +110,11 @@ OnDemandOrderingGate::processProposalRequest(
 void OnDemandOrderingGate::sendCachedTransactions() {
   // TODO mboldyrev 22.03.2019 IR-425
   // make cache_->getBatchesForRound(current_round) that respects sync
-  auto batches = cache_->pop();
-  cache_->addToBack(batches);
-
   // get only transactions which fit to next proposal
-  auto end_iterator = batches.begin();
-  auto current_number_of_transactions = 0u;
-  for (; end_iterator != batches.end(); ++end_iterator) {
-    auto batch_size = (*end_iterator)->transactions().size();
-    if (current_number_of_transactions + batch_size <= transaction_limit_) {
-      current_number_of_transactions += batch_size;
-    } else {
-      break;
-    }
-  }
+  auto batches = cache_->rotate(transaction_limit_);
 
   if (not batches.empty()) {
-    network_client_->onBatches(transport::OdOsNotification::CollectionType{
-        batches.begin(), end_iterator});
+    network_client_->onBatches(std::move(batches));
   }
 }
 
@@ -21,11 +21,35 @@
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "interfaces/transaction.hpp"
 #include "logger/logger.hpp"
+#include "metrics/metrics.hpp"
+#include "tracing/tx_tracer.hpp"
 
 using namespace iroha;
 using namespace iroha::ordering;
 using TransactionBatchType = transport::OdOsNotification::TransactionBatchType;
 
+namespace {
+  /// Metrics of the ordering service
+  struct OrderingMetrics {
+    metrics::Gauge &pending_batches;
+    metrics::Counter &discarded_transactions;
+    metrics::Histogram &proposal_size;
+  };
+
+  OrderingMetrics &orderingMetrics() {
+    auto &registry = metrics::defaultRegistry();
+    static OrderingMetrics metrics{
+        registry.gauge("iroha_ordering_pending_batches",
+                       "Batches waiting in the ordering service queue"),
+        registry.counter("iroha_ordering_discarded_transactions_total",
+                         "Transactions which did not fit into a proposal"),
+        registry.histogram("iroha_ordering_proposal_transactions",
+                           "Transactions in created proposals",
+                           metrics::sizeBounds())};
+    return metrics;
+  }
+}  // namespace
+
 OnDemandOrderingServiceImpl::OnDemandOrderingServiceImpl(
     size_t transaction_limit,
     std::shared_ptr<shared_model::interface::UnsafeProposalFactory>
@@ -64,9 +88,13 @@ void OnDemandOrderingServiceImpl::onBatches(CollectionType batches) {
       unprocessed_batches.begin(),
       unprocessed_batches.end(),
       [this](auto &obj) {
+        for (const auto &tx : obj->transactions()) {
+          tracing::defaultTracer().mark(tx->hash(), tracing::Stage::kQueued);
+        }
         std::shared_lock<std::shared_timed_mutex> lock(batches_mutex_);
         pending_batches_.insert(std::move(obj));
       });
+  orderingMetrics().pending_batches.set(pending_batches_.size());
   log_->info("onBatches => collection size = {}", batches.size());
 }
 
@@ -138,6 +166,7 @@ void OnDemandOrderingServiceImpl::packNextProposals(
     auto txs = getTransactions(
         transaction_limit_, pending_batches_, discarded_txs_quantity);
     log_->debug("Discarded {} transactions", discarded_txs_quantity);
+    orderingMetrics().discarded_transactions.increment(discarded_txs_quantity);
     auto now = iroha::time::now();
     // create proposals for the next commit and reject rounds
     tryCreateProposal({round.block_round, round.reject_round + 1}, txs, now);
@@ -147,6 +176,7 @@ void OnDemandOrderingServiceImpl::packNextProposals(
   if (round.reject_round == kFirstRejectRound) {
     std::lock_guard<std::shared_timed_mutex> lock(batches_mutex_);
     pending_batches_.clear();
+    orderingMetrics().pending_batches.set(0);
   }
 }
 
@@ -162,6 +192,10 @@ void OnDemandOrderingServiceImpl::tryCreateProposal(
           round.block_round, created_time, txs | boost::adaptors::indirected);
       proposal_map_.erase(round);
       proposal_map_.emplace(round, std::move(proposal));
+      orderingMetrics().proposal_size.record(txs.size());
+      for (const auto &tx : txs) {
+        tracing::defaultTracer().mark(tx->hash(), tracing::Stage::kProposed);
+      }
       log_->debug(
           "packNextProposal: data has been fetched for {}. "
           "Number of transactions in proposal = {}.",
@@ -10,14 +10,62 @@
 #include "interfaces/common_objects/peer.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "logger/logger.hpp"
-#include "network/impl/grpc_channel_builder.hpp"
+#include "metrics/metrics.hpp"
 
 using namespace iroha;
 using namespace iroha::ordering;
 using namespace iroha::ordering::transport;
 
+namespace {
+  /// Metrics of proposal requests to the ordering services of peers
+  struct ProposalRequestMetrics {
+    metrics::Histogram &latency;
+    metrics::Counter &failures;
+    metrics::Counter &empty;
+  };
+
+  ProposalRequestMetrics &proposalRequestMetrics() {
+    auto &registry = metrics::defaultRegistry();
+    static ProposalRequestMetrics metrics{
+        registry.histogram("iroha_ordering_proposal_request_microseconds",
+                           "Time to fetch a proposal from an ordering service",
+                           metrics::latencyBounds()),
+        registry.counter("iroha_ordering_proposal_request_failures_total",
+                         "Proposal requests failed with RPC errors"),
+        registry.counter("iroha_ordering_proposal_request_empty_total",
+                         "Proposal requests answered without a proposal")};
+    return metrics;
+  }
+
+  /// Connection to a peer, for which the client could not be created
+  class UnreachablePeerClient : public OdOsNotification {
+   public:
+    UnreachablePeerClient(std::string address, logger::LoggerPtr log)
+        : address_(std::move(address)), log_(std::move(log)) {}
+
+    void onBatches(CollectionType batches) override {
+      log_->warn("No connection to {}, {} batches dropped",
+                 address_,
+                 batches.size());
+    }
+
+    boost::optional<std::shared_ptr<const ProposalType>> onRequestProposal(
+        consensus::Round round) override {
+      log_->warn("No connection to {}, proposal for round {} not requested",
+                 address_,
+                 round);
+      return boost::none;
+    }
+
+   private:
+    std::string address_;
+    logger::LoggerPtr log_;
+  };
+}  // namespace
+
 OnDemandOsClientGrpc::OnDemandOsClientGrpc(
     std::unique_ptr<proto::OnDemandOrdering::StubInterface> stub,
+    std::string address,
     std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
         async_call,
     std::shared_ptr<TransportFactoryType> proposal_factory,
@@ -26,6 +74,7 @@ OnDemandOsClientGrpc::OnDemandOsClientGrpc(
     logger::LoggerPtr log)
     : log_(std::move(log)),
       stub_(std::move(stub)),
+      address_(std::move(address)),
       async_call_(std::move(async_call)),
       proposal_factory_(std::move(proposal_factory)),
       time_provider_(std::move(time_provider)),
@@ -41,11 +90,13 @@ void OnDemandOsClientGrpc::onBatches(CollectionType batches) {
     }
   }
 
-  log_->debug("Propagating: '{}'", request.DebugString());
+  log_->debug("Propagating: '{}'",
+              logger::lazy([&request] { return request.DebugString(); }));
 
-  async_call_->Call([&](auto context, auto cq) {
-    return stub_->AsyncSendBatches(context, request, cq);
-  });
+  async_call_->Call(
+      address_, "OnDemandOrdering.SendBatches", [&](auto context, auto cq) {
+        return stub_->AsyncSendBatches(context, request, cq);
+      });
 }
 
 boost::optional<std::shared_ptr<const OdOsNotification::ProposalType>>
@@ -56,12 +107,19 @@ OnDemandOsClientGrpc::onRequestProposal(consensus::Round round) {
   request.mutable_round()->set_block_round(round.block_round);
   request.mutable_round()->set_reject_round(round.reject_round);
   proto::ProposalResponse response;
-  auto status = stub_->RequestProposal(&context, request, &response);
+  auto &metrics = proposalRequestMetrics();
+  grpc::Status status;
+  {
+    metrics::ScopedTimer timer(metrics.latency);
+    status = stub_->RequestProposal(&context, request, &response);
+  }
   if (not status.ok()) {
+    metrics.failures.increment();
     log_->warn("RPC failed: {}", status.error_message());
     return boost::none;
   }
   if (not response.has_proposal()) {
+    metrics.empty.increment();
     return boost::none;
   }
   return proposal_factory_->build(response.proposal())
@@ -84,20 +142,32 @@ OnDemandOsClientGrpcFactory::OnDemandOsClientGrpcFactory(
     std::shared_ptr<TransportFactoryType> proposal_factory,
     std::function<OnDemandOsClientGrpc::TimepointType()> time_provider,
     OnDemandOsClientGrpc::TimeoutType proposal_request_timeout,
-    logger::LoggerPtr client_log)
+    logger::LoggerPtr client_log,
+    std::shared_ptr<ClientFactory> client_factory)
     : async_call_(std::move(async_call)),
       proposal_factory_(std::move(proposal_factory)),
       time_provider_(time_provider),
       proposal_request_timeout_(proposal_request_timeout),
-      client_log_(std::move(client_log)) {}
+      client_log_(std::move(client_log)),
+      client_factory_(std::move(client_factory)) {}
 
 std::unique_ptr<OdOsNotification> OnDemandOsClientGrpcFactory::create(
     const shared_model::interface::Peer &to) {
-  return std::make_unique<OnDemandOsClientGrpc>(
-      network::createClient<proto::OnDemandOrdering>(to.address()),
-      async_call_,
-      proposal_factory_,
-      time_provider_,
-      proposal_request_timeout_,
-      client_log_);
+  return client_factory_->createClient(to).match(
+      [&](auto &&stub) -> std::unique_ptr<OdOsNotification> {
+        return std::make_unique<OnDemandOsClientGrpc>(std::move(stub.value),
+                                                      to.address(),
+                                                      async_call_,
+                                                      proposal_factory_,
+                                                      time_provider_,
+                                                      proposal_request_timeout_,
+                                                      client_log_);
+      },
+      [&](const auto &error) -> std::unique_ptr<OdOsNotification> {
+        client_log_->error("Failed to create client for {}: {}",
+                           to.address(),
+                           error.error);
+        return std::make_unique<UnreachablePeerClient>(to.address(),
+                                                       client_log_);
+      });
 }
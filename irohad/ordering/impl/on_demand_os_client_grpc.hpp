@@ -11,6 +11,7 @@
 #include "interfaces/iroha_internal/abstract_transport_factory.hpp"
 #include "logger/logger_fwd.hpp"
 #include "network/impl/async_grpc_client.hpp"
+#include "network/impl/client_factory.hpp"
 #include "ordering.grpc.pb.h"
 
 namespace iroha {
@@ -35,6 +36,7 @@ namespace iroha {
          */
         OnDemandOsClientGrpc(
             std::unique_ptr<proto::OnDemandOrdering::StubInterface> stub,
+            std::string address,
             std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
                 async_call,
             std::shared_ptr<TransportFactoryType> proposal_factory,
@@ -50,6 +52,8 @@ namespace iroha {
        private:
         logger::LoggerPtr log_;
         std::unique_ptr<proto::OnDemandOrdering::StubInterface> stub_;
+        /// address of the peer, which limits the batches in flight
+        std::string address_;
         std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
             async_call_;
         std::shared_ptr<TransportFactoryType> proposal_factory_;
@@ -60,19 +64,21 @@ namespace iroha {
       class OnDemandOsClientGrpcFactory : public OdOsNotificationFactory {
        public:
         using TransportFactoryType = OnDemandOsClientGrpc::TransportFactoryType;
+        using ClientFactory =
+            network::ClientFactory<proto::OnDemandOrdering>;
         OnDemandOsClientGrpcFactory(
             std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
                 async_call,
             std::shared_ptr<TransportFactoryType> proposal_factory,
             std::function<OnDemandOsClientGrpc::TimepointType()> time_provider,
             OnDemandOsClientGrpc::TimeoutType proposal_request_timeout,
-            logger::LoggerPtr client_log);
+            logger::LoggerPtr client_log,
+            std::shared_ptr<ClientFactory> client_factory);
 
         /**
-         * Create connection with insecure gRPC channel defined by
-         * network::createClient method
-         * @see network/impl/grpc_channel_builder.hpp
-         * This factory method can be used in production code
+         * Create connection with gRPC stub provided by the client factory.
+         * If the stub can not be created, the returned connection drops
+         * batches and returns no proposals.
          */
         std::unique_ptr<OdOsNotification> create(
             const shared_model::interface::Peer &to) override;
@@ -84,6 +90,7 @@ namespace iroha {
         std::function<OnDemandOsClientGrpc::TimepointType()> time_provider_;
         std::chrono::milliseconds proposal_request_timeout_;
         logger::LoggerPtr client_log_;
+        std::shared_ptr<ClientFactory> client_factory_;
       };
 
     }  // namespace transport
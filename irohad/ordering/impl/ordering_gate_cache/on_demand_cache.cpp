@@ -13,26 +13,34 @@ using namespace iroha::ordering::cache;
 // TODO: IR-1864 13.11.18 kamilsa use nvi to separate business logic and locking
 // logic
 
+constexpr size_t OnDemandCache::kSlots;
+
 void OnDemandCache::addToBack(
     const OrderingGateCache::BatchesSetType &batches) {
   std::unique_lock<std::shared_timed_mutex> lock(mutex_);
-  circ_buffer.back().insert(batches.begin(), batches.end());
+  const auto slot = tailSlot();
+  for (const auto &batch : batches) {
+    if (slots_[slot].insert(batch).second) {
+      for (const auto &tx : batch->transactions()) {
+        index_.emplace(tx->hash(), Location{slot, batch});
+      }
+    }
+  }
 }
 
 void OnDemandCache::remove(const OrderingGateCache::HashesSetType &hashes) {
   std::unique_lock<std::shared_timed_mutex> lock(mutex_);
-  for (auto &batches : circ_buffer) {
-    for (auto it = batches.begin(); it != batches.end();) {
-      if (std::any_of(it->get()->transactions().begin(),
-                      it->get()->transactions().end(),
-                      [&hashes](const auto &tx) {
-                        return hashes.find(tx->hash()) != hashes.end();
-                      })) {
-        // returns iterator following the last removed element
-        // hence there is no increment in loop iteration_expression
-        it = batches.erase(it);
-      } else {
-        ++it;
+  std::vector<Location> found;
+  for (const auto &hash : hashes) {
+    found.clear();
+    auto range = index_.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+      found.push_back(it->second);
+    }
+    // removal of a batch invalidates the range
+    for (const auto &location : found) {
+      if (slots_[location.slot].erase(location.batch) > 0) {
+        unindex(location.slot, location.batch);
       }
     }
   }
@@ -41,18 +49,57 @@ void OnDemandCache::remove(const OrderingGateCache::HashesSetType &hashes) {
 OrderingGateCache::BatchesSetType OnDemandCache::pop() {
   std::unique_lock<std::shared_timed_mutex> lock(mutex_);
   BatchesSetType res;
-  std::swap(res, circ_buffer.front());
-  // push empty set to remove front element
-  circ_buffer.push_back(BatchesSetType{});
+  std::swap(res, slots_[head_]);
+  for (const auto &batch : res) {
+    unindex(head_, batch);
+  }
+  // the emptied head becomes the tail
+  head_ = (head_ + 1) % kSlots;
+  return res;
+}
+
+OrderingGateCache::BatchesCollectionType OnDemandCache::rotate(
+    size_t max_transactions) {
+  std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+  BatchesCollectionType res;
+  size_t transactions = 0;
+  for (const auto &batch : slots_[head_]) {
+    const auto batch_size = batch->transactions().size();
+    if (transactions + batch_size > max_transactions) {
+      break;
+    }
+    transactions += batch_size;
+    res.push_back(batch);
+  }
+  // slots keep their indices, so the index stays valid
+  head_ = (head_ + 1) % kSlots;
   return res;
 }
 
 const OrderingGateCache::BatchesSetType &OnDemandCache::head() const {
   std::shared_lock<std::shared_timed_mutex> lock(mutex_);
-  return circ_buffer.front();
+  return slots_[head_];
 }
 
 const OrderingGateCache::BatchesSetType &OnDemandCache::tail() const {
   std::shared_lock<std::shared_timed_mutex> lock(mutex_);
-  return circ_buffer.back();
+  return slots_[tailSlot()];
+}
+
+size_t OnDemandCache::tailSlot() const {
+  return (head_ + kSlots - 1) % kSlots;
+}
+
+void OnDemandCache::unindex(
+    size_t slot,
+    const std::shared_ptr<shared_model::interface::TransactionBatch> &batch) {
+  for (const auto &tx : batch->transactions()) {
+    auto range = index_.equal_range(tx->hash());
+    for (auto it = range.first; it != range.second; ++it) {
+      if (it->second.slot == slot and it->second.batch == batch) {
+        index_.erase(it);
+        break;
+      }
+    }
+  }
 }
@@ -8,20 +8,28 @@
 
 #include "ordering/impl/ordering_gate_cache/ordering_gate_cache.hpp"
 
+#include <array>
+#include <mutex>
 #include <shared_mutex>
-
-#include <boost/circular_buffer.hpp>
+#include <unordered_map>
 
 namespace iroha {
   namespace ordering {
     namespace cache {
 
+      /**
+       * Cache of three slots of batches, which form a ring. Batches are
+       * indexed by the hashes of their transactions, so that removal of
+       * committed transactions does not scan the cached batches.
+       */
       class OnDemandCache : public OrderingGateCache {
        public:
         void addToBack(const BatchesSetType &batches) override;
 
         BatchesSetType pop() override;
 
+        BatchesCollectionType rotate(size_t max_transactions) override;
+
         void remove(const HashesSetType &hashes) override;
 
         virtual const BatchesSetType &head() const override;
@@ -29,9 +37,31 @@ namespace iroha {
         virtual const BatchesSetType &tail() const override;
 
        private:
+        static constexpr size_t kSlots = 3;
+
+        /// Slot of a batch with the transaction
+        struct Location {
+          size_t slot;
+          std::shared_ptr<shared_model::interface::TransactionBatch> batch;
+        };
+
+        size_t tailSlot() const;
+
+        /// Remove the index entries of the batch in the slot
+        void unindex(
+            size_t slot,
+            const std::shared_ptr<shared_model::interface::TransactionBatch>
+                &batch);
+
         mutable std::shared_timed_mutex mutex_;
-        using BatchesQueueType = boost::circular_buffer<BatchesSetType>;
-        BatchesQueueType circ_buffer{3, BatchesSetType{}};
+        std::array<BatchesSetType, kSlots> slots_;
+        /// slot, which is the head of the queue
+        size_t head_ = 0;
+        /// the same transaction may be in several batches
+        std::unordered_multimap<shared_model::crypto::Hash,
+                                Location,
+                                shared_model::crypto::Hash::Hasher>
+            index_;
       };
 
     }  // namespace cache
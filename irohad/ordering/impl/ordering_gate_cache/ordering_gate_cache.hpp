@@ -8,6 +8,7 @@
 
 #include <memory>
 #include <unordered_set>
+#include <vector>
 
 #include "cryptography/hash.hpp"
 
@@ -49,6 +50,9 @@ namespace iroha {
             std::unordered_set<shared_model::crypto::Hash,
                                shared_model::crypto::Hash::Hasher>;
 
+        using BatchesCollectionType = std::vector<
+            std::shared_ptr<shared_model::interface::TransactionBatch>>;
+
         /**
          * Concatenates batches from the tail of the queue with provided batches
          */
@@ -59,6 +63,14 @@ namespace iroha {
          */
         virtual BatchesSetType pop() = 0;
 
+        /**
+         * Moves the head batches to the tail of the queue, same as pop
+         * followed by addToBack with the popped batches, without copying them
+         * @param max_transactions - limit of transactions in returned batches
+         * @return moved batches, which fit into the limit
+         */
+        virtual BatchesCollectionType rotate(size_t max_transactions) = 0;
+
         /**
          * Removes batches by provided hashes from the head of the queue
          */
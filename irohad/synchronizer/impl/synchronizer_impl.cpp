@@ -5,8 +5,17 @@
 
 #include "synchronizer/impl/synchronizer_impl.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
 #include <utility>
 
+#include <boost/optional.hpp>
+#include <boost/range/size.hpp>
 #include <rxcpp/operators/rx-tap.hpp>
 #include "ametsuchi/block_query_factory.hpp"
 #include "ametsuchi/command_executor.hpp"
@@ -15,6 +24,208 @@
 #include "common/visitor.hpp"
 #include "interfaces/iroha_internal/block.hpp"
 #include "logger/logger.hpp"
+#include "tracing/tx_tracer.hpp"
+
+namespace {
+  using BlockPtr = std::shared_ptr<shared_model::interface::Block>;
+  using HeightType = shared_model::interface::types::HeightType;
+
+  /**
+   * Download of disjoint height ranges from several peers at once. Each peer
+   * is served by its own thread, which takes the next range, so the block
+   * signatures are verified by the loader in parallel. The blocks are
+   * reordered and emitted in height order as soon as they are available.
+   *
+   * A peer, which fails to send its whole range, is not asked anymore, and
+   * the rest of its range is left to other peers.
+   */
+  class RangeDownload {
+   public:
+    RangeDownload(iroha::network::BlockLoader &block_loader,
+                  HeightType first_height,
+                  HeightType last_height,
+                  const iroha::synchronizer::ParallelSyncOptions &options,
+                  logger::LoggerPtr log)
+        : block_loader_(block_loader),
+          last_height_(last_height),
+          window_(options.max_peers * options.range_size
+                  * options.ranges_ahead),
+          next_height_(first_height),
+          log_(std::move(log)) {
+      for (auto height = first_height; height <= last_height;
+           height += options.range_size) {
+        ranges_.push_back(Range{
+            height, std::min<HeightType>(height + options.range_size - 1,
+                                         last_height)});
+      }
+    }
+
+    ~RangeDownload() {
+      stop();
+    }
+
+    /// Start downloading from the peers
+    void start(
+        const std::vector<shared_model::interface::types::PubkeyType> &peers) {
+      workers_ = peers.size();
+      for (const auto &peer : peers) {
+        threads_.emplace_back(&RangeDownload::work, this, peer);
+      }
+    }
+
+    /// @return downloaded blocks in height order, which complete early if a
+    /// range could not be downloaded from any peer
+    rxcpp::observable<BlockPtr> blocks() {
+      return rxcpp::observable<>::create<BlockPtr>([this](auto subscriber) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (subscriber.is_subscribed() and next_height_ <= last_height_) {
+          cv_.wait(lock, [this] {
+            return ready_.count(next_height_) != 0 or workers_ == 0;
+          });
+          auto it = ready_.find(next_height_);
+          if (it == ready_.end()) {
+            break;
+          }
+          auto block = std::move(it->second);
+          ready_.erase(it);
+          ++next_height_;
+          // the window for the workers has moved
+          cv_.notify_all();
+          lock.unlock();
+          subscriber.on_next(std::move(block));
+          lock.lock();
+        }
+        lock.unlock();
+        subscriber.on_completed();
+      });
+    }
+
+    /// Stop the workers and wait for them
+    void stop() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+      }
+      cv_.notify_all();
+      for (auto &thread : threads_) {
+        if (thread.joinable()) {
+          thread.join();
+        }
+      }
+    }
+
+   private:
+    struct Range {
+      HeightType first;
+      HeightType last;
+    };
+
+    void work(shared_model::interface::types::PubkeyType peer) {
+      while (auto range = takeRange()) {
+        auto height = range->first;
+        BlockPtr previous;
+        rxcpp::composite_subscription lifetime;
+        block_loader_
+            .retrieveBlockRange(
+                peer, range->first, range->last - range->first + 1)
+            .subscribe(
+                lifetime,
+                [&](BlockPtr block) {
+                  if (block->height() > range->last) {
+                    // older peers ignore the count and send up to their top
+                    lifetime.unsubscribe();
+                    return;
+                  }
+                  if (block->height() != height
+                      or (previous
+                          and block->prevHash() != previous->hash())) {
+                    log_->warn("Block {} from {} does not follow the range",
+                               block->height(),
+                               peer.hex());
+                    lifetime.unsubscribe();
+                    return;
+                  }
+                  previous = block;
+                  std::lock_guard<std::mutex> lock(mutex_);
+                  if (stop_) {
+                    lifetime.unsubscribe();
+                    return;
+                  }
+                  ready_.emplace(height++, std::move(block));
+                  cv_.notify_all();
+                },
+                [](std::exception_ptr) {});
+        const auto failed = height <= range->last;
+        if (failed) {
+          log_->warn("Peer {} sent blocks up to {} of range {}..{}",
+                     peer.hex(),
+                     height - 1,
+                     range->first,
+                     range->last);
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        --busy_;
+        if (failed) {
+          auto it = std::upper_bound(
+              ranges_.begin(),
+              ranges_.end(),
+              height,
+              [](auto value, const auto &r) { return value < r.first; });
+          ranges_.insert(it, Range{height, range->last});
+        }
+        cv_.notify_all();
+        if (failed) {
+          break;
+        }
+      }
+      std::lock_guard<std::mutex> lock(mutex_);
+      --workers_;
+      cv_.notify_all();
+    }
+
+    /**
+     * Wait for a range within the window
+     * @return none if there are no more ranges, and no other worker may
+     * return a part of its range
+     */
+    boost::optional<Range> takeRange() {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cv_.wait(lock, [this] {
+        return stop_ or (ranges_.empty() and busy_ == 0)
+            or (not ranges_.empty()
+                and ranges_.front().first < next_height_ + window_);
+      });
+      if (stop_ or ranges_.empty()) {
+        return boost::none;
+      }
+      auto range = ranges_.front();
+      ranges_.pop_front();
+      ++busy_;
+      return range;
+    }
+
+    iroha::network::BlockLoader &block_loader_;
+    const HeightType last_height_;
+    /// heights, which may be downloaded ahead of the emitted blocks
+    const HeightType window_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    /// ranges to be downloaded, in height order
+    std::deque<Range> ranges_;
+    /// downloaded blocks, which are not emitted yet
+    std::map<HeightType, BlockPtr> ready_;
+    HeightType next_height_;
+    /// workers, which have not finished
+    size_t workers_ = 0;
+    /// workers, which download a range
+    size_t busy_ = 0;
+    bool stop_ = false;
+
+    std::vector<std::thread> threads_;
+    logger::LoggerPtr log_;
+  };
+}  // namespace
 
 namespace iroha {
   namespace synchronizer {
@@ -26,12 +237,14 @@ namespace iroha {
         std::shared_ptr<ametsuchi::MutableFactory> mutable_factory,
         std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory,
         std::shared_ptr<network::BlockLoader> block_loader,
-        logger::LoggerPtr log)
+        logger::LoggerPtr log,
+        ParallelSyncOptions parallel_sync)
         : command_executor_(std::move(command_executor)),
           validator_(std::move(validator)),
           mutable_factory_(std::move(mutable_factory)),
           block_query_factory_(std::move(block_query_factory)),
           block_loader_(std::move(block_loader)),
+          parallel_sync_(parallel_sync),
           notifier_(notifier_lifetime_),
           log_(std::move(log)) {
       consensus_gate->onOutcome().subscribe(
@@ -87,19 +300,36 @@ namespace iroha {
         const shared_model::interface::types::HeightType start_height,
         const shared_model::interface::types::HeightType target_height,
         const PublicKeysRange &public_keys) {
+      if (parallel_sync_.max_peers > 1
+          and target_height > start_height + parallel_sync_.range_size) {
+        auto result =
+            downloadInParallel(start_height, target_height, public_keys);
+        if (auto e = expected::resultToOptionalError(result)) {
+          log_->warn("Parallel synchronization failed: {}", *e);
+        } else {
+          return result;
+        }
+      }
+
       // TODO andrei 17.10.18 IR-1763 Add delay strategy for loading blocks
       for (const auto &public_key : public_keys) {
         auto storage = getStorage();
 
         shared_model::interface::types::HeightType my_height = start_height;
+        size_t transactions = 0;
+        const auto started = std::chrono::steady_clock::now();
         auto network_chain =
             block_loader_->retrieveBlocks(start_height, public_key)
-                .tap([&my_height](
+                .tap([&my_height, &transactions](
                          const std::shared_ptr<shared_model::interface::Block>
-                             &block) { my_height = block->height(); });
+                             &block) {
+                  my_height = block->height();
+                  transactions += boost::size(block->transactions());
+                });
 
         if (validator_->validateAndApply(network_chain, *storage)
             and my_height >= target_height) {
+          logThroughput(my_height - start_height, transactions, started);
           return mutable_factory_->commit(std::move(storage));
         }
       }
@@ -107,12 +337,80 @@ namespace iroha {
           "Failed to download and commit blocks from given peers");
     }
 
+    ametsuchi::CommitResult SynchronizerImpl::downloadInParallel(
+        const shared_model::interface::types::HeightType start_height,
+        const shared_model::interface::types::HeightType target_height,
+        const PublicKeysRange &public_keys) {
+      std::vector<shared_model::interface::types::PubkeyType> peers;
+      for (const auto &public_key : public_keys) {
+        if (peers.size() == parallel_sync_.max_peers) {
+          break;
+        }
+        peers.push_back(public_key);
+      }
+      if (peers.size() < 2) {
+        return expected::makeError("Not enough peers to download from");
+      }
+
+      RangeDownload download(*block_loader_,
+                             start_height + 1,
+                             target_height,
+                             parallel_sync_,
+                             log_);
+      download.start(peers);
+
+      auto storage = getStorage();
+      shared_model::interface::types::HeightType my_height = start_height;
+      size_t transactions = 0;
+      const auto started = std::chrono::steady_clock::now();
+      auto network_chain = download.blocks().tap(
+          [&my_height, &transactions](
+              const std::shared_ptr<shared_model::interface::Block> &block) {
+            my_height = block->height();
+            transactions += boost::size(block->transactions());
+          });
+      const auto applied =
+          validator_->validateAndApply(network_chain, *storage);
+      download.stop();
+
+      if (not applied or my_height < target_height) {
+        return expected::makeError("Applied blocks up to "
+                                   + std::to_string(my_height) + " of "
+                                   + std::to_string(target_height));
+      }
+      logThroughput(my_height - start_height, transactions, started);
+      return mutable_factory_->commit(std::move(storage));
+    }
+
+    void SynchronizerImpl::logThroughput(
+        size_t blocks,
+        size_t transactions,
+        std::chrono::steady_clock::time_point started) const {
+      const auto seconds = std::chrono::duration<double>(
+                               std::chrono::steady_clock::now() - started)
+                               .count();
+      if (seconds <= 0) {
+        return;
+      }
+      log_->info(
+          "Synchronized {} blocks with {} transactions in {:.3f} s: "
+          "{:.1f} blocks/s, {:.1f} tx/s",
+          blocks,
+          transactions,
+          seconds,
+          blocks / seconds,
+          transactions / seconds);
+    }
+
     std::unique_ptr<ametsuchi::MutableStorage> SynchronizerImpl::getStorage() {
       return mutable_factory_->createMutableStorage(command_executor_);
     }
 
     void SynchronizerImpl::processNext(const consensus::PairValid &msg) {
       log_->info("at handleNext");
+      for (const auto &tx : msg.block->transactions()) {
+        tracing::defaultTracer().mark(tx.hash(), tracing::Stage::kAgreed);
+      }
       const auto notify =
           [this,
            &msg](std::shared_ptr<const iroha::LedgerState> &&ledger_state) {
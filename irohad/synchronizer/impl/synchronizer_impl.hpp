@@ -8,6 +8,8 @@
 
 #include "synchronizer/synchronizer.hpp"
 
+#include <chrono>
+
 #include <rxcpp/rx-lite.hpp>
 #include "ametsuchi/commit_result.hpp"
 #include "ametsuchi/mutable_factory.hpp"
@@ -26,6 +28,21 @@ namespace iroha {
 
   namespace synchronizer {
 
+    /**
+     * Download of missing blocks from several peers at once. The missing
+     * heights are split into ranges, which are requested from different
+     * peers, and the blocks are applied in height order while the next
+     * ranges are downloaded.
+     */
+    struct ParallelSyncOptions {
+      /// peers to download from at once, 1 disables the parallel download
+      size_t max_peers = 1;
+      /// blocks requested from a peer at once
+      size_t range_size = 100;
+      /// ranges per peer, which may be downloaded ahead of the applied blocks
+      size_t ranges_ahead = 2;
+    };
+
     class SynchronizerImpl : public Synchronizer {
      public:
       SynchronizerImpl(
@@ -35,7 +52,8 @@ namespace iroha {
           std::shared_ptr<ametsuchi::MutableFactory> mutable_factory,
           std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory,
           std::shared_ptr<network::BlockLoader> block_loader,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          ParallelSyncOptions parallel_sync = ParallelSyncOptions{});
 
       ~SynchronizerImpl() override;
 
@@ -60,6 +78,21 @@ namespace iroha {
           const shared_model::interface::types::HeightType target_height,
           const PublicKeysRange &public_keys);
 
+      /**
+       * Download the missing blocks in ranges from several peers at once and
+       * apply them
+       * @return Result of committing the downloaded blocks.
+       */
+      ametsuchi::CommitResult downloadInParallel(
+          const shared_model::interface::types::HeightType start_height,
+          const shared_model::interface::types::HeightType target_height,
+          const PublicKeysRange &public_keys);
+
+      /// Log the rate of synchronization, which has started at the given time
+      void logThroughput(size_t blocks,
+                         size_t transactions,
+                         std::chrono::steady_clock::time_point started) const;
+
       void processNext(const consensus::PairValid &msg);
 
       /**
@@ -79,6 +112,7 @@ namespace iroha {
       std::shared_ptr<ametsuchi::MutableFactory> mutable_factory_;
       std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory_;
       std::shared_ptr<network::BlockLoader> block_loader_;
+      const ParallelSyncOptions parallel_sync_;
 
       // internal
       rxcpp::composite_subscription notifier_lifetime_;
@@ -15,6 +15,7 @@
 #include "interfaces/transaction.hpp"
 #include "interfaces/transaction_responses/not_received_tx_response.hpp"
 #include "logger/logger.hpp"
+#include "tracing/tx_tracer.hpp"
 
 namespace iroha {
   namespace torii {
@@ -60,6 +61,9 @@ namespace iroha {
 
     void CommandServiceImpl::handleTransactionBatch(
         std::shared_ptr<shared_model::interface::TransactionBatch> batch) {
+      for (const auto &tx : batch->transactions()) {
+        tracing::defaultTracer().mark(tx->hash(), tracing::Stage::kReceived);
+      }
       processBatch(batch);
     }
 
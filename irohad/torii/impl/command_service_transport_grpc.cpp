@@ -30,8 +30,32 @@
 #include "interfaces/iroha_internal/tx_status_factory.hpp"
 #include "interfaces/transaction.hpp"
 #include "logger/logger.hpp"
+#include "metrics/metrics.hpp"
 #include "torii/status_bus.hpp"
 
+namespace {
+  /// Metrics of the transactions received by Torii
+  struct ToriiMetrics {
+    iroha::metrics::Counter &received;
+    iroha::metrics::Counter &rejected;
+    iroha::metrics::Histogram &validation_time;
+  };
+
+  ToriiMetrics &toriiMetrics() {
+    auto &registry = iroha::metrics::defaultRegistry();
+    static ToriiMetrics metrics{
+        registry.counter("iroha_torii_transactions_received_total",
+                         "Transactions received by Torii"),
+        registry.counter("iroha_torii_transactions_rejected_total",
+                         "Transactions which failed stateless validation"),
+        registry.histogram(
+            "iroha_torii_validation_microseconds",
+            "Time to deserialize and statelessly validate a transaction list",
+            iroha::metrics::latencyBounds())};
+    return metrics;
+  }
+}  // namespace
+
 namespace iroha {
   namespace torii {
 
@@ -71,9 +95,14 @@ namespace iroha {
         grpc::ServerContext *context,
         const iroha::protocol::TxList *request,
         google::protobuf::Empty *response) {
+      auto &metrics = toriiMetrics();
+      metrics.received.increment(request->transactions_size());
+      const auto validation_start = std::chrono::steady_clock::now();
+
       auto publish_stateless_fail = [&](auto &&message) {
         using HashProvider = shared_model::crypto::Sha3_256;
 
+        metrics.rejected.increment(request->transactions_size());
         log_->warn("{}", message);
         for (const auto &tx : request->transactions()) {
           status_bus_->publish(status_factory_->makeStatelessFail(
@@ -102,6 +131,8 @@ namespace iroha {
         return publish_stateless_fail(
             fmt::format("Batch deserialization failed: {}", *e));
       }
+      metrics.validation_time.record(std::chrono::steady_clock::now()
+                                     - validation_start);
 
       for (auto &batch : std::move(batches).assumeValue()) {
         this->command_service_->handleTransactionBatch(std::move(batch));
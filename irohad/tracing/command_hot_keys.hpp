@@ -0,0 +1,48 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_COMMAND_HOT_KEYS_HPP
+#define IROHA_COMMAND_HOT_KEYS_HPP
+
+#include "interfaces/common_objects/types.hpp"
+#include "tracing/hot_key_tracker.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Block;
+    class Command;
+  }  // namespace interface
+}  // namespace shared_model
+
+namespace iroha {
+  namespace tracing {
+
+    /**
+     * Count the accounts and assets, which the command modifies. Balances are
+     * counted as writes of both the account and the asset.
+     * @param tracker - tracker to count the keys in
+     * @param phase - where the command is executed
+     * @param command - the command
+     * @param creator - creator of the transaction with the command
+     */
+    void recordCommandKeys(
+        HotKeyTracker &tracker,
+        Phase phase,
+        const shared_model::interface::Command &command,
+        const shared_model::interface::types::AccountIdType &creator);
+
+    /**
+     * Count the keys of all commands of the committed block in the apply
+     * phase. Committed blocks are counted here rather than when their
+     * commands are executed, since the peer commits the blocks it has
+     * validated itself without executing them again.
+     */
+    void recordBlockKeys(HotKeyTracker &tracker,
+                         const shared_model::interface::Block &block);
+
+  }  // namespace tracing
+}  // namespace iroha
+
+#endif  // IROHA_COMMAND_HOT_KEYS_HPP
@@ -0,0 +1,180 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_HOT_KEY_TRACKER_HPP
+#define IROHA_HOT_KEY_TRACKER_HPP
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace iroha {
+  namespace metrics {
+    class Writer;
+  }
+
+  namespace tracing {
+
+    /**
+     * Approximate counts of the most frequent keys in a stream. Counts are
+     * kept in a count-min sketch, which never underestimates and overestimates
+     * by at most e / width of the stream size with probability 1 - e^-depth.
+     * The keys with the largest estimates are kept in a min-heap of the given
+     * size, so only those are known by name.
+     */
+    class HeavyHitters {
+     public:
+      struct Entry {
+        std::string key;
+        /// estimated number of occurrences, as of the last one
+        uint64_t count;
+      };
+
+      /**
+       * @param top_k - number of keys kept
+       * @param width - counters in each row of the sketch
+       * @param depth - rows of the sketch, each with an own hash
+       */
+      HeavyHitters(size_t top_k, size_t width, size_t depth);
+
+      /// Count the occurrences of the key
+      void add(const std::string &key, uint64_t count = 1);
+
+      /// @return estimated number of occurrences of the key
+      uint64_t estimate(const std::string &key) const;
+
+      /// @return keys with the largest estimates, most frequent first
+      std::vector<Entry> top() const;
+
+      /// @return number of all occurrences
+      uint64_t total() const;
+
+     private:
+      /// Apply the function to the counter of the key in each row
+      template <typename F>
+      void forEachCounter(const std::string &key, F &&f) const;
+
+      void siftUp(size_t index);
+      void siftDown(size_t index);
+      void swapEntries(size_t a, size_t b);
+
+      const size_t top_k_;
+      const size_t width_;
+      const size_t depth_;
+      std::vector<uint64_t> sketch_;
+      uint64_t total_ = 0;
+      /// min-heap of the most frequent keys by the estimate
+      std::vector<Entry> heap_;
+      /// position of each key of the heap
+      std::unordered_map<std::string, size_t> positions_;
+    };
+
+    /// Kinds of world state keys, whose accesses are counted
+    enum class KeyKind : size_t { kAccount, kAsset };
+
+    enum class Access : size_t { kRead, kWrite };
+
+    /// Where the command touching the key is executed
+    enum class Phase : size_t {
+      /// stateful validation of a proposal
+      kValidation,
+      /// application of a committed block
+      kApply,
+    };
+
+    /**
+     * Finds the accounts and assets, which are read or written most often,
+     * separately for stateful validation and block application. Contention
+     * on such keys serializes the transactions touching them, which makes
+     * them rejected or slow.
+     *
+     * Accesses are counted by HeavyHitters under a mutex per kind, access and
+     * phase. A disabled tracker costs a relaxed load per access.
+     */
+    class HotKeyTracker {
+     public:
+      struct Options {
+        /// keys kept for each kind, access and phase, 0 to disable
+        size_t top_k = 0;
+        size_t sketch_width = 4096;
+        size_t sketch_depth = 4;
+      };
+
+      struct HotKey {
+        KeyKind kind;
+        Access access;
+        Phase phase;
+        std::string key;
+        uint64_t count;
+      };
+
+      HotKeyTracker() : HotKeyTracker(Options{}) {}
+
+      explicit HotKeyTracker(Options options);
+
+      ~HotKeyTracker();
+
+      /// Replace the options, dropping all counts
+      void configure(Options options);
+
+      bool enabled() const {
+        return enabled_.load(std::memory_order_relaxed);
+      }
+
+      /// Count an access to the key
+      void record(Phase phase,
+                  Access access,
+                  KeyKind kind,
+                  const std::string &key);
+
+      /// @return most accessed keys of the kind, most frequent first
+      std::vector<HotKey> top(Phase phase, Access access, KeyKind kind) const;
+
+      /**
+       * @return JSON object with the total accesses and the most accessed
+       * keys of each phase, access and kind
+       */
+      std::string toJson() const;
+
+      /**
+       * Report the most accessed keys as the iroha_hot_key_accesses gauges,
+       * and the total accesses as iroha_key_accesses_total counters
+       */
+      void collect(metrics::Writer &writer) const;
+
+     private:
+      static constexpr size_t kSketches = 8;
+
+      struct Sketch {
+        mutable std::mutex mutex;
+        std::unique_ptr<HeavyHitters> hitters;
+      };
+
+      static size_t index(Phase phase, Access access, KeyKind kind);
+
+      std::atomic<bool> enabled_{false};
+      std::array<Sketch, kSketches> sketches_;
+    };
+
+    /// @return name of the enumerator used in the dumps and metric labels
+    const char *keyKindName(KeyKind kind);
+    const char *accessName(Access access);
+    const char *phaseName(Phase phase);
+
+    /**
+     * @return tracker shared by the validation and the ledger, disabled
+     * until configured
+     */
+    HotKeyTracker &defaultHotKeyTracker();
+
+  }  // namespace tracing
+}  // namespace iroha
+
+#endif  // IROHA_HOT_KEY_TRACKER_HPP
@@ -0,0 +1,133 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "tracing/command_hot_keys.hpp"
+
+#include "interfaces/commands/add_asset_quantity.hpp"
+#include "interfaces/commands/add_peer.hpp"
+#include "interfaces/commands/add_signatory.hpp"
+#include "interfaces/commands/append_role.hpp"
+#include "interfaces/commands/command.hpp"
+#include "interfaces/commands/compare_and_set_account_detail.hpp"
+#include "interfaces/commands/create_account.hpp"
+#include "interfaces/commands/create_asset.hpp"
+#include "interfaces/commands/create_domain.hpp"
+#include "interfaces/commands/create_role.hpp"
+#include "interfaces/commands/detach_role.hpp"
+#include "interfaces/commands/grant_permission.hpp"
+#include "interfaces/commands/remove_peer.hpp"
+#include "interfaces/commands/remove_signatory.hpp"
+#include "interfaces/commands/revoke_permission.hpp"
+#include "interfaces/commands/set_account_detail.hpp"
+#include "interfaces/commands/set_quorum.hpp"
+#include "interfaces/commands/set_setting_value.hpp"
+#include "interfaces/commands/subtract_asset_quantity.hpp"
+#include "interfaces/commands/transfer_asset.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "interfaces/transaction.hpp"
+
+using namespace iroha::tracing;
+
+namespace {
+  class HotKeyRecorder : public boost::static_visitor<> {
+   public:
+    HotKeyRecorder(
+        HotKeyTracker &tracker,
+        Phase phase,
+        const shared_model::interface::types::AccountIdType &creator)
+        : tracker_(tracker), phase_(phase), creator_(creator) {}
+
+    void operator()(
+        const shared_model::interface::AddAssetQuantity &command) const {
+      writeBalance(creator_, command.assetId());
+    }
+
+    void operator()(
+        const shared_model::interface::SubtractAssetQuantity &command) const {
+      writeBalance(creator_, command.assetId());
+    }
+
+    void operator()(
+        const shared_model::interface::TransferAsset &command) const {
+      writeBalance(command.srcAccountId(), command.assetId());
+      writeBalance(command.destAccountId(), command.assetId());
+    }
+
+    void operator()(
+        const shared_model::interface::CreateAccount &command) const {
+      write(KeyKind::kAccount,
+            command.accountName() + "@" + command.domainId());
+    }
+
+    void operator()(
+        const shared_model::interface::CreateAsset &command) const {
+      write(KeyKind::kAsset, command.assetName() + "#" + command.domainId());
+    }
+
+    void operator()(
+        const shared_model::interface::CompareAndSetAccountDetail &command)
+        const {
+      tracker_.record(
+          phase_, Access::kRead, KeyKind::kAccount, command.accountId());
+      write(KeyKind::kAccount, command.accountId());
+    }
+
+    template <typename Command>
+    void operator()(const Command &command) const {
+      writeAccount(command, 0);
+    }
+
+   private:
+    /// Commands, which modify the account given by accountId()
+    template <typename Command>
+    auto writeAccount(const Command &command, int) const
+        -> decltype(command.accountId(), void()) {
+      write(KeyKind::kAccount, command.accountId());
+    }
+
+    /// Commands on peers, domains, roles and settings
+    template <typename Command>
+    void writeAccount(const Command &, long) const {}
+
+    void write(KeyKind kind, const std::string &key) const {
+      tracker_.record(phase_, Access::kWrite, kind, key);
+    }
+
+    void writeBalance(const std::string &account_id,
+                      const std::string &asset_id) const {
+      write(KeyKind::kAccount, account_id);
+      write(KeyKind::kAsset, asset_id);
+    }
+
+    HotKeyTracker &tracker_;
+    const Phase phase_;
+    const shared_model::interface::types::AccountIdType &creator_;
+  };
+}  // namespace
+
+namespace iroha {
+  namespace tracing {
+
+    void recordCommandKeys(
+        HotKeyTracker &tracker,
+        Phase phase,
+        const shared_model::interface::Command &command,
+        const shared_model::interface::types::AccountIdType &creator) {
+      boost::apply_visitor(HotKeyRecorder{tracker, phase, creator},
+                           command.get());
+    }
+
+    void recordBlockKeys(HotKeyTracker &tracker,
+                         const shared_model::interface::Block &block) {
+      for (const auto &tx : block.transactions()) {
+        for (const auto &command : tx.commands()) {
+          recordCommandKeys(
+              tracker, Phase::kApply, command, tx.creatorAccountId());
+        }
+      }
+    }
+
+  }  // namespace tracing
+}  // namespace iroha
@@ -0,0 +1,318 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "tracing/hot_key_tracker.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+
+#include <fmt/format.h>
+#include "metrics/metrics.hpp"
+
+using namespace iroha::tracing;
+
+namespace {
+  constexpr Phase kPhases[] = {Phase::kValidation, Phase::kApply};
+  constexpr Access kAccesses[] = {Access::kRead, Access::kWrite};
+  constexpr KeyKind kKeyKinds[] = {KeyKind::kAccount, KeyKind::kAsset};
+
+  /// Second hash of the key, derived from the first one by a 64-bit mixer
+  uint64_t mix(uint64_t hash) {
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+    return hash;
+  }
+}  // namespace
+
+namespace iroha {
+  namespace tracing {
+
+    HeavyHitters::HeavyHitters(size_t top_k, size_t width, size_t depth)
+        : top_k_(top_k),
+          width_(std::max<size_t>(width, 1)),
+          depth_(std::max<size_t>(depth, 1)),
+          sketch_(width_ * depth_, 0) {
+      heap_.reserve(top_k_);
+      positions_.reserve(top_k_);
+    }
+
+    template <typename F>
+    void HeavyHitters::forEachCounter(const std::string &key, F &&f) const {
+      // rows are indexed by h1 + row * h2, which is as good as independent
+      // hashes for the sketch
+      const uint64_t first = std::hash<std::string>{}(key);
+      const uint64_t second = mix(first) | 1;
+      for (size_t row = 0; row < depth_; ++row) {
+        f(row * width_ + (first + row * second) % width_);
+      }
+    }
+
+    void HeavyHitters::add(const std::string &key, uint64_t count) {
+      total_ += count;
+      auto estimate = std::numeric_limits<uint64_t>::max();
+      forEachCounter(key, [this, count, &estimate](size_t counter) {
+        sketch_[counter] += count;
+        estimate = std::min(estimate, sketch_[counter]);
+      });
+      if (top_k_ == 0) {
+        return;
+      }
+
+      auto it = positions_.find(key);
+      if (it != positions_.end()) {
+        // the estimate only grows, so the key goes down the min-heap
+        heap_[it->second].count = estimate;
+        siftDown(it->second);
+      } else if (heap_.size() < top_k_) {
+        positions_.emplace(key, heap_.size());
+        heap_.push_back(Entry{key, estimate});
+        siftUp(heap_.size() - 1);
+      } else if (estimate > heap_.front().count) {
+        positions_.erase(heap_.front().key);
+        positions_.emplace(key, 0);
+        heap_.front() = Entry{key, estimate};
+        siftDown(0);
+      }
+    }
+
+    uint64_t HeavyHitters::estimate(const std::string &key) const {
+      auto estimate = std::numeric_limits<uint64_t>::max();
+      forEachCounter(key, [this, &estimate](size_t counter) {
+        estimate = std::min(estimate, sketch_[counter]);
+      });
+      return estimate;
+    }
+
+    std::vector<HeavyHitters::Entry> HeavyHitters::top() const {
+      auto result = heap_;
+      std::sort(result.begin(), result.end(), [](const auto &a, const auto &b) {
+        return a.count > b.count or (a.count == b.count and a.key < b.key);
+      });
+      return result;
+    }
+
+    uint64_t HeavyHitters::total() const {
+      return total_;
+    }
+
+    void HeavyHitters::siftUp(size_t index) {
+      while (index > 0) {
+        const auto parent = (index - 1) / 2;
+        if (heap_[parent].count <= heap_[index].count) {
+          return;
+        }
+        swapEntries(parent, index);
+        index = parent;
+      }
+    }
+
+    void HeavyHitters::siftDown(size_t index) {
+      while (true) {
+        auto smallest = index;
+        for (auto child : {2 * index + 1, 2 * index + 2}) {
+          if (child < heap_.size()
+              and heap_[child].count < heap_[smallest].count) {
+            smallest = child;
+          }
+        }
+        if (smallest == index) {
+          return;
+        }
+        swapEntries(smallest, index);
+        index = smallest;
+      }
+    }
+
+    void HeavyHitters::swapEntries(size_t a, size_t b) {
+      std::swap(heap_[a], heap_[b]);
+      positions_[heap_[a].key] = a;
+      positions_[heap_[b].key] = b;
+    }
+
+    constexpr size_t HotKeyTracker::kSketches;
+
+    HotKeyTracker::HotKeyTracker(Options options) {
+      configure(options);
+    }
+
+    HotKeyTracker::~HotKeyTracker() = default;
+
+    void HotKeyTracker::configure(Options options) {
+      enabled_.store(false, std::memory_order_relaxed);
+      for (auto &sketch : sketches_) {
+        std::lock_guard<std::mutex> lock(sketch.mutex);
+        sketch.hitters.reset();
+        if (options.top_k > 0) {
+          sketch.hitters = std::make_unique<HeavyHitters>(
+              options.top_k, options.sketch_width, options.sketch_depth);
+        }
+      }
+      enabled_.store(options.top_k > 0, std::memory_order_relaxed);
+    }
+
+    void HotKeyTracker::record(Phase phase,
+                               Access access,
+                               KeyKind kind,
+                               const std::string &key) {
+      if (not enabled()) {
+        return;
+      }
+      auto &sketch = sketches_[index(phase, access, kind)];
+      std::lock_guard<std::mutex> lock(sketch.mutex);
+      if (sketch.hitters) {
+        sketch.hitters->add(key);
+      }
+    }
+
+    std::vector<HotKeyTracker::HotKey> HotKeyTracker::top(Phase phase,
+                                                          Access access,
+                                                          KeyKind kind) const {
+      std::vector<HeavyHitters::Entry> entries;
+      {
+        auto &sketch = sketches_[index(phase, access, kind)];
+        std::lock_guard<std::mutex> lock(sketch.mutex);
+        if (sketch.hitters) {
+          entries = sketch.hitters->top();
+        }
+      }
+      std::vector<HotKey> result;
+      result.reserve(entries.size());
+      for (auto &entry : entries) {
+        result.push_back(
+            HotKey{kind, access, phase, std::move(entry.key), entry.count});
+      }
+      return result;
+    }
+
+    std::string HotKeyTracker::toJson() const {
+      std::string phases;
+      for (auto phase : kPhases) {
+        std::string accesses;
+        for (auto access : kAccesses) {
+          std::string kinds;
+          for (auto kind : kKeyKinds) {
+            uint64_t total = 0;
+            std::vector<HeavyHitters::Entry> entries;
+            {
+              auto &sketch = sketches_[index(phase, access, kind)];
+              std::lock_guard<std::mutex> lock(sketch.mutex);
+              if (sketch.hitters) {
+                total = sketch.hitters->total();
+                entries = sketch.hitters->top();
+              }
+            }
+            std::string keys;
+            for (const auto &entry : entries) {
+              // account and asset ids are validated to need no escaping
+              keys += fmt::format(R"({}{{"key":"{}","count":{}}})",
+                                  keys.empty() ? "" : ",",
+                                  entry.key,
+                                  entry.count);
+            }
+            kinds += fmt::format(R"({}"{}":{{"total":{},"top":[{}]}})",
+                                 kinds.empty() ? "" : ",",
+                                 keyKindName(kind),
+                                 total,
+                                 keys);
+          }
+          accesses += fmt::format(R"({}"{}":{{{}}})",
+                                  accesses.empty() ? "" : ",",
+                                  accessName(access),
+                                  kinds);
+        }
+        phases += fmt::format(R"({}"{}":{{{}}})",
+                              phases.empty() ? "" : ",",
+                              phaseName(phase),
+                              accesses);
+      }
+      return "{" + phases + "}";
+    }
+
+    void HotKeyTracker::collect(metrics::Writer &writer) const {
+      if (not enabled()) {
+        return;
+      }
+      for (auto phase : kPhases) {
+        for (auto access : kAccesses) {
+          for (auto kind : kKeyKinds) {
+            uint64_t total = 0;
+            std::vector<HeavyHitters::Entry> entries;
+            {
+              auto &sketch = sketches_[index(phase, access, kind)];
+              std::lock_guard<std::mutex> lock(sketch.mutex);
+              if (not sketch.hitters) {
+                continue;
+              }
+              total = sketch.hitters->total();
+              entries = sketch.hitters->top();
+            }
+            const metrics::Labels labels{{"phase", phaseName(phase)},
+                                         {"access", accessName(access)},
+                                         {"kind", keyKindName(kind)}};
+            writer.counter("iroha_key_accesses_total",
+                           "Accesses to world state keys by commands",
+                           labels,
+                           total);
+            for (const auto &entry : entries) {
+              auto key_labels = labels;
+              key_labels.emplace_back("key", entry.key);
+              writer.gauge("iroha_hot_key_accesses",
+                           "Estimated accesses to the most accessed keys",
+                           key_labels,
+                           entry.count);
+            }
+          }
+        }
+      }
+    }
+
+    size_t HotKeyTracker::index(Phase phase, Access access, KeyKind kind) {
+      return (static_cast<size_t>(phase) * 2 + static_cast<size_t>(access))
+          * 2
+          + static_cast<size_t>(kind);
+    }
+
+    const char *keyKindName(KeyKind kind) {
+      switch (kind) {
+        case KeyKind::kAccount:
+          return "account";
+        case KeyKind::kAsset:
+          return "asset";
+      }
+      return "unknown";
+    }
+
+    const char *accessName(Access access) {
+      switch (access) {
+        case Access::kRead:
+          return "read";
+        case Access::kWrite:
+          return "write";
+      }
+      return "unknown";
+    }
+
+    const char *phaseName(Phase phase) {
+      switch (phase) {
+        case Phase::kValidation:
+          return "validation";
+        case Phase::kApply:
+          return "apply";
+      }
+      return "unknown";
+    }
+
+    HotKeyTracker &defaultHotKeyTracker() {
+      // never destroyed, as the registry of metrics
+      static auto tracker = new HotKeyTracker();
+      return *tracker;
+    }
+
+  }  // namespace tracing
+}  // namespace iroha
@@ -0,0 +1,305 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "tracing/tx_tracer.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include <fmt/format.h>
+#include "metrics/metrics.hpp"
+
+using namespace iroha::tracing;
+
+namespace {
+  /// @return histogram of time spent by traced transactions before the stage
+  iroha::metrics::Histogram &stageLatency(Stage stage) {
+    static const auto histograms = [] {
+      std::array<iroha::metrics::Histogram *, kStages> result;
+      for (size_t i = 0; i < kStages; ++i) {
+        result[i] = &iroha::metrics::defaultRegistry().histogram(
+            "iroha_tx_stage_microseconds",
+            "Time spent by traced committed transactions before the stage "
+            "since the previous one",
+            iroha::metrics::latencyBounds(),
+            {{"stage", stageName(static_cast<Stage>(i))}});
+      }
+      return result;
+    }();
+    return *histograms[static_cast<size_t>(stage)];
+  }
+
+  const char *outcomeName(TxTracer::Outcome outcome) {
+    switch (outcome) {
+      case TxTracer::Outcome::kCommitted:
+        return "committed";
+      case TxTracer::Outcome::kRejected:
+        return "rejected";
+      case TxTracer::Outcome::kDropped:
+        return "dropped";
+    }
+    return "unknown";
+  }
+
+  /// stale traces are looked for this many times per timeout
+  constexpr int kSweepsPerTimeout = 8;
+
+  /// Calls the function with each passed stage and the previous passed one
+  template <typename F>
+  void forEachInterval(const TxTracer::Trace &trace, F &&f) {
+    boost::optional<size_t> previous;
+    for (size_t i = 0; i < kStages; ++i) {
+      if (not trace.stages[i]) {
+        continue;
+      }
+      if (previous) {
+        f(static_cast<Stage>(i),
+          *trace.stages[*previous],
+          *trace.stages[i]);
+      }
+      previous = i;
+    }
+  }
+
+  int64_t microseconds(TxTracer::Clock::duration duration) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(duration)
+        .count();
+  }
+}  // namespace
+
+namespace iroha {
+  namespace tracing {
+
+    const char *stageName(Stage stage) {
+      switch (stage) {
+        case Stage::kReceived:
+          return "received";
+        case Stage::kQueued:
+          return "queued";
+        case Stage::kProposed:
+          return "proposed";
+        case Stage::kValidated:
+          return "validated";
+        case Stage::kAgreed:
+          return "agreed";
+        case Stage::kCommitted:
+          return "committed";
+      }
+      return "unknown";
+    }
+
+    TxTracer::TxTracer(Options options,
+                       std::function<Clock::time_point()> now)
+        : sample_rate_(options.sample_rate),
+          now_(std::move(now)),
+          start_(now_()),
+          options_(std::move(options)),
+          last_sweep_(start_) {}
+
+    void TxTracer::configure(Options options) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      options_ = std::move(options);
+      in_flight_.clear();
+      ended_.clear();
+      last_sweep_ = now_();
+      sample_rate_.store(options_.sample_rate, std::memory_order_relaxed);
+    }
+
+    bool TxTracer::sampled(const shared_model::crypto::Hash &hash) const {
+      const auto rate = sample_rate_.load(std::memory_order_relaxed);
+      if (rate == 0 or hash.size() < sizeof(uint64_t)) {
+        return false;
+      }
+      uint64_t prefix;
+      std::memcpy(&prefix, hash.blob().data(), sizeof(prefix));
+      return prefix % rate == 0;
+    }
+
+    void TxTracer::mark(const shared_model::crypto::Hash &hash, Stage stage) {
+      if (not sampled(hash)) {
+        return;
+      }
+      auto key = shared_model::crypto::HashBytes::fromBlob(hash);
+      if (not key) {
+        return;
+      }
+      const auto now = now_();
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (now - last_sweep_
+          >= Clock::duration(options_.timeout) / kSweepsPerTimeout) {
+        dropStale(now);
+      }
+      auto it = in_flight_.find(*key);
+      if (it == in_flight_.end()) {
+        if (stage == Stage::kCommitted) {
+          // blocks downloaded from other peers are not traced
+          return;
+        }
+        if (in_flight_.size() >= options_.max_in_flight) {
+          dropStale(now);
+          if (in_flight_.size() >= options_.max_in_flight) {
+            return;
+          }
+        }
+        it = in_flight_.emplace(*key, Trace{*key, {}, Outcome::kDropped, {}})
+                 .first;
+      }
+      auto &time = it->second.stages[static_cast<size_t>(stage)];
+      // a resubmitted transaction keeps the time it first passed the stage
+      if (not time) {
+        time = now;
+      }
+      if (stage == Stage::kCommitted) {
+        end(it, Outcome::kCommitted);
+      }
+    }
+
+    void TxTracer::reject(const shared_model::crypto::Hash &hash) {
+      if (not sampled(hash)) {
+        return;
+      }
+      auto key = shared_model::crypto::HashBytes::fromBlob(hash);
+      if (not key) {
+        return;
+      }
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = in_flight_.find(*key);
+      if (it == in_flight_.end()) {
+        return;
+      }
+      auto &trace = it->second;
+      for (size_t i = kStages; i-- > 0;) {
+        if (trace.stages[i]) {
+          trace.rejected_after = static_cast<Stage>(i);
+          break;
+        }
+      }
+      end(it, Outcome::kRejected);
+    }
+
+    void TxTracer::end(InFlight::iterator it, Outcome outcome) {
+      auto &trace = it->second;
+      trace.outcome = outcome;
+      if (outcome == Outcome::kCommitted) {
+        forEachInterval(
+            trace,
+            [](Stage stage, Clock::time_point from, Clock::time_point to) {
+              stageLatency(stage).record(
+                  std::chrono::duration_cast<std::chrono::microseconds>(
+                      to - from));
+            });
+      }
+      ended_.push_back(std::move(trace));
+      in_flight_.erase(it);
+      while (ended_.size() > options_.capacity) {
+        ended_.pop_front();
+      }
+    }
+
+    void TxTracer::dropStale(Clock::time_point now) {
+      last_sweep_ = now;
+      for (auto it = in_flight_.begin(); it != in_flight_.end();) {
+        const auto &stages = it->second.stages;
+        auto first = std::find_if(stages.begin(),
+                                  stages.end(),
+                                  [](const auto &time) { return bool(time); });
+        if (first != stages.end() and now - **first > options_.timeout) {
+          ended_.push_back(std::move(it->second));
+          it = in_flight_.erase(it);
+        } else {
+          ++it;
+        }
+      }
+      while (ended_.size() > options_.capacity) {
+        ended_.pop_front();
+      }
+    }
+
+    std::vector<TxTracer::Trace> TxTracer::traces() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return std::vector<Trace>(ended_.begin(), ended_.end());
+    }
+
+    std::string TxTracer::toJson() const {
+      const auto ended = traces();
+      std::string result = "[";
+      for (const auto &trace : ended) {
+        if (result.size() > 1) {
+          result += ',';
+        }
+        result += fmt::format(R"({{"hash":"{}","outcome":"{}")",
+                              trace.hash.toBlob().hex(),
+                              outcomeName(trace.outcome));
+        if (trace.rejected_after) {
+          result += fmt::format(R"(,"rejected_after":"{}")",
+                                stageName(*trace.rejected_after));
+        }
+        std::string stages, breakdown;
+        for (size_t i = 0; i < kStages; ++i) {
+          if (trace.stages[i]) {
+            stages += fmt::format(R"({}"{}":{})",
+                                  stages.empty() ? "" : ",",
+                                  stageName(static_cast<Stage>(i)),
+                                  microseconds(*trace.stages[i] - start_));
+          }
+        }
+        forEachInterval(
+            trace,
+            [&breakdown](
+                Stage stage, Clock::time_point from, Clock::time_point to) {
+              breakdown += fmt::format(R"({}"{}":{})",
+                                       breakdown.empty() ? "" : ",",
+                                       stageName(stage),
+                                       microseconds(to - from));
+            });
+        result += fmt::format(
+            R"(,"stages":{{{}}},"breakdown":{{{}}}}})", stages, breakdown);
+      }
+      result += ']';
+      return result;
+    }
+
+    std::string TxTracer::toChromeTrace() const {
+      const auto ended = traces();
+      std::string events;
+      auto add = [&events](const std::string &event) {
+        if (not events.empty()) {
+          events += ",\n";
+        }
+        events += event;
+      };
+      for (size_t tid = 0; tid < ended.size(); ++tid) {
+        const auto &trace = ended[tid];
+        const auto hash = trace.hash.toBlob().hex();
+        add(fmt::format(R"({{"name":"thread_name","ph":"M","pid":1,)"
+                        R"("tid":{},"args":{{"name":"{} {}"}}}})",
+                        tid,
+                        hash.substr(0, 16),
+                        outcomeName(trace.outcome)));
+        forEachInterval(
+            trace,
+            [&](Stage stage, Clock::time_point from, Clock::time_point to) {
+              add(fmt::format(R"({{"name":"{}","cat":"tx","ph":"X",)"
+                              R"("ts":{},"dur":{},"pid":1,"tid":{},)"
+                              R"("args":{{"hash":"{}"}}}})",
+                              stageName(stage),
+                              microseconds(from - start_),
+                              microseconds(to - from),
+                              tid,
+                              hash));
+            });
+      }
+      return R"({"displayTimeUnit":"ms","traceEvents":[)" "\n" + events
+          + "\n]}\n";
+    }
+
+    TxTracer &defaultTracer() {
+      // never destroyed, as the registry of metrics
+      static auto tracer = new TxTracer();
+      return *tracer;
+    }
+
+  }  // namespace tracing
+}  // namespace iroha
@@ -0,0 +1,162 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_TX_TRACER_HPP
+#define IROHA_TX_TRACER_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "cryptography/fixed_blob.hpp"
+#include "cryptography/hash.hpp"
+
+namespace iroha {
+  namespace tracing {
+
+    /// Stages of the transaction pipeline, in the order they are passed
+    enum class Stage : size_t {
+      /// accepted by Torii
+      kReceived,
+      /// added to the queue of the ordering service
+      kQueued,
+      /// packed into a proposal by the ordering service
+      kProposed,
+      /// passed stateful validation of the proposal
+      kValidated,
+      /// block with the transaction is agreed on and starts to be committed
+      kAgreed,
+      /// block with the transaction is committed
+      kCommitted,
+    };
+
+    constexpr size_t kStages = static_cast<size_t>(Stage::kCommitted) + 1;
+
+    /// @return name of the stage used in the dumps
+    const char *stageName(Stage stage);
+
+    /**
+     * Records the time a transaction passes each stage of the pipeline, for a
+     * sample of transactions. Transactions are sampled by their hash, so
+     * every component makes the same decision without coordination, and the
+     * price of a not sampled transaction is a few loads.
+     *
+     * Traces end on commit or rejection, or are dropped unfinished after the
+     * timeout. Ended traces are kept in a ring buffer, which can be dumped to
+     * JSON or to the Chrome trace event format, viewable in chrome://tracing
+     * and Perfetto.
+     */
+    class TxTracer {
+     public:
+      using Clock = std::chrono::steady_clock;
+
+      struct Options {
+        /// trace one of this many transactions, 0 to disable
+        uint32_t sample_rate = 0;
+        /// ended traces kept
+        size_t capacity = 1024;
+        /// unfinished traces kept, new transactions are not traced when full
+        size_t max_in_flight = 4096;
+        /**
+         * time after which an unfinished trace is dropped. Unfinished traces
+         * are checked by marks, at most once per eighth of the timeout
+         */
+        std::chrono::minutes timeout{10};
+      };
+
+      enum class Outcome { kCommitted, kRejected, kDropped };
+
+      struct Trace {
+        shared_model::crypto::HashBytes hash;
+        /// time of each passed stage
+        std::array<boost::optional<Clock::time_point>, kStages> stages;
+        Outcome outcome;
+        /// stage after which the transaction was rejected
+        boost::optional<Stage> rejected_after;
+      };
+
+      TxTracer() : TxTracer(Options{}) {}
+
+      explicit TxTracer(
+          Options options,
+          std::function<Clock::time_point()> now = [] {
+            return Clock::now();
+          });
+
+      /// Replace the options, dropping all traces
+      void configure(Options options);
+
+      /// @return true if the transaction is traced
+      bool sampled(const shared_model::crypto::Hash &hash) const;
+
+      /**
+       * Record that the transaction has passed the stage. Traces start at any
+       * stage but Stage::kCommitted, and end at it
+       * @param hash - hash of the transaction
+       * @param stage - the passed stage
+       */
+      void mark(const shared_model::crypto::Hash &hash, Stage stage);
+
+      /**
+       * End the trace of the transaction as rejected
+       * @param hash - hash of the transaction
+       */
+      void reject(const shared_model::crypto::Hash &hash);
+
+      /// @return ended traces, oldest first
+      std::vector<Trace> traces() const;
+
+      /**
+       * @return ended traces as a JSON array. Each trace has the time of the
+       * passed stages in microseconds since the start of the tracer, and the
+       * time spent before each stage since the previous passed one
+       */
+      std::string toJson() const;
+
+      /**
+       * @return ended traces in the Chrome trace event format. Each traced
+       * transaction is a thread, with a slice per passed stage spanning from
+       * the previous passed one
+       */
+      std::string toChromeTrace() const;
+
+     private:
+      using InFlight =
+          std::unordered_map<shared_model::crypto::HashBytes,
+                             Trace,
+                             shared_model::crypto::HashBytes::Hasher>;
+
+      /// Move the trace to the ended ones
+      void end(InFlight::iterator it, Outcome outcome);
+      /// Drop the unfinished traces, which are older than the timeout
+      void dropStale(Clock::time_point now);
+
+      std::atomic<uint32_t> sample_rate_;
+      std::function<Clock::time_point()> now_;
+      const Clock::time_point start_;
+
+      mutable std::mutex mutex_;
+      Options options_;
+      InFlight in_flight_;
+      std::deque<Trace> ended_;
+      Clock::time_point last_sweep_;
+    };
+
+    /**
+     * @return tracer shared by the pipeline components, disabled until
+     * configured
+     */
+    TxTracer &defaultTracer();
+
+  }  // namespace tracing
+}  // namespace iroha
+
+#endif  // IROHA_TX_TRACER_HPP
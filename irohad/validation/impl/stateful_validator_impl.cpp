@@ -15,11 +15,40 @@
 #include "common/result.hpp"
 #include "interfaces/iroha_internal/batch_meta.hpp"
 #include "logger/logger.hpp"
+#include "metrics/metrics.hpp"
+#include "tracing/hot_key_tracker.hpp"
+#include "tracing/tx_tracer.hpp"
 #include "validation/utils.hpp"
 
 namespace iroha {
   namespace validation {
 
+    namespace {
+      /// Metrics of the stateful validation of proposals
+      struct ValidationMetrics {
+        metrics::Histogram &time;
+        metrics::Counter &valid;
+        metrics::Counter &rejected;
+      };
+
+      ValidationMetrics &validationMetrics() {
+        auto &registry = metrics::defaultRegistry();
+        static ValidationMetrics metrics{
+            registry.histogram("iroha_stateful_validation_microseconds",
+                               "Time of the stateful validation of a proposal",
+                               metrics::latencyBounds()),
+            registry.counter(
+                "iroha_stateful_validation_transactions_total",
+                "Transactions by the result of the stateful validation",
+                {{"result", "valid"}}),
+            registry.counter(
+                "iroha_stateful_validation_transactions_total",
+                "Transactions by the result of the stateful validation",
+                {{"result", "rejected"}})};
+        return metrics;
+      }
+    }  // namespace
+
     /**
      * Complements initial transaction check with command-by-command check
      * @param temporary_wsv to apply commands on
@@ -31,6 +60,11 @@ namespace iroha {
         ametsuchi::TemporaryWsv &temporary_wsv,
         validation::TransactionsErrors &transactions_errors_log,
         const shared_model::interface::Transaction &tx) {
+      // signatories and quorum of the creator are checked
+      tracing::defaultHotKeyTracker().record(tracing::Phase::kValidation,
+                                             tracing::Access::kRead,
+                                             tracing::KeyKind::kAccount,
+                                             tx.creatorAccountId());
       return temporary_wsv.apply(tx).match(
           [](const auto &) { return true; },
           [&tx, &transactions_errors_log](auto &&error) {
@@ -126,6 +160,8 @@ namespace iroha {
         ametsuchi::TemporaryWsv &temporaryWsv) {
       log_->info("transactions in proposal: {}",
                  proposal.transactions().size());
+      auto &metrics = validationMetrics();
+      metrics::ScopedTimer timer(metrics.time);
 
       auto validation_result = std::make_unique<VerifiedProposalAndErrors>();
       auto valid_txs =
@@ -145,6 +181,18 @@ namespace iroha {
 
       log_->info("transactions in verified proposal: {}",
                  validation_result->verified_proposal->transactions().size());
+      metrics.valid.increment(
+          validation_result->verified_proposal->transactions().size());
+      metrics.rejected.increment(
+          validation_result->rejected_transactions.size());
+      auto &tracer = tracing::defaultTracer();
+      for (const auto &tx :
+           validation_result->verified_proposal->transactions()) {
+        tracer.mark(tx.hash(), tracing::Stage::kValidated);
+      }
+      for (const auto &error : validation_result->rejected_transactions) {
+        tracer.reject(error.tx_hash);
+      }
       return validation_result;
     }
   }  // namespace validation
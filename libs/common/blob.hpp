@@ -19,25 +19,6 @@ namespace iroha {
   using BadFormatException = std::invalid_argument;
   using byte_t = uint8_t;
 
-  namespace {
-    static const std::string code = {'0',
-                                     '1',
-                                     '2',
-                                     '3',
-                                     '4',
-                                     '5',
-                                     '6',
-                                     '7',
-                                     '8',
-                                     '9',
-                                     'a',
-                                     'b',
-                                     'c',
-                                     'd',
-                                     'e',
-                                     'f'};
-  }
-
   /**
    * Base type which represents blob of fixed size.
    *
@@ -75,13 +56,7 @@ namespace iroha {
      */
     std::string to_hexstring() const noexcept {
       std::string res(size_ * 2, 0);
-      auto ptr = this->data();
-      for (uint32_t i = 0, k = 0; i < size_; i++) {
-        const auto front = (uint8_t)(ptr[i] & 0xF0) >> 4;
-        const auto back = (uint8_t)(ptr[i] & 0xF);
-        res[k++] = code[front];
-        res[k++] = code[back];
-      }
+      bytesToHex(this->data(), size_, &res[0]);
       return res;
     }
 
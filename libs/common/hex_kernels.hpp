@@ -0,0 +1,361 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_HEX_KERNELS_HPP
+#define IROHA_HEX_KERNELS_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define IROHA_HEX_KERNELS_X86 1
+#include <immintrin.h>
+#endif
+
+/**
+ * Kernels of hex conversions, which hexutils.hpp is built on.
+ *
+ * Each of the kernels has a scalar implementation and, on x86, SSE2 and
+ * AVX2 ones. The SIMD kernels are compiled with the target attribute, so
+ * no compiler flags are needed, and the best one supported by the CPU is
+ * chosen at runtime.
+ */
+namespace iroha {
+  namespace hex_kernels {
+
+    /// Write 2 * size lowercase hex characters of the bytes to out
+    using EncodeFn = void (*)(const uint8_t *bytes, size_t size, char *out);
+
+    /**
+     * Write size / 2 bytes of the hex characters to out
+     * @param size - number of characters, must be even
+     * @return false if there is a non-hex character, out is undefined then
+     */
+    using DecodeFn = bool (*)(const char *hex, size_t size, uint8_t *out);
+
+    /// @return true if all of the characters are hex digits of any case
+    using ValidateFn = bool (*)(const char *str, size_t size);
+
+    enum class Isa { kScalar, kSse2, kAvx2 };
+
+    struct Kernels {
+      Isa isa;
+      const char *name;
+      EncodeFn encode;
+      DecodeFn decode;
+      ValidateFn validate;
+    };
+
+    namespace scalar {
+
+      /// @return value of the hex digit, or -1 for other characters
+      inline const std::array<int8_t, 256> &digitValues() {
+        static const auto values = [] {
+          std::array<int8_t, 256> values;
+          values.fill(-1);
+          for (int i = 0; i < 10; ++i) {
+            values['0' + i] = static_cast<int8_t>(i);
+          }
+          for (int i = 0; i < 6; ++i) {
+            values['a' + i] = values['A' + i] = static_cast<int8_t>(10 + i);
+          }
+          return values;
+        }();
+        return values;
+      }
+
+      inline void encode(const uint8_t *bytes, size_t size, char *out) {
+        static const char kDigits[] = "0123456789abcdef";
+        for (size_t i = 0; i < size; ++i) {
+          *out++ = kDigits[bytes[i] >> 4];
+          *out++ = kDigits[bytes[i] & 0x0f];
+        }
+      }
+
+      inline bool decode(const char *hex, size_t size, uint8_t *out) {
+        const auto &values = digitValues();
+        for (size_t i = 0; i + 1 < size; i += 2) {
+          auto high = values[static_cast<uint8_t>(hex[i])];
+          auto low = values[static_cast<uint8_t>(hex[i + 1])];
+          if ((high | low) < 0) {
+            return false;
+          }
+          *out++ = static_cast<uint8_t>((high << 4) | low);
+        }
+        return true;
+      }
+
+      inline bool validate(const char *str, size_t size) {
+        const auto &values = digitValues();
+        int8_t all = 0;
+        for (size_t i = 0; i < size; ++i) {
+          all |= values[static_cast<uint8_t>(str[i])];
+        }
+        return all >= 0;
+      }
+
+    }  // namespace scalar
+
+#ifdef IROHA_HEX_KERNELS_X86
+
+    namespace sse2 {
+
+      /// @return lowercase hex characters of the nibbles
+      __attribute__((target("sse2"))) inline __m128i toDigits(__m128i nibbles) {
+        auto letters = _mm_and_si128(_mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9)),
+                                     _mm_set1_epi8('a' - '0' - 10));
+        return _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')), letters);
+      }
+
+      /**
+       * Convert hex characters to their values
+       * @param invalid - set to the mask of non-hex characters
+       */
+      __attribute__((target("sse2"))) inline __m128i toValues(
+          __m128i chars, __m128i &invalid) {
+        auto digits = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+        auto letters = _mm_sub_epi8(_mm_or_si128(chars, _mm_set1_epi8(0x20)),
+                                    _mm_set1_epi8('a'));
+        // unsigned x <= n is min(x, n) == x
+        auto is_digit =
+            _mm_cmpeq_epi8(_mm_min_epu8(digits, _mm_set1_epi8(9)), digits);
+        auto is_letter =
+            _mm_cmpeq_epi8(_mm_min_epu8(letters, _mm_set1_epi8(5)), letters);
+        invalid = _mm_andnot_si128(_mm_or_si128(is_digit, is_letter),
+                                   _mm_set1_epi8(-1));
+        return _mm_or_si128(
+            _mm_and_si128(is_digit, digits),
+            _mm_and_si128(is_letter,
+                          _mm_add_epi8(letters, _mm_set1_epi8(10))));
+      }
+
+      /// Join values of the character pairs to bytes in the low halves
+      __attribute__((target("sse2"))) inline __m128i joinPairs(
+          __m128i values) {
+        return _mm_or_si128(
+            _mm_slli_epi16(_mm_and_si128(values, _mm_set1_epi16(0x00ff)), 4),
+            _mm_srli_epi16(values, 8));
+      }
+
+      __attribute__((target("sse2"))) inline void encode(const uint8_t *bytes,
+                                                         size_t size,
+                                                         char *out) {
+        const auto mask = _mm_set1_epi8(0x0f);
+        size_t i = 0;
+        for (; i + 16 <= size; i += 16, out += 32) {
+          auto v =
+              _mm_loadu_si128(reinterpret_cast<const __m128i *>(bytes + i));
+          auto high = toDigits(_mm_and_si128(_mm_srli_epi16(v, 4), mask));
+          auto low = toDigits(_mm_and_si128(v, mask));
+          _mm_storeu_si128(reinterpret_cast<__m128i *>(out),
+                           _mm_unpacklo_epi8(high, low));
+          _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 16),
+                           _mm_unpackhi_epi8(high, low));
+        }
+        scalar::encode(bytes + i, size - i, out);
+      }
+
+      __attribute__((target("sse2"))) inline bool decode(const char *hex,
+                                                         size_t size,
+                                                         uint8_t *out) {
+        size_t i = 0;
+        for (; i + 32 <= size; i += 32, out += 16) {
+          __m128i invalid_first, invalid_second;
+          auto first = toValues(
+              _mm_loadu_si128(reinterpret_cast<const __m128i *>(hex + i)),
+              invalid_first);
+          auto second = toValues(
+              _mm_loadu_si128(reinterpret_cast<const __m128i *>(hex + i + 16)),
+              invalid_second);
+          if (_mm_movemask_epi8(_mm_or_si128(invalid_first, invalid_second))
+              != 0) {
+            return false;
+          }
+          _mm_storeu_si128(
+              reinterpret_cast<__m128i *>(out),
+              _mm_packus_epi16(joinPairs(first), joinPairs(second)));
+        }
+        return scalar::decode(hex + i, size - i, out);
+      }
+
+      __attribute__((target("sse2"))) inline bool validate(const char *str,
+                                                           size_t size) {
+        auto invalid = _mm_setzero_si128();
+        size_t i = 0;
+        for (; i + 16 <= size; i += 16) {
+          __m128i chunk_invalid;
+          toValues(_mm_loadu_si128(reinterpret_cast<const __m128i *>(str + i)),
+                   chunk_invalid);
+          invalid = _mm_or_si128(invalid, chunk_invalid);
+        }
+        return _mm_movemask_epi8(invalid) == 0
+            and scalar::validate(str + i, size - i);
+      }
+
+    }  // namespace sse2
+
+    namespace avx2 {
+
+      /// @see sse2::toDigits
+      __attribute__((target("avx2"))) inline __m256i toDigits(__m256i nibbles) {
+        auto letters =
+            _mm256_and_si256(_mm256_cmpgt_epi8(nibbles, _mm256_set1_epi8(9)),
+                             _mm256_set1_epi8('a' - '0' - 10));
+        return _mm256_add_epi8(_mm256_add_epi8(nibbles, _mm256_set1_epi8('0')),
+                               letters);
+      }
+
+      /// @see sse2::toValues
+      __attribute__((target("avx2"))) inline __m256i toValues(
+          __m256i chars, __m256i &invalid) {
+        auto digits = _mm256_sub_epi8(chars, _mm256_set1_epi8('0'));
+        auto letters =
+            _mm256_sub_epi8(_mm256_or_si256(chars, _mm256_set1_epi8(0x20)),
+                            _mm256_set1_epi8('a'));
+        auto is_digit = _mm256_cmpeq_epi8(
+            _mm256_min_epu8(digits, _mm256_set1_epi8(9)), digits);
+        auto is_letter = _mm256_cmpeq_epi8(
+            _mm256_min_epu8(letters, _mm256_set1_epi8(5)), letters);
+        invalid = _mm256_andnot_si256(_mm256_or_si256(is_digit, is_letter),
+                                      _mm256_set1_epi8(-1));
+        return _mm256_or_si256(
+            _mm256_and_si256(is_digit, digits),
+            _mm256_and_si256(is_letter,
+                             _mm256_add_epi8(letters, _mm256_set1_epi8(10))));
+      }
+
+      /// @see sse2::joinPairs
+      __attribute__((target("avx2"))) inline __m256i joinPairs(
+          __m256i values) {
+        return _mm256_or_si256(
+            _mm256_slli_epi16(
+                _mm256_and_si256(values, _mm256_set1_epi16(0x00ff)), 4),
+            _mm256_srli_epi16(values, 8));
+      }
+
+      __attribute__((target("avx2"))) inline void encode(const uint8_t *bytes,
+                                                         size_t size,
+                                                         char *out) {
+        const auto mask = _mm256_set1_epi8(0x0f);
+        size_t i = 0;
+        for (; i + 32 <= size; i += 32, out += 64) {
+          auto v =
+              _mm256_loadu_si256(reinterpret_cast<const __m256i *>(bytes + i));
+          auto high =
+              toDigits(_mm256_and_si256(_mm256_srli_epi16(v, 4), mask));
+          auto low = toDigits(_mm256_and_si256(v, mask));
+          // unpacking interleaves within 128-bit lanes, so the lanes are
+          // reordered afterwards
+          auto first = _mm256_unpacklo_epi8(high, low);
+          auto second = _mm256_unpackhi_epi8(high, low);
+          _mm256_storeu_si256(reinterpret_cast<__m256i *>(out),
+                              _mm256_permute2x128_si256(first, second, 0x20));
+          _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + 32),
+                              _mm256_permute2x128_si256(first, second, 0x31));
+        }
+        sse2::encode(bytes + i, size - i, out);
+      }
+
+      __attribute__((target("avx2"))) inline bool decode(const char *hex,
+                                                         size_t size,
+                                                         uint8_t *out) {
+        size_t i = 0;
+        for (; i + 64 <= size; i += 64, out += 32) {
+          __m256i invalid_first, invalid_second;
+          auto first = toValues(
+              _mm256_loadu_si256(reinterpret_cast<const __m256i *>(hex + i)),
+              invalid_first);
+          auto second = toValues(_mm256_loadu_si256(
+                                     reinterpret_cast<const __m256i *>(
+                                         hex + i + 32)),
+                                 invalid_second);
+          if (not _mm256_testz_si256(
+                  _mm256_or_si256(invalid_first, invalid_second),
+                  _mm256_set1_epi8(-1))) {
+            return false;
+          }
+          // packing works within 128-bit lanes too
+          auto packed =
+              _mm256_packus_epi16(joinPairs(first), joinPairs(second));
+          _mm256_storeu_si256(reinterpret_cast<__m256i *>(out),
+                              _mm256_permute4x64_epi64(packed, 0xd8));
+        }
+        return sse2::decode(hex + i, size - i, out);
+      }
+
+      __attribute__((target("avx2"))) inline bool validate(const char *str,
+                                                           size_t size) {
+        auto invalid = _mm256_setzero_si256();
+        size_t i = 0;
+        for (; i + 32 <= size; i += 32) {
+          __m256i chunk_invalid;
+          toValues(
+              _mm256_loadu_si256(reinterpret_cast<const __m256i *>(str + i)),
+              chunk_invalid);
+          invalid = _mm256_or_si256(invalid, chunk_invalid);
+        }
+        return _mm256_testz_si256(invalid, invalid)
+            and sse2::validate(str + i, size - i);
+      }
+
+    }  // namespace avx2
+
+#endif  // IROHA_HEX_KERNELS_X86
+
+    /**
+     * @param isa - instruction set of the kernels
+     * @return kernels of the instruction set, or nullptr if it is not
+     * supported by the CPU or by the build
+     */
+    inline const Kernels *kernels(Isa isa) {
+      static const Kernels kScalar{
+          Isa::kScalar, "scalar", scalar::encode, scalar::decode,
+          scalar::validate};
+#ifdef IROHA_HEX_KERNELS_X86
+      static const Kernels kSse2{
+          Isa::kSse2, "sse2", sse2::encode, sse2::decode, sse2::validate};
+      static const Kernels kAvx2{
+          Isa::kAvx2, "avx2", avx2::encode, avx2::decode, avx2::validate};
+      static const bool kHasSse2 = [] {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("sse2") != 0;
+      }();
+      static const bool kHasAvx2 = [] {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") != 0;
+      }();
+#endif
+      switch (isa) {
+        case Isa::kScalar:
+          return &kScalar;
+#ifdef IROHA_HEX_KERNELS_X86
+        case Isa::kSse2:
+          return kHasSse2 ? &kSse2 : nullptr;
+        case Isa::kAvx2:
+          return kHasAvx2 ? &kAvx2 : nullptr;
+#endif
+        default:
+          return nullptr;
+      }
+    }
+
+    /// @return the fastest kernels supported by the CPU
+    inline const Kernels &bestKernels() {
+      static const Kernels &best = []() -> const Kernels & {
+        for (auto isa : {Isa::kAvx2, Isa::kSse2}) {
+          if (auto supported = kernels(isa)) {
+            return *supported;
+          }
+        }
+        return *kernels(Isa::kScalar);
+      }();
+      return best;
+    }
+
+  }  // namespace hex_kernels
+}  // namespace iroha
+
+#endif  // IROHA_HEX_KERNELS_HPP
@@ -5,26 +5,57 @@
 #ifndef IROHA_HEXUTILS_HPP
 #define IROHA_HEXUTILS_HPP
 
+#include <ciso646>
+#include <cstdint>
 #include <string>
 
-#include <boost/algorithm/hex.hpp>
 #include <boost/optional.hpp>
+#include "common/hex_kernels.hpp"
 #include "common/result.hpp"
 
 namespace iroha {
 
+  /**
+   * Write lowercase hex representation of the bytes
+   * @param bytes - bytes to convert
+   * @param size - number of bytes
+   * @param out - buffer of at least 2 * size characters
+   */
+  inline void bytesToHex(const uint8_t *bytes, size_t size, char *out) {
+    hex_kernels::bestKernels().encode(bytes, size, out);
+  }
+
+  /**
+   * Convert hex characters to bytes
+   * @param hex - characters to convert
+   * @param size - number of characters, must be even
+   * @param out - buffer of at least size / 2 bytes
+   * @return false if there is a non-hex character
+   */
+  inline bool hexToBytes(const char *hex, size_t size, uint8_t *out) {
+    return hex_kernels::bestKernels().decode(hex, size, out);
+  }
+
+  /**
+   * Check that the string consists of hex digits of any case only
+   * @param str - string to check, may be empty
+   * @return true if it does
+   */
+  inline bool isHexString(const std::string &str) {
+    return hex_kernels::bestKernels().validate(str.data(), str.size());
+  }
+
   /**
    * Convert string of raw bytes to printable hex string
    * @param str - raw bytes string to convert
    * @return - converted hex string
    */
   inline std::string bytestringToHexstring(const std::string &str) {
-    std::stringstream ss;
-    ss << std::hex << std::setfill('0');
-    for (const auto &c : str) {
-      ss << std::setw(2) << (static_cast<int>(c) & 0xff);
-    }
-    return ss.str();
+    std::string result(str.size() * 2, '\0');
+    bytesToHex(reinterpret_cast<const uint8_t *>(str.data()),
+               str.size(),
+               &result[0]);
+    return result;
   }
 
   /**
@@ -42,13 +73,10 @@ namespace iroha {
     if (str.size() % 2 != 0) {
       return makeError("Hex string contains uneven number of characters.");
     }
-    std::string result;
-    result.reserve(str.size() / 2);
-    try {
-      boost::algorithm::unhex(
-          str.begin(), str.end(), std::back_inserter(result));
-    } catch (const boost::algorithm::hex_decode_error &e) {
-      return makeError(e.what());
+    std::string result(str.size() / 2, '\0');
+    if (not hexToBytes(
+            str.data(), str.size(), reinterpret_cast<uint8_t *>(&result[0]))) {
+      return makeError("Hex string contains non-hex characters.");
     }
     return iroha::expected::makeValue(std::move(result));
   }
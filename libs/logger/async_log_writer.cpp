@@ -0,0 +1,173 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "logger/async_log_writer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <ciso646>
+#include <future>
+
+namespace {
+  /// Safety net against a missed wakeup, the writer is normally notified
+  constexpr std::chrono::milliseconds kIdleWait{100};
+
+  size_t roundUpToPowerOfTwo(size_t value) {
+    size_t result = 2;
+    while (result < value) {
+      result <<= 1;
+    }
+    return result;
+  }
+}  // namespace
+
+namespace logger {
+
+  struct AsyncLogWriter::Cell {
+    /// equals the position for a free cell, and the position + 1 for a cell
+    /// holding a task
+    std::atomic<size_t> sequence;
+    Write write;
+  };
+
+  AsyncLogWriter::AsyncLogWriter(Options options)
+      : mask_(roundUpToPowerOfTwo(options.capacity) - 1),
+        overflow_(options.overflow),
+        cells_(new Cell[mask_ + 1]) {
+    for (size_t i = 0; i <= mask_; ++i) {
+      cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    writer_ = std::thread([this] { run(); });
+  }
+
+  AsyncLogWriter::~AsyncLogWriter() {
+    stop_.store(true, std::memory_order_release);
+    {
+      std::lock_guard<std::mutex> lock(wakeup_mutex_);
+      wakeup_.notify_one();
+    }
+    writer_.join();
+  }
+
+  bool AsyncLogWriter::push(Task task) {
+    Write write;
+    write.task = std::move(task);
+    return push(write);
+  }
+
+  bool AsyncLogWriter::push(LogMessage message) {
+    Write write;
+    write.message = std::move(message);
+    return push(write);
+  }
+
+  bool AsyncLogWriter::push(Write &write) {
+    while (not tryPush(write)) {
+      if (overflow_ == OverflowPolicy::kDrop) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      }
+      notifyWriter();
+      std::this_thread::yield();
+    }
+    notifyWriter();
+    return true;
+  }
+
+  void AsyncLogWriter::flush() {
+    std::promise<void> done;
+    auto future = done.get_future();
+    Write marker;
+    marker.task = [&done] { done.set_value(); };
+    // the marker is never dropped
+    while (not tryPush(marker)) {
+      notifyWriter();
+      std::this_thread::yield();
+    }
+    notifyWriter();
+    future.wait();
+  }
+
+  uint64_t AsyncLogWriter::dropped() const {
+    return dropped_.load(std::memory_order_relaxed);
+  }
+
+  bool AsyncLogWriter::tryPush(Write &write) {
+    auto position = enqueue_position_.load(std::memory_order_relaxed);
+    while (true) {
+      auto &cell = cells_[position & mask_];
+      const auto sequence = cell.sequence.load(std::memory_order_acquire);
+      const auto difference = static_cast<std::ptrdiff_t>(sequence - position);
+      if (difference == 0) {
+        if (enqueue_position_.compare_exchange_weak(
+                position, position + 1, std::memory_order_relaxed)) {
+          cell.write = std::move(write);
+          // sequentially consistent to pair with the writer going to sleep
+          cell.sequence.store(position + 1, std::memory_order_seq_cst);
+          return true;
+        }
+      } else if (difference < 0) {
+        // the cell still holds the task pushed a lap ago
+        return false;
+      } else {
+        position = enqueue_position_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  bool AsyncLogWriter::tryPop(Write &write) {
+    auto &cell = cells_[dequeue_position_ & mask_];
+    if (cell.sequence.load(std::memory_order_acquire)
+        != dequeue_position_ + 1) {
+      return false;
+    }
+    write = std::move(cell.write);
+    cell.write = Write{};
+    cell.sequence.store(dequeue_position_ + mask_ + 1,
+                        std::memory_order_release);
+    ++dequeue_position_;
+    return true;
+  }
+
+  void AsyncLogWriter::notifyWriter() {
+    // either the writer sees the pushed task before going to sleep, or the
+    // producer sees it sleeping
+    if (writer_sleeping_.load(std::memory_order_seq_cst)) {
+      std::lock_guard<std::mutex> lock(wakeup_mutex_);
+      wakeup_.notify_one();
+    }
+  }
+
+  void AsyncLogWriter::run() {
+    Write write;
+    while (true) {
+      while (tryPop(write)) {
+        try {
+          if (write.task) {
+            write.task();
+          } else {
+            write.message.sink->write(write.message);
+          }
+        } catch (...) {
+          // a failed write must not stop the following ones
+        }
+        write = Write{};
+      }
+      if (stop_.load(std::memory_order_acquire)) {
+        return;
+      }
+      std::unique_lock<std::mutex> lock(wakeup_mutex_);
+      writer_sleeping_.store(true, std::memory_order_seq_cst);
+      const auto &next = cells_[dequeue_position_ & mask_];
+      if (next.sequence.load(std::memory_order_seq_cst)
+              != dequeue_position_ + 1
+          and not stop_.load(std::memory_order_acquire)) {
+        wakeup_.wait_for(lock, kIdleWait);
+      }
+      writer_sleeping_.store(false, std::memory_order_relaxed);
+    }
+  }
+
+}  // namespace logger
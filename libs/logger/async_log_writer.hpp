@@ -0,0 +1,131 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_LOGGER_ASYNC_LOG_WRITER_HPP
+#define IROHA_LOGGER_ASYNC_LOG_WRITER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace logger {
+
+  enum class LogLevel;
+
+  class LogSink;
+
+  /// Message of a logger, queued with the time and the thread of the call
+  struct LogMessage {
+    std::shared_ptr<const LogSink> sink;
+    LogLevel level{};
+    std::chrono::system_clock::time_point time;
+    size_t thread_id{0};
+    /// formatted text, if format is not set
+    std::string text;
+    /// formats the text on the writer thread
+    std::function<std::string()> format;
+  };
+
+  /// Destination of queued log messages
+  class LogSink {
+   public:
+    virtual ~LogSink() = default;
+
+    /// Write the message, called on the writer thread
+    virtual void write(LogMessage &message) const = 0;
+  };
+
+  /**
+   * Runs log writes on a dedicated thread. Producers put the writes to a
+   * bounded lock-free queue and return, so that neither formatting nor the
+   * output blocks them. The queue is multi-producer single-consumer, based on
+   * the bounded queue by Dmitry Vyukov.
+   */
+  class AsyncLogWriter {
+   public:
+    using Task = std::function<void()>;
+
+    /// What a producer does when the queue is full
+    enum class OverflowPolicy {
+      /// wait for the writer to make room
+      kBlock,
+      /// discard the write, counting it in dropped()
+      kDrop,
+    };
+
+    struct Options {
+      /// queued writes, rounded up to a power of two
+      size_t capacity = 8192;
+      OverflowPolicy overflow = OverflowPolicy::kDrop;
+    };
+
+    AsyncLogWriter() : AsyncLogWriter(Options{}) {}
+
+    explicit AsyncLogWriter(Options options);
+
+    /// Completes the queued writes and stops the writer thread
+    ~AsyncLogWriter();
+
+    AsyncLogWriter(const AsyncLogWriter &) = delete;
+    AsyncLogWriter &operator=(const AsyncLogWriter &) = delete;
+
+    /**
+     * Queue the write
+     * @param task - the write, run on the writer thread
+     * @return false if the write was dropped due to overflow
+     */
+    bool push(Task task);
+
+    /**
+     * Queue the message. Unlike a task, it is moved to the queue without an
+     * allocation.
+     * @param message - the message, written to its sink on the writer thread
+     * @return false if the message was dropped due to overflow
+     */
+    bool push(LogMessage message);
+
+    /// Wait until the writes queued before the call are completed
+    void flush();
+
+    /// @return number of writes dropped due to overflow
+    uint64_t dropped() const;
+
+   private:
+    /// Either a task or a message
+    struct Write {
+      Task task;
+      LogMessage message;
+    };
+    struct Cell;
+
+    bool push(Write &write);
+    bool tryPush(Write &write);
+    bool tryPop(Write &write);
+    void notifyWriter();
+    void run();
+
+    const size_t mask_;
+    const OverflowPolicy overflow_;
+    std::unique_ptr<Cell[]> cells_;
+
+    std::atomic<size_t> enqueue_position_{0};
+    size_t dequeue_position_ = 0;
+    std::atomic<uint64_t> dropped_{0};
+
+    std::atomic<bool> writer_sleeping_{false};
+    std::atomic<bool> stop_{false};
+    std::mutex wakeup_mutex_;
+    std::condition_variable wakeup_;
+    std::thread writer_;
+  };
+
+}  // namespace logger
+
+#endif  // IROHA_LOGGER_ASYNC_LOG_WRITER_HPP
@@ -8,7 +8,9 @@
 
 #include "logger/logger_fwd.hpp"
 
+#include <functional>
 #include <string>
+#include <type_traits>
 
 #include <fmt/core.h>
 // Windows includes transitively included by format.h define interface as
@@ -37,6 +39,17 @@ namespace fmt {
   };
 }  // namespace fmt
 
+/**
+ * Least severe level, from 0 for trace to 5 for critical, of the messages
+ * which may be logged. The check of less severe levels is a compile time
+ * constant, so their messages are never formatted or passed to the logger.
+ * The arguments at the call site are still evaluated; wrap costly ones in
+ * lazy().
+ */
+#ifndef IROHA_LOG_MIN_LEVEL
+#define IROHA_LOG_MIN_LEVEL 0
+#endif
+
 namespace logger {
 
   enum class LogLevel;
@@ -53,6 +66,55 @@ namespace logger {
     kCritical,
   };
 
+  constexpr LogLevel kMinLogLevel = static_cast<LogLevel>(IROHA_LOG_MIN_LEVEL);
+
+  /// Argument computed only if the message is logged, see lazy()
+  template <typename F>
+  class LazyArg {
+   public:
+    explicit LazyArg(F f) : f_(std::move(f)) {}
+
+    auto operator()() const {
+      return f_();
+    }
+
+   private:
+    F f_;
+  };
+
+  /**
+   * Make an argument computed only if the message is logged, e.g.
+   * log.debug("{}", lazy([&] { return request.DebugString(); }))
+   * It is computed on the calling thread, so it may capture references.
+   */
+  template <typename F>
+  LazyArg<std::decay_t<F>> lazy(F &&f) {
+    return LazyArg<std::decay_t<F>>(std::forward<F>(f));
+  }
+
+  namespace detail {
+    /// Whether the argument may be copied and formatted on another thread
+    template <typename T>
+    struct IsCapturable
+        : std::integral_constant<bool,
+                                 std::is_arithmetic<T>::value
+                                     or std::is_enum<T>::value
+                                     or std::is_same<T, std::string>::value> {
+    };
+
+    template <size_t N>
+    struct IsCapturable<char[N]> : std::true_type {};
+
+    template <typename... Args>
+    struct AllCapturable : std::true_type {};
+
+    template <typename T, typename... Args>
+    struct AllCapturable<T, Args...>
+        : std::integral_constant<bool,
+                                 IsCapturable<T>::value
+                                     and AllCapturable<Args...>::value> {};
+  }  // namespace detail
+
   class Logger {
    public:
     using Level = LogLevel;
@@ -63,54 +125,110 @@ namespace logger {
 
     template <typename... Args>
     void trace(const std::string &format, const Args &... args) const {
-      log(LogLevel::kTrace, format, args...);
+      if (LogLevel::kTrace >= kMinLogLevel) {
+        log(LogLevel::kTrace, format, args...);
+      }
     }
 
     template <typename... Args>
     void debug(const std::string &format, const Args &... args) const {
-      log(LogLevel::kDebug, format, args...);
+      if (LogLevel::kDebug >= kMinLogLevel) {
+        log(LogLevel::kDebug, format, args...);
+      }
     }
 
     template <typename... Args>
     void info(const std::string &format, const Args &... args) const {
-      log(LogLevel::kInfo, format, args...);
+      if (LogLevel::kInfo >= kMinLogLevel) {
+        log(LogLevel::kInfo, format, args...);
+      }
     }
 
     template <typename... Args>
     void warn(const std::string &format, const Args &... args) const {
-      log(LogLevel::kWarn, format, args...);
+      if (LogLevel::kWarn >= kMinLogLevel) {
+        log(LogLevel::kWarn, format, args...);
+      }
     }
 
     template <typename... Args>
     void error(const std::string &format, const Args &... args) const {
-      log(LogLevel::kError, format, args...);
+      if (LogLevel::kError >= kMinLogLevel) {
+        log(LogLevel::kError, format, args...);
+      }
     }
 
     template <typename... Args>
     void critical(const std::string &format, const Args &... args) const {
-      log(LogLevel::kCritical, format, args...);
+      if (LogLevel::kCritical >= kMinLogLevel) {
+        log(LogLevel::kCritical, format, args...);
+      }
     }
 
     template <typename... Args>
     void log(Level level,
              const std::string &format,
              const Args &... args) const {
-      if (shouldLog(level)) {
-        try {
-          logInternal(level, fmt::format(format, args...));
-        } catch (const std::exception &error) {
-          std::string error_msg("Exception was thrown while logging: ");
-          logInternal(LogLevel::kError, error_msg.append(error.what()));
-        }
+      if (level >= kMinLogLevel and shouldLog(level)) {
+        logFormatted(
+            detail::AllCapturable<Args...>{}, level, format, args...);
       }
     }
 
    protected:
     virtual void logInternal(Level level, const std::string &s) const = 0;
 
+    /// Whether the messages are formatted later by logDeferred
+    virtual bool defersFormatting() const {
+      return false;
+    }
+
+    /**
+     * Log the message formatted later, possibly on another thread
+     * @param level - the level of the message
+     * @param format - formats the message
+     */
+    virtual void logDeferred(Level level,
+                             std::function<std::string()> format) const {
+      logInternal(level, format());
+    }
+
     /// Whether the configured logging level is at least as verbose as the
     /// one given in parameter.
     virtual bool shouldLog(Level level) const = 0;
+
+   private:
+    /// Format the message on the calling thread
+    template <typename... Args>
+    void logFormatted(std::false_type,
+                      Level level,
+                      const std::string &format,
+                      const Args &... args) const {
+      try {
+        logInternal(level, fmt::format(format, args...));
+      } catch (const std::exception &error) {
+        std::string error_msg("Exception was thrown while logging: ");
+        logInternal(LogLevel::kError, error_msg.append(error.what()));
+      }
+    }
+
+    /// Copy the arguments to format the message later, if the logger defers
+    template <typename... Args>
+    void logFormatted(std::true_type,
+                      Level level,
+                      const std::string &format,
+                      const Args &... args) const {
+      if (not defersFormatting()) {
+        return logFormatted(std::false_type{}, level, format, args...);
+      }
+      try {
+        logDeferred(level,
+                    [format, args...] { return fmt::format(format, args...); });
+      } catch (const std::exception &error) {
+        std::string error_msg("Exception was thrown while logging: ");
+        logInternal(LogLevel::kError, error_msg.append(error.what()));
+      }
+    }
   };
 
   /**
@@ -122,4 +240,21 @@ namespace logger {
 
 }  // namespace logger
 
+namespace fmt {
+  /// Formats the computed value of a lazy argument
+  template <typename F>
+  struct formatter<logger::LazyArg<F>> {
+    template <typename ParseContext>
+    typename ParseContext::iterator parse(ParseContext &ctx) {
+      return ctx.begin();
+    }
+
+    template <typename FormatContext>
+    auto format(const logger::LazyArg<F> &arg, FormatContext &ctx)
+        -> decltype(ctx.out()) {
+      return format_to(ctx.out(), "{}", arg());
+    }
+  };
+}  // namespace fmt
+
 #endif  // IROHA_LOGGER_LOGGER_HPP
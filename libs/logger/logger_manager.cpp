@@ -37,7 +37,8 @@ namespace logger {
     LoggerConfig child_config{
         log_level.value_or(config_->log_level),
         patterns ? std::move(patterns)->inherit(config_->patterns)
-                 : config_->patterns};
+                 : config_->patterns,
+        config_->async_writer};
     // Operator new is employed due to private visibility of used constructor.
     LoggerManagerTreePtr child(new LoggerManagerTree(
         joinTags(full_tag_, tag),
@@ -9,9 +9,14 @@
 #include <ciso646>
 #include <mutex>
 
+#include <spdlog/details/log_msg.h>
+#include <spdlog/details/os.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 #include <spdlog/spdlog.h>
+#include <spdlog/version.h>
 #include <boost/assert.hpp>
+#include "logger/async_log_writer.hpp"
+#include "metrics/metrics.hpp"
 
 namespace {
 
@@ -46,6 +51,56 @@ namespace {
     return logger;
   }
 
+  /// Writes the queued messages to the sinks of the logger, keeping the time
+  /// and the thread of the call
+  class SpdlogSink : public logger::LogSink {
+   public:
+    explicit SpdlogSink(std::shared_ptr<spdlog::logger> logger)
+        : logger_(std::move(logger)) {}
+
+    void write(logger::LogMessage &message) const override {
+      auto level = getSpdlogLogLevel(message.level);
+      if (message.format) {
+        try {
+          message.text = message.format();
+        } catch (const std::exception &error) {
+          level = spdlog::level::err;
+          message.text = std::string("Exception was thrown while logging: ")
+              + error.what();
+        }
+      }
+#if SPDLOG_VER_MAJOR == 1 and SPDLOG_VER_MINOR < 4
+      spdlog::details::log_msg msg(&logger_->name(), level, message.text);
+#else
+      spdlog::details::log_msg msg(logger_->name(), level, message.text);
+#endif
+      msg.time = message.time;
+      msg.thread_id = message.thread_id;
+      for (const auto &sink : logger_->sinks()) {
+        if (sink->should_log(level)) {
+          sink->log(msg);
+        }
+      }
+    }
+
+   private:
+    const std::shared_ptr<spdlog::logger> logger_;
+  };
+
+  /// Queue the message with the time and the thread of the call, counting it
+  /// if dropped
+  void pushMessage(logger::AsyncLogWriter &writer,
+                   logger::LogMessage message) {
+    static auto &dropped = iroha::metrics::defaultRegistry().counter(
+        "iroha_log_messages_dropped_total",
+        "Log messages dropped due to the overflow of the async log queue");
+    message.time = spdlog::log_clock::now();
+    message.thread_id = spdlog::details::os::thread_id();
+    if (not writer.push(std::move(message))) {
+      dropped.increment();
+    }
+  }
+
 }  // namespace
 
 namespace logger {
@@ -89,7 +144,11 @@ namespace logger {
   }
 
   LoggerSpdlog::LoggerSpdlog(std::string tag, ConstLoggerConfigPtr config)
-      : tag_(tag), config_(std::move(config)), logger_(getOrCreateLogger(tag)) {
+      : tag_(tag),
+        config_(std::move(config)),
+        logger_(getOrCreateLogger(tag)),
+        sink_(config_->async_writer ? std::make_shared<SpdlogSink>(logger_)
+                                    : nullptr) {
     setupLogger();
   }
 
@@ -99,7 +158,31 @@ namespace logger {
   }
 
   void LoggerSpdlog::logInternal(Level level, const std::string &s) const {
-    logger_->log(getSpdlogLogLevel(level), s);
+    if (config_->async_writer) {
+      LogMessage message;
+      message.sink = sink_;
+      message.level = level;
+      message.text = s;
+      pushMessage(*config_->async_writer, std::move(message));
+    } else {
+      logger_->log(getSpdlogLogLevel(level), s);
+    }
+  }
+
+  bool LoggerSpdlog::defersFormatting() const {
+    return config_->async_writer != nullptr;
+  }
+
+  void LoggerSpdlog::logDeferred(Level level,
+                                 std::function<std::string()> format) const {
+    if (not config_->async_writer) {
+      return logInternal(level, format());
+    }
+    LogMessage message;
+    message.sink = sink_;
+    message.level = level;
+    message.format = std::move(format);
+    pushMessage(*config_->async_writer, std::move(message));
   }
 
   bool LoggerSpdlog::shouldLog(Level level) const {
@@ -18,7 +18,9 @@ namespace spdlog {
 
 namespace logger {
 
+  class AsyncLogWriter;
   class LogPatterns;
+  class LogSink;
   struct LoggerConfig;
 
   using ConstLoggerConfigPtr = std::shared_ptr<const LoggerConfig>;
@@ -49,6 +51,8 @@ namespace logger {
   struct LoggerConfig {
     LogLevel log_level;
     LogPatterns patterns;
+    /// writer thread shared by the loggers, nullptr to write synchronously
+    std::shared_ptr<AsyncLogWriter> async_writer;
   };
 
   class LoggerSpdlog : public Logger {
@@ -62,6 +66,11 @@ namespace logger {
    private:
     void logInternal(Level level, const std::string &s) const override;
 
+    bool defersFormatting() const override;
+
+    void logDeferred(Level level,
+                     std::function<std::string()> format) const override;
+
     /// Whether the configured logging level is at least as verbose as the
     /// one given in parameter.
     bool shouldLog(Level level) const override;
@@ -72,6 +81,8 @@ namespace logger {
     const std::string tag_;
     const ConstLoggerConfigPtr config_;
     const std::shared_ptr<spdlog::logger> logger_;
+    /// writes the messages queued to the async writer
+    const std::shared_ptr<const LogSink> sink_;
   };
 
 }  // namespace logger
@@ -0,0 +1,415 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "metrics/metrics.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+#include <fmt/format.h>
+
+namespace iroha {
+  namespace metrics {
+
+    uint64_t Counter::value() const {
+      uint64_t sum = 0;
+      for (const auto &shard : shards_) {
+        sum += shard.value.load(std::memory_order_relaxed);
+      }
+      return sum;
+    }
+
+    constexpr size_t Histogram::kSubBucketBits;
+    constexpr size_t Histogram::kSubBuckets;
+    constexpr size_t Histogram::kMaxExponent;
+    constexpr uint64_t Histogram::kMaxValue;
+    constexpr size_t Histogram::kBuckets;
+
+    Histogram::Histogram(std::vector<uint64_t> bounds)
+        : bounds_(std::move(bounds)), shards_(new Shard[detail::kShards]()) {
+      assert(std::is_sorted(bounds_.begin(), bounds_.end()));
+    }
+
+    size_t Histogram::bucket(uint64_t value) {
+      if (value < kSubBuckets) {
+        return static_cast<size_t>(value);
+      }
+      value = std::min(value, kMaxValue);
+      const size_t exponent = 63 - __builtin_clzll(value);
+      const size_t shift = exponent - kSubBucketBits;
+      const size_t sub_bucket = static_cast<size_t>(value >> shift);
+      return kSubBuckets * (shift + 1) + sub_bucket - kSubBuckets;
+    }
+
+    uint64_t Histogram::bucketLowerBound(size_t bucket) {
+      if (bucket < kSubBuckets) {
+        return bucket;
+      }
+      const size_t shift = bucket / kSubBuckets - 1;
+      const uint64_t sub_bucket = kSubBuckets + bucket % kSubBuckets;
+      return sub_bucket << shift;
+    }
+
+    uint64_t Histogram::bucketUpperBound(size_t bucket) {
+      if (bucket + 1 == kBuckets) {
+        return kMaxValue;
+      }
+      return bucketLowerBound(bucket + 1) - 1;
+    }
+
+    Histogram::Snapshot Histogram::snapshot() const {
+      Snapshot snapshot{std::vector<uint64_t>(kBuckets), 0, 0};
+      for (size_t i = 0; i < detail::kShards; ++i) {
+        const auto &shard = shards_[i];
+        for (size_t bucket = 0; bucket < kBuckets; ++bucket) {
+          auto count = shard.buckets[bucket].load(std::memory_order_relaxed);
+          snapshot.buckets[bucket] += count;
+          snapshot.count += count;
+        }
+        snapshot.sum += shard.sum.load(std::memory_order_relaxed);
+      }
+      return snapshot;
+    }
+
+    uint64_t Histogram::Snapshot::quantile(double quantile) const {
+      if (count == 0) {
+        return 0;
+      }
+      const auto rank = static_cast<uint64_t>(
+          std::ceil(std::max(0., std::min(quantile, 1.)) * count));
+      uint64_t seen = 0;
+      for (size_t bucket = 0; bucket < buckets.size(); ++bucket) {
+        seen += buckets[bucket];
+        if (seen >= std::max<uint64_t>(rank, 1)) {
+          return bucketUpperBound(bucket);
+        }
+      }
+      return kMaxValue;
+    }
+
+    uint64_t Histogram::Snapshot::countNotAbove(uint64_t bound) const {
+      uint64_t result = 0;
+      for (size_t bucket = 0; bucket < buckets.size(); ++bucket) {
+        const auto lower = bucketLowerBound(bucket);
+        const auto upper = bucketUpperBound(bucket);
+        if (upper <= bound) {
+          result += buckets[bucket];
+        } else {
+          if (lower <= bound) {
+            // values are assumed to be spread evenly within the bucket
+            result += buckets[bucket] * (bound - lower + 1)
+                / (upper - lower + 1);
+          }
+          break;
+        }
+      }
+      return result;
+    }
+
+    std::vector<uint64_t> exponentialBounds(uint64_t start,
+                                            uint64_t factor,
+                                            size_t count) {
+      std::vector<uint64_t> bounds;
+      bounds.reserve(count);
+      for (auto bound = start; bounds.size() < count; bound *= factor) {
+        bounds.push_back(bound);
+      }
+      return bounds;
+    }
+
+    const std::vector<uint64_t> &latencyBounds() {
+      static const std::vector<uint64_t> bounds{100,
+                                                250,
+                                                500,
+                                                1000,
+                                                2500,
+                                                5000,
+                                                10000,
+                                                25000,
+                                                50000,
+                                                100000,
+                                                250000,
+                                                500000,
+                                                1000000,
+                                                2500000,
+                                                5000000,
+                                                10000000,
+                                                100000000};
+      return bounds;
+    }
+
+    const std::vector<uint64_t> &sizeBounds() {
+      static const std::vector<uint64_t> bounds = exponentialBounds(1, 4, 12);
+      return bounds;
+    }
+
+    namespace {
+      std::string escape(const std::string &value, bool quoted) {
+        std::string result;
+        result.reserve(value.size());
+        for (auto c : value) {
+          switch (c) {
+            case '\\':
+              result += "\\\\";
+              break;
+            case '\n':
+              result += "\\n";
+              break;
+            case '"':
+              result += quoted ? "\\\"" : "\"";
+              break;
+            default:
+              result += c;
+          }
+        }
+        return result;
+      }
+
+      /// @return labels in exposition format without braces
+      std::string formatLabels(const Labels &labels) {
+        std::string result;
+        for (const auto &label : labels) {
+          if (not result.empty()) {
+            result += ',';
+          }
+          result += label.first;
+          result += "=\"";
+          result += escape(label.second, true);
+          result += '"';
+        }
+        return result;
+      }
+
+      /// @return sample line of the metric with the labels
+      std::string sample(const std::string &name,
+                         const std::string &labels,
+                         const std::string &value) {
+        if (labels.empty()) {
+          return fmt::format("{} {}\n", name, value);
+        }
+        return fmt::format("{}{{{}}} {}\n", name, labels, value);
+      }
+
+      std::string join(const std::string &labels, const std::string &label) {
+        return labels.empty() ? label : labels + ',' + label;
+      }
+
+      /// Text of the metric family
+      struct Exposition {
+        std::string help;
+        std::string type;
+        std::string samples;
+      };
+    }  // namespace
+
+    struct Registry::Family {
+      std::string help;
+      const char *type;
+      /// metrics keyed by the formatted labels
+      std::map<std::string, std::unique_ptr<Counter>> counters;
+      std::map<std::string, std::unique_ptr<Gauge>> gauges;
+      std::map<std::string, std::unique_ptr<Histogram>> histograms;
+    };
+
+    /// Writes collected values to the exposition
+    class Registry::FamilyWriter : public Writer {
+     public:
+      explicit FamilyWriter(std::map<std::string, Exposition> &families)
+          : families_(families) {}
+
+      void counter(const std::string &name,
+                   const std::string &help,
+                   const Labels &labels,
+                   double value) override {
+        write(name, help, "counter", labels, value);
+      }
+
+      void gauge(const std::string &name,
+                 const std::string &help,
+                 const Labels &labels,
+                 double value) override {
+        write(name, help, "gauge", labels, value);
+      }
+
+     private:
+      void write(const std::string &name,
+                 const std::string &help,
+                 const char *type,
+                 const Labels &labels,
+                 double value) {
+        auto &family = families_[name];
+        if (family.type.empty()) {
+          family.help = help;
+          family.type = type;
+        }
+        family.samples +=
+            sample(name, formatLabels(labels), fmt::format("{}", value));
+      }
+
+      std::map<std::string, Exposition> &families_;
+    };
+
+    Registry::CollectorHandle::CollectorHandle(Registry *registry, size_t id)
+        : registry_(registry), id_(id) {}
+
+    Registry::CollectorHandle::CollectorHandle(
+        CollectorHandle &&other) noexcept
+        : registry_(other.registry_), id_(other.id_) {
+      other.registry_ = nullptr;
+    }
+
+    Registry::CollectorHandle &Registry::CollectorHandle::operator=(
+        CollectorHandle &&other) noexcept {
+      if (this != &other) {
+        reset();
+        registry_ = other.registry_;
+        id_ = other.id_;
+        other.registry_ = nullptr;
+      }
+      return *this;
+    }
+
+    Registry::CollectorHandle::~CollectorHandle() {
+      reset();
+    }
+
+    void Registry::CollectorHandle::reset() {
+      if (registry_) {
+        registry_->removeCollector(id_);
+        registry_ = nullptr;
+      }
+    }
+
+    Registry::Registry() = default;
+
+    Registry::~Registry() = default;
+
+    Registry::Family &Registry::family(const std::string &name,
+                                       const std::string &help,
+                                       const char *type) {
+      auto &family = families_[name];
+      if (not family) {
+        family = std::make_unique<Family>();
+        family->help = help;
+        family->type = type;
+      }
+      assert(family->type == std::string{type});
+      return *family;
+    }
+
+    Counter &Registry::counter(const std::string &name,
+                               const std::string &help,
+                               const Labels &labels) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto &counter =
+          family(name, help, "counter").counters[formatLabels(labels)];
+      if (not counter) {
+        counter = std::make_unique<Counter>();
+      }
+      return *counter;
+    }
+
+    Gauge &Registry::gauge(const std::string &name,
+                           const std::string &help,
+                           const Labels &labels) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto &gauge = family(name, help, "gauge").gauges[formatLabels(labels)];
+      if (not gauge) {
+        gauge = std::make_unique<Gauge>();
+      }
+      return *gauge;
+    }
+
+    Histogram &Registry::histogram(const std::string &name,
+                                   const std::string &help,
+                                   const std::vector<uint64_t> &bounds,
+                                   const Labels &labels) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto &histogram =
+          family(name, help, "histogram").histograms[formatLabels(labels)];
+      if (not histogram) {
+        histogram = std::make_unique<Histogram>(bounds);
+      }
+      return *histogram;
+    }
+
+    Registry::CollectorHandle Registry::addCollector(Collector collector) {
+      std::lock_guard<std::mutex> lock(collectors_mutex_);
+      auto id = next_collector_id_++;
+      collectors_.emplace(id, std::move(collector));
+      return CollectorHandle(this, id);
+    }
+
+    void Registry::removeCollector(size_t id) {
+      std::lock_guard<std::mutex> lock(collectors_mutex_);
+      collectors_.erase(id);
+    }
+
+    std::string Registry::serialize() const {
+      std::map<std::string, Exposition> families;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto &named_family : families_) {
+          const auto &name = named_family.first;
+          const auto &family = *named_family.second;
+          auto &exposition = families[name];
+          exposition.help = family.help;
+          exposition.type = family.type;
+          for (const auto &counter : family.counters) {
+            exposition.samples += sample(
+                name, counter.first, std::to_string(counter.second->value()));
+          }
+          for (const auto &gauge : family.gauges) {
+            exposition.samples += sample(
+                name, gauge.first, std::to_string(gauge.second->value()));
+          }
+          for (const auto &histogram : family.histograms) {
+            const auto &labels = histogram.first;
+            const auto snapshot = histogram.second->snapshot();
+            for (auto bound : histogram.second->bounds()) {
+              exposition.samples += sample(
+                  name + "_bucket",
+                  join(labels, fmt::format("le=\"{}\"", bound)),
+                  std::to_string(snapshot.countNotAbove(bound)));
+            }
+            exposition.samples += sample(name + "_bucket",
+                                         join(labels, "le=\"+Inf\""),
+                                         std::to_string(snapshot.count));
+            exposition.samples += sample(
+                name + "_sum", labels, std::to_string(snapshot.sum));
+            exposition.samples += sample(
+                name + "_count", labels, std::to_string(snapshot.count));
+          }
+        }
+      }
+      {
+        std::lock_guard<std::mutex> lock(collectors_mutex_);
+        FamilyWriter writer(families);
+        for (const auto &collector : collectors_) {
+          collector.second(writer);
+        }
+      }
+
+      std::string result;
+      for (const auto &family : families) {
+        result += fmt::format("# HELP {} {}\n# TYPE {} {}\n",
+                              family.first,
+                              escape(family.second.help, false),
+                              family.first,
+                              family.second.type);
+        result += family.second.samples;
+      }
+      return result;
+    }
+
+    Registry &defaultRegistry() {
+      // never destroyed, so that metrics may be used by static objects
+      static auto registry = new Registry();
+      return *registry;
+    }
+
+  }  // namespace metrics
+}  // namespace iroha
@@ -0,0 +1,303 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_METRICS_HPP
+#define IROHA_METRICS_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace iroha {
+  namespace metrics {
+
+    /// Label names and values of a metric
+    using Labels = std::vector<std::pair<std::string, std::string>>;
+
+    namespace detail {
+      /// number of shards of each metric, which threads write to
+      constexpr size_t kShards = 8;
+
+      /// @return shard of the calling thread
+      inline size_t shard() {
+        static std::atomic<size_t> next_shard{0};
+        thread_local const size_t shard = next_shard++ % kShards;
+        return shard;
+      }
+
+      /// Value padded to a cache line, so that shards do not share lines
+      struct PaddedCounter {
+        std::atomic<uint64_t> value{0};
+        char padding[64 - sizeof(std::atomic<uint64_t>)];
+      };
+    }  // namespace detail
+
+    /**
+     * Monotonic counter. Increments are relaxed atomic additions to the
+     * shard of the calling thread, so that threads do not contend.
+     */
+    class Counter {
+     public:
+      void increment(uint64_t value = 1) {
+        shards_[detail::shard()].value.fetch_add(value,
+                                                 std::memory_order_relaxed);
+      }
+
+      /// @return sum of all increments
+      uint64_t value() const;
+
+     private:
+      std::array<detail::PaddedCounter, detail::kShards> shards_;
+    };
+
+    /// Value which can go up and down, such as a queue depth
+    class Gauge {
+     public:
+      void set(int64_t value) {
+        value_.store(value, std::memory_order_relaxed);
+      }
+
+      void add(int64_t value) {
+        value_.fetch_add(value, std::memory_order_relaxed);
+      }
+
+      int64_t value() const {
+        return value_.load(std::memory_order_relaxed);
+      }
+
+     private:
+      std::atomic<int64_t> value_{0};
+    };
+
+    /**
+     * Histogram with log-linear buckets, as in HdrHistogram: each power of
+     * two is split into kSubBuckets buckets, so that any recorded value is
+     * known with relative error below 1/kSubBuckets. Recording is a few
+     * relaxed atomic additions to the shard of the calling thread.
+     *
+     * Values are integers in units chosen by the user, usually microseconds
+     * or items. Values above kMaxValue are recorded as kMaxValue.
+     */
+    class Histogram {
+     public:
+      static constexpr size_t kSubBucketBits = 4;
+      static constexpr size_t kSubBuckets = 1 << kSubBucketBits;
+      /// the largest power of two, which is split into buckets
+      static constexpr size_t kMaxExponent = 47;
+      static constexpr uint64_t kMaxValue = (uint64_t{2} << kMaxExponent) - 1;
+      static constexpr size_t kBuckets =
+          kSubBuckets + (kMaxExponent - kSubBucketBits + 1) * kSubBuckets;
+
+      /// Values recorded by all threads
+      struct Snapshot {
+        /// number of values in each bucket
+        std::vector<uint64_t> buckets;
+        uint64_t count;
+        uint64_t sum;
+
+        /**
+         * @param quantile - from 0 to 1
+         * @return upper bound of the bucket, in which the quantile is, or 0
+         * if there are no values
+         */
+        uint64_t quantile(double quantile) const;
+
+        /**
+         * @return number of values, which are not greater than the bound,
+         * interpolated within the bucket of the bound
+         */
+        uint64_t countNotAbove(uint64_t bound) const;
+      };
+
+      /**
+       * @param bounds - ascending upper bounds of buckets, which are exported
+       * to Prometheus
+       */
+      explicit Histogram(std::vector<uint64_t> bounds);
+
+      void record(uint64_t value) {
+        auto &shard = shards_[detail::shard()];
+        shard.buckets[bucket(value)].fetch_add(1, std::memory_order_relaxed);
+        shard.sum.fetch_add(value, std::memory_order_relaxed);
+      }
+
+      /// Record the duration in microseconds
+      template <typename Rep, typename Period>
+      void record(std::chrono::duration<Rep, Period> duration) {
+        auto us =
+            std::chrono::duration_cast<std::chrono::microseconds>(duration)
+                .count();
+        record(static_cast<uint64_t>(us > 0 ? us : 0));
+      }
+
+      Snapshot snapshot() const;
+
+      const std::vector<uint64_t> &bounds() const {
+        return bounds_;
+      }
+
+      /// @return index of the bucket of the value
+      static size_t bucket(uint64_t value);
+
+      /// @return the smallest value of the bucket
+      static uint64_t bucketLowerBound(size_t bucket);
+
+      /// @return the largest value of the bucket
+      static uint64_t bucketUpperBound(size_t bucket);
+
+     private:
+      struct Shard {
+        std::array<std::atomic<uint64_t>, kBuckets> buckets{};
+        std::atomic<uint64_t> sum{0};
+      };
+
+      std::vector<uint64_t> bounds_;
+      std::unique_ptr<Shard[]> shards_;
+    };
+
+    /**
+     * @return bounds start, start * factor, ..., count in total
+     */
+    std::vector<uint64_t> exponentialBounds(uint64_t start,
+                                            uint64_t factor,
+                                            size_t count);
+
+    /// Bounds of latency histograms in microseconds, from 100us to 100s
+    const std::vector<uint64_t> &latencyBounds();
+
+    /// Bounds of size histograms, such as transactions in a proposal
+    const std::vector<uint64_t> &sizeBounds();
+
+    /**
+     * Records the time from its construction to its destruction
+     */
+    class ScopedTimer {
+     public:
+      explicit ScopedTimer(Histogram &histogram)
+          : histogram_(histogram), start_(std::chrono::steady_clock::now()) {}
+
+      ~ScopedTimer() {
+        histogram_.record(std::chrono::steady_clock::now() - start_);
+      }
+
+      ScopedTimer(const ScopedTimer &) = delete;
+      ScopedTimer &operator=(const ScopedTimer &) = delete;
+
+     private:
+      Histogram &histogram_;
+      std::chrono::steady_clock::time_point start_;
+    };
+
+    /**
+     * Values, which collectors report on each scrape for the metrics kept by
+     * other components, such as connection counters of the channel pool
+     */
+    class Writer {
+     public:
+      virtual ~Writer() = default;
+
+      virtual void counter(const std::string &name,
+                           const std::string &help,
+                           const Labels &labels,
+                           double value) = 0;
+
+      virtual void gauge(const std::string &name,
+                         const std::string &help,
+                         const Labels &labels,
+                         double value) = 0;
+    };
+
+    /**
+     * Named metrics of the process and their Prometheus text exposition.
+     *
+     * Metrics are created once, usually into function-local statics next to
+     * the instrumented code, and are never destroyed, so the references may
+     * be kept and used without locking. A metric with the same name and
+     * labels is created only once.
+     */
+    class Registry {
+     public:
+      using Collector = std::function<void(Writer &)>;
+
+      /// Removes its collector from the registry on destruction
+      class CollectorHandle {
+       public:
+        CollectorHandle() = default;
+        CollectorHandle(Registry *registry, size_t id);
+        CollectorHandle(CollectorHandle &&other) noexcept;
+        CollectorHandle &operator=(CollectorHandle &&other) noexcept;
+        ~CollectorHandle();
+
+        void reset();
+
+       private:
+        Registry *registry_ = nullptr;
+        size_t id_ = 0;
+      };
+
+      Registry();
+      ~Registry();
+
+      Counter &counter(const std::string &name,
+                       const std::string &help,
+                       const Labels &labels = {});
+
+      Gauge &gauge(const std::string &name,
+                   const std::string &help,
+                   const Labels &labels = {});
+
+      /**
+       * @param bounds - ascending bucket bounds exported to Prometheus. They
+       * are used only when the histogram is created.
+       */
+      Histogram &histogram(const std::string &name,
+                           const std::string &help,
+                           const std::vector<uint64_t> &bounds,
+                           const Labels &labels = {});
+
+      /**
+       * Add the collector, which is called on each serialization. The handle
+       * waits for the running collector on removal, so the collector may
+       * refer to objects, which outlive the handle.
+       * @return handle which removes the collector
+       */
+      CollectorHandle addCollector(Collector collector);
+
+      /// @return metrics in Prometheus text format
+      std::string serialize() const;
+
+     private:
+      struct Family;
+      class FamilyWriter;
+
+      Family &family(const std::string &name,
+                     const std::string &help,
+                     const char *type);
+
+      void removeCollector(size_t id);
+
+      mutable std::mutex mutex_;
+      std::map<std::string, std::unique_ptr<Family>> families_;
+      mutable std::mutex collectors_mutex_;
+      std::map<size_t, Collector> collectors_;
+      size_t next_collector_id_ = 0;
+    };
+
+    /// @return registry of the process
+    Registry &defaultRegistry();
+
+  }  // namespace metrics
+}  // namespace iroha
+
+#endif  // IROHA_METRICS_HPP
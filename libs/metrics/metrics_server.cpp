@@ -0,0 +1,239 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "metrics/metrics_server.hpp"
+
+#include <limits>
+#include <thread>
+
+#include <boost/asio.hpp>
+#include "common/result.hpp"
+#include "logger/logger.hpp"
+#include "metrics/metrics.hpp"
+
+using namespace iroha::metrics;
+using boost::asio::ip::tcp;
+
+namespace {
+  /// time given to a client to send the request and receive the response
+  constexpr std::chrono::seconds kSessionTimeout{10};
+  /// requests are only a request line and a few headers
+  constexpr size_t kMaxRequestSize = 8 * 1024;
+  /// pause after a failed accept, so a persistent error such as running out
+  /// of file descriptors does not keep the thread busy
+  constexpr std::chrono::milliseconds kAcceptRetryDelay{100};
+
+  /// Connection, which serves a single request
+  class Session : public std::enable_shared_from_this<Session> {
+   public:
+    Session(boost::asio::io_service &io_service,
+            const Registry &registry,
+            const MetricsServer::JsonPages &json_pages)
+        : socket_(io_service),
+          timer_(io_service),
+          request_(kMaxRequestSize),
+          registry_(registry),
+          json_pages_(json_pages) {}
+
+    tcp::socket &socket() {
+      return socket_;
+    }
+
+    void start() {
+      auto self = shared_from_this();
+      timer_.expires_from_now(kSessionTimeout);
+      timer_.async_wait([self](const boost::system::error_code &error) {
+        if (not error) {
+          boost::system::error_code ignored;
+          self->socket_.close(ignored);
+        }
+      });
+      boost::asio::async_read_until(
+          socket_,
+          request_,
+          "\r\n\r\n",
+          [self](const boost::system::error_code &error, size_t) {
+            if (not error) {
+              self->respond();
+            }
+          });
+    }
+
+   private:
+    void respond() {
+      std::istream stream(&request_);
+      std::string method, target;
+      stream >> method >> target;
+
+      std::string status = "200 OK";
+      std::string content_type = "text/plain; version=0.0.4";
+      std::string body;
+      auto page = json_pages_.find(target);
+      if (method != "GET") {
+        status = "405 Method Not Allowed";
+      } else if (target == "/metrics") {
+        body = registry_.serialize();
+      } else if (page != json_pages_.end()) {
+        content_type = "application/json";
+        body = page->second();
+      } else {
+        status = "404 Not Found";
+      }
+      response_ = "HTTP/1.1 " + status + "\r\nContent-Type: " + content_type
+          + "\r\nConnection: close\r\nContent-Length: "
+          + std::to_string(body.size()) + "\r\n\r\n" + body;
+
+      auto self = shared_from_this();
+      boost::asio::async_write(
+          socket_,
+          boost::asio::buffer(response_),
+          [self](const boost::system::error_code &, size_t) {
+            boost::system::error_code ignored;
+            self->socket_.shutdown(tcp::socket::shutdown_both, ignored);
+            self->socket_.close(ignored);
+            self->timer_.cancel(ignored);
+          });
+    }
+
+    tcp::socket socket_;
+    boost::asio::steady_timer timer_;
+    boost::asio::streambuf request_;
+    std::string response_;
+    const Registry &registry_;
+    const MetricsServer::JsonPages &json_pages_;
+  };
+}  // namespace
+
+class MetricsServer::Impl {
+ public:
+  Impl(const Registry &registry,
+       logger::LoggerPtr log,
+       JsonPages json_pages)
+      : acceptor_(io_service_),
+        accept_retry_timer_(io_service_),
+        registry_(registry),
+        log_(std::move(log)),
+        json_pages_(std::move(json_pages)) {}
+
+  ~Impl() {
+    io_service_.stop();
+    if (thread_.joinable()) {
+      thread_.join();
+    }
+  }
+
+  iroha::expected::Result<void, std::string> listen(
+      const std::string &address) {
+    auto colon = address.rfind(':');
+    if (colon == std::string::npos) {
+      return iroha::expected::makeError("Metrics address " + address
+                                        + " is not in ip:port format");
+    }
+    boost::system::error_code error;
+    auto ip = boost::asio::ip::address::from_string(address.substr(0, colon),
+                                                    error);
+    uint16_t port_number = 0;
+    try {
+      auto parsed = std::stoul(address.substr(colon + 1));
+      if (parsed > std::numeric_limits<uint16_t>::max()) {
+        throw std::out_of_range("port");
+      }
+      port_number = static_cast<uint16_t>(parsed);
+    } catch (const std::exception &) {
+      error = boost::asio::error::invalid_argument;
+    }
+    tcp::endpoint endpoint(ip, port_number);
+    if (not error) {
+      acceptor_.open(endpoint.protocol(), error);
+    }
+    if (not error) {
+      acceptor_.set_option(tcp::acceptor::reuse_address(true), error);
+    }
+    if (not error) {
+      acceptor_.bind(endpoint, error);
+    }
+    if (not error) {
+      acceptor_.listen(boost::asio::socket_base::max_connections, error);
+    }
+    if (error) {
+      return iroha::expected::makeError("Failed to listen for metrics on "
+                                        + address + ": " + error.message());
+    }
+
+    accept();
+    thread_ = std::thread([this] { io_service_.run(); });
+    log_->info("Serving metrics on {}:{}/metrics",
+               address.substr(0, colon),
+               port());
+    return {};
+  }
+
+  uint16_t port() const {
+    boost::system::error_code error;
+    return acceptor_.local_endpoint(error).port();
+  }
+
+ private:
+  void accept() {
+    auto session =
+        std::make_shared<Session>(io_service_, registry_, json_pages_);
+    acceptor_.async_accept(
+        session->socket(),
+        [this, session](const boost::system::error_code &error) {
+          if (error == boost::asio::error::operation_aborted) {
+            return;
+          }
+          if (error) {
+            log_->warn("Failed to accept metrics request: {}, retrying in {}ms",
+                       error.message(),
+                       kAcceptRetryDelay.count());
+            retryAccept();
+            return;
+          }
+          session->start();
+          accept();
+        });
+  }
+
+  void retryAccept() {
+    accept_retry_timer_.expires_from_now(kAcceptRetryDelay);
+    accept_retry_timer_.async_wait(
+        [this](const boost::system::error_code &error) {
+          if (error != boost::asio::error::operation_aborted) {
+            accept();
+          }
+        });
+  }
+
+  boost::asio::io_service io_service_;
+  tcp::acceptor acceptor_;
+  boost::asio::steady_timer accept_retry_timer_;
+  const Registry &registry_;
+  logger::LoggerPtr log_;
+  const JsonPages json_pages_;
+  std::thread thread_;
+};
+
+iroha::expected::Result<std::unique_ptr<MetricsServer>, std::string>
+MetricsServer::create(const std::string &address,
+                      const Registry &registry,
+                      logger::LoggerPtr log,
+                      JsonPages json_pages) {
+  auto impl = std::make_unique<Impl>(
+      registry, std::move(log), std::move(json_pages));
+  if (auto e = iroha::expected::resultToOptionalError(impl->listen(address))) {
+    return iroha::expected::makeError(*e);
+  }
+  return std::unique_ptr<MetricsServer>(new MetricsServer(std::move(impl)));
+}
+
+MetricsServer::MetricsServer(std::unique_ptr<Impl> impl)
+    : impl_(std::move(impl)) {}
+
+MetricsServer::~MetricsServer() = default;
+
+uint16_t MetricsServer::port() const {
+  return impl_->port();
+}
@@ -0,0 +1,65 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_METRICS_SERVER_HPP
+#define IROHA_METRICS_SERVER_HPP
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "common/result_fwd.hpp"
+#include "logger/logger_fwd.hpp"
+
+namespace iroha {
+  namespace metrics {
+
+    class Registry;
+
+    /**
+     * HTTP endpoint, which serves the registry in Prometheus text format on
+     * GET /metrics, and JSON reports of components on their own paths.
+     * Requests are served one by one by a single thread, as scrapes are rare
+     * and cheap.
+     */
+    class MetricsServer {
+     public:
+      /// Functions returning JSON documents, by the path they are served on
+      using JsonPages = std::map<std::string, std::function<std::string()>>;
+
+      /**
+       * Start listening
+       * @param address - "ip:port" to listen on, port 0 for any free port
+       * @param registry - metrics to serve, must outlive the server
+       * @param log - logger
+       * @param json_pages - additional pages, such as "/hot_keys"
+       * @return the running server or error if the address can not be bound
+       */
+      static iroha::expected::Result<std::unique_ptr<MetricsServer>,
+                                     std::string>
+      create(const std::string &address,
+             const Registry &registry,
+             logger::LoggerPtr log,
+             JsonPages json_pages = {});
+
+      /// Stops listening and waits for the serving thread
+      ~MetricsServer();
+
+      /// @return port, on which the server listens
+      uint16_t port() const;
+
+     private:
+      class Impl;
+
+      explicit MetricsServer(std::unique_ptr<Impl> impl);
+
+      std::unique_ptr<Impl> impl_;
+    };
+
+  }  // namespace metrics
+}  // namespace iroha
+
+#endif  // IROHA_METRICS_SERVER_HPP
@@ -8,11 +8,15 @@
 
 #include "interfaces/iroha_internal/block.hpp"
 
+#include <vector>
+
 #include "block.pb.h"
 #include "interfaces/common_objects/types.hpp"
 
 namespace shared_model {
   namespace proto {
+    class Transaction;
+
     class Block final : public interface::Block {
      public:
       using TransportType = iroha::protocol::Block_v1;
@@ -22,6 +26,17 @@ namespace shared_model {
       explicit Block(const TransportType &ref);
       explicit Block(TransportType &&ref);
 
+      /**
+       * Create block of copies of the transactions. The copies are kept on
+       * the arena of the block, and the blobs and hashes of the transactions
+       * are reused instead of being computed again.
+       */
+      Block(interface::types::HeightType height,
+            const interface::types::HashType &prev_hash,
+            interface::types::TimestampType created_time,
+            const std::vector<const Transaction *> &transactions,
+            const interface::types::HashCollectionType &rejected_hashes);
+
       interface::types::TransactionsCollectionType transactions()
           const override;
 
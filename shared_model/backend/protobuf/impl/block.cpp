@@ -5,6 +5,8 @@
 
 #include "backend/protobuf/block.hpp"
 
+#include <functional>
+
 #include <boost/range/adaptors.hpp>
 #include "backend/protobuf/common_objects/signature.hpp"
 #include "backend/protobuf/transaction.hpp"
@@ -14,14 +16,52 @@
 namespace shared_model {
   namespace proto {
 
+    namespace {
+      /// number of the payload field in the Block_v1 schema
+      constexpr int kPayloadField = 1;
+      /// number of the transactions field in the Block_v1.Payload schema
+      constexpr int kTransactionsField = 1;
+    }  // namespace
+
     struct Block::Impl {
       explicit Impl(TransportType &&ref) : proto_(std::move(ref)) {}
       explicit Impl(const TransportType &ref) : proto_(ref) {}
+      Impl(interface::types::HeightType height,
+           const interface::types::HashType &prev_hash,
+           interface::types::TimestampType created_time,
+           const std::vector<const Transaction *> &transactions,
+           const interface::types::HashCollectionType &rejected_hashes)
+          : transactions_{[&] {
+              payload_.set_height(height);
+              payload_.set_prev_block_hash(prev_hash.hex());
+              payload_.set_created_time(created_time);
+              for (const auto &hash : rejected_hashes) {
+                payload_.add_rejected_transactions_hashes(hash.hex());
+              }
+              std::vector<proto::Transaction> copies;
+              copies.reserve(transactions.size());
+              for (const auto *tx : transactions) {
+                auto *copy = payload_.add_transactions();
+                *copy = tx->getTransport();
+                copies.emplace_back(*copy, *tx);
+              }
+              return copies;
+            }()} {}
       Impl(Impl &&o) noexcept = delete;
       Impl &operator=(Impl &&o) noexcept = delete;
 
-      TransportType proto_;
-      iroha::protocol::Block_v1::Payload &payload_{*proto_.mutable_payload()};
+      /// Serialize the block with the payload, which is serialized already
+      interface::types::BlobType makeBlockBlob() const {
+        TransportType without_payload;
+        *without_payload.mutable_signatures() = proto_->signatures();
+        const std::reference_wrapper<const interface::types::BlobType>
+            payload[] = {payload_blob_};
+        return spliceBlob(
+            makeBlob(without_payload).blob(), kPayloadField, payload);
+      }
+
+      ArenaMessage<TransportType> proto_;
+      iroha::protocol::Block_v1::Payload &payload_{*proto_->mutable_payload()};
 
       std::vector<proto::Transaction> transactions_{[this] {
         return std::vector<proto::Transaction>(
@@ -29,15 +69,27 @@ namespace shared_model {
             payload_.mutable_transactions()->end());
       }()};
 
-      interface::types::BlobType blob_{[this] { return makeBlob(proto_); }()};
+      interface::types::BlobType payload_blob_{[this] {
+        return makeBlob(payload_,
+                        *payload_.mutable_transactions(),
+                        kTransactionsField,
+                        proto_.arena(),
+                        transactions_
+                            | boost::adaptors::transformed(
+                                  [](const auto &tx) -> decltype(auto) {
+                                    return tx.blob();
+                                  }));
+      }()};
+
+      interface::types::BlobType blob_{makeBlockBlob()};
 
       interface::types::HashType prev_hash_{[this] {
         return interface::types::HashType(
-            crypto::Hash::fromHexString(proto_.payload().prev_block_hash()));
+            crypto::Hash::fromHexString(proto_->payload().prev_block_hash()));
       }()};
 
       SignatureSetType<proto::Signature> signatures_{[this] {
-        auto signatures = *proto_.mutable_signatures()
+        auto signatures = *proto_->mutable_signatures()
             | boost::adaptors::transformed(
                   [](auto &x) { return proto::Signature(x); });
         return SignatureSetType<proto::Signature>(signatures.begin(),
@@ -55,9 +107,6 @@ namespace shared_model {
             return hashes;
           }()};
 
-      interface::types::BlobType payload_blob_{
-          [this] { return makeBlob(payload_); }()};
-
       interface::types::HashType hash_ = makeHash(payload_blob_);
     };
 
@@ -71,6 +120,15 @@ namespace shared_model {
       impl_ = std::make_unique<Block::Impl>(std::move(ref));
     }
 
+    Block::Block(interface::types::HeightType height,
+                 const interface::types::HashType &prev_hash,
+                 interface::types::TimestampType created_time,
+                 const std::vector<const Transaction *> &transactions,
+                 const interface::types::HashCollectionType &rejected_hashes) {
+      impl_ = std::make_unique<Block::Impl>(
+          height, prev_hash, created_time, transactions, rejected_hashes);
+    }
+
     interface::types::TransactionsCollectionType Block::transactions() const {
       return impl_->transactions_;
     }
@@ -103,18 +161,18 @@ namespace shared_model {
         return false;
       }
 
-      auto sig = impl_->proto_.add_signatures();
+      auto sig = impl_->proto_->add_signatures();
       sig->set_signature(signed_blob.hex());
       sig->set_public_key(public_key.hex());
 
       impl_->signatures_ = [this] {
-        auto signatures = *impl_->proto_.mutable_signatures()
+        auto signatures = *impl_->proto_->mutable_signatures()
             | boost::adaptors::transformed(
                   [](auto &x) { return proto::Signature(x); });
         return SignatureSetType<proto::Signature>(signatures.begin(),
                                                   signatures.end());
       }();
-      impl_->blob_ = makeBlob(impl_->proto_);
+      impl_->blob_ = impl_->makeBlockBlob();
 
       return true;
     }
@@ -141,11 +199,11 @@ namespace shared_model {
     }
 
     const iroha::protocol::Block_v1 &Block::getTransport() const {
-      return impl_->proto_;
+      return *impl_->proto_;
     }
 
     Block::ModelType *Block::clone() const {
-      return new Block(impl_->proto_);
+      return new Block(*impl_->proto_);
     }
 
     Block::~Block() = default;
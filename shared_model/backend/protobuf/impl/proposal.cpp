@@ -5,6 +5,7 @@
 
 #include "backend/protobuf/proposal.hpp"
 
+#include <boost/range/adaptor/transformed.hpp>
 #include "backend/protobuf/transaction.hpp"
 #include "backend/protobuf/util.hpp"
 
@@ -12,20 +13,51 @@ namespace shared_model {
   namespace proto {
     using namespace interface::types;
 
+    namespace {
+      /// number of the transactions field in the Proposal schema
+      constexpr int kTransactionsField = 2;
+    }  // namespace
+
     struct Proposal::Impl {
       explicit Impl(TransportType &&ref) : proto_(std::move(ref)) {}
 
       explicit Impl(const TransportType &ref) : proto_(ref) {}
 
-      TransportType proto_;
+      Impl(HeightType height,
+           TimestampType created_time,
+           const std::vector<const Transaction *> &transactions)
+          : transactions_{[&] {
+              proto_->set_height(height);
+              proto_->set_created_time(created_time);
+              std::vector<proto::Transaction> copies;
+              copies.reserve(transactions.size());
+              for (const auto *tx : transactions) {
+                auto *copy = proto_->add_transactions();
+                *copy = tx->getTransport();
+                copies.emplace_back(*copy, *tx);
+              }
+              return copies;
+            }()} {}
+
+      ArenaMessage<TransportType> proto_;
 
       const std::vector<proto::Transaction> transactions_{[this] {
         return std::vector<proto::Transaction>(
-            proto_.mutable_transactions()->begin(),
-            proto_.mutable_transactions()->end());
+            proto_->mutable_transactions()->begin(),
+            proto_->mutable_transactions()->end());
       }()};
 
-      interface::types::BlobType blob_{[this] { return makeBlob(proto_); }()};
+      interface::types::BlobType blob_{[this] {
+        return makeBlob(*proto_,
+                        *proto_->mutable_transactions(),
+                        kTransactionsField,
+                        proto_.arena(),
+                        transactions_
+                            | boost::adaptors::transformed(
+                                  [](const auto &tx) -> decltype(auto) {
+                                    return tx.blob();
+                                  }));
+      }()};
 
       const interface::types::HashType hash_{
           [this] { return crypto::DefaultHashProvider::makeHash(blob_); }()};
@@ -41,16 +73,23 @@ namespace shared_model {
       impl_ = std::make_unique<Proposal::Impl>(std::move(ref));
     }
 
+    Proposal::Proposal(HeightType height,
+                       TimestampType created_time,
+                       const std::vector<const Transaction *> &transactions) {
+      impl_ =
+          std::make_unique<Proposal::Impl>(height, created_time, transactions);
+    }
+
     TransactionsCollectionType Proposal::transactions() const {
       return impl_->transactions_;
     }
 
     TimestampType Proposal::createdTime() const {
-      return impl_->proto_.created_time();
+      return impl_->proto_->created_time();
     }
 
     HeightType Proposal::height() const {
-      return impl_->proto_.height();
+      return impl_->proto_->height();
     }
 
     const interface::types::BlobType &Proposal::blob() const {
@@ -58,7 +97,7 @@ namespace shared_model {
     }
 
     const Proposal::TransportType &Proposal::getTransport() const {
-      return impl_->proto_;
+      return *impl_->proto_;
     }
 
     const interface::types::HashType &Proposal::hash() const {
@@ -29,35 +29,20 @@ ProtoBlockFactory::unsafeCreateBlock(
     interface::types::TimestampType created_time,
     const interface::types::TransactionsCollectionType &txs,
     const interface::types::HashCollectionType &rejected_hashes) {
-  iroha::protocol::Block_v1 block;
-  auto *block_payload = block.mutable_payload();
-  block_payload->set_height(height);
-  block_payload->set_prev_block_hash(prev_hash.hex());
-  block_payload->set_created_time(created_time);
-
-  // set accepted transactions
-  std::for_each(
-      std::begin(txs), std::end(txs), [block_payload](const auto &tx) {
-        auto *transaction = block_payload->add_transactions();
-        (*transaction) = static_cast<const Transaction &>(tx).getTransport();
-      });
-
-  // set rejected transactions
-  std::for_each(std::begin(rejected_hashes),
-                std::end(rejected_hashes),
-                [block_payload](const auto &hash) {
-                  auto *next_hash =
-                      block_payload->add_rejected_transactions_hashes();
-                  (*next_hash) = hash.hex();
-                });
-
-  iroha::protocol::Block proto_block_container;
-  proto_block_container.set_allocated_block_v1(&block);
-  assert(not proto_validator_->validate(proto_block_container));
-  proto_block_container.release_block_v1();
+  std::vector<const Transaction *> proto_txs;
+  proto_txs.reserve(txs.size());
+  for (const auto &tx : txs) {
+    proto_txs.push_back(&static_cast<const Transaction &>(tx));
+  }
+  auto model_proto_block = std::make_unique<shared_model::proto::Block>(
+      height, prev_hash, created_time, proto_txs, rejected_hashes);
 
-  auto model_proto_block =
-      std::make_unique<shared_model::proto::Block>(std::move(block));
+  assert([&] {
+    iroha::protocol::Block proto_block_container;
+    *proto_block_container.mutable_block_v1() =
+        model_proto_block->getTransport();
+    return not proto_validator_->validate(proto_block_container);
+  }());
   assert(not interface_validator_->validate(*model_proto_block));
 
   return model_proto_block;
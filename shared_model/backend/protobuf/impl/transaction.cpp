@@ -22,6 +22,14 @@ namespace shared_model {
 
       explicit Impl(TransportType &ref) : proto_{ref} {}
 
+      Impl(TransportType &ref, const Impl &copy_of)
+          : proto_{ref},
+            blob_{copy_of.blob_},
+            payload_blob_{copy_of.payload_blob_},
+            reduced_payload_blob_{copy_of.reduced_payload_blob_},
+            reduced_hash_{copy_of.reduced_hash_},
+            hash_{copy_of.hash_} {}
+
       detail::ReferenceHolder<TransportType> proto_;
 
       iroha::protocol::Transaction::Payload &payload_{
@@ -77,6 +85,11 @@ namespace shared_model {
       impl_ = std::make_unique<Transaction::Impl>(transaction);
     }
 
+    Transaction::Transaction(TransportType &transaction,
+                             const Transaction &copy_of) {
+      impl_ = std::make_unique<Transaction::Impl>(transaction, *copy_of.impl_);
+    }
+
     // TODO [IR-1866] Akvinikym 13.11.18: remove the copy ctor and fix fallen
     // tests
     Transaction::Transaction(const Transaction &transaction)
@@ -6,12 +6,16 @@
 #ifndef IROHA_SHARED_MODEL_PROTO_PROPOSAL_HPP
 #define IROHA_SHARED_MODEL_PROTO_PROPOSAL_HPP
 
+#include <vector>
+
 #include "interfaces/common_objects/types.hpp"
 #include "interfaces/iroha_internal/proposal.hpp"
 #include "proposal.pb.h"
 
 namespace shared_model {
   namespace proto {
+    class Transaction;
+
     class Proposal final : public interface::Proposal {
      public:
       using TransportType = iroha::protocol::Proposal;
@@ -22,6 +26,15 @@ namespace shared_model {
       explicit Proposal(const TransportType &ref);
       explicit Proposal(TransportType &&ref);
 
+      /**
+       * Create proposal of copies of the transactions. The copies are kept
+       * on the arena of the proposal, and the blobs and hashes of the
+       * transactions are reused instead of being computed again.
+       */
+      Proposal(interface::types::HeightType height,
+               interface::types::TimestampType created_time,
+               const std::vector<const Transaction *> &transactions);
+
       interface::types::TransactionsCollectionType transactions()
           const override;
 
@@ -32,8 +32,7 @@ namespace shared_model {
           interface::types::HeightType height,
           interface::types::TimestampType created_time,
           TransactionsCollectionType transactions) override {
-        return createProposal(
-            createProtoProposal(height, created_time, transactions));
+        return validate(makeProposal(height, created_time, transactions));
       }
 
       // TODO mboldyrev 13.02.2019 IR-323
@@ -42,8 +41,7 @@ namespace shared_model {
           interface::types::HeightType height,
           interface::types::TimestampType created_time,
           UnsafeTransactionsCollectionType transactions) override {
-        return std::make_unique<Proposal>(
-            createProtoProposal(height, created_time, transactions));
+        return makeProposal(height, created_time, transactions);
       }
 
       /**
@@ -55,22 +53,17 @@ namespace shared_model {
       }
 
      private:
-      iroha::protocol::Proposal createProtoProposal(
+      std::unique_ptr<Proposal> makeProposal(
           interface::types::HeightType height,
           interface::types::TimestampType created_time,
           UnsafeTransactionsCollectionType transactions) {
-        iroha::protocol::Proposal proposal;
-
-        proposal.set_height(height);
-        proposal.set_created_time(created_time);
-
+        std::vector<const Transaction *> proto_transactions;
         for (const auto &tx : transactions) {
-          *proposal.add_transactions() =
-              static_cast<const shared_model::proto::Transaction &>(tx)
-                  .getTransport();
+          proto_transactions.push_back(
+              &static_cast<const shared_model::proto::Transaction &>(tx));
         }
-
-        return proposal;
+        return std::make_unique<Proposal>(
+            height, created_time, proto_transactions);
       }
 
       FactoryResult<std::unique_ptr<interface::Proposal>> validate(
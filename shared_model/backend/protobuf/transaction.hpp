@@ -21,6 +21,14 @@ namespace shared_model {
 
       explicit Transaction(TransportType &transaction);
 
+      /**
+       * Create transaction over a copy of the transport of another one,
+       * taking its blobs and hashes instead of computing them again
+       * @param transaction - transport equal to the one of copy_of
+       * @param copy_of - transaction, which the transport is copied from
+       */
+      Transaction(TransportType &transaction, const Transaction &copy_of);
+
       Transaction(const Transaction &transaction);
 
       Transaction(Transaction &&o) noexcept;
@@ -6,7 +6,12 @@
 #ifndef IROHA_SHARED_MODEL_PROTO_UTIL_HPP
 #define IROHA_SHARED_MODEL_PROTO_UTIL_HPP
 
+#include <google/protobuf/arena.h>
+#include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <memory>
 #include <vector>
 #include "cryptography/blob.hpp"
 
@@ -21,6 +26,128 @@ namespace shared_model {
       return crypto::Blob(std::move(data));
     }
 
+    /**
+     * Insert length-delimited records of a field to a serialized message
+     * @param message - serialized message without the field
+     * @param field_number - number of the field in the schema
+     * @param records - range of serialized records of the field
+     * @return the same blob, as if the message was serialized with the field
+     */
+    template <typename Records>
+    crypto::Blob spliceBlob(const crypto::Blob::Bytes &message,
+                            int field_number,
+                            const Records &records) {
+      using google::protobuf::internal::WireFormatLite;
+      using google::protobuf::io::CodedInputStream;
+      using google::protobuf::io::CodedOutputStream;
+
+      // fields are serialized in the order of their numbers, so the records
+      // go right before the first field with a greater number
+      CodedInputStream input(message.data(), static_cast<int>(message.size()));
+      size_t position = 0;
+      for (auto tag = input.ReadTag();
+           tag != 0
+           and WireFormatLite::GetTagFieldNumber(tag) < field_number
+           and WireFormatLite::SkipField(&input, tag);
+           tag = input.ReadTag()) {
+        position = input.CurrentPosition();
+      }
+
+      const auto tag = WireFormatLite::MakeTag(
+          field_number, WireFormatLite::WIRETYPE_LENGTH_DELIMITED);
+      size_t size = message.size();
+      for (const crypto::Blob &record : records) {
+        auto length = static_cast<uint32_t>(record.size());
+        size += CodedOutputStream::VarintSize32(tag)
+            + CodedOutputStream::VarintSize32(length) + length;
+      }
+
+      crypto::Blob::Bytes data(size);
+      auto out =
+          std::copy(message.data(), message.data() + position, data.data());
+      for (const crypto::Blob &record : records) {
+        out = CodedOutputStream::WriteVarint32ToArray(tag, out);
+        out = CodedOutputStream::WriteVarint32ToArray(
+            static_cast<uint32_t>(record.size()), out);
+        out = std::copy(record.blob().begin(), record.blob().end(), out);
+      }
+      std::copy(
+          message.data() + position, message.data() + message.size(), out);
+      return crypto::Blob(std::move(data));
+    }
+
+    /**
+     * Serialize the message like makeBlob, but take the records of its
+     * repeated field from the given blobs, so that the elements of the field,
+     * which are serialized already, are not serialized again
+     * @param message - message to serialize
+     * @param field - the repeated field of the message
+     * @param field_number - number of the field in the schema
+     * @param arena - arena of the message, nullptr if it is on the heap
+     * @param records - range of serialized elements of the field
+     */
+    template <typename Message, typename Element, typename Records>
+    crypto::Blob makeBlob(Message &message,
+                          google::protobuf::RepeatedPtrField<Element> &field,
+                          int field_number,
+                          google::protobuf::Arena *arena,
+                          const Records &records) {
+      // the field is detached for a while; elements keep their addresses
+      google::protobuf::RepeatedPtrField<Element> detached(arena);
+      field.Swap(&detached);
+      auto rest = makeBlob(message);
+      field.Swap(&detached);
+      return spliceBlob(rest.blob(), field_number, records);
+    }
+
+    /**
+     * Protobuf message owned together with an arena. Messages created on
+     * the arena allocate their submessages there as well, so copying
+     * transactions to them does not allocate each field separately, and
+     * they are freed at once.
+     * @tparam T - type of the message
+     */
+    template <typename T>
+    class ArenaMessage {
+     public:
+      /// Create an empty message on the arena
+      ArenaMessage()
+          : arena_(std::make_unique<google::protobuf::Arena>()),
+            message_(google::protobuf::Arena::CreateMessage<T>(arena_.get())),
+            on_arena_(true) {}
+
+      /// Copy the message to the arena
+      explicit ArenaMessage(const T &message) : ArenaMessage() {
+        message_->CopyFrom(message);
+      }
+
+      /// Take the message, which stays on the heap
+      explicit ArenaMessage(T &&message)
+          : arena_(std::make_unique<google::protobuf::Arena>()),
+            message_(new T(std::move(message))),
+            on_arena_(false) {
+        arena_->Own(message_);
+      }
+
+      T &operator*() const {
+        return *message_;
+      }
+
+      T *operator->() const {
+        return message_;
+      }
+
+      /// @return arena of the message, nullptr if it is on the heap
+      google::protobuf::Arena *arena() const {
+        return on_arena_ ? arena_.get() : nullptr;
+      }
+
+     private:
+      std::unique_ptr<google::protobuf::Arena> arena_;
+      T *message_;
+      bool on_arena_;
+    };
+
   }  // namespace proto
 }  // namespace shared_model
 
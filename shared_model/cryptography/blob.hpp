@@ -6,6 +6,7 @@
 #ifndef IROHA_SHARED_MODEL_BLOB_HPP
 #define IROHA_SHARED_MODEL_BLOB_HPP
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -21,6 +22,9 @@ namespace shared_model {
     /**
      * Blob class present user-friendly blob for working with low-level
      * binary stuff. Its length is not fixed in compile time.
+     *
+     * Hex representation is computed on the first request only, since most
+     * blobs, such as payloads, are never printed.
      */
     class Blob : public interface::ModelPrimitive<Blob>,
                  public Cloneable<Blob> {
@@ -42,6 +46,11 @@ namespace shared_model {
 
       explicit Blob(Bytes &&blob) noexcept;
 
+      Blob(const Blob &other);
+      Blob(Blob &&other) noexcept;
+      Blob &operator=(const Blob &other);
+      Blob &operator=(Blob &&other) noexcept;
+
       /**
        * Creates new Blob object from provided hex string
        * @param hex - string in hex format to create Blob from
@@ -75,7 +84,8 @@ namespace shared_model {
 
      private:
       Bytes blob_;
-      std::string hex_;
+      /// accessed atomically, since const blobs are shared between threads
+      mutable std::shared_ptr<const std::string> hex_;
     };
 
   }  // namespace crypto
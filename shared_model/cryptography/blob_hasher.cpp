@@ -5,11 +5,10 @@
 
 #include "cryptography/blob_hasher.hpp"
 
-#include <boost/functional/hash.hpp>
 #include "cryptography/blob.hpp"
 
 using namespace shared_model::crypto;
 
 std::size_t BlobHasher::operator()(const Blob &blob) const {
-  return boost::hash_value(blob.blob());
+  return hashBytes(blob.blob().data(), blob.blob().size());
 }
@@ -7,11 +7,34 @@
 #define IROHA_CRYPTO_BLOB_HASHER_HPP
 
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <boost/functional/hash.hpp>
 
 namespace shared_model {
   namespace crypto {
     class Blob;
 
+    /**
+     * Hash the bytes a machine word at a time, which is much cheaper than
+     * combining each byte for keys and hashes of tens of bytes
+     */
+    inline std::size_t hashBytes(const uint8_t *data, std::size_t size) {
+      std::size_t seed = size;
+      std::size_t word;
+      for (; size >= sizeof(word); data += sizeof(word), size -= sizeof(word)) {
+        std::memcpy(&word, data, sizeof(word));
+        boost::hash_combine(seed, word);
+      }
+      if (size > 0) {
+        word = 0;
+        std::memcpy(&word, data, size);
+        boost::hash_combine(seed, word);
+      }
+      return seed;
+    }
+
     /**
      * Hashing of Blob object
      */
@@ -0,0 +1,94 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SHARED_MODEL_FIXED_BLOB_HPP
+#define IROHA_SHARED_MODEL_FIXED_BLOB_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <string>
+
+#include <boost/optional.hpp>
+#include "cryptography/blob.hpp"
+#include "cryptography/blob_hasher.hpp"
+
+namespace shared_model {
+  namespace crypto {
+
+    /**
+     * Blob of the size fixed in compile time, which keeps its bytes inline.
+     * Unlike Blob, it is a plain value without heap allocations, so it is
+     * cheap to copy, compare and hash as a key of containers.
+     * @tparam N - size in bytes
+     */
+    template <size_t N>
+    class FixedBlob {
+     public:
+      static constexpr size_t kSize = N;
+
+      FixedBlob() : bytes_{} {}
+
+      /**
+       * @param blob - blob to copy the bytes from
+       * @return blob with the same bytes, or none if the size is not N
+       */
+      static boost::optional<FixedBlob> fromBlob(const Blob &blob) {
+        if (blob.size() != N) {
+          return boost::none;
+        }
+        FixedBlob result;
+        std::copy(
+            blob.blob().begin(), blob.blob().end(), result.bytes_.begin());
+        return result;
+      }
+
+      const uint8_t *data() const {
+        return bytes_.data();
+      }
+
+      static constexpr size_t size() {
+        return N;
+      }
+
+      Blob toBlob() const {
+        return Blob(Blob::Bytes(bytes_.begin(), bytes_.end()));
+      }
+
+      bool operator==(const FixedBlob &rhs) const {
+        return bytes_ == rhs.bytes_;
+      }
+
+      bool operator!=(const FixedBlob &rhs) const {
+        return bytes_ != rhs.bytes_;
+      }
+
+      bool operator<(const FixedBlob &rhs) const {
+        return bytes_ < rhs.bytes_;
+      }
+
+      /**
+       * To calculate hash used by some standard containers
+       */
+      struct Hasher {
+        std::size_t operator()(const FixedBlob &blob) const {
+          return hashBytes(blob.data(), N);
+        }
+      };
+
+     private:
+      std::array<uint8_t, N> bytes_;
+    };
+
+    template <size_t N>
+    constexpr size_t FixedBlob<N>::kSize;
+
+    /// Hash of the default hash provider
+    using HashBytes = FixedBlob<32>;
+
+  }  // namespace crypto
+}  // namespace shared_model
+
+#endif  // IROHA_SHARED_MODEL_FIXED_BLOB_HPP
@@ -19,8 +19,30 @@ namespace shared_model {
 
     Blob::Blob(const Bytes &blob) : Blob(Bytes(blob)) {}
 
-    Blob::Blob(Bytes &&blob) noexcept : blob_(std::move(blob)) {
-      hex_ = iroha::bytestringToHexstring(toBinaryString(*this));
+    Blob::Blob(Bytes &&blob) noexcept : blob_(std::move(blob)) {}
+
+    Blob::Blob(const Blob &other)
+        : interface::ModelPrimitive<Blob>(other),
+          Cloneable<Blob>(other),
+          blob_(other.blob_),
+          hex_(std::atomic_load(&other.hex_)) {}
+
+    Blob::Blob(Blob &&other) noexcept
+        : interface::ModelPrimitive<Blob>(other),
+          Cloneable<Blob>(other),
+          blob_(std::move(other.blob_)),
+          hex_(std::move(other.hex_)) {}
+
+    Blob &Blob::operator=(const Blob &other) {
+      blob_ = other.blob_;
+      std::atomic_store(&hex_, std::atomic_load(&other.hex_));
+      return *this;
+    }
+
+    Blob &Blob::operator=(Blob &&other) noexcept {
+      blob_ = std::move(other.blob_);
+      hex_ = std::move(other.hex_);
+      return *this;
     }
 
     Blob *Blob::clone() const {
@@ -32,10 +54,12 @@ namespace shared_model {
     }
 
     Blob Blob::fromHexString(const std::string &hex) {
-      using iroha::operator|;
-      Blob b("");
-      iroha::hexstringToBytestring(hex) | [&](auto &&s) { b = Blob(s); };
-      return b;
+      Bytes bytes(hex.size() / 2);
+      if (hex.size() % 2 != 0
+          or not iroha::hexToBytes(hex.data(), hex.size(), bytes.data())) {
+        return Blob("");
+      }
+      return Blob(std::move(bytes));
     }
 
     const Blob::Bytes &Blob::blob() const {
@@ -43,7 +67,18 @@ namespace shared_model {
     }
 
     const std::string &Blob::hex() const {
-      return hex_;
+      auto hex = std::atomic_load(&hex_);
+      if (not hex) {
+        std::string encoded(blob_.size() * 2, '\0');
+        iroha::bytesToHex(blob_.data(), blob_.size(), &encoded[0]);
+        auto computed =
+            std::make_shared<const std::string>(std::move(encoded));
+        // keep the value of another thread, which has computed it meanwhile
+        if (std::atomic_compare_exchange_strong(&hex_, &hex, computed)) {
+          hex = std::move(computed);
+        }
+      }
+      return *hex;
     }
 
     size_t Blob::size() const {
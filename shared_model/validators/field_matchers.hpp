@@ -0,0 +1,257 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SHARED_MODEL_FIELD_MATCHERS_HPP
+#define IROHA_SHARED_MODEL_FIELD_MATCHERS_HPP
+
+#include <algorithm>
+#include <ciso646>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * Matchers of the field formats, which FieldValidator checks.
+ *
+ * Each matcher accepts exactly the strings, which the regular expression of
+ * the format matches entirely, but it scans the string once with a table of
+ * character classes, so it neither backtracks nor allocates. The regular
+ * expressions are kept for error messages and for the tests of the matchers.
+ */
+namespace shared_model {
+  namespace validation {
+    namespace matchers {
+
+      namespace detail {
+        enum CharClass : uint8_t {
+          kLower = 1 << 0,
+          kUpper = 1 << 1,
+          kDigit = 1 << 2,
+          kUnderscore = 1 << 3,
+          kHyphen = 1 << 4,
+        };
+
+        struct CharClassTable {
+          uint8_t classes[256];
+        };
+
+        constexpr CharClassTable makeCharClassTable() {
+          CharClassTable table{};
+          for (int c = 'a'; c <= 'z'; ++c) {
+            table.classes[c] = kLower;
+          }
+          for (int c = 'A'; c <= 'Z'; ++c) {
+            table.classes[c] = kUpper;
+          }
+          for (int c = '0'; c <= '9'; ++c) {
+            table.classes[c] = kDigit;
+          }
+          table.classes[static_cast<uint8_t>('_')] = kUnderscore;
+          table.classes[static_cast<uint8_t>('-')] = kHyphen;
+          return table;
+        }
+
+        constexpr CharClassTable kCharClasses = makeCharClassTable();
+
+        /// @return true if the character is of one of the classes
+        inline bool is(char c, uint8_t classes) {
+          return (kCharClasses.classes[static_cast<uint8_t>(c)] & classes)
+              != 0;
+        }
+
+        /// @return true if [begin, end) has from 1 to max_size characters,
+        /// each of one of the classes
+        inline bool isWord(const char *begin,
+                           const char *end,
+                           size_t max_size,
+                           uint8_t classes) {
+          auto size = static_cast<size_t>(end - begin);
+          return size >= 1 and size <= max_size
+              and std::all_of(begin, end, [classes](char c) {
+                   return is(c, classes);
+                 });
+        }
+
+        /// @return true if [begin, end) is a decimal number not greater than
+        /// max, which has no leading zeros
+        inline bool isNumber(const char *begin,
+                             const char *end,
+                             size_t max_digits,
+                             uint32_t max) {
+          if (not isWord(begin, end, max_digits, kDigit)
+              or (*begin == '0' and end - begin > 1)) {
+            return false;
+          }
+          uint32_t value = 0;
+          for (auto it = begin; it != end; ++it) {
+            value = value * 10 + static_cast<uint32_t>(*it - '0');
+          }
+          return value <= max;
+        }
+
+        /// @see matchers::isName
+        inline bool isName(const char *begin, const char *end) {
+          return isWord(begin, end, 32, kLower | kDigit | kUnderscore);
+        }
+
+        /// @see matchers::isDomain
+        inline bool isDomain(const char *begin, const char *end) {
+          constexpr size_t kMaxLabelSize = 63;
+          constexpr uint8_t kLetter = kLower | kUpper;
+          auto label = begin;
+          while (true) {
+            auto label_end = std::find(label, end, '.');
+            if (label == label_end or not is(*label, kLetter)
+                or not is(label_end[-1], kLetter | kDigit)
+                or not isWord(label,
+                              label_end,
+                              kMaxLabelSize,
+                              kLetter | kDigit | kHyphen)) {
+              return false;
+            }
+            if (label_end == end) {
+              return true;
+            }
+            label = label_end + 1;
+          }
+        }
+
+        /// @see matchers::isIpV4
+        inline bool isIpV4(const char *begin, const char *end) {
+          auto octet = begin;
+          for (int i = 0; i < 4; ++i) {
+            auto octet_end = i < 3 ? std::find(octet, end, '.') : end;
+            if (octet_end == end and i < 3) {
+              return false;
+            }
+            if (not isNumber(octet, octet_end, 3, 255)) {
+              return false;
+            }
+            octet = octet_end + 1;
+          }
+          return true;
+        }
+
+        /// @return true if [begin, end) is name, separator and domain
+        inline bool isQualifiedName(const char *begin,
+                                    const char *end,
+                                    char separator) {
+          auto it = std::find(begin, end, separator);
+          return it != end and isName(begin, it) and isDomain(it + 1, end);
+        }
+      }  // namespace detail
+
+      /// @return true if the string matches [a-z_0-9]{1,32}
+      inline bool isName(const std::string &str) {
+        return detail::isName(str.data(), str.data() + str.size());
+      }
+
+      /**
+       * @return true if the string is a dot-separated sequence of labels,
+       * which have from 1 to 63 letters, digits or hyphens, start with a
+       * letter and end with a letter or a digit
+       */
+      inline bool isDomain(const std::string &str) {
+        return detail::isDomain(str.data(), str.data() + str.size());
+      }
+
+      /// @return true if the string is name@domain
+      inline bool isAccountId(const std::string &str) {
+        return detail::isQualifiedName(
+            str.data(), str.data() + str.size(), '@');
+      }
+
+      /// @return true if the string is name#domain
+      inline bool isAssetId(const std::string &str) {
+        return detail::isQualifiedName(
+            str.data(), str.data() + str.size(), '#');
+      }
+
+      /// @return true if the string matches [A-Za-z0-9_]{1,64}
+      inline bool isAccountDetailKey(const std::string &str) {
+        using namespace detail;
+        return isWord(str.data(),
+                      str.data() + str.size(),
+                      64,
+                      kLower | kUpper | kDigit | kUnderscore);
+      }
+
+      /**
+       * @return true if the string is host:port, where host is either IPv4
+       * address or domain, and port is a number from 0 to 65535, both
+       * without leading zeros
+       */
+      inline bool isPeerAddress(const std::string &str) {
+        auto begin = str.data();
+        auto end = str.data() + str.size();
+        auto colon = std::find(begin, end, ':');
+        return colon != end
+            and (detail::isIpV4(begin, colon)
+                 or detail::isDomain(begin, colon))
+            and detail::isNumber(colon + 1, end, 5, 65535);
+      }
+
+      namespace patterns {
+        /// regular expression of isName
+        inline const std::string &name() {
+          static const std::string pattern{R"#([a-z_0-9]{1,32})#"};
+          return pattern;
+        }
+
+        /// regular expression of isDomain
+        inline const std::string &domain() {
+          static const std::string pattern{
+              R"#(([a-zA-Z]([a-zA-Z0-9\-]{0,61}[a-zA-Z0-9])?\.)*)#"
+              R"#([a-zA-Z]([a-zA-Z0-9\-]{0,61}[a-zA-Z0-9])?)#"};
+          return pattern;
+        }
+
+        /// regular expression of isAccountId
+        inline const std::string &accountId() {
+          static const std::string pattern{name() + R"#(\@)#" + domain()};
+          return pattern;
+        }
+
+        /// regular expression of isAssetId
+        inline const std::string &assetId() {
+          static const std::string pattern{name() + R"#(\#)#" + domain()};
+          return pattern;
+        }
+
+        /// regular expression of isAccountDetailKey
+        inline const std::string &accountDetailKey() {
+          static const std::string pattern{R"([A-Za-z0-9_]{1,64})"};
+          return pattern;
+        }
+
+        /// regular expression of the host of isPeerAddress, which is IPv4
+        inline const std::string &ipV4() {
+          static const std::string pattern{
+              R"#(^((([0-9]|[1-9][0-9]|1[0-9]{2}|2[0-4][0-9]|25[0-5])\.){3})#"
+              R"#(([0-9]|[1-9][0-9]|1[0-9]{2}|2[0-4][0-9]|25[0-5])))#"};
+          return pattern;
+        }
+
+        /// regular expression of the port of isPeerAddress
+        inline const std::string &port() {
+          static const std::string pattern{
+              R"#((6553[0-5]|655[0-2]\d|65[0-4]\d\d|6[0-4]\d{3}|[1-5]\d{4})#"
+              R"#(|[1-9]\d{0,3}|0)$)#"};
+          return pattern;
+        }
+
+        /// regular expression of isPeerAddress
+        inline const std::string &peerAddress() {
+          static const std::string pattern{"((" + ipV4() + ")|(" + domain()
+                                           + ")):" + port()};
+          return pattern;
+        }
+      }  // namespace patterns
+
+    }  // namespace matchers
+  }  // namespace validation
+}  // namespace shared_model
+
+#endif  // IROHA_SHARED_MODEL_FIELD_MATCHERS_HPP
@@ -8,7 +8,6 @@
 #include <limits>
 
 #include <fmt/core.h>
-#include <boost/algorithm/string_regex.hpp>
 #include <boost/format.hpp>
 #include <boost/range/adaptor/indexed.hpp>
 #include "common/bind.hpp"
@@ -25,7 +24,7 @@
 #include "interfaces/queries/asset_pagination_meta.hpp"
 #include "interfaces/queries/query_payload_meta.hpp"
 #include "interfaces/queries/tx_pagination_meta.hpp"
-#include "validators/field_validator.hpp"
+#include "validators/field_matchers.hpp"
 #include "validators/validation_error_helpers.hpp"
 
 // TODO: 15.02.18 nickaleks Change structure to compositional IR-978
@@ -33,15 +32,24 @@
 using iroha::operator|;
 
 namespace {
-  class RegexValidator {
+  namespace matchers = shared_model::validation::matchers;
+
+  /**
+   * Validator of a field format, which checks it with a compiled matcher.
+   * The error message refers to the regular expression of the format.
+   */
+  class FormatValidator {
    public:
-    RegexValidator(
+    using Matcher = bool (*)(const std::string &);
+
+    FormatValidator(
         std::string name,
+        Matcher matcher,
         std::string pattern,
         boost::optional<const char *> format_description = boost::none)
         : name_(std::move(name)),
+          matcher_(matcher),
           pattern_(std::move(pattern)),
-          regex_(pattern_),
           format_description_(
               std::move(format_description) | [](std::string description) {
                 return std::string{" "} + std::move(description);
@@ -49,7 +57,7 @@ namespace {
 
     boost::optional<shared_model::validation::ValidationError> validate(
         const std::string &value) const {
-      if (not std::regex_match(value, regex_)) {
+      if (not matcher_(value)) {
         return shared_model::validation::ValidationError(
             name_,
             {fmt::format("passed value: '{}' does not match regex '{}'.{}",
@@ -60,48 +68,35 @@ namespace {
       return boost::none;
     }
 
-    std::string getPattern() const {
-      return pattern_;
-    }
-
    private:
     std::string name_;
+    Matcher matcher_;
     std::string pattern_;
-    std::regex regex_;
     std::string format_description_;
   };
 
-  const RegexValidator kAccountNameValidator{"AccountName",
-                                             R"#([a-z_0-9]{1,32})#"};
-  const RegexValidator kAssetNameValidator{"AssetName", R"#([a-z_0-9]{1,32})#"};
-  const RegexValidator kDomainValidator{
-      "Domain",
-      R"#(([a-zA-Z]([a-zA-Z0-9\-]{0,61}[a-zA-Z0-9])?\.)*)#"
-      R"#([a-zA-Z]([a-zA-Z0-9\-]{0,61}[a-zA-Z0-9])?)#"};
-  static const std::string kIpV4Pattern{
-      R"#(^((([0-9]|[1-9][0-9]|1[0-9]{2}|2[0-4][0-9]|25[0-5])\.){3})#"
-      R"#(([0-9]|[1-9][0-9]|1[0-9]{2}|2[0-4][0-9]|25[0-5])))#"};
-  static const std::string kPortPattern{
-      R"#((6553[0-5]|655[0-2]\d|65[0-4]\d\d|6[0-4]\d{3}|[1-5]\d{4}|[1-9]\d{0,3}|0)$)#"};
-  const RegexValidator kPeerAddressValidator{
+  const FormatValidator kAccountNameValidator{
+      "AccountName", matchers::isName, matchers::patterns::name()};
+  const FormatValidator kAssetNameValidator{
+      "AssetName", matchers::isName, matchers::patterns::name()};
+  const FormatValidator kDomainValidator{
+      "Domain", matchers::isDomain, matchers::patterns::domain()};
+  const FormatValidator kPeerAddressValidator{
       "PeerAddress",
-      fmt::format("(({})|({})):{}",
-                  kIpV4Pattern,
-                  kDomainValidator.getPattern(),
-                  kPortPattern),
+      matchers::isPeerAddress,
+      matchers::patterns::peerAddress(),
       "Field should have a valid 'host:port' format where host is "
       "IPv4 or a hostname following RFC1035, RFC1123 specifications"};
-  const RegexValidator kAccountIdValidator{"AccountId",
-                                           kAccountNameValidator.getPattern()
-                                               + R"#(\@)#"
-                                               + kDomainValidator.getPattern()};
-  const RegexValidator kAssetIdValidator{"AssetId",
-                                         kAssetNameValidator.getPattern()
-                                             + R"#(\#)#"
-                                             + kDomainValidator.getPattern()};
-  const RegexValidator kAccountDetailKeyValidator{"DetailKey",
-                                                  R"([A-Za-z0-9_]{1,64})"};
-  const RegexValidator kRoleIdValidator{"RoleId", R"#([a-z_0-9]{1,32})#"};
+  const FormatValidator kAccountIdValidator{
+      "AccountId", matchers::isAccountId, matchers::patterns::accountId()};
+  const FormatValidator kAssetIdValidator{
+      "AssetId", matchers::isAssetId, matchers::patterns::assetId()};
+  const FormatValidator kAccountDetailKeyValidator{
+      "DetailKey",
+      matchers::isAccountDetailKey,
+      matchers::patterns::accountDetailKey()};
+  const FormatValidator kRoleIdValidator{
+      "RoleId", matchers::isName, matchers::patterns::name()};
 }  // namespace
 
 namespace shared_model {
@@ -5,7 +5,7 @@
 
 #include "validators/validators_common.hpp"
 
-#include <regex>
+#include "common/hexutils.hpp"
 
 namespace shared_model {
   namespace validation {
@@ -20,8 +20,7 @@ namespace shared_model {
           txs_duplicates_allowed(txs_duplicates_allowed) {}
 
     bool validateHexString(const std::string &str) {
-      static const std::regex hex_regex{R"([0-9a-fA-F]*)"};
-      return std::regex_match(str, hex_regex);
+      return iroha::isHexString(str);
     }
 
   }  // namespace validation
@@ -0,0 +1,183 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+#include <soci/soci.h>
+#include "ametsuchi/block_storage.hpp"
+#include "ametsuchi/impl/postgres_command_executor.hpp"
+#include "ametsuchi/impl/postgres_specific_query_executor.hpp"
+#include "backend/protobuf/proto_permission_to_string.hpp"
+#include "backend/protobuf/proto_query_response_factory.hpp"
+#include "framework/common_constants.hpp"
+#include "framework/executor_itf/executor_itf.hpp"
+#include "framework/test_db_manager.hpp"
+#include "framework/test_logger.hpp"
+#include "interfaces/query_responses/transactions_page_response.hpp"
+#include "logger/logger_manager.hpp"
+#include "module/irohad/pending_txs_storage/pending_txs_storage_mock.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+using namespace common_constants;
+using namespace iroha::ametsuchi;
+using namespace iroha::integration_framework;
+
+namespace {
+  const size_t kTxsPerBlock = 100;
+  const shared_model::interface::types::TransactionsNumberType kPageSize = 10;
+
+  /// Serves the same transaction at every position of the synthetic history
+  class SyntheticBlockStorage : public BlockStorage {
+   public:
+    bool insert(
+        std::shared_ptr<const shared_model::interface::Block>) override {
+      return false;
+    }
+
+    boost::optional<std::shared_ptr<const shared_model::interface::Block>>
+    fetch(shared_model::interface::types::HeightType) const override {
+      return boost::none;
+    }
+
+    boost::optional<std::unique_ptr<shared_model::interface::Transaction>>
+    fetchTransaction(shared_model::interface::types::HeightType,
+                     size_t) const override {
+      return clone(tx_);
+    }
+
+    size_t size() const override {
+      return 0;
+    }
+
+    void clear() override {}
+
+    void forEach(FunctionType) const override {}
+
+   private:
+    shared_model::proto::Transaction tx_ =
+        TestTransactionBuilder().creatorAccountId(kUserId).build();
+  };
+
+  /**
+   * Database where the user has created history_size transactions. Only the
+   * transaction indices are filled, so that the history is generated fast.
+   */
+  class HistoryEnvironment {
+   public:
+    explicit HistoryEnvironment(size_t history_size) {
+      auto db_manager = TestDbManager::createWithRandomDbName(
+          2, getTestLoggerManager()->getChild("TestDbManager"));
+      throwOnError(db_manager);
+      db_manager_ = std::move(db_manager).assumeValue();
+      sql_ = db_manager_->getSession();
+
+      auto perm_converter =
+          std::make_shared<shared_model::proto::ProtoPermissionToString>();
+      ExecutorItfTarget target;
+      target.command_executor = std::make_shared<PostgresCommandExecutor>(
+          db_manager_->getSession(), perm_converter);
+      target.query_executor = std::make_shared<PostgresSpecificQueryExecutor>(
+          *sql_,
+          block_storage_,
+          std::make_shared<MockPendingTransactionStorage>(),
+          std::make_shared<shared_model::proto::ProtoQueryResponseFactory>(),
+          perm_converter,
+          getTestLogger("SpecificQueryExecutor"));
+      auto itf = ExecutorItf::create(std::move(target));
+      throwOnError(itf);
+      itf_ = std::move(itf).assumeValue();
+
+      throwOnError(itf_->createUserWithPerms(
+          kUser,
+          kDomain,
+          kUserKeypair.publicKey(),
+          {shared_model::interface::permissions::Role::kGetMyAccTxs}));
+
+      const auto size = static_cast<long long>(history_size);
+      const auto per_block = static_cast<long long>(kTxsPerBlock);
+      *sql_ << "INSERT INTO tx_position_by_creator(creator_id, height, index) "
+               "SELECT :account, n / :per_block + 1, n % :per_block "
+               "FROM generate_series(0, :size - 1) n",
+          soci::use(kUserId, "account"), soci::use(per_block, "per_block"),
+          soci::use(size, "size");
+      *sql_ << "INSERT INTO position_by_hash(hash, height, index) "
+               "SELECT md5(n::text), n / :per_block + 1, n % :per_block "
+               "FROM generate_series(0, :size - 1) n",
+          soci::use(per_block, "per_block"), soci::use(size, "size");
+      *sql_ << "INSERT INTO tx_count_by_creator(creator_id, count) "
+               "VALUES (:account, :size)",
+          soci::use(kUserId, "account"), soci::use(size, "size");
+      *sql_ << "ANALYZE";
+
+      std::string middle_hash;
+      *sql_ << "SELECT md5((:size / 2)::text)", soci::use(size, "size"),
+          soci::into(middle_hash);
+      middle_hash_ = shared_model::crypto::Hash::fromHexString(middle_hash);
+    }
+
+    ExecutorItf &itf() {
+      return *itf_;
+    }
+
+    /// Hash of the transaction in the middle of the history.
+    const shared_model::crypto::Hash &middleHash() const {
+      return middle_hash_;
+    }
+
+   private:
+    static std::string errorMessage(const std::string &error) {
+      return error;
+    }
+
+    static std::string errorMessage(const CommandError &error) {
+      return error.toString();
+    }
+
+    template <typename Result>
+    static void throwOnError(const Result &result) {
+      if (auto e = iroha::expected::resultToOptionalError(result)) {
+        throw std::runtime_error(errorMessage(*e));
+      }
+    }
+
+    std::unique_ptr<TestDbManager> db_manager_;
+    std::unique_ptr<soci::session> sql_;
+    SyntheticBlockStorage block_storage_;
+    std::unique_ptr<ExecutorItf> itf_;
+    shared_model::crypto::Hash middle_hash_;
+  };
+}  // namespace
+
+/**
+ * Requests a page of the user's transactions. The first argument is the size
+ * of the history, the second one selects whether the page starts from the
+ * middle of the history by pagination hash, or from its beginning.
+ */
+static void BM_AccountTransactionsPage(benchmark::State &state) {
+  HistoryEnvironment env(state.range(0));
+  const auto first_hash = state.range(1)
+      ? boost::make_optional(env.middleHash())
+      : boost::none;
+  const auto &factory = env.itf().getMockQueryFactory();
+  auto pagination = factory->constructTxPaginationMeta(kPageSize, first_hash);
+  auto query = factory->constructGetAccountTransactions(kUserId, *pagination);
+
+  while (state.KeepRunning()) {
+    auto response = env.itf().executeQuery(*query, kUserId);
+    if (not boost::get<const shared_model::interface::TransactionsPageResponse
+                           &>(&response->get())) {
+      state.SkipWithError(response->toString().c_str());
+      break;
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_AccountTransactionsPage)
+    ->Args({10000, 0})
+    ->Args({10000, 1})
+    ->Args({1000000, 0})
+    ->Args({1000000, 1})
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,68 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+#include <soci/soci.h>
+#include "ametsuchi/impl/postgres_block_index.hpp"
+#include "ametsuchi/impl/postgres_indexer.hpp"
+#include "framework/test_db_manager.hpp"
+#include "framework/test_logger.hpp"
+#include "logger/logger_manager.hpp"
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+using namespace iroha::ametsuchi;
+using namespace iroha::integration_framework;
+
+namespace {
+  /// Make a block where each transaction moves an asset between accounts
+  shared_model::proto::Block makeBlock(size_t transactions) {
+    std::vector<shared_model::proto::Transaction> txs;
+    txs.reserve(transactions);
+    for (size_t i = 0; i < transactions; ++i) {
+      const auto creator = "user" + std::to_string(i % 10) + "@test";
+      txs.push_back(TestTransactionBuilder()
+                        .creatorAccountId(creator)
+                        .createdTime(i)
+                        .addAssetQuantity("coin#test", "2.0")
+                        .transferAsset(
+                            creator, "admin@test", "coin#test", "", "1.0")
+                        .build());
+    }
+    return TestBlockBuilder().height(1).transactions(txs).build();
+  }
+}  // namespace
+
+/**
+ * Indexes a block and writes the indices to the database, in a transaction
+ * which is rolled back afterwards. The argument is the block size.
+ */
+static void BM_IndexBlock(benchmark::State &state) {
+  auto db_manager_result = TestDbManager::createWithRandomDbName(
+      1, getTestLoggerManager()->getChild("TestDbManager"));
+  if (auto e = iroha::expected::resultToOptionalError(db_manager_result)) {
+    state.SkipWithError(e->c_str());
+    return;
+  }
+  auto db_manager = std::move(db_manager_result).assumeValue();
+  auto sql = db_manager->getSession();
+  PostgresBlockIndex block_index(std::make_unique<PostgresIndexer>(*sql),
+                                 getTestLogger("BlockIndex"));
+  const auto block = makeBlock(state.range(0));
+
+  while (state.KeepRunning()) {
+    *sql << "BEGIN";
+    block_index.index(block);
+    *sql << "ROLLBACK";
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_IndexBlock)
+    ->Arg(10)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,137 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "ametsuchi/impl/k_times_reconnection_strategy.hpp"
+#include "ametsuchi/impl/postgres_block_storage_factory.hpp"
+#include "ametsuchi/impl/postgres_options.hpp"
+#include "framework/config_helper.hpp"
+#include "framework/test_logger.hpp"
+#include "logger/logger_manager.hpp"
+#include "main/impl/pg_connection_init.hpp"
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+#include "validators/always_valid_validator.hpp"
+
+using namespace iroha::ametsuchi;
+
+namespace {
+  const shared_model::interface::types::HeightType kHeight = 1;
+
+  /// Database with a block storage holding a single block of given size
+  class BlockStorageEnvironment {
+   public:
+    explicit BlockStorageEnvironment(size_t transactions) {
+      throwOnError(PgConnectionInit::createDatabaseIfNotExist(options_));
+      auto pool = PgConnectionInit::prepareConnectionPool(
+          KTimesReconnectionStrategyFactory{0},
+          options_,
+          1,
+          getTestLoggerManager()->getChild("Storage"));
+      throwOnError(pool);
+      pool_wrapper_ = std::move(pool).assumeValue();
+
+      auto block_factory =
+          std::make_shared<shared_model::proto::ProtoBlockFactory>(
+              std::make_unique<shared_model::validation::AlwaysValidValidator<
+                  shared_model::interface::Block>>(),
+              std::make_unique<shared_model::validation::AlwaysValidValidator<
+                  iroha::protocol::Block>>());
+      storage_ = PostgresBlockStorageFactory(
+                     pool_wrapper_,
+                     block_factory,
+                     [] { return std::string("bm_blocks"); },
+                     getTestLogger("PostgresBlockStorage"))
+                     .create();
+
+      std::vector<shared_model::proto::Transaction> txs;
+      txs.reserve(transactions);
+      for (size_t i = 0; i < transactions; ++i) {
+        txs.push_back(TestTransactionBuilder()
+                          .creatorAccountId("user@test")
+                          .createdTime(i)
+                          .setAccountDetail("user@test", "key", "value")
+                          .transferAsset("user@test",
+                                         "admin@test",
+                                         "coin#test",
+                                         "transfer",
+                                         "1.00")
+                          .build());
+      }
+      if (not storage_->insert(clone(
+              TestBlockBuilder().height(kHeight).transactions(txs).build()))) {
+        throw std::runtime_error("Failed to insert the block");
+      }
+    }
+
+    ~BlockStorageEnvironment() {
+      storage_ = nullptr;
+      pool_wrapper_ = nullptr;
+      PgConnectionInit::dropWorkingDatabase(options_);
+    }
+
+    BlockStorage &storage() {
+      return *storage_;
+    }
+
+   private:
+    template <typename Result>
+    static void throwOnError(const Result &result) {
+      if (auto e = iroha::expected::resultToOptionalError(result)) {
+        throw std::runtime_error(e.value());
+      }
+    }
+
+    logger::LoggerPtr log_ = getTestLogger("Storage");
+    std::string dbname_ = integration_framework::getRandomDbName();
+    PostgresOptions options_{
+        "dbname=" + dbname_ + " "
+            + integration_framework::getPostgresCredsOrDefault(),
+        dbname_,
+        log_};
+    std::shared_ptr<PoolWrapper> pool_wrapper_;
+    std::unique_ptr<BlockStorage> storage_;
+  };
+}  // namespace
+
+/**
+ * Retrieves a single transaction by decoding the whole block, as the
+ * transactions queries used to do. The argument is the block size.
+ */
+static void BM_FetchTransactionFromBlock(benchmark::State &state) {
+  BlockStorageEnvironment env(state.range(0));
+  const size_t index = state.range(0) / 2;
+
+  while (state.KeepRunning()) {
+    auto block = env.storage().fetch(kHeight);
+    benchmark::DoNotOptimize(clone((*block)->transactions()[index]));
+  }
+}
+BENCHMARK(BM_FetchTransactionFromBlock)
+    ->Arg(10)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Unit(benchmark::kMicrosecond);
+
+/**
+ * Retrieves a single transaction by its offsets in the stored block.
+ * The argument is the block size.
+ */
+static void BM_FetchTransaction(benchmark::State &state) {
+  BlockStorageEnvironment env(state.range(0));
+  const size_t index = state.range(0) / 2;
+
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(env.storage().fetchTransaction(kHeight, index));
+  }
+}
+BENCHMARK(BM_FetchTransaction)
+    ->Arg(10)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,213 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Blocks and proposals keep their payloads as blobs, and hashes and keys are
+ * blobs too. The purpose of this benchmark is to keep track of the time and
+ * memory, which the blobs cost to construct, and of the cost of hashes as
+ * keys of containers.
+ *
+ * Allocations are counted by the replaced global operator new, and reported
+ * as counters per iteration.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <unordered_map>
+
+#include "backend/protobuf/block.hpp"
+#include "backend/protobuf/proposal.hpp"
+#include "cryptography/default_hash_provider.hpp"
+#include "cryptography/fixed_blob.hpp"
+#include "cryptography/hash.hpp"
+#include "datetime/time.hpp"
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_proposal_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+namespace {
+  std::atomic<size_t> allocated_bytes{0};
+  std::atomic<size_t> allocations{0};
+}  // namespace
+
+void *operator new(std::size_t size) {
+  allocated_bytes += size;
+  ++allocations;
+  if (auto ptr = std::malloc(size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
+
+namespace {
+  /// number of commands in a single transaction
+  constexpr int kCommands = 5;
+
+  std::vector<shared_model::proto::Transaction> makeTransactions(
+      size_t count) {
+    auto base_tx =
+        TestTransactionBuilder().createdTime(iroha::time::now()).quorum(1);
+    for (int i = 0; i < kCommands; ++i) {
+      base_tx.transferAsset("player@one", "player@two", "coin", "", "5.00");
+    }
+    std::vector<shared_model::proto::Transaction> txs;
+    for (size_t i = 0; i < count; ++i) {
+      txs.push_back(base_tx.build());
+    }
+    return txs;
+  }
+
+  /// Counts allocations of the benchmark loop
+  class AllocationCounter {
+   public:
+    AllocationCounter()
+        : bytes_(allocated_bytes.load()), count_(allocations.load()) {}
+
+    void report(benchmark::State &state) const {
+      state.counters["allocated_bytes"] = benchmark::Counter(
+          static_cast<double>(allocated_bytes.load() - bytes_),
+          benchmark::Counter::kAvgIterations);
+      state.counters["allocations"] = benchmark::Counter(
+          static_cast<double>(allocations.load() - count_),
+          benchmark::Counter::kAvgIterations);
+    }
+
+   private:
+    size_t bytes_;
+    size_t count_;
+  };
+
+  /**
+   * Construct a block from its transport.
+   * Arguments are the number of transactions, and whether hex of the block
+   * blobs is requested, as it was done by each blob constructor before.
+   */
+  void BM_BlockConstruction(benchmark::State &state) {
+    const auto transport = TestBlockBuilder()
+                               .createdTime(iroha::time::now())
+                               .height(1)
+                               .transactions(makeTransactions(state.range(0)))
+                               .build()
+                               .getTransport();
+    const bool hex = state.range(1) != 0;
+
+    AllocationCounter counter;
+    for (auto _ : state) {
+      shared_model::proto::Block block(transport);
+      if (hex) {
+        benchmark::DoNotOptimize(block.blob().hex());
+        benchmark::DoNotOptimize(block.payload().hex());
+      }
+      benchmark::DoNotOptimize(block.hash());
+    }
+    counter.report(state);
+  }
+
+  /**
+   * Construct a proposal from its transport.
+   * Arguments are the same as of the block construction.
+   */
+  void BM_ProposalConstruction(benchmark::State &state) {
+    const auto transport = TestProposalBuilder()
+                               .createdTime(iroha::time::now())
+                               .height(1)
+                               .transactions(makeTransactions(state.range(0)))
+                               .build()
+                               .getTransport();
+    const bool hex = state.range(1) != 0;
+
+    AllocationCounter counter;
+    for (auto _ : state) {
+      shared_model::proto::Proposal proposal(transport);
+      if (hex) {
+        benchmark::DoNotOptimize(proposal.blob().hex());
+      }
+      benchmark::DoNotOptimize(proposal.hash());
+    }
+    counter.report(state);
+  }
+
+  std::vector<shared_model::crypto::Hash> makeHashes(size_t count) {
+    std::vector<shared_model::crypto::Hash> hashes;
+    for (size_t i = 0; i < count; ++i) {
+      hashes.push_back(shared_model::crypto::DefaultHashProvider::makeHash(
+          shared_model::crypto::Blob(std::to_string(i))));
+    }
+    return hashes;
+  }
+
+  /**
+   * Look up each of the hashes in a map keyed by Hash.
+   * Argument is the number of hashes.
+   */
+  void BM_HashLookup(benchmark::State &state) {
+    const auto hashes = makeHashes(state.range(0));
+    std::unordered_map<shared_model::crypto::Hash,
+                       size_t,
+                       shared_model::crypto::Hash::Hasher>
+        map;
+    for (size_t i = 0; i < hashes.size(); ++i) {
+      map.emplace(hashes[i], i);
+    }
+
+    for (auto _ : state) {
+      for (const auto &hash : hashes) {
+        benchmark::DoNotOptimize(map.find(hash));
+      }
+    }
+    state.SetItemsProcessed(state.iterations() * hashes.size());
+  }
+
+  /**
+   * Look up each of the hashes in a map keyed by HashBytes.
+   * Argument is the number of hashes.
+   */
+  void BM_HashBytesLookup(benchmark::State &state) {
+    std::vector<shared_model::crypto::HashBytes> hashes;
+    for (const auto &hash : makeHashes(state.range(0))) {
+      hashes.push_back(*shared_model::crypto::HashBytes::fromBlob(hash));
+    }
+    std::unordered_map<shared_model::crypto::HashBytes,
+                       size_t,
+                       shared_model::crypto::HashBytes::Hasher>
+        map;
+    for (size_t i = 0; i < hashes.size(); ++i) {
+      map.emplace(hashes[i], i);
+    }
+
+    for (auto _ : state) {
+      for (const auto &hash : hashes) {
+        benchmark::DoNotOptimize(map.find(hash));
+      }
+    }
+    state.SetItemsProcessed(state.iterations() * hashes.size());
+  }
+
+  void constructionArgs(benchmark::internal::Benchmark *b) {
+    for (auto txs : {10, 100, 1000}) {
+      for (auto hex : {0, 1}) {
+        b->Args({txs, hex});
+      }
+    }
+  }
+}  // namespace
+
+BENCHMARK(BM_BlockConstruction)->Apply(constructionArgs);
+BENCHMARK(BM_ProposalConstruction)->Apply(constructionArgs);
+BENCHMARK(BM_HashLookup)->Range(1 << 6, 1 << 16);
+BENCHMARK(BM_HashBytesLookup)->Range(1 << 6, 1 << 16);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,93 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Stateless validation checks the format of every account id, asset id and
+ * peer address of each transaction and query. The purpose of this benchmark
+ * is to compare the field matchers with the regular expressions, which
+ * FieldValidator used before them.
+ *
+ * Argument is the index of the format.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <regex>
+#include <string>
+#include <vector>
+
+#include "validators/field_matchers.hpp"
+
+namespace {
+  namespace matchers = shared_model::validation::matchers;
+
+  struct Format {
+    const char *name;
+    bool (*matcher)(const std::string &);
+    const std::string &pattern;
+    std::vector<std::string> values;
+  };
+
+  const std::vector<Format> &formats() {
+    static const std::vector<Format> formats{
+        {"AccountId",
+         matchers::isAccountId,
+         matchers::patterns::accountId(),
+         {"admin@test",
+          "alice_2019@soramitsu.co.jp",
+          "bob@bank-of-iroha.example.com",
+          "Invalid@test"}},
+        {"AssetId",
+         matchers::isAssetId,
+         matchers::patterns::assetId(),
+         {"coin#test", "usd#bank-of-iroha.example.com", "xor#sora"}},
+        {"PeerAddress",
+         matchers::isPeerAddress,
+         matchers::patterns::peerAddress(),
+         {"127.0.0.1:10001", "iroha-node-3.example.com:50541", "1.2.3.4:0"}},
+        {"AccountDetailKey",
+         matchers::isAccountDetailKey,
+         matchers::patterns::accountDetailKey(),
+         {"age", "Registration_Date_2019", "key with spaces"}},
+    };
+    return formats;
+  }
+
+  void formatArgs(benchmark::internal::Benchmark *b) {
+    for (size_t i = 0; i < formats().size(); ++i) {
+      b->Arg(static_cast<int64_t>(i));
+    }
+  }
+
+  void BM_Regex(benchmark::State &state) {
+    const auto &format = formats().at(state.range(0));
+    const std::regex regex(format.pattern);
+    state.SetLabel(format.name);
+
+    for (auto _ : state) {
+      for (const auto &value : format.values) {
+        benchmark::DoNotOptimize(std::regex_match(value, regex));
+      }
+    }
+    state.SetItemsProcessed(state.iterations() * format.values.size());
+  }
+
+  void BM_Matcher(benchmark::State &state) {
+    const auto &format = formats().at(state.range(0));
+    state.SetLabel(format.name);
+
+    for (auto _ : state) {
+      for (const auto &value : format.values) {
+        benchmark::DoNotOptimize(format.matcher(value));
+      }
+    }
+    state.SetItemsProcessed(state.iterations() * format.values.size());
+  }
+}  // namespace
+
+BENCHMARK(BM_Regex)->Apply(formatArgs);
+BENCHMARK(BM_Matcher)->Apply(formatArgs);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,152 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Hex conversions are done for keys, signatures and hashes of every
+ * transaction. The purpose of this benchmark is to compare the kernels of
+ * each instruction set, which hexutils.hpp can dispatch to, and the
+ * stringstream and boost implementations used before them.
+ *
+ * Arguments are the input size in bytes, and the instruction set.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/algorithm/hex.hpp>
+#include "common/hexutils.hpp"
+
+namespace {
+  using iroha::hex_kernels::Isa;
+
+  std::vector<uint8_t> makeBytes(size_t size) {
+    std::mt19937 random(size);
+    std::vector<uint8_t> bytes(size);
+    for (auto &byte : bytes) {
+      byte = static_cast<uint8_t>(random());
+    }
+    return bytes;
+  }
+
+  std::string makeHex(size_t size) {
+    auto bytes = makeBytes(size);
+    std::string hex(size * 2, '\0');
+    iroha::bytesToHex(bytes.data(), bytes.size(), &hex[0]);
+    return hex;
+  }
+
+  /// @return kernels of the benchmark argument, or nullptr if skipped
+  const iroha::hex_kernels::Kernels *kernels(benchmark::State &state) {
+    auto kernels =
+        iroha::hex_kernels::kernels(static_cast<Isa>(state.range(1)));
+    if (not kernels) {
+      state.SkipWithError("instruction set is not supported");
+      return nullptr;
+    }
+    state.SetLabel(kernels->name);
+    return kernels;
+  }
+
+  void BM_Encode(benchmark::State &state) {
+    auto kernels = ::kernels(state);
+    const auto bytes = makeBytes(state.range(0));
+    std::string hex(bytes.size() * 2, '\0');
+
+    for (auto _ : state) {
+      if (not kernels) {
+        break;
+      }
+      kernels->encode(bytes.data(), bytes.size(), &hex[0]);
+      benchmark::DoNotOptimize(hex.data());
+      benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * bytes.size());
+  }
+
+  void BM_Decode(benchmark::State &state) {
+    auto kernels = ::kernels(state);
+    const auto hex = makeHex(state.range(0));
+    std::vector<uint8_t> bytes(hex.size() / 2);
+
+    for (auto _ : state) {
+      if (not kernels) {
+        break;
+      }
+      benchmark::DoNotOptimize(
+          kernels->decode(hex.data(), hex.size(), bytes.data()));
+      benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * hex.size());
+  }
+
+  void BM_Validate(benchmark::State &state) {
+    auto kernels = ::kernels(state);
+    const auto hex = makeHex(state.range(0));
+
+    for (auto _ : state) {
+      if (not kernels) {
+        break;
+      }
+      benchmark::DoNotOptimize(kernels->validate(hex.data(), hex.size()));
+    }
+    state.SetBytesProcessed(state.iterations() * hex.size());
+  }
+
+  /// Encoding as it was done by bytestringToHexstring before the kernels
+  void BM_EncodeStringstream(benchmark::State &state) {
+    const auto bytes = makeBytes(state.range(0));
+    const std::string str(bytes.begin(), bytes.end());
+
+    for (auto _ : state) {
+      std::stringstream ss;
+      ss << std::hex << std::setfill('0');
+      for (const auto &c : str) {
+        ss << std::setw(2) << (static_cast<int>(c) & 0xff);
+      }
+      benchmark::DoNotOptimize(ss.str());
+    }
+    state.SetBytesProcessed(state.iterations() * bytes.size());
+  }
+
+  /// Decoding as it was done by hexstringToBytestringResult before
+  void BM_DecodeBoost(benchmark::State &state) {
+    const auto hex = makeHex(state.range(0));
+
+    for (auto _ : state) {
+      std::string result;
+      result.reserve(hex.size() / 2);
+      boost::algorithm::unhex(
+          hex.begin(), hex.end(), std::back_inserter(result));
+      benchmark::DoNotOptimize(result);
+    }
+    state.SetBytesProcessed(state.iterations() * hex.size());
+  }
+
+  constexpr int64_t kMinSize = 32;
+  constexpr int64_t kMaxSize = 1 << 20;
+
+  void kernelArgs(benchmark::internal::Benchmark *b) {
+    for (auto size = kMinSize; size <= kMaxSize; size *= 8) {
+      for (auto isa : {Isa::kScalar, Isa::kSse2, Isa::kAvx2}) {
+        b->Args({size, static_cast<int64_t>(isa)});
+      }
+    }
+  }
+}  // namespace
+
+BENCHMARK(BM_Encode)->Apply(kernelArgs);
+BENCHMARK(BM_Decode)->Apply(kernelArgs);
+BENCHMARK(BM_Validate)->Apply(kernelArgs);
+BENCHMARK(BM_EncodeStringstream)
+    ->RangeMultiplier(8)
+    ->Range(kMinSize, kMaxSize);
+BENCHMARK(BM_DecodeBoost)->RangeMultiplier(8)->Range(kMinSize, kMaxSize);
+
+BENCHMARK_MAIN();
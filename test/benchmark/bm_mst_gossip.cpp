@@ -0,0 +1,244 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <unordered_map>
+
+#include <google/protobuf/io/coded_stream.h>
+#include "backend/protobuf/transaction.hpp"
+#include "cryptography/blob_hasher.hpp"
+#include "cryptography/crypto_provider/crypto_defaults.hpp"
+#include "cryptography/crypto_provider/crypto_signer.hpp"
+#include "framework/test_logger.hpp"
+#include "interfaces/iroha_internal/transaction_batch_impl.hpp"
+#include "logger/logger_manager.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+#include "multi_sig_transactions/storage/mst_storage_impl.hpp"
+#include "multi_sig_transactions/transport/mst_transport_grpc.hpp"
+
+using namespace iroha;
+
+namespace {
+  const TimeType kCreatedTime = 1000000;
+  /// Signatures which arrive to peers between gossip rounds
+  const size_t kSignaturesPerRound = 4;
+  /// Gossip rounds after the last signature, enough for all peers to settle
+  const size_t kMaxFinalRounds = 16;
+
+  /// Single transaction batches, which peers get signed by one key at once
+  struct Workload {
+    std::vector<iroha::protocol::Transaction> transactions;
+    std::vector<std::vector<DetachedSignature>> signatures;
+    std::unordered_map<shared_model::interface::types::HashType,
+                       size_t,
+                       shared_model::crypto::BlobHasher>
+        index;
+    /// size of each transaction with the number of its signatures
+    std::vector<std::vector<size_t>> sizes;
+  };
+
+  Workload makeWorkload(size_t batches, size_t quorum) {
+    Workload workload;
+    for (size_t i = 0; i < batches; ++i) {
+      auto tx = TestTransactionBuilder()
+                    .createdTime(kCreatedTime)
+                    .creatorAccountId("user@test")
+                    .setAccountQuorum("user@test", i + 1)
+                    .quorum(quorum)
+                    .build();
+      workload.index.emplace(tx.reducedHash(), i);
+      workload.signatures.emplace_back();
+      workload.sizes.emplace_back();
+      auto transport = tx.getTransport();
+      workload.sizes.back().push_back(transport.ByteSizeLong());
+      for (size_t j = 0; j < quorum; ++j) {
+        auto keypair =
+            shared_model::crypto::DefaultCryptoAlgorithmType::generateKeypair();
+        workload.signatures.back().push_back(DetachedSignature{
+            keypair.publicKey(),
+            shared_model::crypto::CryptoSigner<>::sign(
+                shared_model::crypto::Blob(tx.payload()), keypair)});
+        auto signature = transport.add_signatures();
+        signature->set_public_key(keypair.publicKey().hex());
+        signature->set_signature(
+            workload.signatures.back().back().signed_data.hex());
+        workload.sizes.back().push_back(transport.ByteSizeLong());
+      }
+      workload.transactions.push_back(tx.getTransport());
+    }
+    return workload;
+  }
+
+  BatchPtr makeBatch(const iroha::protocol::Transaction &transport,
+                     const std::vector<DetachedSignature> &signatures) {
+    auto tx = std::make_shared<shared_model::proto::Transaction>(transport);
+    for (const auto &signature : signatures) {
+      tx->addSignature(signature.signed_data, signature.public_key);
+    }
+    return std::make_shared<shared_model::interface::TransactionBatchImpl>(
+        shared_model::interface::types::SharedTxsCollectionType{tx});
+  }
+
+  /// Peers do not share batch objects, as if the gossip was deserialized
+  MstGossip copyGossip(const MstGossip &gossip,
+                       logger::LoggerPtr log,
+                       const CompleterType &completer) {
+    MstGossip copy{MstState::empty(std::move(log), completer)};
+    gossip.batches.iterateBatches([&copy](const auto &batch) {
+      shared_model::interface::types::SharedTxsCollectionType transactions;
+      for (const auto &tx : batch->transactions()) {
+        const auto &proto_tx =
+            static_cast<const shared_model::proto::Transaction &>(*tx);
+        transactions.push_back(
+            std::make_shared<shared_model::proto::Transaction>(
+                proto_tx.getTransport()));
+      }
+      copy.batches +=
+          std::make_shared<shared_model::interface::TransactionBatchImpl>(
+              std::move(transactions));
+    });
+    copy.signatures = gossip.signatures;
+    copy.summaries = gossip.summaries;
+    // as the transport of the peers tells
+    copy.compact_sender = true;
+    return copy;
+  }
+
+  /**
+   * Collect signatures of multisignature transactions by gossip between
+   * peers. Each signature arrives to a random peer, and all peers exchange
+   * their states after every few signatures.
+   * Arguments are the number of peers, batches and the quorum of their
+   * transactions.
+   * Counters are the bytes sent per batch, and the bytes which gossip of
+   * whole batches would send instead of the same messages.
+   */
+  void BM_MstGossip(benchmark::State &state) {
+    const size_t peers = state.range(0);
+    const size_t batches = state.range(1);
+    const size_t quorum = state.range(2);
+
+    auto log_manager = getTestLoggerManager(logger::LogLevel::kCritical)
+                           ->getChild("MstGossip");
+    auto state_log = log_manager->getChild("State")->getLogger();
+    auto storage_log = log_manager->getChild("Storage")->getLogger();
+    auto completer =
+        std::make_shared<DefaultCompleter>(std::chrono::minutes(1));
+
+    auto workload = makeWorkload(batches, quorum);
+    std::vector<shared_model::crypto::PublicKey> keys;
+    for (size_t i = 0; i < peers; ++i) {
+      keys.push_back(shared_model::crypto::DefaultCryptoAlgorithmType::
+                         generateKeypair()
+                             .publicKey());
+    }
+    std::vector<std::pair<size_t, size_t>> events;
+    for (size_t i = 0; i < batches; ++i) {
+      for (size_t j = 0; j < quorum; ++j) {
+        events.emplace_back(i, j);
+      }
+    }
+
+    size_t sent_bytes = 0;
+    size_t whole_batch_bytes = 0;
+    size_t messages = 0;
+    for (auto _ : state) {
+      std::mt19937 random(1);
+      std::shuffle(events.begin(), events.end(), random);
+      std::vector<std::unique_ptr<MstStorage>> storages;
+      for (size_t i = 0; i < peers; ++i) {
+        storages.push_back(std::make_unique<MstStorageStateImpl>(
+            completer, state_log, storage_log));
+      }
+      // signatures of each batch, which each peer has
+      std::vector<std::vector<std::set<size_t>>> signers(
+          peers, std::vector<std::set<size_t>>(batches));
+
+      auto gossip_round = [&] {
+        size_t round_messages = 0;
+        for (size_t from = 0; from < peers; ++from) {
+          for (size_t to = 0; to < peers; ++to) {
+            if (from == to) {
+              continue;
+            }
+            auto gossip = storages[from]->getDiffState(keys[to], kCreatedTime);
+            if (gossip.isEmpty()) {
+              continue;
+            }
+            ++round_messages;
+            const auto sender_key =
+                shared_model::crypto::toBinaryString(keys[from]);
+            sent_bytes +=
+                network::makeMstStateMessage(gossip, sender_key).ByteSizeLong();
+
+            std::vector<size_t> sent_batches;
+            gossip.batches.iterateBatches([&](const auto &batch) {
+              sent_batches.push_back(workload.index.at(batch->reducedHash()));
+            });
+            for (const auto &batch : gossip.signatures) {
+              sent_batches.push_back(workload.index.at(batch.reduced_hash));
+            }
+            whole_batch_bytes += sender_key.size() + 2;
+            for (auto i : sent_batches) {
+              const auto size = workload.sizes[i][signers[from][i].size()];
+              whole_batch_bytes += size + 1
+                  + google::protobuf::io::CodedOutputStream::VarintSize64(size);
+              signers[to][i].insert(signers[from][i].begin(),
+                                    signers[from][i].end());
+            }
+
+            storages[to]->apply(keys[from],
+                                copyGossip(gossip, state_log, completer));
+            storages[from]->gossipSent(keys[to], gossip, true);
+          }
+        }
+        messages += round_messages;
+        return round_messages;
+      };
+
+      for (size_t i = 0; i < events.size(); ++i) {
+        const auto batch = events[i].first;
+        const auto signer = events[i].second;
+        const auto peer = random() % peers;
+        signers[peer][batch].insert(signer);
+        storages[peer]->updateOwnState(
+            makeBatch(workload.transactions[batch],
+                      {workload.signatures[batch][signer]}));
+        if ((i + 1) % kSignaturesPerRound == 0) {
+          gossip_round();
+        }
+      }
+      for (size_t i = 0; i < kMaxFinalRounds and gossip_round() > 0; ++i) {
+      }
+    }
+
+    state.counters["bytes_per_batch"] = benchmark::Counter(
+        static_cast<double>(sent_bytes) / batches,
+        benchmark::Counter::kAvgIterations);
+    state.counters["whole_batch_bytes_per_batch"] = benchmark::Counter(
+        static_cast<double>(whole_batch_bytes) / batches,
+        benchmark::Counter::kAvgIterations);
+    state.counters["messages"] = benchmark::Counter(
+        static_cast<double>(messages), benchmark::Counter::kAvgIterations);
+  }
+
+  void multisigWorkloads(benchmark::internal::Benchmark *b) {
+    for (auto peers : {4, 7}) {
+      for (auto quorum : {2, 5, 10}) {
+        b->Args({peers, 20, quorum});
+      }
+    }
+  }
+}  // namespace
+
+BENCHMARK(BM_MstGossip)
+    ->Apply(multisigWorkloads)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,101 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "backend/protobuf/transaction.hpp"
+#include "interfaces/iroha_internal/transaction_batch_impl.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+#include "ordering/impl/ordering_gate_cache/on_demand_cache.hpp"
+
+using namespace iroha::ordering::cache;
+
+namespace {
+  /// transactions committed in a block
+  constexpr size_t kCommitted = 100;
+
+  /// Batches of a single transaction each
+  OrderingGateCache::BatchesCollectionType makeBatches(size_t count) {
+    OrderingGateCache::BatchesCollectionType batches;
+    batches.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+      auto tx = std::make_shared<shared_model::proto::Transaction>(
+          TestTransactionBuilder()
+              .creatorAccountId("user" + std::to_string(i % 100) + "@test")
+              .createdTime(i)
+              .setAccountDetail("admin@test", "key", std::to_string(i))
+              .build());
+      batches.push_back(
+          std::make_shared<shared_model::interface::TransactionBatchImpl>(
+              shared_model::interface::types::SharedTxsCollectionType{tx}));
+    }
+    return batches;
+  }
+
+  /// Spread the batches evenly over the slots of the cache
+  void fill(OnDemandCache &cache,
+            const OrderingGateCache::BatchesCollectionType &batches) {
+    constexpr size_t kSlots = 3;
+    for (size_t slot = 0; slot < kSlots; ++slot) {
+      OrderingGateCache::BatchesSetType slot_batches;
+      for (size_t i = slot; i < batches.size(); i += kSlots) {
+        slot_batches.insert(batches[i]);
+      }
+      cache.addToBack(slot_batches);
+      cache.rotate(0);
+    }
+  }
+}  // namespace
+
+/**
+ * Removes the transactions of a committed block from the cache, as the
+ * ordering gate does on every commit, and adds them back. The argument is
+ * the number of cached batches.
+ */
+static void BM_CacheRemoveCommitted(benchmark::State &state) {
+  const auto batches = makeBatches(state.range(0));
+  OnDemandCache cache;
+  fill(cache, batches);
+
+  size_t next = 0;
+  while (state.KeepRunning()) {
+    OrderingGateCache::HashesSetType hashes;
+    OrderingGateCache::BatchesSetType removed;
+    for (size_t i = 0; i < kCommitted; ++i) {
+      hashes.insert(batches[next]->transactions().front()->hash());
+      removed.insert(batches[next]);
+      next = (next + 1) % batches.size();
+    }
+    cache.remove(hashes);
+    cache.addToBack(removed);
+  }
+  state.SetItemsProcessed(state.iterations() * kCommitted);
+}
+BENCHMARK(BM_CacheRemoveCommitted)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Arg(50000)
+    ->Unit(benchmark::kMicrosecond);
+
+/**
+ * Takes the batches for the next proposal from the cache, as the ordering
+ * gate does on every round. The argument is the number of cached batches.
+ */
+static void BM_CacheRotate(benchmark::State &state) {
+  const auto batches = makeBatches(state.range(0));
+  OnDemandCache cache;
+  fill(cache, batches);
+
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(cache.rotate(kCommitted));
+  }
+}
+BENCHMARK(BM_CacheRotate)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Arg(50000)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
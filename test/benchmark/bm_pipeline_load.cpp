@@ -0,0 +1,618 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Offline load driver for the whole pipeline. It starts irohad in-process
+ * with the integration framework, optionally in a network with fake peers,
+ * against the local Postgres given by IROHA_POSTGRES_* environment
+ * variables. Then it sends a synthetic workload at the target rate, and
+ * prints a JSON report with the throughput, commit latency and resource
+ * usage, so that the results of different builds can be compared.
+ * Latencies are measured from the scheduled send time, so that a stalled
+ * send is counted too. The resource usage is of the whole process, which
+ * includes building and signing of the workload by the driver.
+ *
+ * Example:
+ *   bm_pipeline_load --workload=mixed --rate=200 --duration=60 \
+ *       --output=report.json
+ */
+
+#include <sys/resource.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+#include <fmt/format.h>
+#include <gflags/gflags.h>
+#include "ametsuchi/storage.hpp"
+#include "common/visitor.hpp"
+#include "cryptography/crypto_provider/crypto_defaults.hpp"
+#include "datetime/time.hpp"
+#include "framework/common_constants.hpp"
+#include "framework/integration_framework/integration_test_framework.hpp"
+#include "framework/integration_framework/iroha_instance.hpp"
+#include "framework/integration_framework/test_irohad.hpp"
+#include "interfaces/iroha_internal/transaction_sequence_factory.hpp"
+#include "interfaces/query_responses/error_query_response.hpp"
+#include "logger/logger_manager.hpp"
+#include "metrics/metrics.hpp"
+#include "module/irohad/common/validators_config.hpp"
+#include "module/shared_model/builders/protobuf/test_query_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+DEFINE_string(workload,
+              "mixed",
+              "One of transfer, create_account, multisig, detail, query, "
+              "or mixed for all of them in turn");
+DEFINE_uint32(rate, 100, "Target rate of transactions and queries per second");
+DEFINE_uint32(duration, 30, "Seconds to send the workload for");
+DEFINE_uint32(drain_timeout,
+              30,
+              "Seconds to wait for the sent transactions to be committed");
+DEFINE_uint32(accounts, 100, "Number of accounts sending the workload");
+DEFINE_uint32(batch_size, 2, "Transactions in a multisig batch");
+DEFINE_uint32(proposal_size, 100, "Maximum transactions in a proposal");
+DEFINE_uint32(fake_peers, 0, "Number of honest fake peers in the network");
+DEFINE_string(output, "", "File to write the report to, stdout if empty");
+
+using namespace common_constants;
+using shared_model::crypto::Keypair;
+
+namespace {
+  using Clock = std::chrono::steady_clock;
+
+  const std::string kLoadRole = "load";
+  const std::string kAccountFunds = "1000000.0";
+  const std::string kTransferAmount = "0.1";
+
+  enum class Operation {
+    kTransfer,
+    kCreateAccount,
+    kMultisig,
+    kDetail,
+    kQuery,
+  };
+
+  const std::map<std::string, std::vector<Operation>> kWorkloads{
+      {"transfer", {Operation::kTransfer}},
+      {"create_account", {Operation::kCreateAccount}},
+      {"multisig", {Operation::kMultisig}},
+      {"detail", {Operation::kDetail}},
+      {"query", {Operation::kQuery}},
+      {"mixed",
+       {Operation::kTransfer,
+        Operation::kCreateAccount,
+        Operation::kMultisig,
+        Operation::kDetail,
+        Operation::kQuery}}};
+
+  bool validateWorkload(const char *, const std::string &workload) {
+    if (kWorkloads.count(workload) == 0) {
+      std::cerr << "Unknown workload " << workload << std::endl;
+      return false;
+    }
+    return true;
+  }
+
+  struct Account {
+    std::string id;
+    Keypair keypair;
+    /// second signatory of multisig accounts
+    boost::optional<Keypair> cosigner;
+  };
+
+  auto baseTx(const std::string &creator) {
+    return TestUnsignedTransactionBuilder()
+        .creatorAccountId(creator)
+        .createdTime(iroha::time::now());
+  }
+
+  /// Records the time of each sent transaction until it is committed
+  class CommitTracker {
+   public:
+    explicit CommitTracker(const std::vector<uint64_t> &bounds)
+        : latency_(bounds) {}
+
+    /// @param scheduled - the time the transaction was due to be sent
+    void sent(const shared_model::crypto::Hash &hash,
+              Clock::time_point scheduled) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      in_flight_.emplace(hash, scheduled);
+    }
+
+    void onBlock(const shared_model::interface::Block &block) {
+      const auto now = Clock::now();
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (const auto &tx : block.transactions()) {
+        auto it = in_flight_.find(tx.hash());
+        if (it != in_flight_.end()) {
+          latency_.record(now - it->second);
+          in_flight_.erase(it);
+          ++committed_;
+          last_commit_ = now;
+        }
+      }
+      for (const auto &hash : block.rejected_transactions_hashes()) {
+        rejected_ += in_flight_.erase(hash);
+      }
+      settled_.notify_all();
+    }
+
+    /// @return true if all sent transactions are settled before the timeout
+    bool waitSettled(Clock::duration timeout) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      return settled_.wait_for(
+          lock, timeout, [this] { return in_flight_.empty(); });
+    }
+
+    void reset() {
+      std::lock_guard<std::mutex> lock(mutex_);
+      in_flight_.clear();
+      committed_ = rejected_ = 0;
+      latency_ = iroha::metrics::Histogram(iroha::metrics::latencyBounds());
+    }
+
+    size_t committed() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return committed_;
+    }
+
+    size_t rejected() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return rejected_;
+    }
+
+    size_t inFlight() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return in_flight_.size();
+    }
+
+    Clock::time_point lastCommit() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return last_commit_;
+    }
+
+    iroha::metrics::Histogram::Snapshot latency() const {
+      return latency_.snapshot();
+    }
+
+   private:
+    mutable std::mutex mutex_;
+    std::condition_variable settled_;
+    std::unordered_map<shared_model::crypto::Hash,
+                       Clock::time_point,
+                       shared_model::crypto::Hash::Hasher>
+        in_flight_;
+    iroha::metrics::Histogram latency_;
+    size_t committed_ = 0;
+    size_t rejected_ = 0;
+    Clock::time_point last_commit_;
+  };
+
+  struct Usage {
+    double user_cpu_seconds;
+    double system_cpu_seconds;
+    long max_rss_kb;
+  };
+
+  /// @return usage of the whole process, the driver and irohad
+  Usage processUsage() {
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    auto seconds = [](const timeval &time) {
+      return time.tv_sec + time.tv_usec / 1e6;
+    };
+    return {seconds(usage.ru_utime), seconds(usage.ru_stime), usage.ru_maxrss};
+  }
+
+  std::string latencyJson(const iroha::metrics::Histogram::Snapshot &latency) {
+    auto ms = [](uint64_t us) { return us / 1000.; };
+    return fmt::format(
+        R"({{"count":{},"mean_ms":{:.3f},"p50_ms":{:.3f},"p99_ms":{:.3f},)"
+        R"("max_ms":{:.3f}}})",
+        latency.count,
+        latency.count == 0 ? 0. : ms(latency.sum) / latency.count,
+        ms(latency.quantile(0.5)),
+        ms(latency.quantile(0.99)),
+        ms(latency.quantile(1.)));
+  }
+
+  class LoadDriver {
+   public:
+    LoadDriver()
+        : itf_(FLAGS_proposal_size,
+               boost::none,
+               true,
+               false,
+               boost::none,
+               std::chrono::hours(1),
+               std::chrono::hours(1),
+               std::chrono::minutes(1),
+               std::make_shared<logger::LoggerManagerTree>(logger::LoggerConfig{
+                   logger::LogLevel::kError,
+                   logger::getDefaultLogPatterns()})),
+          tracker_(std::make_shared<CommitTracker>(
+              iroha::metrics::latencyBounds())),
+          query_latency_(iroha::metrics::latencyBounds()) {}
+
+    /// Start the network and create the accounts
+    void prepare() {
+      itf_.initPipeline(kAdminKeypair);
+      itf_.addFakePeers(FLAGS_fake_peers);
+      // the checker queues would keep every block and status of the run
+      itf_.setGenesisBlock(itf_.defaultBlock()).run();
+      itf_.getIrohaInstance()
+          .getIrohaInstance()
+          ->getStorage()
+          ->on_commit()
+          .subscribe([tracker = tracker_](const auto &block) {
+            tracker->onBlock(*block);
+          });
+
+      auto setup = baseTx(kAdminId).createRole(
+          kLoadRole,
+          {shared_model::interface::permissions::Role::kReceive,
+           shared_model::interface::permissions::Role::kTransfer,
+           shared_model::interface::permissions::Role::kAddSignatory,
+           shared_model::interface::permissions::Role::kSetQuorum,
+           shared_model::interface::permissions::Role::kGetMyAccount,
+           shared_model::interface::permissions::Role::kGetMyAccAst,
+           shared_model::interface::permissions::Role::kGetMyAccDetail});
+      auto add_account = [&](const std::string &name, bool multisig) {
+        Account account{
+            name + "@" + kDomain,
+            shared_model::crypto::DefaultCryptoAlgorithmType::
+                generateKeypair(),
+            boost::none};
+        if (multisig) {
+          account.cosigner = shared_model::crypto::DefaultCryptoAlgorithmType::
+              generateKeypair();
+        }
+        setup = setup.createAccount(name, kDomain, account.keypair.publicKey())
+                    .appendRole(account.id, kLoadRole)
+                    .addAssetQuantity(kAssetId, kAccountFunds)
+                    .transferAsset(
+                        kAdminId, account.id, kAssetId, "", kAccountFunds);
+        return account;
+      };
+      for (size_t i = 0; i < FLAGS_accounts; ++i) {
+        accounts_.push_back(add_account("load" + std::to_string(i), false));
+        multisig_accounts_.push_back(
+            add_account("multisig" + std::to_string(i), true));
+      }
+      send(setup.quorum(1).build().signAndAddSignature(kAdminKeypair).finish(),
+           Clock::now());
+      waitSettled("the setup transaction");
+
+      for (const auto &account : multisig_accounts_) {
+        send(baseTx(account.id)
+                 .addSignatory(account.id, account.cosigner->publicKey())
+                 .setAccountQuorum(account.id, 2)
+                 .quorum(1)
+                 .build()
+                 .signAndAddSignature(account.keypair)
+                 .finish(),
+             Clock::now());
+      }
+      waitSettled("the multisig setup transactions");
+      if (tracker_->rejected() > 0) {
+        throw std::runtime_error("setup transactions are rejected");
+      }
+      tracker_->reset();
+      sent_transactions_ = 0;
+    }
+
+    /// Send the workload at the target rate and report the results
+    std::string run() {
+      const auto &operations = kWorkloads.at(FLAGS_workload);
+      const auto interval = std::chrono::duration_cast<Clock::duration>(
+          std::chrono::duration<double>(1. / std::max(FLAGS_rate, 1u)));
+      const auto usage_before = processUsage();
+      const auto start = Clock::now();
+      const auto end = start + std::chrono::seconds(FLAGS_duration);
+
+      // queries wait for the response, so they do not delay the transactions
+      std::thread query_sender([this] { sendQueries(); });
+      size_t sequence = 0;
+      for (auto next = start; next < end; next += interval, ++sequence) {
+        std::this_thread::sleep_until(next);
+        sendOperation(operations[sequence % operations.size()], sequence, next);
+      }
+      {
+        std::lock_guard<std::mutex> lock(queries_mutex_);
+        queries_finished_ = true;
+      }
+      queries_cv_.notify_one();
+      query_sender.join();
+      const auto sending_end = Clock::now();
+      tracker_->waitSettled(std::chrono::seconds(FLAGS_drain_timeout));
+      const auto usage_after = processUsage();
+
+      const auto committed = tracker_->committed();
+      const auto commit_end = committed > 0 ? tracker_->lastCommit() : start;
+      auto seconds = [](Clock::duration duration) {
+        return std::chrono::duration<double>(duration).count();
+      };
+      return fmt::format(
+          R"({{"config":{{"workload":"{}","rate":{},"duration_s":{},)"
+          R"("accounts":{},"batch_size":{},"proposal_size":{},)"
+          R"("fake_peers":{}}},)"
+          "\n"
+          R"("transactions":{{"sent":{},"committed":{},"rejected":{},)"
+          R"("lost":{}}},"queries":{{"sent":{},"failed":{}}},)"
+          "\n"
+          R"("sent_per_second":{:.2f},"tps":{:.2f},)"
+          "\n"
+          R"("commit_latency":{},)"
+          "\n"
+          R"("query_latency":{},)"
+          "\n"
+          R"("process_resources":{{"user_cpu_s":{:.3f},"system_cpu_s":{:.3f},)"
+          R"("max_rss_kb":{}}}}})"
+          "\n",
+          FLAGS_workload,
+          FLAGS_rate,
+          FLAGS_duration,
+          FLAGS_accounts,
+          FLAGS_batch_size,
+          FLAGS_proposal_size,
+          FLAGS_fake_peers,
+          sent_transactions_,
+          committed,
+          tracker_->rejected(),
+          tracker_->inFlight(),
+          sent_queries_,
+          failed_queries_,
+          (sent_transactions_ + sent_queries_) / seconds(sending_end - start),
+          committed == 0 ? 0. : committed / seconds(commit_end - start),
+          latencyJson(tracker_->latency()),
+          latencyJson(query_latency_.snapshot()),
+          usage_after.user_cpu_seconds - usage_before.user_cpu_seconds,
+          usage_after.system_cpu_seconds - usage_before.system_cpu_seconds,
+          usage_after.max_rss_kb);
+    }
+
+    void done() {
+      itf_.done();
+    }
+
+   private:
+    void send(const shared_model::proto::Transaction &tx,
+              Clock::time_point scheduled) {
+      tracker_->sent(tx.hash(), scheduled);
+      itf_.sendTxWithoutValidation(tx);
+      ++sent_transactions_;
+    }
+
+    void waitSettled(const std::string &what) {
+      if (not tracker_->waitSettled(
+              std::chrono::seconds(FLAGS_drain_timeout))) {
+        throw std::runtime_error(what + " is not committed in time");
+      }
+    }
+
+    void sendOperation(Operation operation,
+                       size_t sequence,
+                       Clock::time_point scheduled) {
+      const auto &account = accounts_[sequence % accounts_.size()];
+      const auto &receiver = accounts_[(sequence + 1) % accounts_.size()];
+      switch (operation) {
+        case Operation::kTransfer:
+          send(baseTx(account.id)
+                   .transferAsset(account.id,
+                                  receiver.id,
+                                  kAssetId,
+                                  std::to_string(sequence),
+                                  kTransferAmount)
+                   .quorum(1)
+                   .build()
+                   .signAndAddSignature(account.keypair)
+                   .finish(),
+               scheduled);
+          break;
+        case Operation::kCreateAccount:
+          send(baseTx(kAdminId)
+                   .createAccount("created" + std::to_string(sequence),
+                                  kDomain,
+                                  kUserKeypair.publicKey())
+                   .quorum(1)
+                   .build()
+                   .signAndAddSignature(kAdminKeypair)
+                   .finish(),
+               scheduled);
+          break;
+        case Operation::kMultisig:
+          sendMultisigBatch(sequence, scheduled);
+          break;
+        case Operation::kDetail:
+          send(baseTx(account.id)
+                   .setAccountDetail(account.id,
+                                     "key" + std::to_string(sequence % 16),
+                                     std::to_string(sequence))
+                   .quorum(1)
+                   .build()
+                   .signAndAddSignature(account.keypair)
+                   .finish(),
+               scheduled);
+          break;
+        case Operation::kQuery:
+          queueQuery(account, sequence, scheduled);
+          break;
+      }
+    }
+
+    /// Send an atomic batch of transfers from multisig accounts
+    void sendMultisigBatch(size_t sequence, Clock::time_point scheduled) {
+      std::vector<TestUnsignedTransactionBuilder> builders;
+      std::vector<shared_model::interface::types::HashType> reduced_hashes;
+      for (size_t i = 0; i < FLAGS_batch_size; ++i) {
+        const auto &sender =
+            multisig_accounts_[(sequence + i) % multisig_accounts_.size()];
+        builders.push_back(
+            baseTx(sender.id)
+                .transferAsset(sender.id,
+                               accounts_[i % accounts_.size()].id,
+                               kAssetId,
+                               std::to_string(sequence),
+                               kTransferAmount)
+                .quorum(2));
+        reduced_hashes.push_back(builders.back().build().reducedHash());
+      }
+
+      shared_model::interface::types::SharedTxsCollectionType txs;
+      for (size_t i = 0; i < builders.size(); ++i) {
+        const auto &sender =
+            multisig_accounts_[(sequence + i) % multisig_accounts_.size()];
+        auto tx = std::make_shared<shared_model::proto::Transaction>(
+            builders[i]
+                .batchMeta(shared_model::interface::types::BatchType::ATOMIC,
+                           reduced_hashes)
+                .build()
+                .signAndAddSignature(sender.keypair)
+                .signAndAddSignature(*sender.cosigner)
+                .finish());
+        tracker_->sent(tx->hash(), scheduled);
+        txs.push_back(std::move(tx));
+      }
+
+      auto sequence_result = shared_model::interface::
+          TransactionSequenceFactory::createTransactionSequence(
+              txs,
+              shared_model::validation::DefaultSignedTransactionsValidator(
+                  iroha::test::kTestsValidatorsConfig),
+              shared_model::validation::FieldValidator(
+                  iroha::test::kTestsValidatorsConfig));
+      if (auto error =
+              iroha::expected::resultToOptionalError(sequence_result)) {
+        throw std::runtime_error("invalid batch: " + *error);
+      }
+      itf_.sendTxSequence(std::move(sequence_result).assumeValue());
+      sent_transactions_ += txs.size();
+    }
+
+    struct ScheduledQuery {
+      const Account *account;
+      size_t sequence;
+      Clock::time_point scheduled;
+    };
+
+    /// Pass the query to the query sender thread
+    void queueQuery(const Account &account,
+                    size_t sequence,
+                    Clock::time_point scheduled) {
+      {
+        std::lock_guard<std::mutex> lock(queries_mutex_);
+        queries_.push_back({&account, sequence, scheduled});
+      }
+      queries_cv_.notify_one();
+    }
+
+    /// Send the queued queries until the sending is finished
+    void sendQueries() {
+      std::unique_lock<std::mutex> lock(queries_mutex_);
+      while (true) {
+        queries_cv_.wait(
+            lock, [this] { return queries_finished_ or not queries_.empty(); });
+        if (queries_.empty()) {
+          return;
+        }
+        auto query = queries_.front();
+        queries_.pop_front();
+        lock.unlock();
+        sendQuery(*query.account, query.sequence, query.scheduled);
+        lock.lock();
+      }
+    }
+
+    /// Send one of account queries and wait for the response
+    void sendQuery(const Account &account,
+                   size_t sequence,
+                   Clock::time_point scheduled) {
+      auto builder = TestUnsignedQueryBuilder()
+                         .createdTime(iroha::time::now())
+                         .creatorAccountId(account.id)
+                         .queryCounter(sequence + 1);
+      auto query = [&] {
+        switch (sequence / kWorkloads.at(FLAGS_workload).size() % 3) {
+          case 0:
+            return builder.getAccount(account.id).build();
+          case 1:
+            return builder
+                .getAccountAssets(account.id, kMaxPageSize, boost::none)
+                .build();
+          default:
+            return builder.getAccountDetail(kMaxPageSize, account.id).build();
+        }
+      }();
+
+      itf_.sendQuery(query.signAndAddSignature(account.keypair).finish(),
+                     [this](const auto &response) {
+                       if (iroha::visit_in_place(
+                               response.get(),
+                               [](const shared_model::interface::
+                                      ErrorQueryResponse &) { return true; },
+                               [](const auto &) { return false; })) {
+                         ++failed_queries_;
+                       }
+                     });
+      query_latency_.record(Clock::now() - scheduled);
+      ++sent_queries_;
+    }
+
+    integration_framework::IntegrationTestFramework itf_;
+    std::shared_ptr<CommitTracker> tracker_;
+    iroha::metrics::Histogram query_latency_;
+
+    std::vector<Account> accounts_;
+    std::vector<Account> multisig_accounts_;
+
+    std::mutex queries_mutex_;
+    std::condition_variable queries_cv_;
+    std::deque<ScheduledQuery> queries_;
+    bool queries_finished_ = false;
+
+    size_t sent_transactions_ = 0;
+    /// changed by the query sender thread only
+    size_t sent_queries_ = 0;
+    size_t failed_queries_ = 0;
+  };
+}  // namespace
+
+DEFINE_validator(workload, &validateWorkload);
+
+int main(int argc, char *argv[]) {
+  gflags::SetUsageMessage(
+      "Sends a synthetic workload to in-process irohad and reports the "
+      "throughput and latency as JSON");
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  if (FLAGS_accounts == 0 or FLAGS_batch_size == 0) {
+    std::cerr << "accounts and batch_size must be positive" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::string report;
+  try {
+    LoadDriver driver;
+    driver.prepare();
+    report = driver.run();
+    driver.done();
+  } catch (const std::exception &e) {
+    std::cerr << "Load failed: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if (FLAGS_output.empty()) {
+    std::cout << report;
+  } else {
+    std::ofstream(FLAGS_output) << report;
+  }
+  return EXIT_SUCCESS;
+}
@@ -19,6 +19,7 @@
 #include <benchmark/benchmark.h>
 
 #include "backend/protobuf/block.hpp"
+#include "backend/protobuf/proposal.hpp"
 #include "datetime/time.hpp"
 #include "module/shared_model/builders/protobuf/test_block_builder.hpp"
 #include "module/shared_model/builders/protobuf/test_proposal_builder.hpp"
@@ -212,6 +213,104 @@ BENCHMARK_DEFINE_F(ProposalBenchmark, MoveTest)(benchmark::State &st) {
   }
 }
 
+/// number of transactions in a proposal of the pipeline benchmarks
+constexpr int number_of_pipeline_txs = 1000;
+
+/**
+ * Pipeline forms a proposal of transactions, then a verified proposal of the
+ * proposal transactions, and then a block of the verified ones.
+ */
+class PipelineBenchmark : public benchmark::Fixture {
+ public:
+  std::vector<shared_model::proto::Transaction> txs;
+
+  void SetUp(benchmark::State &st) override {
+    TestTransactionBuilder txbuilder;
+
+    auto base_tx = txbuilder.createdTime(iroha::time::now()).quorum(1);
+
+    for (int i = 0; i < number_of_commands; i++) {
+      base_tx.transferAsset("player@one", "player@two", "coin", "", "5.00");
+    }
+
+    txs.clear();
+    for (int i = 0; i < number_of_pipeline_txs; i++) {
+      txs.push_back(base_tx.build());
+    }
+  }
+
+  void TearDown(benchmark::State &st) override {
+    txs.clear();
+  }
+};
+
+/**
+ * Benchmark the pipeline, which copies transaction transports to the
+ * transport of each proposal and block, as the factories did before
+ */
+BENCHMARK_DEFINE_F(PipelineBenchmark, TransportCopyTest)
+(benchmark::State &st) {
+  while (st.KeepRunning()) {
+    runBenchmark(st, [this] {
+      auto make_proposal = [](const auto &transactions) {
+        iroha::protocol::Proposal proposal;
+        proposal.set_height(1);
+        proposal.set_created_time(iroha::time::now());
+        for (const auto &tx : transactions) {
+          *proposal.add_transactions() =
+              static_cast<const shared_model::proto::Transaction &>(tx)
+                  .getTransport();
+        }
+        return shared_model::proto::Proposal(std::move(proposal));
+      };
+      auto proposal = make_proposal(txs);
+      auto verified_proposal = make_proposal(proposal.transactions());
+
+      iroha::protocol::Block_v1 block;
+      auto *payload = block.mutable_payload();
+      payload->set_height(1);
+      payload->set_created_time(iroha::time::now());
+      for (const auto &tx : verified_proposal.transactions()) {
+        *payload->add_transactions() =
+            static_cast<const shared_model::proto::Transaction &>(tx)
+                .getTransport();
+      }
+      shared_model::proto::Block result(std::move(block));
+      benchmark::DoNotOptimize(result.hash());
+    });
+  }
+}
+
+/**
+ * Benchmark the pipeline, which copies transactions to arenas of proposals
+ * and blocks, and reuses their blobs and hashes
+ */
+BENCHMARK_DEFINE_F(PipelineBenchmark, ArenaTest)(benchmark::State &st) {
+  while (st.KeepRunning()) {
+    runBenchmark(st, [this] {
+      auto pointers = [](const auto &transactions) {
+        std::vector<const shared_model::proto::Transaction *> result;
+        for (const auto &tx : transactions) {
+          result.push_back(
+              &static_cast<const shared_model::proto::Transaction &>(tx));
+        }
+        return result;
+      };
+      shared_model::proto::Proposal proposal(
+          1, iroha::time::now(), pointers(txs));
+      shared_model::proto::Proposal verified_proposal(
+          1, iroha::time::now(), pointers(proposal.transactions()));
+      shared_model::proto::Block result(
+          1,
+          shared_model::crypto::Hash(""),
+          iroha::time::now(),
+          pointers(verified_proposal.transactions()),
+          std::vector<shared_model::crypto::Hash>{});
+      benchmark::DoNotOptimize(result.hash());
+    });
+  }
+}
+
 BENCHMARK_REGISTER_F(BlockBenchmark, MoveTest)->UseManualTime();
 BENCHMARK_REGISTER_F(BlockBenchmark, CloneTest)->UseManualTime();
 BENCHMARK_REGISTER_F(BlockBenchmark, TransportMoveTest)->UseManualTime();
@@ -219,5 +318,7 @@ BENCHMARK_REGISTER_F(BlockBenchmark, TransportCopyTest)->UseManualTime();
 BENCHMARK_REGISTER_F(ProposalBenchmark, MoveTest)->UseManualTime();
 BENCHMARK_REGISTER_F(ProposalBenchmark, TransportMoveTest)->UseManualTime();
 BENCHMARK_REGISTER_F(ProposalBenchmark, TransportCopyTest)->UseManualTime();
+BENCHMARK_REGISTER_F(PipelineBenchmark, TransportCopyTest)->UseManualTime();
+BENCHMARK_REGISTER_F(PipelineBenchmark, ArenaTest)->UseManualTime();
 
 BENCHMARK_MAIN();
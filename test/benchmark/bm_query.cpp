@@ -16,46 +16,101 @@
 using namespace benchmark::utils;
 using namespace common_constants;
 
+namespace {
+  /**
+   * Start a peer with a user allowed to query any account, and make admin own
+   * some asset and transactions to be queried.
+   */
+  void prepareState(integration_framework::IntegrationTestFramework &itf) {
+    itf.setInitialState(kAdminKeypair);
+    itf.sendTx(createUserWithPerms(
+                   kUser,
+                   kUserKeypair.publicKey(),
+                   kRole,
+                   {shared_model::interface::permissions::Role::kGetAllAccounts,
+                    shared_model::interface::permissions::Role::kGetAllAccAst,
+                    shared_model::interface::permissions::Role::kGetAllAccTxs})
+                   .addAssetQuantity(kAssetId, "100.0")
+                   .build()
+                   .signAndAddSignature(kAdminKeypair)
+                   .finish());
+
+    itf.skipBlock().skipProposal();
+  }
+
+  /**
+   * Send the queries made by make_query until the benchmark is over. The
+   * first response is checked to be of the expected type.
+   */
+  template <typename ExpectedResponse, typename QueryMaker>
+  void runQueries(benchmark::State &state, QueryMaker &&make_query) {
+    integration_framework::IntegrationTestFramework itf(1);
+    prepareState(itf);
+
+    auto check = [](auto &status) {
+      boost::get<const ExpectedResponse &>(status.get());
+    };
+
+    itf.sendQuery(make_query(), check);
+
+    while (state.KeepRunning()) {
+      itf.sendQuery(make_query());
+    }
+    state.SetItemsProcessed(state.iterations());
+    itf.done();
+  }
+
+  auto baseQuery() {
+    return TestUnsignedQueryBuilder()
+        .createdTime(iroha::time::now())
+        .creatorAccountId(kUserId)
+        .queryCounter(1);
+  }
+}  // namespace
+
 /**
  * This benchmark executes get account query in order to measure query execution
  * performance
  */
 static void BM_QueryAccount(benchmark::State &state) {
-  integration_framework::IntegrationTestFramework itf(1);
-  itf.setInitialState(kAdminKeypair);
-  itf.sendTx(createUserWithPerms(
-                 kUser,
-                 kUserKeypair.publicKey(),
-                 kRole,
-                 {shared_model::interface::permissions::Role::kGetAllAccounts})
-                 .build()
-                 .signAndAddSignature(kAdminKeypair)
-                 .finish());
-
-  itf.skipBlock().skipProposal();
-
-  auto make_query = []() {
-    return TestUnsignedQueryBuilder()
-        .createdTime(iroha::time::now())
-        .creatorAccountId(kUserId)
-        .queryCounter(1)
-        .getAccount(kUserId)
+  runQueries<shared_model::interface::AccountResponse>(state, [] {
+    return baseQuery()
+        .getAccount(kAdminId)
         .build()
         .signAndAddSignature(kUserKeypair)
         .finish();
-  };
-
-  auto check = [](auto &status) {
-    boost::get<const shared_model::interface::AccountResponse &>(status.get());
-  };
+  });
+}
+BENCHMARK(BM_QueryAccount)->Unit(benchmark::kMicrosecond);
 
-  itf.sendQuery(make_query(), check);
+/**
+ * This benchmark executes get account assets query in order to measure query
+ * execution performance
+ */
+static void BM_QueryAccountAssets(benchmark::State &state) {
+  runQueries<shared_model::interface::AccountAssetResponse>(state, [] {
+    return baseQuery()
+        .getAccountAssets(kAdminId, kMaxPageSize, boost::none)
+        .build()
+        .signAndAddSignature(kUserKeypair)
+        .finish();
+  });
+}
+BENCHMARK(BM_QueryAccountAssets)->Unit(benchmark::kMicrosecond);
 
-  while (state.KeepRunning()) {
-    itf.sendQuery(make_query());
-  }
-  itf.done();
+/**
+ * This benchmark executes get account transactions query in order to measure
+ * query execution performance
+ */
+static void BM_QueryAccountTransactions(benchmark::State &state) {
+  runQueries<shared_model::interface::TransactionsPageResponse>(state, [] {
+    return baseQuery()
+        .getAccountTransactions(kAdminId, 10, boost::none)
+        .build()
+        .signAndAddSignature(kUserKeypair)
+        .finish();
+  });
 }
-BENCHMARK(BM_QueryAccount)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_QueryAccountTransactions)->Unit(benchmark::kMicrosecond);
 
 BENCHMARK_MAIN();
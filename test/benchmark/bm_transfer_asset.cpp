@@ -0,0 +1,72 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+#include "ametsuchi/impl/amount_storage_mode.hpp"
+#include "framework/common_constants.hpp"
+#include "framework/executor_itf/executor_itf.hpp"
+#include "integration/executor/executor_fixture_param_postgres.hpp"
+#include "interfaces/common_objects/amount.hpp"
+#include "module/shared_model/mock_objects_factories/mock_command_factory.hpp"
+
+using namespace common_constants;
+using namespace iroha::ametsuchi;
+using namespace iroha::integration_framework;
+
+using shared_model::interface::Amount;
+
+namespace {
+  std::unique_ptr<ExecutorItf> createItf(
+      const executor_testing::PostgresExecutorTestParam &param) {
+    auto itf_result = ExecutorItf::create(param.getExecutorItfParam());
+    if (auto e = iroha::expected::resultToOptionalError(itf_result)) {
+      throw std::runtime_error(e.value());
+    }
+    auto itf = std::move(itf_result).assumeValue();
+
+    auto check = [](const CommandResult &result) {
+      if (auto e = iroha::expected::resultToOptionalError(result)) {
+        throw std::runtime_error(e->toString());
+      }
+    };
+    const auto &factory = itf->getMockCommandFactory();
+    check(itf->executeMaintenanceCommand(
+        *factory->constructCreateAsset(kAssetName, kDomain, 2)));
+    check(itf->createUserWithPerms(
+        kUser, kDomain, kUserKeypair.publicKey(), {}));
+    check(itf->executeMaintenanceCommand(*factory->constructAddAssetQuantity(
+        kAssetId, Amount{"100000000000.00"})));
+    return itf;
+  }
+}  // namespace
+
+/**
+ * Transfers a small amount from admin to user back to back, so that the
+ * balance update arithmetic and amount conversion dominate the measurement.
+ * The benchmark argument selects the account balances storage layout.
+ */
+static void BM_TransferAsset(benchmark::State &state) {
+  const auto amount_storage_mode =
+      static_cast<AmountStorageMode>(state.range(0));
+  executor_testing::PostgresExecutorTestParam param(amount_storage_mode);
+  auto itf = createItf(param);
+  auto transfer = itf->getMockCommandFactory()->constructTransferAsset(
+      kAdminId, kUserId, kAssetId, "", Amount{"0.01"});
+
+  while (state.KeepRunning()) {
+    if (auto e = iroha::expected::resultToOptionalError(
+            itf->executeCommandAsAccount(*transfer, kAdminId, true))) {
+      state.SkipWithError(e->toString().c_str());
+      break;
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TransferAsset)
+    ->Arg(static_cast<int>(AmountStorageMode::kDecimal))
+    ->Arg(static_cast<int>(AmountStorageMode::kScaledInteger))
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,94 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "consensus/yac/impl/yac_crypto_provider_impl.hpp"
+#include "consensus/yac/outcome_messages.hpp"
+#include "cryptography/crypto_provider/crypto_defaults.hpp"
+
+using namespace iroha::consensus;
+using namespace iroha::consensus::yac;
+
+namespace {
+  /**
+   * Votes of all peers for a single round: each vote is received alone, and
+   * then inside the commit message of each peer.
+   */
+  std::vector<VoteMessage> makeRoundVotes(
+      std::vector<std::unique_ptr<CryptoProviderImpl>> &signers,
+      BlockRoundType block_round) {
+    YacHash hash(Round{block_round, 0}, "proposal", "block");
+    std::vector<VoteMessage> votes;
+    for (auto &signer : signers) {
+      votes.push_back(signer->getVote(hash));
+    }
+    return votes;
+  }
+
+  /**
+   * Verify the votes of consecutive rounds as a peer does.
+   * Arguments are the number of peers and whether a single provider, which
+   * keeps the verified votes, is used. Otherwise each message is verified by
+   * a fresh provider, as if there was no cache.
+   */
+  void BM_VerifyRoundVotes(benchmark::State &state) {
+    const size_t peers = state.range(0);
+    const bool cached = state.range(1);
+
+    std::vector<std::unique_ptr<CryptoProviderImpl>> signers;
+    std::vector<shared_model::crypto::PublicKey> voters;
+    for (size_t i = 0; i < peers; ++i) {
+      auto signer_keypair =
+          shared_model::crypto::DefaultCryptoAlgorithmType::generateKeypair();
+      voters.push_back(signer_keypair.publicKey());
+      signers.push_back(std::make_unique<CryptoProviderImpl>(signer_keypair));
+    }
+    const auto keypair =
+        shared_model::crypto::DefaultCryptoAlgorithmType::generateKeypair();
+    auto verifier = std::make_unique<CryptoProviderImpl>(keypair);
+    BlockRoundType block_round = 0;
+
+    auto verify = [&](const std::vector<VoteMessage> &message) {
+      if (not cached) {
+        verifier = std::make_unique<CryptoProviderImpl>(keypair);
+        verifier->setVoting(Round{block_round, 0}, voters);
+      }
+      if (not verifier->verify(message)) {
+        state.SkipWithError("verification failed");
+      }
+    };
+
+    for (auto _ : state) {
+      state.PauseTiming();
+      auto votes = makeRoundVotes(signers, ++block_round);
+      verifier->setVoting(Round{block_round, 0}, voters);
+      state.ResumeTiming();
+
+      for (const auto &vote : votes) {
+        verify({vote});
+      }
+      for (size_t i = 0; i < peers; ++i) {
+        verify(votes);
+      }
+    }
+    state.counters["signatures"] = benchmark::Counter(
+        static_cast<double>(peers * (peers + 1)),
+        benchmark::Counter::kIsIterationInvariantRate);
+  }
+
+  void peersAndCache(benchmark::internal::Benchmark *b) {
+    for (auto peers : {4, 16, 50, 100}) {
+      b->Args({peers, 0});
+      b->Args({peers, 1});
+    }
+  }
+}  // namespace
+
+BENCHMARK(BM_VerifyRoundVotes)
+    ->Apply(peersAndCache)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
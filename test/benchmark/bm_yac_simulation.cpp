@@ -0,0 +1,139 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "framework/yac_simulation/yac_simulation.hpp"
+#include "logger/async_log_writer.hpp"
+#include "logger/logger_manager.hpp"
+
+using namespace iroha::consensus::yac::simulation;
+
+namespace {
+  const size_t kRounds = 10;
+
+  /**
+   * Run consensus rounds in the simulated network.
+   * Arguments are the number of peers, the vote delay in milliseconds, the
+   * message loss in per mille, the number of silent byzantine peers as a
+   * share of the tolerated maximum, in percent, and whether the vote delay is
+   * adaptive.
+   * Counters other than the wall time describe the virtual time of the
+   * simulation, which is the same in each iteration.
+   */
+  void BM_YacSimulation(benchmark::State &state) {
+    SimulationConfig config;
+    config.peers = state.range(0);
+    config.vote_delay = std::chrono::milliseconds(state.range(1));
+    config.loss = state.range(2) / 1000.;
+    config.byzantine_peers = (config.peers - 1) / 3 * state.range(3) / 100;
+    config.adaptive_vote_delay = state.range(4);
+    config.rounds = kRounds;
+    config.latency = std::chrono::milliseconds(5);
+    config.jitter = std::chrono::milliseconds(5);
+
+    SimulationReport report;
+    for (auto _ : state) {
+      report = YacSimulation(config).run();
+    }
+    if (report.committed_rounds < config.rounds) {
+      state.SkipWithError("not all rounds are committed");
+      return;
+    }
+
+    state.counters["rounds_per_second"] = report.roundsPerSecond();
+    state.counters["messages_per_round"] = report.messagesPerRound();
+    state.counters["verified_votes_per_round"] =
+        report.verifiedVotesPerRound();
+    state.counters["mean_commit_ms"] =
+        std::chrono::duration<double, std::milli>(report.meanTimeToCommit())
+            .count();
+    state.counters["max_commit_ms"] =
+        std::chrono::duration<double, std::milli>(report.maxTimeToCommit())
+            .count();
+  }
+
+  /**
+   * Run consensus rounds with logging on and off, to measure its cost.
+   * Arguments are the number of peers, and the logging: 0 for critical
+   * messages only, 1 for info messages written synchronously, 2 for info
+   * messages written by the async writer.
+   * Run with stdout redirected and --benchmark_out, as the messages go to
+   * stdout. The wall time of a round is spent on the consensus thread, while
+   * the async writer completes its writes outside the measurement.
+   */
+  void BM_YacSimulationLogging(benchmark::State &state) {
+    SimulationConfig config;
+    config.peers = state.range(0);
+    config.rounds = kRounds;
+    config.latency = std::chrono::milliseconds(5);
+
+    std::shared_ptr<logger::AsyncLogWriter> writer;
+    if (state.range(1) > 0) {
+      if (state.range(1) == 2) {
+        writer = std::make_shared<logger::AsyncLogWriter>();
+      }
+      config.log_manager =
+          std::make_shared<logger::LoggerManagerTree>(logger::LoggerConfig{
+              logger::LogLevel::kInfo, logger::getDefaultLogPatterns(), writer})
+              ->getChild("YacSimulation");
+    }
+
+    std::chrono::steady_clock::duration consensus_time{};
+    for (auto _ : state) {
+      const auto start = std::chrono::steady_clock::now();
+      YacSimulation(config).run();
+      consensus_time += std::chrono::steady_clock::now() - start;
+      if (writer) {
+        state.PauseTiming();
+        writer->flush();
+        state.ResumeTiming();
+      }
+    }
+
+    state.counters["wall_ms_per_round"] =
+        std::chrono::duration<double, std::milli>(consensus_time).count()
+        / (state.iterations() * kRounds);
+    if (writer) {
+      state.counters["dropped_messages"] = writer->dropped();
+    }
+  }
+
+  void reliableNetwork(benchmark::internal::Benchmark *b) {
+    for (auto peers : {4, 16, 50, 100, 200}) {
+      b->Args({peers, 100, 0, 0, 0});
+    }
+  }
+
+  void unreliableNetwork(benchmark::internal::Benchmark *b) {
+    for (auto peers : {4, 16, 50, 100, 200}) {
+      for (auto vote_delay : {50, 100, 500}) {
+        b->Args({peers, vote_delay, 10, 100, 0});
+        b->Args({peers, vote_delay, 10, 100, 1});
+      }
+    }
+  }
+
+  void loggingModes(benchmark::internal::Benchmark *b) {
+    for (auto peers : {4, 16, 50}) {
+      for (auto logging : {0, 1, 2}) {
+        b->Args({peers, logging});
+      }
+    }
+  }
+}  // namespace
+
+BENCHMARK(BM_YacSimulation)
+    ->Apply(reliableNetwork)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_YacSimulation)
+    ->Apply(unreliableNetwork)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_YacSimulationLogging)
+    ->Apply(loggingModes)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -26,6 +26,7 @@
 #include "framework/integration_framework/fake_peer/network/yac_network_notifier.hpp"
 #include "framework/integration_framework/fake_peer/proposal_storage.hpp"
 #include "framework/result_fixture.hpp"
+#include "framework/test_client_factory.hpp"
 #include "interfaces/common_objects/common_objects_factory.hpp"
 #include "logger/logger.hpp"
 #include "logger/logger_manager.hpp"
@@ -303,7 +304,8 @@ namespace integration_framework {
     }
 
     void FakePeer::sendMstState(const iroha::MstState &state) {
-      mst_transport_->sendState(*real_peer_, state);
+      mst_transport_->sendState(
+          *real_peer_, iroha::MstGossip{state}, [](bool) {});
     }
 
     void FakePeer::sendYacState(
@@ -387,7 +389,9 @@ namespace integration_framework {
               proposal_factory_,
               [] { return std::chrono::system_clock::now(); },
               timeout,
-              ordering_log_manager_->getChild("NetworkClient")->getLogger())
+              ordering_log_manager_->getChild("NetworkClient")->getLogger(),
+              getTestInsecureClientFactory<
+                  iroha::ordering::proto::OnDemandOrdering>())
               .create(*real_peer_);
       return on_demand_os_transport->onRequestProposal(round);
     }
@@ -10,10 +10,10 @@ namespace integration_framework {
 
     void MstNetworkNotifier::onNewState(
         const shared_model::crypto::PublicKey &from,
-        iroha::MstState new_state) {
+        iroha::MstGossip gossip) {
       std::lock_guard<std::mutex> guard(mst_subject_mutex_);
       mst_subject_.get_subscriber().on_next(
-          std::make_shared<MstMessage>(from, std::move(new_state)));
+          std::make_shared<MstMessage>(from, std::move(gossip.batches)));
     }
 
     rxcpp::observable<std::shared_ptr<MstMessage>>
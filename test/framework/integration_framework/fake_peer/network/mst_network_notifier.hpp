@@ -21,7 +21,7 @@ namespace integration_framework {
         : public iroha::network::MstTransportNotification {
      public:
       void onNewState(const shared_model::crypto::PublicKey &from,
-                      iroha::MstState new_state) override;
+                      iroha::MstGossip gossip) override;
 
       rxcpp::observable<std::shared_ptr<MstMessage>> getObservable();
 
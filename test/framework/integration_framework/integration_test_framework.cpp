@@ -36,6 +36,7 @@
 #include "framework/integration_framework/port_guard.hpp"
 #include "framework/integration_framework/test_irohad.hpp"
 #include "framework/result_fixture.hpp"
+#include "framework/test_client_factory.hpp"
 #include "framework/test_logger.hpp"
 #include "interfaces/iroha_internal/transaction_batch_factory_impl.hpp"
 #include "interfaces/iroha_internal/transaction_batch_parser_impl.hpp"
@@ -421,6 +422,10 @@ namespace integration_framework {
                      response->toString());
         });
 
+    run();
+  }
+
+  void IntegrationTestFramework::run() {
     if (fake_peers_.size() > 0) {
       log_->info("starting fake iroha peers");
       for (auto &fake_peer : fake_peers_) {
@@ -661,7 +666,9 @@ namespace integration_framework {
                                            // only used when waiting a response
                                            // for a proposal request, which our
                                            // client does not do
-            log_manager_->getChild("OrderingClientTransport")->getLogger())
+            log_manager_->getChild("OrderingClientTransport")->getLogger(),
+            getTestInsecureClientFactory<
+                iroha::ordering::proto::OnDemandOrdering>())
             .create(*this_peer_);
     on_demand_os_transport->onBatches(batches);
     return *this;
@@ -676,7 +683,9 @@ namespace integration_framework {
             proposal_factory_,
             [] { return std::chrono::system_clock::now(); },
             timeout,
-            log_manager_->getChild("OrderingClientTransport")->getLogger())
+            log_manager_->getChild("OrderingClientTransport")->getLogger(),
+            getTestInsecureClientFactory<
+                iroha::ordering::proto::OnDemandOrdering>())
             .create(*this_peer_);
     return on_demand_os_transport->onRequestProposal(round);
   }
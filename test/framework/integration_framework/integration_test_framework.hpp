@@ -455,6 +455,9 @@ namespace integration_framework {
     /// Start the ITF.
     void subscribeQueuesAndRun();
 
+    /// Start the ITF without keeping the intercepted objects for the checks.
+    void run();
+
     /// Get interface::Peer object for this instance.
     std::shared_ptr<shared_model::interface::Peer> getThisPeer() const;
 
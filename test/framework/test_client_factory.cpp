@@ -0,0 +1,15 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "framework/test_client_factory.hpp"
+
+#include "network/impl/channel_factory.hpp"
+
+std::shared_ptr<iroha::network::GenericClientFactory>
+getTestInsecureClientFactory() {
+  return std::make_shared<iroha::network::GenericClientFactory>(
+      std::make_shared<iroha::network::ChannelFactory>(
+          iroha::network::getDefaultChannelParams()));
+}
@@ -0,0 +1,26 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef TEST_FRAMEWORK_TEST_CLIENT_FACTORY_HPP
+#define TEST_FRAMEWORK_TEST_CLIENT_FACTORY_HPP
+
+#include <memory>
+
+#include "network/impl/client_factory_impl.hpp"
+#include "network/impl/generic_client_factory.hpp"
+
+/// @return factory of insecure clients with default channel params
+std::shared_ptr<iroha::network::GenericClientFactory>
+getTestInsecureClientFactory();
+
+/// @return factory of insecure clients of Service with default channel params
+template <typename Service>
+std::shared_ptr<iroha::network::ClientFactory<Service>>
+getTestInsecureClientFactory() {
+  return std::make_shared<iroha::network::ClientFactoryImpl<Service>>(
+      getTestInsecureClientFactory());
+}
+
+#endif  // TEST_FRAMEWORK_TEST_CLIENT_FACTORY_HPP
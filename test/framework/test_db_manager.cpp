@@ -40,14 +40,17 @@ class TestDbManager::DbDropper {
 
 Result<std::unique_ptr<TestDbManager>, std::string>
 TestDbManager::createWithRandomDbName(
-    size_t sessions, logger::LoggerManagerTreePtr log_manager) {
+    size_t sessions,
+    logger::LoggerManagerTreePtr log_manager,
+    AmountStorageMode amount_storage_mode) {
   size_t random_db_name_attempts = 0;
   static const auto default_creds = getPostgresCredsOrDefault();
   while (random_db_name_attempts++ < kMaxRandomDbNameAttempts) {
     auto pg_opts = std::make_unique<PostgresOptions>(
         default_creds,
         getRandomDbName(),
-        log_manager->getChild("PostgresOptions")->getLogger());
+        log_manager->getChild("PostgresOptions")->getLogger(),
+        amount_storage_mode);
     auto db_exists_result =
         PgConnectionInit::checkIfWorkingDatabaseExists(*pg_opts);
     if (auto e = resultToOptionalError(db_exists_result)) {
@@ -6,6 +6,7 @@
 #ifndef TEST_DB_MANAGER_HPP
 #define TEST_DB_MANAGER_HPP
 
+#include "ametsuchi/impl/amount_storage_mode.hpp"
 #include "common/result.hpp"
 #include "logger/logger_manager_fwd.hpp"
 
@@ -32,12 +33,15 @@ namespace iroha {
        *
        * @param sessions The number of sessions to create.
        * @param log_manager A log manager to create loggers for child objects.
+       * @param amount_storage_mode The layout of account balances.
        * @return TestDbManager instance on success, or string error otherwise.
        */
       static iroha::expected::Result<std::unique_ptr<TestDbManager>,
                                      std::string>
       createWithRandomDbName(size_t sessions,
-                             logger::LoggerManagerTreePtr log_manager);
+                             logger::LoggerManagerTreePtr log_manager,
+                             ametsuchi::AmountStorageMode amount_storage_mode =
+                                 ametsuchi::AmountStorageMode::kDecimal);
 
       ~TestDbManager();
 
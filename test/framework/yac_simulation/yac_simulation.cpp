@@ -0,0 +1,475 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "framework/yac_simulation/yac_simulation.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <tuple>
+
+#include "backend/plain/peer.hpp"
+#include "backend/plain/signature.hpp"
+#include "common/visitor.hpp"
+#include "consensus/yac/cluster_order.hpp"
+#include "consensus/yac/impl/peer_orderer_impl.hpp"
+#include "consensus/yac/impl/vote_delay_estimator.hpp"
+#include "consensus/yac/impl/yac_crypto_provider_impl.hpp"
+#include "consensus/yac/storage/buffered_cleanup_strategy.hpp"
+#include "consensus/yac/supermajority_checker.hpp"
+#include "consensus/yac/timer.hpp"
+#include "consensus/yac/transport/yac_network_interface.hpp"
+#include "consensus/yac/yac.hpp"
+#include "consensus/yac/yac_crypto_provider.hpp"
+#include "cryptography/crypto_provider/crypto_defaults.hpp"
+#include "cryptography/public_key.hpp"
+#include "cryptography/signed.hpp"
+#include "framework/test_logger.hpp"
+#include "logger/logger_manager.hpp"
+
+namespace {
+  using namespace iroha::consensus;
+  using namespace iroha::consensus::yac;
+
+  const size_t kPublicKeySize = 32;
+  const size_t kSignatureSize = 64;
+
+  std::string padded(std::string value, size_t size) {
+    value.resize(size, '0');
+    return value;
+  }
+
+  /// Crypto provider which signs votes with a fake signature and accepts all
+  class StubCryptoProvider : public YacCryptoProvider {
+   public:
+    explicit StubCryptoProvider(shared_model::crypto::PublicKey public_key)
+        : signature_(std::make_shared<shared_model::plain::Signature>(
+              shared_model::crypto::Signed(
+                  padded(public_key.hex(), kSignatureSize)),
+              public_key)) {}
+
+    bool verify(const std::vector<VoteMessage> &msg) override {
+      return true;
+    }
+
+    VoteMessage getVote(YacHash hash) override {
+      VoteMessage vote;
+      vote.hash = std::move(hash);
+      vote.signature = signature_;
+      return vote;
+    }
+
+    void setVoting(
+        const Round &,
+        const std::vector<shared_model::crypto::PublicKey> &) override {}
+
+   private:
+    std::shared_ptr<shared_model::interface::Signature> signature_;
+  };
+
+  std::string roundSuffix(const Round &round) {
+    return std::to_string(round.block_round) + "_"
+        + std::to_string(round.reject_round);
+  }
+
+  const Round &getRound(const std::vector<VoteMessage> &votes) {
+    return votes.at(0).hash.vote_round;
+  }
+}  // namespace
+
+namespace iroha {
+  namespace consensus {
+    namespace yac {
+      namespace simulation {
+
+        // ----------| Report |----------
+
+        double SimulationReport::roundsPerSecond() const {
+          if (duration == VirtualTime::zero()) {
+            return 0.;
+          }
+          return committed_rounds
+              / std::chrono::duration<double>(duration).count();
+        }
+
+        double SimulationReport::messagesPerRound() const {
+          return committed_rounds == 0
+              ? 0.
+              : static_cast<double>(messages) / committed_rounds;
+        }
+
+        double SimulationReport::verifiedVotesPerRound() const {
+          return committed_rounds == 0
+              ? 0.
+              : static_cast<double>(verified_votes) / committed_rounds;
+        }
+
+        VirtualTime SimulationReport::meanTimeToCommit() const {
+          if (time_to_commit.empty()) {
+            return VirtualTime::zero();
+          }
+          return std::accumulate(time_to_commit.begin(),
+                                 time_to_commit.end(),
+                                 VirtualTime::zero())
+              / time_to_commit.size();
+        }
+
+        VirtualTime SimulationReport::maxTimeToCommit() const {
+          if (time_to_commit.empty()) {
+            return VirtualTime::zero();
+          }
+          return *std::max_element(time_to_commit.begin(),
+                                   time_to_commit.end());
+        }
+
+        // ----------| Simulated environment |----------
+
+        /// Network of a single peer, which delivers messages through events
+        class YacSimulation::SimulatedNetwork : public YacNetwork {
+         public:
+          SimulatedNetwork(YacSimulation &simulation, size_t peer)
+              : simulation_(simulation), peer_(peer) {}
+
+          void subscribe(
+              std::shared_ptr<YacNetworkNotifications> handler) override {
+            handler_ = handler;
+          }
+
+          void sendState(const shared_model::interface::Peer &to,
+                         const std::vector<VoteMessage> &state) override {
+            simulation_.send(peer_, to, state);
+          }
+
+          void deliver(std::vector<VoteMessage> state) {
+            if (auto handler = handler_.lock()) {
+              handler->onState(std::move(state));
+            }
+          }
+
+         private:
+          YacSimulation &simulation_;
+          size_t peer_;
+          std::weak_ptr<YacNetworkNotifications> handler_;
+        };
+
+        /// Timer which counts the virtual time
+        class YacSimulation::SimulatedTimer : public Timer {
+         public:
+          SimulatedTimer(YacSimulation &simulation,
+                         std::function<std::chrono::milliseconds()> delay)
+              : simulation_(simulation), delay_(std::move(delay)) {}
+
+          void invokeAfterDelay(std::function<void()> handler) override {
+            auto generation = ++generation_;
+            simulation_.schedule(delay_(),
+                                 [this, generation, handler] {
+                                   if (generation == generation_) {
+                                     handler();
+                                   }
+                                 });
+          }
+
+          void deny() override {
+            ++generation_;
+          }
+
+         private:
+          YacSimulation &simulation_;
+          std::function<std::chrono::milliseconds()> delay_;
+          /// only the handler of the latest invocation is run
+          uint64_t generation_ = 0;
+        };
+
+        /// Crypto provider counting the votes passed for verification
+        class YacSimulation::CountingCryptoProvider
+            : public YacCryptoProvider {
+         public:
+          CountingCryptoProvider(std::shared_ptr<YacCryptoProvider> impl,
+                                 size_t &verified_votes)
+              : impl_(std::move(impl)), verified_votes_(verified_votes) {}
+
+          bool verify(const std::vector<VoteMessage> &msg) override {
+            verified_votes_ += msg.size();
+            return impl_->verify(msg);
+          }
+
+          VoteMessage getVote(YacHash hash) override {
+            return impl_->getVote(std::move(hash));
+          }
+
+          void setVoting(const Round &round,
+                         const std::vector<shared_model::crypto::PublicKey>
+                             &voters) override {
+            impl_->setVoting(round, voters);
+          }
+
+         private:
+          std::shared_ptr<YacCryptoProvider> impl_;
+          size_t &verified_votes_;
+        };
+
+        struct YacSimulation::Peer {
+          std::shared_ptr<SimulatedNetwork> network;
+          std::shared_ptr<CountingCryptoProvider> crypto;
+          std::shared_ptr<shared_model::interface::Signature> block_signature;
+          /// not set for silent byzantine peers
+          std::shared_ptr<Yac> yac;
+          rxcpp::composite_subscription subscription;
+          Round round{1, 0};
+          bool finished = false;
+        };
+
+        bool YacSimulation::EventOrder::operator()(const Event &lhs,
+                                                   const Event &rhs) const {
+          // priority queue keeps the greatest element on top
+          return std::tie(lhs.time, lhs.sequence)
+              > std::tie(rhs.time, rhs.sequence);
+        }
+
+        // ----------| Simulation |----------
+
+        YacSimulation::YacSimulation(SimulationConfig config)
+            : config_(std::move(config)),
+              now_(VirtualTime::zero()),
+              random_(config_.seed) {
+          if (not config_.cleanup_strategy) {
+            config_.cleanup_strategy = [] {
+              return std::make_shared<BufferedCleanupStrategy>();
+            };
+          }
+
+          auto log_manager = config_.log_manager
+              ? config_.log_manager
+              : getTestLoggerManager(logger::LogLevel::kCritical)
+                    ->getChild("YacSimulation");
+
+          std::vector<std::shared_ptr<YacCryptoProvider>> providers;
+          for (size_t i = 0; i < config_.peers; ++i) {
+            const auto address = "peer_" + std::to_string(i);
+            std::shared_ptr<YacCryptoProvider> provider;
+            auto public_key = [&] {
+              if (config_.real_crypto) {
+                auto keypair = shared_model::crypto::
+                    DefaultCryptoAlgorithmType::generateKeypair();
+                provider = std::make_shared<CryptoProviderImpl>(keypair);
+                return keypair.publicKey();
+              }
+              shared_model::crypto::PublicKey key(
+                  padded(std::to_string(i), kPublicKeySize));
+              provider = std::make_shared<StubCryptoProvider>(key);
+              return key;
+            }();
+            providers.push_back(std::move(provider));
+            ledger_.push_back(std::make_shared<shared_model::plain::Peer>(
+                address, public_key, boost::none));
+            peer_by_address_.emplace(address, i);
+          }
+
+          auto initial_order = ClusterOrdering::create(ledger_);
+          for (size_t i = 0; i < config_.peers; ++i) {
+            auto peer = std::make_unique<Peer>();
+            peer->network = std::make_shared<SimulatedNetwork>(*this, i);
+            peer->crypto = std::make_shared<CountingCryptoProvider>(
+                providers[i], report_.verified_votes);
+            peer->block_signature =
+                std::make_shared<shared_model::plain::Signature>(
+                    shared_model::crypto::Signed(
+                        padded(ledger_[i]->address(), kSignatureSize)),
+                    ledger_[i]->pubkey());
+
+            if (not isByzantine(i)
+                or config_.byzantine_behaviour
+                    != ByzantineBehaviour::kSilent) {
+              auto peer_log_manager =
+                  log_manager->getChild(ledger_[i]->address());
+              std::shared_ptr<VoteDelayEstimator> estimator;
+              std::function<std::chrono::milliseconds()> delay =
+                  [vote_delay = config_.vote_delay] { return vote_delay; };
+              if (config_.adaptive_vote_delay) {
+                estimator = std::make_shared<VoteDelayEstimator>(
+                    config_.vote_delay,
+                    config_.vote_delay / 10,
+                    config_.vote_delay * 4,
+                    peer_log_manager->getChild("VoteDelay")->getLogger(),
+                    [this] {
+                      return VoteDelayEstimator::Clock::time_point(now_);
+                    });
+                delay = [estimator] { return estimator->voteDelay(); };
+              }
+              peer->yac = Yac::create(
+                  YacVoteStorage(
+                      config_.cleanup_strategy(),
+                      getSupermajorityChecker(ConsistencyModel::kBft),
+                      peer_log_manager->getChild("VoteStorage")),
+                  peer->network,
+                  peer->crypto,
+                  std::make_shared<SimulatedTimer>(*this, std::move(delay)),
+                  *initial_order,
+                  peer->round,
+                  rxcpp::observe_on_one_worker(
+                      rxcpp::schedulers::make_current_thread()),
+                  peer_log_manager->getChild("Yac")->getLogger(),
+                  std::move(estimator));
+              peer->network->subscribe(peer->yac);
+            }
+            peers_.push_back(std::move(peer));
+          }
+
+          for (size_t i = 0; i < config_.peers; ++i) {
+            auto &peer = *peers_[i];
+            if (not peer.yac) {
+              continue;
+            }
+            peer.yac->onOutcome().subscribe(
+                peer.subscription, [this, i, &peer](const Answer &answer) {
+                  auto next_round = [&](Round round) {
+                    peer.round = round;
+                    if (not peer.finished) {
+                      this->schedule(config_.round_delay,
+                                     [this, i, round] { this->vote(i, round); });
+                    }
+                  };
+                  visit_in_place(
+                      answer,
+                      [&](const CommitMessage &commit) {
+                        const auto &round = getRound(commit.votes);
+                        if (round.block_round < peer.round.block_round) {
+                          return;
+                        }
+                        for (auto block = peer.round.block_round;
+                             block <= round.block_round;
+                             ++block) {
+                          this->finishRound(i, block);
+                        }
+                        next_round(Round{round.block_round + 1, 0});
+                      },
+                      [&](const RejectMessage &reject) {
+                        const auto &round = getRound(reject.votes);
+                        if (round != peer.round) {
+                          return;
+                        }
+                        ++report_.reject_outcomes;
+                        next_round(
+                            Round{round.block_round, round.reject_round + 1});
+                      },
+                      [&](const FutureMessage &future) {
+                        const auto &round = getRound(future.votes);
+                        if (round <= peer.round) {
+                          return;
+                        }
+                        ++report_.future_outcomes;
+                        // the peer synchronizes the blocks it has missed
+                        for (auto block = peer.round.block_round;
+                             block < round.block_round;
+                             ++block) {
+                          this->finishRound(i, block);
+                        }
+                        next_round(round);
+                      });
+                });
+          }
+        }
+
+        YacSimulation::~YacSimulation() {
+          for (auto &peer : peers_) {
+            peer->subscription.unsubscribe();
+          }
+        }
+
+        SimulationReport YacSimulation::run() {
+          for (size_t i = 0; i < config_.peers; ++i) {
+            if (peers_[i]->yac) {
+              schedule(VirtualTime::zero(),
+                       [this, i] { this->vote(i, peers_[i]->round); });
+            }
+          }
+
+          while (not events_.empty()
+                 and report_.committed_rounds < config_.rounds) {
+            auto event = events_.top();
+            events_.pop();
+            if (event.time > config_.time_limit) {
+              break;
+            }
+            now_ = event.time;
+            event.action();
+          }
+          return report_;
+        }
+
+        void YacSimulation::schedule(VirtualTime delay,
+                                     std::function<void()> action) {
+          events_.push(Event{now_ + delay, sequence_++, std::move(action)});
+        }
+
+        void YacSimulation::send(size_t from,
+                                 const shared_model::interface::Peer &to,
+                                 std::vector<VoteMessage> state) {
+          ++report_.messages;
+          report_.votes += state.size();
+          if (config_.loss > 0.
+              and std::bernoulli_distribution(config_.loss)(random_)) {
+            ++report_.dropped_messages;
+            return;
+          }
+
+          auto delay = config_.latency;
+          if (config_.jitter > VirtualTime::zero()) {
+            delay += VirtualTime(std::uniform_int_distribution<
+                                 VirtualTime::rep>(0, config_.jitter.count())(
+                random_));
+          }
+
+          auto target = peer_by_address_.at(to.address());
+          schedule(delay, [this, target, state = std::move(state)] {
+            peers_[target]->network->deliver(state);
+          });
+        }
+
+        void YacSimulation::vote(size_t peer_index, Round round) {
+          auto &peer = *peers_[peer_index];
+          if (peer.round != round) {
+            // the peer has already moved to another round
+            return;
+          }
+          rounds_.emplace(round.block_round, RoundProgress{now_});
+
+          auto block_hash = "block_" + roundSuffix(round);
+          if (isByzantine(peer_index)) {
+            block_hash += "_" + ledger_[peer_index]->address();
+          }
+          YacHash hash(round, "proposal_" + roundSuffix(round), block_hash);
+          hash.block_signature = peer.block_signature;
+
+          auto order = PeerOrdererImpl(nullptr).getOrdering(hash, ledger_);
+          peer.yac->vote(hash, *order);
+        }
+
+        void YacSimulation::finishRound(size_t peer_index,
+                                        BlockRoundType block_round) {
+          if (isByzantine(peer_index)) {
+            return;
+          }
+          if (block_round >= config_.rounds) {
+            peers_[peer_index]->finished = true;
+          }
+
+          auto &progress =
+              rounds_.emplace(block_round, RoundProgress{now_}).first->second;
+          if (++progress.finished_peers
+              == config_.peers - config_.byzantine_peers) {
+            ++report_.committed_rounds;
+            report_.time_to_commit.push_back(now_ - progress.start);
+            report_.duration = now_;
+          }
+        }
+
+        bool YacSimulation::isByzantine(size_t peer) const {
+          return peer >= config_.peers - config_.byzantine_peers;
+        }
+
+      }  // namespace simulation
+    }    // namespace yac
+  }      // namespace consensus
+}  // namespace iroha
@@ -0,0 +1,172 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_YAC_SIMULATION_HPP
+#define IROHA_YAC_SIMULATION_HPP
+
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <queue>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "consensus/round.hpp"
+#include "consensus/yac/storage/cleanup_strategy.hpp"
+#include "logger/logger_manager_fwd.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Peer;
+  }  // namespace interface
+}  // namespace shared_model
+
+namespace iroha {
+  namespace consensus {
+    namespace yac {
+
+      class Yac;
+      struct VoteMessage;
+
+      namespace simulation {
+
+        using VirtualTime = std::chrono::microseconds;
+
+        /// Behaviour of faulty peers
+        enum class ByzantineBehaviour {
+          /// the peer neither votes nor answers
+          kSilent,
+          /// the peer votes for its own block in every round
+          kEquivocating
+        };
+
+        struct SimulationConfig {
+          /// Total number of peers, including byzantine ones
+          size_t peers = 4;
+          size_t byzantine_peers = 0;
+          ByzantineBehaviour byzantine_behaviour = ByzantineBehaviour::kSilent;
+          /// Number of block rounds to commit
+          size_t rounds = 10;
+
+          /// Delay of the timer, which passes the vote to the next peer
+          std::chrono::milliseconds vote_delay{100};
+          /// Derive the delay from observed latency, starting from vote_delay
+          bool adaptive_vote_delay = false;
+          /// Time between an outcome and the vote for the next round
+          VirtualTime round_delay = VirtualTime::zero();
+          /// One way delivery time of a message
+          VirtualTime latency = std::chrono::milliseconds(1);
+          /// Maximal random addition to the latency
+          VirtualTime jitter = VirtualTime::zero();
+          /// Probability of a message to be lost
+          double loss = 0.;
+          /// The simulation stops when reaching this time
+          VirtualTime time_limit = std::chrono::minutes(10);
+
+          /// Sign and verify votes with the real crypto provider
+          bool real_crypto = false;
+          /// Cleanup strategy of the vote storage of each peer
+          std::function<std::shared_ptr<CleanupStrategy>()> cleanup_strategy;
+          /// Loggers of the peers, critical messages only if not set
+          logger::LoggerManagerTreePtr log_manager;
+
+          uint64_t seed = 1;
+        };
+
+        struct SimulationReport {
+          /// Block rounds committed by all honest peers
+          size_t committed_rounds = 0;
+          /// Virtual time when the last of them was committed
+          VirtualTime duration = VirtualTime::zero();
+
+          size_t messages = 0;
+          size_t dropped_messages = 0;
+          /// Votes in all sent messages
+          size_t votes = 0;
+          /// Votes passed to crypto providers for verification
+          size_t verified_votes = 0;
+          size_t reject_outcomes = 0;
+          size_t future_outcomes = 0;
+
+          /// Time between the first vote of a block round and its commit on
+          /// the last honest peer, for each committed round
+          std::vector<VirtualTime> time_to_commit;
+
+          double roundsPerSecond() const;
+          double messagesPerRound() const;
+          double verifiedVotesPerRound() const;
+          VirtualTime meanTimeToCommit() const;
+          VirtualTime maxTimeToCommit() const;
+        };
+
+        /**
+         * Deterministic discrete-event simulation of Yac peers connected by a
+         * virtual network. All events run on the calling thread in the order
+         * of their virtual time, so the same config gives the same report.
+         */
+        class YacSimulation {
+         public:
+          explicit YacSimulation(SimulationConfig config);
+          ~YacSimulation();
+
+          /// Run the rounds and collect the report
+          SimulationReport run();
+
+         private:
+          class SimulatedNetwork;
+          class SimulatedTimer;
+          class CountingCryptoProvider;
+          struct Peer;
+
+          struct Event {
+            VirtualTime time;
+            uint64_t sequence;
+            std::function<void()> action;
+          };
+
+          struct EventOrder {
+            bool operator()(const Event &lhs, const Event &rhs) const;
+          };
+
+          struct RoundProgress {
+            VirtualTime start;
+            size_t finished_peers = 0;
+          };
+
+          void schedule(VirtualTime delay, std::function<void()> action);
+
+          void send(size_t from,
+                    const shared_model::interface::Peer &to,
+                    std::vector<VoteMessage> state);
+
+          void vote(size_t peer_index, Round round);
+
+          /// Peer got a commit of the round, or synchronized past it
+          void finishRound(size_t peer_index, BlockRoundType block_round);
+
+          bool isByzantine(size_t peer) const;
+
+          SimulationConfig config_;
+          SimulationReport report_;
+
+          VirtualTime now_;
+          uint64_t sequence_ = 0;
+          std::priority_queue<Event, std::vector<Event>, EventOrder> events_;
+          std::mt19937_64 random_;
+
+          std::vector<std::shared_ptr<shared_model::interface::Peer>> ledger_;
+          std::unordered_map<std::string, size_t> peer_by_address_;
+          std::vector<std::unique_ptr<Peer>> peers_;
+          std::map<BlockRoundType, RoundProgress> rounds_;
+        };
+
+      }  // namespace simulation
+    }    // namespace yac
+  }      // namespace consensus
+}  // namespace iroha
+
+#endif  // IROHA_YAC_SIMULATION_HPP
@@ -59,11 +59,8 @@ TEST_F(AccountAssetTxsFixture,
  * @when the user tries to retrieve a list of own asset transactions, which
  * contain a transaction with addAssetQuantity command
  * @then all transactions are shown
- *
- * TODO igor-egorov, 2018-08-21, IR-1632, wrong response (response does not
- * contain transaction with addAssetQuantity command)
  */
-TEST_F(AccountAssetTxsFixture, DISABLED_OwnTxsIncludingAddAssetQuantity) {
+TEST_F(AccountAssetTxsFixture, OwnTxsIncludingAddAssetQuantity) {
   auto tx = complete(baseTx().addAssetQuantity(kAssetId, "200.0"));
   impl_.tx_hashes_.push_back(tx.hash());
   impl_.prepareState(*this, {Role::kGetAllAccAstTxs})
@@ -82,11 +79,8 @@ TEST_F(AccountAssetTxsFixture, DISABLED_OwnTxsIncludingAddAssetQuantity) {
  * @when the user tries to retrieve a list of own asset transactions, which
  * contain a transaction with subtractAssetQuantity command
  * @then all transactions are shown
- *
- * TODO igor-egorov, 2018-08-21, IR-1632, wrong response (response does not
- * contain transaction with subtractAssetQuantity command)
  */
-TEST_F(AccountAssetTxsFixture, DISABLED_OwnTxsIncludingSubtractAssetQuantity) {
+TEST_F(AccountAssetTxsFixture, OwnTxsIncludingSubtractAssetQuantity) {
   auto tx = complete(baseTx()
                          .addAssetQuantity(kAssetId, "200.0")
                          .subtractAssetQuantity(kAssetId, "100.0"));
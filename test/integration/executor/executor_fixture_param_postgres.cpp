@@ -33,19 +33,24 @@ namespace {
                                                   // - query executor
                                                   // - resetWsv
 
-  ExecutorItfTarget createPostgresExecutorItfTarget(TestDbManager &db_manager);
+  ExecutorItfTarget createPostgresExecutorItfTarget(
+      TestDbManager &db_manager, AmountStorageMode amount_storage_mode);
 }  // namespace
 
-PostgresExecutorTestParam::PostgresExecutorTestParam() {
+PostgresExecutorTestParam::PostgresExecutorTestParam(
+    AmountStorageMode amount_storage_mode)
+    : amount_storage_mode_(amount_storage_mode) {
   auto db_manager_result = TestDbManager::createWithRandomDbName(
       kDataBaseSessionPoolSize,
-      getTestLoggerManager()->getChild("TestDbManager"));
+      getTestLoggerManager()->getChild("TestDbManager"),
+      amount_storage_mode_);
   if (auto e = resultToOptionalError(db_manager_result)) {
     throw std::runtime_error(e.value());
   }
   db_manager_ = std::move(db_manager_result).assumeValue();
 
-  executor_itf_target_ = createPostgresExecutorItfTarget(*db_manager_);
+  executor_itf_target_ =
+      createPostgresExecutorItfTarget(*db_manager_, amount_storage_mode_);
 }
 
 PostgresExecutorTestParam::~PostgresExecutorTestParam() = default;
@@ -60,6 +65,9 @@ ExecutorItfTarget PostgresExecutorTestParam::getExecutorItfParam() const {
 }
 
 std::string PostgresExecutorTestParam::toString() const {
+  if (amount_storage_mode_ == AmountStorageMode::kScaledInteger) {
+    return "PostgreSQL with integer amounts";
+  }
   return "PostgreSQL";
 }
 
@@ -82,25 +90,29 @@ namespace {
             response_factory,
         std::shared_ptr<shared_model::interface::PermissionToString>
             perm_converter,
-        logger::LoggerPtr log)
+        logger::LoggerPtr log,
+        AmountStorageMode amount_storage_mode)
         : SessionHolder(std::move(session)),
           PostgresSpecificQueryExecutor(*SessionHolder::session,
                                         *block_storage,
                                         std::move(pending_txs_storage),
                                         std::move(response_factory),
                                         std::move(perm_converter),
-                                        std::move(log)),
+                                        std::move(log),
+                                        amount_storage_mode),
           block_storage_(std::move(block_storage)) {}
 
    private:
     std::unique_ptr<BlockStorage> block_storage_;
   };
 
-  ExecutorItfTarget createPostgresExecutorItfTarget(TestDbManager &db_manager) {
+  ExecutorItfTarget createPostgresExecutorItfTarget(
+      TestDbManager &db_manager, AmountStorageMode amount_storage_mode) {
     ExecutorItfTarget target;
     target.command_executor = std::make_shared<PostgresCommandExecutor>(
         db_manager.getSession(),
-        std::make_shared<shared_model::proto::ProtoPermissionToString>());
+        std::make_shared<shared_model::proto::ProtoPermissionToString>(),
+        amount_storage_mode);
     target.query_executor =
         std::make_unique<PostgresSpecificQueryExecutorWrapper>(
             db_manager.getSession(),
@@ -110,7 +122,8 @@ namespace {
             std::make_shared<shared_model::proto::ProtoPermissionToString>(),
             getTestLoggerManager()
                 ->getChild("SpecificQueryExecutor")
-                ->getLogger());
+                ->getLogger(),
+            amount_storage_mode);
     return target;
   }
 
@@ -6,6 +6,7 @@
 #ifndef TEST_INTEGRATION_EXECUTOR_FIXTURE_PARAM_POSTGRES_HPP
 #define TEST_INTEGRATION_EXECUTOR_FIXTURE_PARAM_POSTGRES_HPP
 
+#include "ametsuchi/impl/amount_storage_mode.hpp"
 #include "integration/executor/executor_fixture_param.hpp"
 
 namespace iroha {
@@ -22,10 +23,13 @@ namespace executor_testing {
    * - gets PostgreSQL connection options
    * - creates a new working database with a random name
    * - drops the working database when the test suite is complete
+   * The account balances layout is set by amount_storage_mode.
    */
   class PostgresExecutorTestParam : public ExecutorTestParam {
    public:
-    PostgresExecutorTestParam();
+    explicit PostgresExecutorTestParam(
+        iroha::ametsuchi::AmountStorageMode amount_storage_mode =
+            iroha::ametsuchi::AmountStorageMode::kDecimal);
 
     virtual ~PostgresExecutorTestParam();
 
@@ -37,6 +41,7 @@ namespace executor_testing {
     std::string toString() const override;
 
    private:
+    const iroha::ametsuchi::AmountStorageMode amount_storage_mode_;
     std::unique_ptr<iroha::integration_framework::TestDbManager> db_manager_;
     iroha::integration_framework::ExecutorItfTarget executor_itf_target_;
   };
@@ -8,7 +8,9 @@ namespace executor_testing {
   std::vector<std::shared_ptr<ExecutorTestParam>>
   getExecutorTestParamsVector() {
     return std::vector<std::shared_ptr<ExecutorTestParam>>{
-        {std::make_shared<PostgresExecutorTestParam>()}};
+        {std::make_shared<PostgresExecutorTestParam>(),
+         std::make_shared<PostgresExecutorTestParam>(
+             iroha::ametsuchi::AmountStorageMode::kScaledInteger)}};
   }
 
   auto getExecutorTestParams()
@@ -18,6 +18,7 @@
 #include "framework/test_subscriber.hpp"
 #include "module/shared_model/builders/protobuf/test_block_builder.hpp"
 #include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+#include "tracing/hot_key_tracker.hpp"
 
 using namespace iroha::ametsuchi;
 using namespace framework::test_subscriber;
@@ -610,6 +611,37 @@ TEST_F(PreparedBlockTest, CommitPreparedStateChanged) {
   validateAccountAsset(sql_query, "admin@test", "coin#test", resultingAmount);
 }
 
+/**
+ * @given Storage with prepared state @and enabled hot key tracker
+ * @when prepared state is applied
+ * @then keys of the committed block are counted in the apply phase
+ */
+TEST_F(PreparedBlockTest, CommitPreparedRecordsAppliedKeys) {
+  iroha::tracing::HotKeyTracker::Options options;
+  options.top_k = 10;
+  auto &hot_keys = iroha::tracing::defaultHotKeyTracker();
+  hot_keys.configure(options);
+  auto block = createBlock({createAddAsset("5.00")}, 2);
+
+  auto result = temp_wsv->apply(*initial_tx);
+  ASSERT_FALSE(framework::expected::err(result));
+  storage->prepareBlock(std::move(temp_wsv));
+  ASSERT_TRUE(val(storage->commitPrepared(block)));
+
+  auto accounts = hot_keys.top(iroha::tracing::Phase::kApply,
+                               iroha::tracing::Access::kWrite,
+                               iroha::tracing::KeyKind::kAccount);
+  auto assets = hot_keys.top(iroha::tracing::Phase::kApply,
+                             iroha::tracing::Access::kWrite,
+                             iroha::tracing::KeyKind::kAsset);
+  hot_keys.configure({});
+  ASSERT_EQ(1, accounts.size());
+  EXPECT_EQ("admin@test", accounts.front().key);
+  EXPECT_EQ(1, accounts.front().count);
+  ASSERT_EQ(1, assets.size());
+  EXPECT_EQ("coin#test", assets.front().key);
+}
+
 /**
  * @given Storage with prepared state
  * @when another block is applied
@@ -0,0 +1,101 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/caching_block_storage.hpp"
+
+#include <gtest/gtest.h>
+#include "module/irohad/ametsuchi/mock_block_storage.hpp"
+#include "module/shared_model/interface_mocks.hpp"
+
+using namespace iroha::ametsuchi;
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+class CachingBlockStorageTest : public ::testing::Test {
+ public:
+  std::shared_ptr<MockBlock> makeBlock(
+      shared_model::interface::types::HeightType height) {
+    auto block = std::make_shared<NiceMock<MockBlock>>();
+    ON_CALL(*block, height()).WillByDefault(Return(height));
+    return block;
+  }
+
+ protected:
+  void SetUp() override {
+    auto storage = std::make_unique<MockBlockStorage>();
+    storage_ = storage.get();
+    caching_storage_ =
+        std::make_unique<CachingBlockStorage>(std::move(storage), capacity_);
+  }
+
+  const size_t capacity_ = 2;
+  MockBlockStorage *storage_;
+  std::unique_ptr<CachingBlockStorage> caching_storage_;
+};
+
+/**
+ * @given caching storage
+ * @when a block is inserted and then fetched
+ * @then the block is returned without querying the underlying storage
+ */
+TEST_F(CachingBlockStorageTest, FetchInserted) {
+  auto block = makeBlock(1);
+  EXPECT_CALL(*storage_, insert(_)).WillOnce(Return(true));
+  EXPECT_CALL(*storage_, fetch(_)).Times(0);
+
+  ASSERT_TRUE(caching_storage_->insert(block));
+  ASSERT_EQ(block, *caching_storage_->fetch(1));
+}
+
+/**
+ * @given caching storage
+ * @when insertion to the underlying storage fails
+ * @then the block is not cached
+ */
+TEST_F(CachingBlockStorageTest, FailedInsertIsNotCached) {
+  EXPECT_CALL(*storage_, insert(_)).WillOnce(Return(false));
+  EXPECT_CALL(*storage_, fetch(1)).WillOnce(Return(boost::none));
+
+  ASSERT_FALSE(caching_storage_->insert(makeBlock(1)));
+  ASSERT_FALSE(caching_storage_->fetch(1));
+}
+
+/**
+ * @given caching storage with capacity for two blocks
+ * @when three blocks are fetched and the first one is fetched again
+ * @then the first block is fetched from the underlying storage twice
+ * @and the most recently used block remains cached
+ */
+TEST_F(CachingBlockStorageTest, EvictsLeastRecentlyUsed) {
+  std::shared_ptr<const shared_model::interface::Block> b1 = makeBlock(1),
+                                                        b2 = makeBlock(2),
+                                                        b3 = makeBlock(3);
+  EXPECT_CALL(*storage_, fetch(1)).Times(2).WillRepeatedly(Return(b1));
+  EXPECT_CALL(*storage_, fetch(2)).WillOnce(Return(b2));
+  EXPECT_CALL(*storage_, fetch(3)).WillOnce(Return(b3));
+
+  caching_storage_->fetch(1);
+  caching_storage_->fetch(2);
+  caching_storage_->fetch(2);
+  caching_storage_->fetch(3);
+  caching_storage_->fetch(1);
+  caching_storage_->fetch(3);
+}
+
+/**
+ * @given caching storage with a cached block
+ * @when the storage is cleared
+ * @then the underlying storage is cleared and the block is fetched from it
+ */
+TEST_F(CachingBlockStorageTest, ClearDropsCache) {
+  EXPECT_CALL(*storage_, insert(_)).WillOnce(Return(true));
+  EXPECT_CALL(*storage_, clear());
+  EXPECT_CALL(*storage_, fetch(1)).WillOnce(Return(boost::none));
+
+  ASSERT_TRUE(caching_storage_->insert(makeBlock(1)));
+  caching_storage_->clear();
+  ASSERT_FALSE(caching_storage_->fetch(1));
+}
@@ -0,0 +1,129 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/postgres_block_index.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "framework/test_logger.hpp"
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+using namespace iroha::ametsuchi;
+using ::testing::_;
+using ::testing::Field;
+using ::testing::Return;
+
+namespace {
+  class MockIndexer : public Indexer {
+   public:
+    MOCK_METHOD3(committedTx,
+                 void(const shared_model::interface::types::HashType &,
+                      const shared_model::interface::types::AccountIdType &,
+                      TxPosition));
+    MOCK_METHOD1(rejectedTxHash,
+                 void(const shared_model::interface::types::HashType &));
+    MOCK_METHOD3(accountAssetTxPosition,
+                 void(const shared_model::interface::types::AccountIdType &,
+                      const shared_model::interface::types::AssetIdType &,
+                      TxPosition));
+    MOCK_METHOD0(flush, iroha::expected::Result<void, std::string>());
+  };
+
+  const std::string kCreator = "creator@test";
+  const std::string kReceiver = "receiver@test";
+  const std::string kAsset = "coin#test";
+}  // namespace
+
+class PostgresBlockIndexTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    auto indexer = std::make_unique<MockIndexer>();
+    indexer_ = indexer.get();
+    block_index_ = std::make_unique<PostgresBlockIndex>(
+        std::move(indexer), getTestLogger("BlockIndex"));
+    EXPECT_CALL(*indexer_, flush())
+        .WillOnce(Return(iroha::expected::Value<void>{}));
+  }
+
+  void index(std::vector<shared_model::proto::Transaction> txs) {
+    block_index_->index(
+        TestBlockBuilder().height(kHeight).transactions(txs).build());
+  }
+
+  const shared_model::interface::types::HeightType kHeight = 3;
+  MockIndexer *indexer_;
+  std::unique_ptr<PostgresBlockIndex> block_index_;
+};
+
+/**
+ * @given a block with two transactions
+ * @when the block is indexed
+ * @then each transaction is indexed as committed once at its position
+ */
+TEST_F(PostgresBlockIndexTest, IndexesCommittedTransactions) {
+  std::vector<shared_model::proto::Transaction> txs{
+      TestTransactionBuilder().creatorAccountId(kCreator).build(),
+      TestTransactionBuilder().creatorAccountId(kReceiver).build()};
+
+  EXPECT_CALL(*indexer_,
+              committedTx(txs[0].hash(),
+                          kCreator,
+                          Field(&Indexer::TxPosition::index, 0)));
+  EXPECT_CALL(*indexer_,
+              committedTx(txs[1].hash(),
+                          kReceiver,
+                          Field(&Indexer::TxPosition::index, 1)));
+  EXPECT_CALL(*indexer_, accountAssetTxPosition(_, _, _)).Times(0);
+
+  index(txs);
+}
+
+/**
+ * @given a transaction which transfers an asset from its creator twice
+ * @when the block is indexed
+ * @then the transaction is indexed once for the creator and the receiver
+ */
+TEST_F(PostgresBlockIndexTest, DeduplicatesAccountAssets) {
+  std::vector<shared_model::proto::Transaction> txs{
+      TestTransactionBuilder()
+          .creatorAccountId(kCreator)
+          .transferAsset(kCreator, kReceiver, kAsset, "first", "1.0")
+          .transferAsset(kCreator, kReceiver, kAsset, "second", "1.0")
+          .build()};
+
+  EXPECT_CALL(*indexer_, committedTx(_, _, _));
+  EXPECT_CALL(*indexer_, accountAssetTxPosition(kCreator, kAsset, _));
+  EXPECT_CALL(*indexer_, accountAssetTxPosition(kReceiver, kAsset, _));
+
+  index(txs);
+}
+
+/**
+ * @given transactions adding and subtracting asset quantity
+ * @when the block is indexed
+ * @then each transaction is indexed for the creator account asset
+ */
+TEST_F(PostgresBlockIndexTest, IndexesAssetQuantityCommands) {
+  std::vector<shared_model::proto::Transaction> txs{
+      TestTransactionBuilder()
+          .creatorAccountId(kCreator)
+          .addAssetQuantity(kAsset, "2.0")
+          .build(),
+      TestTransactionBuilder()
+          .creatorAccountId(kCreator)
+          .subtractAssetQuantity(kAsset, "1.0")
+          .build()};
+
+  EXPECT_CALL(*indexer_, committedTx(_, _, _)).Times(2);
+  EXPECT_CALL(*indexer_,
+              accountAssetTxPosition(
+                  kCreator, kAsset, Field(&Indexer::TxPosition::index, 0)));
+  EXPECT_CALL(*indexer_,
+              accountAssetTxPosition(
+                  kCreator, kAsset, Field(&Indexer::TxPosition::index, 1)));
+
+  index(txs);
+}
@@ -145,6 +145,30 @@ TEST_F(PostgresBlockStorageTest, FetchExisting) {
   ASSERT_EQ(block.blob(), block_var->blob());
 }
 
+/**
+ * @given initialized block storage, block with two transactions inserted
+ * @when each transaction is fetched by its index
+ * @then the same transactions are returned
+ * @and fetching a transaction beyond the block returns nothing
+ */
+TEST_F(PostgresBlockStorageTest, FetchTransaction) {
+  std::vector<shared_model::proto::Transaction> txs;
+  txs.push_back(TestTransactionBuilder().creatorAccountId(creator_).build());
+  txs.push_back(
+      TestTransactionBuilder().creatorAccountId("user2@test").build());
+  auto block = TestBlockBuilder().height(height_).transactions(txs).build();
+
+  ASSERT_TRUE(block_storage_->insert(clone(block)));
+
+  for (size_t i = 0; i < txs.size(); ++i) {
+    auto tx = block_storage_->fetchTransaction(height_, i);
+    ASSERT_TRUE(tx);
+    ASSERT_EQ(txs[i], **tx);
+  }
+  ASSERT_FALSE(block_storage_->fetchTransaction(height_, txs.size()));
+  ASSERT_FALSE(block_storage_->fetchTransaction(height_ + 1, 0));
+}
+
 /**
  * @given initialized block storage without blocks
  * @when block with height_ is fetched
@@ -15,6 +15,7 @@
 #include "module/irohad/common/validators_config.hpp"
 #include "module/shared_model/interface_mocks.hpp"
 #include "module/shared_model/mock_objects_factories/mock_command_factory.hpp"
+#include "tracing/hot_key_tracker.hpp"
 
 using namespace common_constants;
 
@@ -2104,5 +2105,165 @@ namespace iroha {
       ASSERT_EQ(setting_value.get(), value);
     }
 
+    class HotKeysTest : public CommandExecutorTest {
+     public:
+      void SetUp() override {
+        CommandExecutorTest::SetUp();
+        account2_id = "id2@" + domain_id;
+
+        createDefaultRole();
+        createDefaultDomain();
+        createDefaultAccount();
+        CHECK_SUCCESSFUL_RESULT(
+            execute(*mock_command_factory->constructCreateAccount(
+                        "id2", domain_id, *pubkey),
+                    true));
+        addAllPerms();
+        addAllPerms(account2_id, "all2");
+        addAsset();
+        CHECK_SUCCESSFUL_RESULT(
+            execute(*mock_command_factory->constructAddAssetQuantity(
+                        asset_id, asset_amount_one_zero),
+                    true));
+
+        tracing::HotKeyTracker::Options options;
+        options.top_k = 10;
+        tracing::defaultHotKeyTracker().configure(options);
+      }
+
+      void TearDown() override {
+        tracing::defaultHotKeyTracker().configure({});
+        CommandExecutorTest::TearDown();
+      }
+
+      /// @return keys counted during validation
+      static std::vector<std::string> keys(tracing::Access access,
+                                           tracing::KeyKind kind) {
+        std::vector<std::string> keys;
+        for (const auto &hot_key : tracing::defaultHotKeyTracker().top(
+                 tracing::Phase::kValidation, access, kind)) {
+          keys.push_back(hot_key.key);
+        }
+        return keys;
+      }
+
+      static std::vector<std::string> writtenAccounts() {
+        return keys(tracing::Access::kWrite, tracing::KeyKind::kAccount);
+      }
+
+      static std::vector<std::string> writtenAssets() {
+        return keys(tracing::Access::kWrite, tracing::KeyKind::kAsset);
+      }
+
+      shared_model::interface::types::AssetIdType asset_id =
+          "coin#" + domain_id;
+      shared_model::interface::types::AccountIdType account2_id;
+    };
+
+    /**
+     * @given hot key tracker
+     * @when transfer is validated
+     * @then balances of both accounts are counted as written
+     * @and the creator is counted as read
+     */
+    TEST_F(HotKeysTest, TransferRecordsBothBalances) {
+      CHECK_SUCCESSFUL_RESULT(
+          execute(*mock_command_factory->constructTransferAsset(
+              account_id, account2_id, asset_id, "", asset_amount_one_zero)));
+
+      EXPECT_THAT(writtenAccounts(),
+                  ::testing::UnorderedElementsAre(account_id, account2_id));
+      EXPECT_THAT(writtenAssets(), ::testing::ElementsAre(asset_id));
+      EXPECT_THAT(keys(tracing::Access::kRead, tracing::KeyKind::kAccount),
+                  ::testing::ElementsAre(account_id));
+    }
+
+    /**
+     * @given hot key tracker
+     * @when asset quantity is added
+     * @then the balance of the creator is counted as written
+     */
+    TEST_F(HotKeysTest, AddAssetQuantityRecordsCreatorBalance) {
+      CHECK_SUCCESSFUL_RESULT(
+          execute(*mock_command_factory->constructAddAssetQuantity(
+              asset_id, asset_amount_one_zero)));
+
+      EXPECT_THAT(writtenAccounts(), ::testing::ElementsAre(account_id));
+      EXPECT_THAT(writtenAssets(), ::testing::ElementsAre(asset_id));
+    }
+
+    /**
+     * @given hot key tracker
+     * @when account and asset are created
+     * @then the new account and asset are counted as written
+     */
+    TEST_F(HotKeysTest, CreateRecordsNewKeys) {
+      CHECK_SUCCESSFUL_RESULT(
+          execute(*mock_command_factory->constructCreateAccount(
+              "id3", domain_id, *pubkey)));
+      CHECK_SUCCESSFUL_RESULT(execute(
+          *mock_command_factory->constructCreateAsset("bar", domain_id, 1)));
+
+      EXPECT_THAT(writtenAccounts(),
+                  ::testing::ElementsAre("id3@" + domain_id));
+      EXPECT_THAT(writtenAssets(),
+                  ::testing::ElementsAre("bar#" + domain_id));
+    }
+
+    /**
+     * @given hot key tracker
+     * @when account detail is set
+     * @then the account of the detail is counted as written
+     */
+    TEST_F(HotKeysTest, SetAccountDetailRecordsTargetAccount) {
+      CHECK_SUCCESSFUL_RESULT(
+          execute(*mock_command_factory->constructSetAccountDetail(
+              account2_id, "key", "value")));
+
+      EXPECT_THAT(writtenAccounts(), ::testing::ElementsAre(account2_id));
+      EXPECT_THAT(writtenAssets(), ::testing::IsEmpty());
+    }
+
+    /**
+     * @given hot key tracker
+     * @when domain is created
+     * @then no accounts and assets are counted as written
+     * @and the creator is counted as read
+     */
+    TEST_F(HotKeysTest, CreateDomainRecordsOnlyCreator) {
+      CHECK_SUCCESSFUL_RESULT(execute(
+          *mock_command_factory->constructCreateDomain("domain2", role)));
+
+      EXPECT_THAT(writtenAccounts(), ::testing::IsEmpty());
+      EXPECT_THAT(writtenAssets(), ::testing::IsEmpty());
+      EXPECT_THAT(keys(tracing::Access::kRead, tracing::KeyKind::kAccount),
+                  ::testing::ElementsAre(account_id));
+    }
+
+    /**
+     * @given hot key tracker
+     * @when command is executed without validation
+     * @then no keys are counted, since committed blocks are counted by the
+     * storage
+     */
+    TEST_F(HotKeysTest, NotRecordedWithoutValidation) {
+      CHECK_SUCCESSFUL_RESULT(
+          execute(*mock_command_factory->constructTransferAsset(
+                      account_id,
+                      account2_id,
+                      asset_id,
+                      "",
+                      asset_amount_one_zero),
+                  true));
+
+      for (auto phase : {tracing::Phase::kValidation, tracing::Phase::kApply}) {
+        EXPECT_TRUE(tracing::defaultHotKeyTracker()
+                        .top(phase,
+                             tracing::Access::kWrite,
+                             tracing::KeyKind::kAccount)
+                        .empty());
+      }
+    }
+
   }  // namespace ametsuchi
 }  // namespace iroha
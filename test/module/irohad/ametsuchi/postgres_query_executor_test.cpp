@@ -705,18 +705,16 @@ namespace iroha {
       // create valid transactions and commit them
       void createTransactionsAndCommit(size_t transactions_amount) {
         addPerms(Impl::getUserPermissions());
+        Impl::prepareState(*this, transactions_amount);
 
-        auto initial_txs = Impl::makeInitialTransactions(transactions_amount);
         auto target_txs = Impl::makeTargetTransactions(transactions_amount);
 
         tx_hashes_.reserve(target_txs.size());
-        initial_txs.reserve(initial_txs.size() + target_txs.size());
         for (auto &tx : target_txs) {
           tx_hashes_.emplace_back(tx.hash());
-          initial_txs.emplace_back(std::move(tx));
         }
 
-        auto block = createBlock(initial_txs, 1);
+        auto block = createBlock(target_txs, 1);
 
         apply(storage, block);
       }
@@ -794,10 +792,8 @@ namespace iroha {
         return {permissions::Role::kSetDetail, permissions::Role::kGetMyAccTxs};
       }
 
-      static std::vector<shared_model::proto::Transaction>
-      makeInitialTransactions(size_t transactions_amount) {
-        return {};
-      }
+      template <typename Fixture>
+      static void prepareState(Fixture &fixture, size_t transactions_amount) {}
 
       static auto makeTargetTransactions(size_t transactions_amount) {
         std::vector<shared_model::proto::Transaction> transactions;
@@ -839,15 +835,20 @@ namespace iroha {
                 permissions::Role::kGetMyAccAstTxs};
       }
 
-      static std::vector<shared_model::proto::Transaction>
-      makeInitialTransactions(size_t transactions_amount) {
-        return {
-            TestTransactionBuilder()
-                .creatorAccountId(account_id)
-                .createdTime(iroha::time::now())
-                .addAssetQuantity(
-                    asset_id, assetAmount(transactions_amount, kAssetPrecision))
-                .build()};
+      /// Issue the transferred amount directly to WSV, as the asset quantity
+      /// commands in blocks get to the account asset transactions as well
+      template <typename Fixture>
+      static void prepareState(Fixture &fixture, size_t transactions_amount) {
+        if (transactions_amount == 0) {
+          return;
+        }
+        fixture.execute(
+            *fixture.mock_command_factory->constructAddAssetQuantity(
+                asset_id,
+                shared_model::interface::Amount{
+                    assetAmount(transactions_amount, kAssetPrecision)}),
+            true,
+            account_id);
       }
 
       static auto makeTargetTransactions(size_t transactions_amount) {
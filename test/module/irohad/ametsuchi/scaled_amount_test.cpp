@@ -0,0 +1,52 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/scaled_amount.hpp"
+
+#include <gtest/gtest.h>
+#include "interfaces/common_objects/amount.hpp"
+
+using namespace iroha::ametsuchi;
+using shared_model::interface::Amount;
+
+/**
+ * @given amounts of different precision
+ * @when they are converted to scaled integers
+ * @then the decimal separator and leading zeroes are removed
+ */
+TEST(ScaledAmountTest, ToScaledInteger) {
+  EXPECT_EQ(toScaledIntegerString(Amount("123")), "123");
+  EXPECT_EQ(toScaledIntegerString(Amount("1.50")), "150");
+  EXPECT_EQ(toScaledIntegerString(Amount("0.001")), "1");
+  EXPECT_EQ(toScaledIntegerString(Amount("0.00")), "0");
+}
+
+/**
+ * @given scaled integer balances
+ * @when they are converted back with a precision
+ * @then the decimal representation has exactly that many fractional digits
+ */
+TEST(ScaledAmountTest, FromScaledInteger) {
+  EXPECT_EQ(fromScaledIntegerString("123", 0), "123");
+  EXPECT_EQ(fromScaledIntegerString("150", 2), "1.50");
+  EXPECT_EQ(fromScaledIntegerString("1", 3), "0.001");
+  EXPECT_EQ(fromScaledIntegerString("0", 2), "0.00");
+  EXPECT_EQ(fromScaledIntegerString("15", 2), "0.15");
+}
+
+/**
+ * @given an amount
+ * @when it is scaled and converted back with its own precision
+ * @then the result equals the original amount
+ */
+TEST(ScaledAmountTest, RoundTrip) {
+  for (const auto &repr : {"0.1", "10.00", "123456789.987654321", "7"}) {
+    Amount amount(repr);
+    EXPECT_EQ(Amount(fromScaledIntegerString(toScaledIntegerString(amount),
+                                             amount.precision())),
+              amount)
+        << repr;
+  }
+}
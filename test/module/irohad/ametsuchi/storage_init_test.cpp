@@ -160,3 +160,35 @@ TEST_F(StorageInitTest, CreateStorageWithInvalidPgOpt) {
   pool.match([](const auto &) { FAIL() << "storage created, but should not"; },
              [](const auto &) { SUCCEED(); });
 }
+
+/**
+ * @given database of the schema without transaction counts by creator
+ * @when tables are prepared twice
+ * @then the counts are filled from the transaction positions once
+ */
+TEST_F(StorageInitTest, TxCountByCreatorBackfilled) {
+  {
+    soci::session sql(*soci::factory_postgresql(), pg_opt_without_dbname_);
+    sql << "CREATE DATABASE " + dbname_;
+  }
+  soci::session sql(*soci::factory_postgresql(), pgopt_);
+  PgConnectionInit::prepareTables(sql);
+  // schema before the counts were added
+  sql << "DELETE FROM schema_version";
+  sql << "INSERT INTO tx_position_by_creator(creator_id, height, index) "
+         "VALUES ('a@test', 1, 0), ('a@test', 2, 0), ('b@test', 2, 1)";
+
+  PgConnectionInit::prepareTables(sql);
+  // counted by the indexer after the upgrade
+  sql << "UPDATE tx_count_by_creator SET count = 3 "
+         "WHERE creator_id = 'a@test'";
+  PgConnectionInit::prepareTables(sql);
+
+  long long a_count = 0, b_count = 0;
+  sql << "SELECT count FROM tx_count_by_creator WHERE creator_id = 'a@test'",
+      soci::into(a_count);
+  sql << "SELECT count FROM tx_count_by_creator WHERE creator_id = 'b@test'",
+      soci::into(b_count);
+  EXPECT_EQ(3, a_count);
+  EXPECT_EQ(1, b_count);
+}
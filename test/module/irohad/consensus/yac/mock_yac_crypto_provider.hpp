@@ -48,6 +48,10 @@ namespace iroha {
           return vote;
         }
 
+        void setVoting(const Round &,
+                       const std::vector<shared_model::crypto::PublicKey> &)
+            override {}
+
         VoteMessage getVote(YacHash hash, std::string pub_key) {
           VoteMessage vote;
           vote.hash = std::move(hash);
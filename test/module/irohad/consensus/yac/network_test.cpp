@@ -84,6 +84,106 @@ namespace iroha {
         ASSERT_EQ(request.votes_size(), 1);
       }
 
+      /**
+       * @given initialized network with default options
+       * @when send votes of several peers for the same hash
+       * @then the votes are sent as they are, so that peers of older versions
+       * can read them
+       */
+      TEST_F(YacNetworkTest, VotesSentForSameHashByDefault) {
+        auto other_message = message;
+        other_message.hash.block_signature = createSig("other");
+        other_message.signature = createSig("other");
+
+        proto::State request;
+        auto r = std::make_unique<grpc::testing::MockClientAsyncResponseReader<
+            google::protobuf::Empty>>();
+        EXPECT_CALL(*stub, AsyncSendStateRaw(_, _, _))
+            .WillOnce(DoAll(SaveArg<1>(&request), Return(r.get())));
+
+        network->sendState(*peer, {message, other_message});
+
+        ASSERT_FALSE(request.has_certificate());
+        ASSERT_EQ(request.votes_size(), 2);
+      }
+
+      /**
+       * @given initialized network with commit certificates enabled
+       * @when send votes of several peers for the same hash
+       * @then a commit certificate is sent instead of the votes
+       * @and the received certificate is passed to the subscriber as the
+       * original votes
+       */
+      TEST_F(YacNetworkTest, CertificateSentForSameHash) {
+        network = std::make_shared<NetworkImpl>(
+            async_call,
+            [this](const shared_model::interface::Peer &) {
+              return std::unique_ptr<proto::Yac::StubInterface>(stub);
+            },
+            getTestLogger("YacNetwork"),
+            true);
+        network->subscribe(notifications);
+
+        auto other_message = message;
+        other_message.hash.block_signature = createSig("other");
+        other_message.signature = createSig("other");
+
+        proto::State request;
+        auto r = std::make_unique<grpc::testing::MockClientAsyncResponseReader<
+            google::protobuf::Empty>>();
+        EXPECT_CALL(*stub, AsyncSendStateRaw(_, _, _))
+            .WillOnce(DoAll(SaveArg<1>(&request), Return(r.get())));
+
+        network->sendState(*peer, {message, other_message});
+
+        ASSERT_EQ(request.votes_size(), 0);
+        ASSERT_TRUE(request.has_certificate());
+        ASSERT_EQ(request.certificate().votes_size(), 2);
+        // block signatures are made with the same keys as votes
+        ASSERT_TRUE(
+            request.certificate().votes(0).block_signature().pubkey().empty());
+
+        std::vector<VoteMessage> received;
+        EXPECT_CALL(*notifications, onState(_))
+            .WillOnce(SaveArg<0>(&received));
+
+        grpc::ServerContext context;
+        auto response = network->SendState(&context, &request, nullptr);
+        ASSERT_EQ(response.error_code(), grpc::StatusCode::OK);
+
+        std::vector<VoteMessage> expected{message, other_message};
+        ASSERT_EQ(received, expected);
+        ASSERT_EQ(*received.at(1).hash.block_signature,
+                  *other_message.hash.block_signature);
+      }
+
+      /**
+       * @given network, whose client factory gives a new stub each time
+       * @when votes are sent to the same peer twice
+       * @then each send uses a stub fetched from the factory for it
+       */
+      TEST_F(YacNetworkTest, StubFetchedForEachSend) {
+        auto r = std::make_unique<grpc::testing::MockClientAsyncResponseReader<
+            google::protobuf::Empty>>();
+        size_t stubs_created = 0;
+        network = std::make_shared<NetworkImpl>(
+            async_call,
+            [&](const shared_model::interface::Peer &) {
+              ++stubs_created;
+              auto stub = std::make_unique<proto::MockYacStub>();
+              EXPECT_CALL(*stub, AsyncSendStateRaw(_, _, _))
+                  .WillOnce(Return(r.get()));
+              return std::unique_ptr<proto::Yac::StubInterface>(
+                  std::move(stub));
+            },
+            getTestLogger("YacNetwork"));
+
+        network->sendState(*peer, {message});
+        network->sendState(*peer, {message});
+
+        ASSERT_EQ(stubs_created, 2);
+      }
+
       /**
        * @given initialized network
        * @when send request with one vote
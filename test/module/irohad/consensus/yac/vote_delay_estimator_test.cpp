@@ -0,0 +1,146 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/yac/impl/vote_delay_estimator.hpp"
+
+#include <gtest/gtest.h>
+
+#include "framework/test_logger.hpp"
+
+using namespace iroha::consensus;
+using namespace iroha::consensus::yac;
+using namespace std::chrono_literals;
+
+class VoteDelayEstimatorTest : public ::testing::Test {
+ public:
+  /// Send the vote to the peers one by one and get the outcome after latency
+  void round(const std::vector<std::string> &peers,
+             std::chrono::milliseconds latency) {
+    ++current_round.block_round;
+    for (const auto &peer : peers) {
+      estimator.voteSent(peer, current_round);
+    }
+    now += latency;
+    estimator.outcomeReceived(current_round);
+  }
+
+  VoteDelayEstimator::Clock::time_point now;
+  Round current_round{1, 0};
+  VoteDelayEstimator estimator{100ms,
+                               10ms,
+                               400ms,
+                               getTestLogger("VoteDelayEstimator"),
+                               [this] { return now; }};
+};
+
+/**
+ * @given estimator without samples
+ * @then the initial delay is used
+ */
+TEST_F(VoteDelayEstimatorTest, InitialDelay) {
+  EXPECT_EQ(estimator.voteDelay(), 100ms);
+  EXPECT_EQ(estimator.voteDelay("peer"), 100ms);
+  EXPECT_TRUE(estimator.estimates().empty());
+}
+
+/**
+ * @given a round, in which the vote was sent to one peer
+ * @when the outcome is received
+ * @then the delay for the peer is its latency plus four mean deviations
+ * @and the same round estimate is used for other peers
+ */
+TEST_F(VoteDelayEstimatorTest, SinglePeerRound) {
+  round({"a"}, 20ms);
+
+  // the first deviation is half of the sample
+  EXPECT_EQ(estimator.voteDelay("a"), 60ms);
+  EXPECT_EQ(estimator.voteDelay(), 60ms);
+  EXPECT_EQ(estimator.voteDelay("b"), 60ms);
+
+  auto estimates = estimator.estimates();
+  ASSERT_EQ(estimates.size(), 1);
+  EXPECT_EQ(estimates[0].peer, "a");
+  EXPECT_EQ(estimates[0].response.latency, 20ms);
+  EXPECT_EQ(estimates[0].response.deviation, 10ms);
+  EXPECT_EQ(estimates[0].response.samples, 1);
+}
+
+/**
+ * @given peer with stable latency
+ * @when many rounds complete
+ * @then the deviation decays and the delay approaches the latency
+ */
+TEST_F(VoteDelayEstimatorTest, StableLatencyConverges) {
+  for (int i = 0; i < 50; ++i) {
+    round({"a"}, 30ms);
+  }
+  EXPECT_EQ(estimator.voteDelay("a"), 30ms);
+}
+
+/**
+ * @given a round, in which the vote was passed to several peers
+ * @when the outcome is received
+ * @then only the round latency of the first leader is updated
+ */
+TEST_F(VoteDelayEstimatorTest, PassedVoteIsNotResponseSample) {
+  round({"a", "b"}, 120ms);
+
+  auto estimates = estimator.estimates();
+  ASSERT_EQ(estimates.size(), 1);
+  EXPECT_EQ(estimates[0].peer, "a");
+  EXPECT_EQ(estimates[0].response.samples, 0);
+  EXPECT_EQ(estimates[0].round.samples, 1);
+  EXPECT_EQ(estimates[0].round.latency, 120ms);
+
+  // peers without own response samples use the round estimate, bounded
+  EXPECT_EQ(estimator.voteDelay("a"), 360ms);
+  round({"c"}, 200ms);
+  EXPECT_EQ(estimator.voteDelay("c"), 400ms);
+}
+
+/**
+ * @given a peer, which led a round with the vote passed on
+ * @and a faster round led by another peer
+ * @then the delay for the first peer is derived from its own rounds
+ * @and peers without samples use the rounds of all peers
+ */
+TEST_F(VoteDelayEstimatorTest, PeerRoundsPreferredOverAllRounds) {
+  round({"a", "b"}, 120ms);
+  round({"c"}, 20ms);
+
+  EXPECT_EQ(estimator.voteDelay("a"), 360ms);
+  // mean 107.5 ms and deviation 70 ms of both rounds
+  EXPECT_EQ(estimator.voteDelay("b"), 388ms);
+  EXPECT_EQ(estimator.voteDelay("c"), 60ms);
+}
+
+/**
+ * @given very fast peer
+ * @then its delay is not less than the lower bound
+ */
+TEST_F(VoteDelayEstimatorTest, LowerBound) {
+  round({"a"}, 1ms);
+  EXPECT_EQ(estimator.voteDelay("a"), 10ms);
+}
+
+/**
+ * @given a round in progress
+ * @when the outcome of another round, or a repeated outcome, is received
+ * @then no samples are taken
+ */
+TEST_F(VoteDelayEstimatorTest, OtherRoundOutcomeIgnored) {
+  estimator.voteSent("a", Round{5, 0});
+  now += 10ms;
+  estimator.outcomeReceived(Round{4, 0});
+  EXPECT_TRUE(estimator.estimates().empty());
+
+  estimator.outcomeReceived(Round{5, 0});
+  now += 10ms;
+  estimator.outcomeReceived(Round{5, 0});
+  auto estimates = estimator.estimates();
+  ASSERT_EQ(estimates.size(), 1);
+  EXPECT_EQ(estimates[0].response.samples, 1);
+  EXPECT_EQ(estimates[0].response.latency, 10ms);
+}
@@ -102,3 +102,22 @@ TEST_F(YacBlockStorageTest, YacBlockStorageWhenIsContains) {
   ASSERT_TRUE(storage.isContains(valid_votes.at(0)));
   ASSERT_FALSE(storage.isContains(valid_votes.at(3)));
 }
+
+/**
+ * @given storage with some votes
+ * @when the same votes are inserted again
+ * @then the storage keeps a single copy of each vote
+ * @and a vote for another hash is not contained in the storage
+ */
+TEST_F(YacBlockStorageTest, YacBlockStorageWhenDuplicateVotes) {
+  storage.insert(valid_votes.at(0));
+  storage.insert(valid_votes.at(1));
+  storage.insert(valid_votes.at(0));
+  storage.insert({valid_votes.at(1), valid_votes.at(1)});
+
+  ASSERT_EQ(2, storage.getNumberOfVotes());
+
+  auto other_hash_vote = valid_votes.at(0);
+  other_hash_vote.hash.vote_hashes.block_hash = "other commit";
+  ASSERT_FALSE(storage.isContains(other_hash_vote));
+}
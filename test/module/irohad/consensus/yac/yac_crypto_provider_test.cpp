@@ -31,6 +31,7 @@ namespace iroha {
 
         void SetUp() override {
           crypto_provider = std::make_shared<CryptoProviderImpl>(keypair);
+          crypto_provider->setVoting(Round{1, 1}, {keypair.publicKey()});
         }
 
         std::unique_ptr<shared_model::interface::Signature> makeSignature(
@@ -75,6 +76,99 @@ namespace iroha {
         ASSERT_FALSE(crypto_provider->verify({vote}));
       }
 
+      /**
+       * @given a vote which is already verified
+       * @when the vote is verified again alone and in a bundle with a
+       * repeated copy of it
+       * @then verification succeeds
+       */
+      TEST_F(YacCryptoProviderTest, ValidWhenVerifiedAgain) {
+        YacHash hash(Round{1, 1}, "1", "1");
+
+        hash.block_signature = makeSignature();
+
+        auto vote = crypto_provider->getVote(hash);
+
+        ASSERT_TRUE(crypto_provider->verify({vote}));
+        ASSERT_TRUE(crypto_provider->verify({vote}));
+        ASSERT_TRUE(crypto_provider->verify({vote, vote}));
+      }
+
+      /**
+       * @given a vote which is already verified
+       * @when the same signature is presented with a changed message, alone
+       * or in a bundle with the verified vote
+       * @then verification fails
+       */
+      TEST_F(YacCryptoProviderTest, InvalidWhenVerifiedMessageChanged) {
+        YacHash hash(Round{1, 1}, "1", "1");
+
+        hash.block_signature = makeSignature();
+
+        auto vote = crypto_provider->getVote(hash);
+        ASSERT_TRUE(crypto_provider->verify({vote}));
+
+        auto changed_vote = vote;
+        changed_vote.hash.vote_hashes.block_hash = "hash changed";
+
+        ASSERT_FALSE(crypto_provider->verify({changed_vote}));
+        ASSERT_FALSE(crypto_provider->verify({vote, changed_vote}));
+      }
+
+      /**
+       * @given a vote of a peer, which is not a ledger peer, and a vote of a
+       * round far from the current one
+       * @when the votes are verified several times
+       * @then verification succeeds each time, and fails for changed votes
+       */
+      TEST_F(YacCryptoProviderTest, ValidWhenVoteIsNotRemembered) {
+        crypto_provider->setVoting(Round{1, 1}, {});
+
+        YacHash hash(Round{1, 1}, "1", "1");
+        hash.block_signature = makeSignature();
+        auto unknown_peer_vote = crypto_provider->getVote(hash);
+
+        YacHash far_hash(Round{10, 1}, "1", "1");
+        far_hash.block_signature = makeSignature();
+        auto far_vote = crypto_provider->getVote(far_hash);
+
+        for (auto &vote : {unknown_peer_vote, far_vote}) {
+          ASSERT_TRUE(crypto_provider->verify({vote}));
+          ASSERT_TRUE(crypto_provider->verify({vote}));
+
+          auto changed_vote = vote;
+          changed_vote.hash.vote_hashes.block_hash = "hash changed";
+          ASSERT_FALSE(crypto_provider->verify({changed_vote}));
+        }
+      }
+
+      /**
+       * @given a vote which is verified in an old round
+       * @when votes of several newer rounds are verified and the old vote is
+       * changed
+       * @then verification of the changed vote fails
+       */
+      TEST_F(YacCryptoProviderTest, InvalidWhenOldRoundMessageChanged) {
+        YacHash hash(Round{1, 1}, "1", "1");
+
+        hash.block_signature = makeSignature();
+
+        auto vote = crypto_provider->getVote(hash);
+        ASSERT_TRUE(crypto_provider->verify({vote}));
+
+        for (shared_model::interface::types::HeightType height = 2; height < 10;
+             ++height) {
+          YacHash next_hash(Round{height, 1}, "1", "1");
+          next_hash.block_signature = makeSignature();
+          ASSERT_TRUE(
+              crypto_provider->verify({crypto_provider->getVote(next_hash)}));
+        }
+
+        ASSERT_TRUE(crypto_provider->verify({vote}));
+        vote.hash.vote_hashes.proposal_hash = "hash changed";
+        ASSERT_FALSE(crypto_provider->verify({vote}));
+      }
+
     }  // namespace yac
   }    // namespace consensus
 }  // namespace iroha
@@ -0,0 +1,93 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "framework/yac_simulation/yac_simulation.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace iroha::consensus::yac::simulation;
+using namespace std::chrono_literals;
+
+/**
+ * @given simulation of honest peers connected by a reliable network
+ * @when the simulation is run
+ * @then all rounds are committed without rejects
+ * @and no vote is passed to the next peer by the timer
+ */
+TEST(YacSimulationTest, HonestPeersCommitAllRounds) {
+  SimulationConfig config;
+  config.peers = 7;
+  config.rounds = 5;
+  config.latency = 2ms;
+
+  auto report = YacSimulation(config).run();
+
+  EXPECT_EQ(report.committed_rounds, config.rounds);
+  EXPECT_EQ(report.reject_outcomes, 0);
+  EXPECT_EQ(report.dropped_messages, 0);
+  // the leader starts the next round up to one delivery earlier than others
+  EXPECT_LE(report.maxTimeToCommit(), 3 * config.latency);
+}
+
+/**
+ * @given simulation with lossy network and jitter
+ * @when it is run twice with the same seed
+ * @then the reports are the same
+ */
+TEST(YacSimulationTest, SameSeedSameReport) {
+  SimulationConfig config;
+  config.peers = 10;
+  config.rounds = 5;
+  config.jitter = 5ms;
+  config.loss = 0.1;
+
+  auto first = YacSimulation(config).run();
+  auto second = YacSimulation(config).run();
+
+  EXPECT_EQ(first.committed_rounds, config.rounds);
+  EXPECT_EQ(first.messages, second.messages);
+  EXPECT_EQ(first.dropped_messages, second.dropped_messages);
+  EXPECT_EQ(first.verified_votes, second.verified_votes);
+  EXPECT_EQ(first.time_to_commit, second.time_to_commit);
+}
+
+/**
+ * @given simulation with the maximal number of byzantine peers tolerated by
+ * BFT consistency model
+ * @when the simulation is run with silent and with equivocating byzantine
+ * peers
+ * @then honest peers commit all rounds
+ */
+TEST(YacSimulationTest, ByzantinePeersTolerated) {
+  for (auto behaviour :
+       {ByzantineBehaviour::kSilent, ByzantineBehaviour::kEquivocating}) {
+    SimulationConfig config;
+    config.peers = 10;
+    config.byzantine_peers = 3;
+    config.byzantine_behaviour = behaviour;
+    config.rounds = 5;
+
+    auto report = YacSimulation(config).run();
+
+    EXPECT_EQ(report.committed_rounds, config.rounds);
+  }
+}
+
+/**
+ * @given simulation with more silent peers than BFT model tolerates
+ * @when the simulation is run
+ * @then no round is committed before the time limit
+ */
+TEST(YacSimulationTest, TooManySilentPeers) {
+  SimulationConfig config;
+  config.peers = 4;
+  config.byzantine_peers = 2;
+  config.rounds = 1;
+  config.time_limit = 10s;
+
+  auto report = YacSimulation(config).run();
+
+  EXPECT_EQ(report.committed_rounds, 0);
+}
@@ -0,0 +1,187 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "logger/async_log_writer.hpp"
+
+#include <future>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "logger/logger.hpp"
+
+using logger::AsyncLogWriter;
+
+class AsyncLogWriterTest : public ::testing::Test {
+ public:
+  AsyncLogWriter::Options options(AsyncLogWriter::OverflowPolicy overflow) {
+    AsyncLogWriter::Options options;
+    options.capacity = 2;
+    options.overflow = overflow;
+    return options;
+  }
+
+  /// Occupy the writer thread until release() is called
+  void stall(AsyncLogWriter &writer) {
+    std::promise<void> started;
+    auto started_future = started.get_future();
+    auto released = released_.get_future().share();
+    ASSERT_TRUE(writer.push([&started, released] {
+      started.set_value();
+      released.wait();
+    }));
+    started_future.wait();
+  }
+
+  void release() {
+    released_.set_value();
+  }
+
+ private:
+  std::promise<void> released_;
+};
+
+/**
+ * @given writer
+ * @when several threads push writes
+ * @then all writes run, in the order of each thread
+ */
+TEST_F(AsyncLogWriterTest, RunsWritesInOrder) {
+  constexpr size_t kThreads = 4, kWrites = 10000;
+  AsyncLogWriter::Options options;
+  options.capacity = 64;
+  options.overflow = AsyncLogWriter::OverflowPolicy::kBlock;
+  AsyncLogWriter writer(options);
+
+  std::vector<std::vector<size_t>> written(kThreads);
+  std::vector<std::thread> threads;
+  for (size_t thread = 0; thread < kThreads; ++thread) {
+    threads.emplace_back([&, thread] {
+      for (size_t i = 0; i < kWrites; ++i) {
+        writer.push([&written, thread, i] { written[thread].push_back(i); });
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  writer.flush();
+
+  for (const auto &thread_written : written) {
+    ASSERT_EQ(thread_written.size(), kWrites);
+    for (size_t i = 0; i < kWrites; ++i) {
+      ASSERT_EQ(thread_written[i], i);
+    }
+  }
+  EXPECT_EQ(writer.dropped(), 0);
+}
+
+/**
+ * @given writer dropping writes on overflow, with a stalled writer thread
+ * @when more writes are pushed than the queue holds
+ * @then the excess writes are dropped and counted
+ */
+TEST_F(AsyncLogWriterTest, DropsOnOverflow) {
+  AsyncLogWriter writer(options(AsyncLogWriter::OverflowPolicy::kDrop));
+  stall(writer);
+
+  size_t written = 0;
+  EXPECT_TRUE(writer.push([&written] { ++written; }));
+  EXPECT_TRUE(writer.push([&written] { ++written; }));
+  EXPECT_FALSE(writer.push([&written] { ++written; }));
+  release();
+  writer.flush();
+
+  EXPECT_EQ(written, 2);
+  EXPECT_EQ(writer.dropped(), 1);
+}
+
+/**
+ * @given writer blocking on overflow, with a stalled writer thread
+ * @when more writes are pushed than the queue holds
+ * @then the producer waits until the writer makes room, and nothing is lost
+ */
+TEST_F(AsyncLogWriterTest, BlocksOnOverflow) {
+  AsyncLogWriter writer(options(AsyncLogWriter::OverflowPolicy::kBlock));
+  stall(writer);
+
+  size_t written = 0;
+  std::atomic<bool> pushed{false};
+  std::thread producer([&] {
+    for (size_t i = 0; i < 3; ++i) {
+      writer.push([&written] { ++written; });
+    }
+    pushed = true;
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_FALSE(pushed);
+  release();
+  producer.join();
+  writer.flush();
+
+  EXPECT_EQ(written, 3);
+  EXPECT_EQ(writer.dropped(), 0);
+}
+
+/**
+ * @given writer with queued writes
+ * @when it is destroyed
+ * @then the queued writes are completed
+ */
+TEST_F(AsyncLogWriterTest, CompletesWritesOnDestruction) {
+  size_t written = 0;
+  {
+    AsyncLogWriter writer;
+    for (size_t i = 0; i < 100; ++i) {
+      writer.push([&written] { ++written; });
+    }
+  }
+  EXPECT_EQ(written, 100);
+}
+
+/// Sink saving the written messages
+class SavingSink : public logger::LogSink {
+ public:
+  void write(logger::LogMessage &message) const override {
+    if (message.format) {
+      message.text = message.format();
+    }
+    written.push_back(message);
+  }
+
+  mutable std::vector<logger::LogMessage> written;
+};
+
+/**
+ * @given writer
+ * @when messages with text and with deferred formatting are pushed
+ * @then they are written to the sink in order, with the time and the thread
+ * set by the producer
+ */
+TEST_F(AsyncLogWriterTest, WritesMessagesToSink) {
+  auto sink = std::make_shared<SavingSink>();
+  AsyncLogWriter writer;
+
+  logger::LogMessage message;
+  message.sink = sink;
+  message.level = logger::LogLevel::kInfo;
+  message.time =
+      std::chrono::system_clock::time_point{} + std::chrono::hours(1);
+  message.thread_id = 42;
+  message.text = "text";
+  EXPECT_TRUE(writer.push(message));
+  message.text.clear();
+  message.format = [] { return std::string("formatted"); };
+  EXPECT_TRUE(writer.push(message));
+  writer.flush();
+
+  ASSERT_EQ(sink->written.size(), 2);
+  EXPECT_EQ(sink->written[0].text, "text");
+  EXPECT_EQ(sink->written[1].text, "formatted");
+  for (const auto &written : sink->written) {
+    EXPECT_EQ(written.level, logger::LogLevel::kInfo);
+    EXPECT_EQ(written.time, message.time);
+    EXPECT_EQ(written.thread_id, 42);
+  }
+}
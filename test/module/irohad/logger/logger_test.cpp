@@ -4,6 +4,7 @@
  */
 
 #include <gtest/gtest.h>
+#include "logger/async_log_writer.hpp"
 #include "logger/logger_manager.hpp"
 
 TEST(LoggerTest, basicStandaloneLoggerTest) {
@@ -21,3 +22,44 @@ TEST(LoggerTest, boolReprTest) {
   ASSERT_EQ("true", logger::boolRepr(true));
   ASSERT_EQ("false", logger::boolRepr(false));
 }
+
+/**
+ * @given logger with info level
+ * @when lazy arguments are logged with debug and info levels
+ * @then only the info one is computed
+ */
+TEST(LoggerTest, lazyArgumentTest) {
+  logger::LoggerManagerTree manager(
+      logger::LoggerConfig{logger::LogLevel::kInfo, {}});
+  auto a_logger = manager.getChild("lazy logger")->getLogger();
+  bool debug_computed = false, info_computed = false;
+  a_logger->debug("{}", logger::lazy([&debug_computed] {
+                    debug_computed = true;
+                    return "debug";
+                  }));
+  a_logger->info("{}", logger::lazy([&info_computed] {
+                   info_computed = true;
+                   return "info";
+                 }));
+  EXPECT_FALSE(debug_computed);
+  EXPECT_TRUE(info_computed);
+}
+
+/**
+ * @given logger writing on a writer thread
+ * @when messages with plain and other arguments are logged
+ * @then they are written without dropping
+ */
+TEST(LoggerTest, asyncLoggerTest) {
+  auto writer = std::make_shared<logger::AsyncLogWriter>();
+  logger::LoggerManagerTree manager(
+      logger::LoggerConfig{logger::LogLevel::kInfo, {}, writer});
+  auto a_logger = manager.getChild("async logger")->getLogger();
+  a_logger->info("testing an async logger: {} {}", 1, std::string("info"));
+  a_logger->info("testing an async logger: {}", logger::lazy([] {
+                   return "formatted on the calling thread";
+                 }));
+  a_logger->error("testing an async logger: bad format {}");
+  writer->flush();
+  EXPECT_EQ(writer->dropped(), 0);
+}
@@ -105,8 +105,8 @@ TEST(CompleterTest, BatchExpirationTestExpired) {
   auto tx3 = std::make_shared<MockTransaction>();
   EXPECT_CALL(*tx3, createdTime()).WillRepeatedly(Return(time));
   auto batch = createMockBatchWithTransactions({tx1, tx2, tx3}, "");
-  ASSERT_TRUE(completer->isExpired(
-      batch, time + std::chrono::minutes(2) / std::chrono::milliseconds(1)));
+  ASSERT_LT(completer->expirationTime(oldestTimestamp(batch)),
+            time + std::chrono::minutes(2) / std::chrono::milliseconds(1));
 }
 
 /**
@@ -132,5 +132,5 @@ TEST(CompleterTest, BatchExpirationTestNoExpired) {
       .WillRepeatedly(Return(
           time + std::chrono::minutes(4) / std::chrono::milliseconds(1)));
   auto batch = createMockBatchWithTransactions({tx1, tx2, tx3}, "");
-  ASSERT_FALSE(completer->isExpired(batch, time));
+  ASSERT_GE(completer->expirationTime(oldestTimestamp(batch)), time);
 }
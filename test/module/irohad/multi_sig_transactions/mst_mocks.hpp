@@ -20,9 +20,10 @@ namespace iroha {
    public:
     MOCK_METHOD1(subscribe,
                  void(std::shared_ptr<network::MstTransportNotification>));
-    MOCK_METHOD2(sendState,
+    MOCK_METHOD3(sendState,
                  void(const shared_model::interface::Peer &to,
-                      const MstState &providing_state));
+                      const MstGossip &gossip,
+                      SentCallback on_sent));
   };
 
   /**
@@ -33,7 +34,7 @@ namespace iroha {
    public:
     MOCK_METHOD2(onNewState,
                  void(const shared_model::crypto::PublicKey &from,
-                      MstState state));
+                      MstGossip gossip));
   };
 
   /**
@@ -261,7 +261,7 @@ TEST_F(MstProcessorTest, onUpdateFromTransportUsecase) {
                                            std::make_shared<TestCompleter>());
   transported_state += addSignaturesFromKeyPairs(
       makeTestBatch(txBuilder(1, time_now, quorum)), 0, makeKey());
-  mst_processor->onNewState(another_peer_key, transported_state);
+  mst_processor->onNewState(another_peer_key, MstGossip{transported_state});
 
   // ---------------------------------| then |----------------------------------
   check(observers);
@@ -282,7 +282,7 @@ TEST_F(MstProcessorTest, onNewPropagationUsecase) {
   auto quorum = 2u;
   mst_processor->propagateBatch(addSignaturesFromKeyPairs(
       makeTestBatch(txBuilder(1, time_after, quorum)), 0, makeKey()));
-  EXPECT_CALL(*transport, sendState(_, _)).Times(2);
+  EXPECT_CALL(*transport, sendState(_, _, _)).Times(2);
 
   // ---------------------------------| when |----------------------------------
   std::vector<std::shared_ptr<shared_model::interface::Peer>> peers{
@@ -291,6 +291,41 @@ TEST_F(MstProcessorTest, onNewPropagationUsecase) {
   propagation_subject.get_subscriber().on_next(peers);
 }
 
+/**
+ * @given initialised mst processor
+ * AND our state contains one transaction
+ *
+ * @when the state is propagated to a peer and the sending fails
+ * @and the state is propagated to the peer again, and then once more
+ *
+ * @then the transaction is sent again after the failure @and not after the
+ * delivery
+ */
+TEST_F(MstProcessorTest, lostStatePropagatedAgain) {
+  // ---------------------------------| given |---------------------------------
+  auto quorum = 2u;
+  mst_processor->propagateBatch(addSignaturesFromKeyPairs(
+      makeTestBatch(txBuilder(1, time_after, quorum)), 0, makeKey()));
+  std::vector<std::shared_ptr<shared_model::interface::Peer>> peers{
+      makePeer("one", shared_model::interface::types::PubkeyType("sign_one"))};
+
+  // ----------------------------------| then |---------------------------------
+  EXPECT_CALL(*transport, sendState(_, _, _))
+      .WillOnce(testing::Invoke([](const auto &, const auto &gossip, auto cb) {
+        EXPECT_EQ(1, gossip.batches.getBatches().size());
+        cb(false);
+      }))
+      .WillOnce(testing::Invoke([](const auto &, const auto &gossip, auto cb) {
+        EXPECT_EQ(1, gossip.batches.getBatches().size());
+        cb(true);
+      }));
+
+  // ---------------------------------| when |----------------------------------
+  propagation_subject.get_subscriber().on_next(peers);
+  propagation_subject.get_subscriber().on_next(peers);
+  propagation_subject.get_subscriber().on_next(peers);
+}
+
 /**
  * @given initialized mst processor
  * AND our state contains one transaction
@@ -302,7 +337,7 @@ TEST_F(MstProcessorTest, onNewPropagationUsecase) {
  */
 TEST_F(MstProcessorTest, emptyStatePropagation) {
   // ---------------------------------| then |----------------------------------
-  EXPECT_CALL(*transport, sendState(_, _)).Times(0);
+  EXPECT_CALL(*transport, sendState(_, _, _)).Times(0);
 
   // ---------------------------------| given |---------------------------------
   auto another_peer = makePeer(
@@ -334,7 +369,7 @@ TEST_F(MstProcessorTest, emptyStatePropagation) {
  */
 TEST_F(MstProcessorTest, receivedOutdatedState) {
   // ---------------------------------| then |----------------------------------
-  EXPECT_CALL(*transport, sendState(_, _)).Times(0);
+  EXPECT_CALL(*transport, sendState(_, _, _)).Times(0);
   auto observers = initObservers(mst_processor, 0, 0, 0);
 
   // ---------------------------------| when |----------------------------------
@@ -343,7 +378,7 @@ TEST_F(MstProcessorTest, receivedOutdatedState) {
                                            std::make_shared<TestCompleter>());
   const auto expired_batch = makeTestBatch(txBuilder(1, time_before, 3));
   transported_state += addSignaturesFromKeyPairs(expired_batch, 0, makeKey());
-  mst_processor->onNewState(another_peer_key, transported_state);
+  mst_processor->onNewState(another_peer_key, MstGossip{transported_state});
 
   // ---------------------------------| then |----------------------------------
   EXPECT_FALSE(storage->batchInStorage(expired_batch));
@@ -370,7 +405,7 @@ TEST_F(MstProcessorTest, receivedOneOfExistingTxs) {
   received_state += batch;
   auto observers = initObservers(mst_processor, 0, 0, 0);
   shared_model::crypto::PublicKey another_peer_key("another_pubkey");
-  mst_processor->onNewState(another_peer_key, received_state);
+  mst_processor->onNewState(another_peer_key, MstGossip{received_state});
 
   check(observers);
 }
@@ -0,0 +1,354 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "multi_sig_transactions/storage/mst_state_log.hpp"
+
+#include <sys/resource.h>
+#include <csignal>
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include "backend/protobuf/proto_transport_factory.hpp"
+#include "endpoint.pb.h"
+#include "framework/result_gtest_checkers.hpp"
+#include "framework/test_logger.hpp"
+#include "interfaces/iroha_internal/transaction_batch_factory_impl.hpp"
+#include "interfaces/iroha_internal/transaction_batch_parser_impl.hpp"
+#include "module/irohad/ametsuchi/mock_tx_presence_cache.hpp"
+#include "module/irohad/common/validators_config.hpp"
+#include "module/irohad/multi_sig_transactions/mst_test_helpers.hpp"
+#include "module/shared_model/validators/validators.hpp"
+#include "multi_sig_transactions/storage/mst_storage_impl.hpp"
+#include "validators/default_validator.hpp"
+
+using namespace iroha;
+
+using ::testing::A;
+using ::testing::Invoke;
+
+class MstStateLogTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    path_ = (boost::filesystem::temp_directory_path()
+             / boost::filesystem::unique_path())
+                .string();
+  }
+
+  void TearDown() override {
+    boost::filesystem::remove(path_);
+  }
+
+  std::unique_ptr<MstStateLog> open(
+      MstStateLog::Options options = MstStateLog::Options{}) {
+    auto state_log =
+        MstStateLog::create(path_, options, getTestLogger("MstStateLog"));
+    if (auto e = expected::resultToOptionalError(state_log)) {
+      ADD_FAILURE() << *e;
+      return nullptr;
+    }
+    return std::move(state_log).assumeValue();
+  }
+
+  /// @return number of signatures of the first transaction of the record
+  static int signatures(const MstStateLog::Record &record) {
+    iroha::protocol::TxList list;
+    EXPECT_TRUE(list.ParseFromString(record.transactions));
+    return list.transactions(0).signatures_size();
+  }
+
+  std::string path_;
+  const TimeType creation_time_ = iroha::time::now();
+};
+
+/**
+ * @given log with updates of two batches, one of which is removed
+ * @when the log is reopened
+ * @then only the remaining batch is recovered with its last signatures
+ */
+TEST_F(MstStateLogTest, LiveBatchesRecovered) {
+  auto batch = makeTestBatch(txBuilder(1, creation_time_));
+  auto other_batch = makeTestBatch(txBuilder(2, creation_time_));
+  {
+    auto state_log = open();
+    EXPECT_TRUE(state_log->recovered().empty());
+    state_log->update(batch);
+    state_log->update(addSignatures(batch, 0, makeSignature("1", "pub_1")));
+    state_log->update(other_batch);
+    state_log->remove(other_batch->reducedHash());
+  }
+
+  auto state_log = open();
+  ASSERT_EQ(1, state_log->recovered().size());
+  EXPECT_EQ(batch->reducedHash(), state_log->recovered().front().reduced_hash);
+  EXPECT_EQ(1, signatures(state_log->recovered().front()));
+}
+
+/**
+ * @given log, to which an incomplete record was written
+ * @when the log is reopened
+ * @then the complete records are recovered @and the incomplete is dropped
+ */
+TEST_F(MstStateLogTest, TornTailDropped) {
+  auto batch = makeTestBatch(txBuilder(1, creation_time_));
+  {
+    auto state_log = open();
+    state_log->update(batch);
+  }
+  const auto size = boost::filesystem::file_size(path_);
+  {
+    std::ofstream file(path_, std::ios::binary | std::ios::app);
+    file << std::string("\x40\0\0\0\x01\x02", 6);
+  }
+
+  auto state_log = open();
+  ASSERT_EQ(1, state_log->recovered().size());
+  EXPECT_EQ(size, boost::filesystem::file_size(path_));
+
+  state_log->update(makeTestBatch(txBuilder(2, creation_time_)));
+  state_log.reset();
+  EXPECT_EQ(2, open()->recovered().size());
+}
+
+/**
+ * @given log of three batches, the record of the second of which is corrupted
+ * @when the log is reopened
+ * @then the first and the third batches are recovered
+ */
+TEST_F(MstStateLogTest, CorruptedRecordSkipped) {
+  auto first_batch = makeTestBatch(txBuilder(1, creation_time_));
+  auto second_batch = makeTestBatch(txBuilder(2, creation_time_));
+  auto third_batch = makeTestBatch(txBuilder(3, creation_time_));
+  size_t first_size = 0;
+  {
+    auto state_log = open();
+    state_log->update(first_batch);
+    IROHA_ASSERT_RESULT_VALUE(state_log->flush());
+    first_size = boost::filesystem::file_size(path_);
+    state_log->update(second_batch);
+    IROHA_ASSERT_RESULT_VALUE(state_log->flush());
+    state_log->update(third_batch);
+  }
+  const auto size = boost::filesystem::file_size(path_);
+  {
+    std::fstream file(path_, std::ios::binary | std::ios::in | std::ios::out);
+    file.seekg(first_size + 20);
+    const auto byte = file.get();
+    file.seekp(first_size + 20);
+    file.put(static_cast<char>(byte ^ 0xFF));
+  }
+
+  auto state_log = open();
+  ASSERT_EQ(2, state_log->recovered().size());
+  std::vector<shared_model::interface::types::HashType> hashes;
+  for (const auto &record : state_log->recovered()) {
+    hashes.push_back(record.reduced_hash);
+  }
+  EXPECT_NE(
+      hashes.end(),
+      std::find(hashes.begin(), hashes.end(), first_batch->reducedHash()));
+  EXPECT_NE(
+      hashes.end(),
+      std::find(hashes.begin(), hashes.end(), third_batch->reducedHash()));
+  EXPECT_EQ(size, boost::filesystem::file_size(path_));
+}
+
+/**
+ * @given log of two batches, between the records of which there is a large
+ * region of garbage, which looks like frame headers with bogus sizes
+ * @when the log is reopened
+ * @then the region is skipped @and both batches are recovered
+ */
+TEST_F(MstStateLogTest, LargeCorruptedRegionSkipped) {
+  size_t first_size = 0;
+  {
+    auto state_log = open();
+    state_log->update(makeTestBatch(txBuilder(1, creation_time_)));
+    IROHA_ASSERT_RESULT_VALUE(state_log->flush());
+    first_size = boost::filesystem::file_size(path_);
+    state_log->update(makeTestBatch(txBuilder(2, creation_time_)));
+  }
+  std::string contents;
+  {
+    std::ifstream file(path_, std::ios::binary);
+    contents.assign(std::istreambuf_iterator<char>(file),
+                    std::istreambuf_iterator<char>());
+  }
+  std::string garbage;
+  while (garbage.size() < (16 << 20)) {
+    garbage.append("MSL1\xF0\xFF\xFF\x0F", 8);
+  }
+  contents.insert(first_size, garbage);
+  {
+    std::ofstream file(path_, std::ios::binary | std::ios::trunc);
+    file << contents;
+  }
+
+  auto state_log = open();
+  EXPECT_EQ(2, state_log->recovered().size());
+  EXPECT_EQ(contents.size(), boost::filesystem::file_size(path_));
+}
+
+/**
+ * @given log, the file of which can not grow
+ * @when a batch is logged
+ * @then flush reports an error
+ * @when the file can grow again
+ * @then the batch is written without new records @and flush succeeds
+ */
+TEST_F(MstStateLogTest, FailedWriteRetried) {
+  MstStateLog::Options options;
+  options.retry_delay = std::chrono::milliseconds(10);
+  options.max_retry_delay = std::chrono::milliseconds(10);
+  auto state_log = open(options);
+  state_log->update(makeTestBatch(txBuilder(1, creation_time_)));
+  IROHA_ASSERT_RESULT_VALUE(state_log->flush());
+
+  rlimit limit;
+  ASSERT_EQ(0, getrlimit(RLIMIT_FSIZE, &limit));
+  const auto previous_handler = std::signal(SIGXFSZ, SIG_IGN);
+  auto file_limit = limit;
+  file_limit.rlim_cur = boost::filesystem::file_size(path_);
+  ASSERT_EQ(0, setrlimit(RLIMIT_FSIZE, &file_limit));
+  state_log->update(makeTestBatch(txBuilder(2, creation_time_)));
+  auto failed = state_log->flush();
+  setrlimit(RLIMIT_FSIZE, &limit);
+  std::signal(SIGXFSZ, previous_handler);
+  IROHA_ASSERT_RESULT_ERROR(failed);
+  EXPECT_LE(1, state_log->metrics().failures);
+
+  IROHA_ASSERT_RESULT_VALUE(state_log->flush());
+  state_log.reset();
+  EXPECT_EQ(2, open()->recovered().size());
+}
+
+/**
+ * @given log, which compacts the file as soon as it has stale records
+ * @when a batch is updated several times
+ * @then the file keeps only the last update
+ */
+TEST_F(MstStateLogTest, StaleRecordsCompacted) {
+  MstStateLog::Options options;
+  options.group_commit_delay = std::chrono::milliseconds(0);
+  options.min_compaction_size = 0;
+  options.compaction_ratio = 1;
+  auto batch = makeTestBatch(txBuilder(1, creation_time_));
+  {
+    auto state_log = open(options);
+    state_log->update(batch);
+    IROHA_ASSERT_RESULT_VALUE(state_log->flush());
+    state_log->update(addSignatures(batch, 0, makeSignature("1", "pub_1")));
+    IROHA_ASSERT_RESULT_VALUE(state_log->flush());
+
+    auto metrics = state_log->metrics();
+    EXPECT_EQ(1, metrics.compactions);
+    EXPECT_EQ(metrics.live_size, metrics.file_size);
+    EXPECT_EQ(metrics.file_size, boost::filesystem::file_size(path_));
+  }
+
+  auto state_log = open();
+  ASSERT_EQ(1, state_log->recovered().size());
+  EXPECT_EQ(1, signatures(state_log->recovered().front()));
+}
+
+/**
+ * @given storage with the log
+ * @when batches are added, completed and expire
+ * @then the log keeps only the pending batches
+ */
+TEST_F(MstStateLogTest, StorageStateLogged) {
+  auto completer = std::make_shared<TestCompleter>();
+  {
+    auto storage =
+        std::make_shared<MstStorageStateImpl>(completer,
+                                              getTestLogger("MstState"),
+                                              getTestLogger("MstStorage"),
+                                              open());
+    storage->updateOwnState(makeTestBatch(txBuilder(1, creation_time_)));
+    storage->updateOwnState(
+        makeTestBatch(txBuilder(2, creation_time_ + 1000)));
+    storage->updateOwnState(
+        makeTestBatch(txBuilder(3, creation_time_ + 1000, 1)));
+    storage->updateOwnState(
+        addSignatures(makeTestBatch(txBuilder(3, creation_time_ + 1000, 1)),
+                      0,
+                      makeSignature("1", "pub_1")));
+    ASSERT_EQ(1,
+              storage->extractExpiredTransactions(creation_time_ + 1)
+                  .getBatches()
+                  .size());
+  }
+
+  auto state_log = open();
+  ASSERT_EQ(1, state_log->recovered().size());
+  EXPECT_EQ(makeTestBatch(txBuilder(2, creation_time_ + 1000))->reducedHash(),
+            state_log->recovered().front().reduced_hash);
+}
+
+/**
+ * @given log with a pending, an expired and a committed batch
+ * @when the batches are recovered
+ * @then only the pending batch is returned
+ * @and the others are removed from the log
+ */
+TEST_F(MstStateLogTest, ExpiredAndCommittedBatchesSkipped) {
+  auto pending = makeTestBatch(txBuilder(1, creation_time_));
+  auto expired = makeTestBatch(txBuilder(2, creation_time_ - 120000));
+  auto committed = makeTestBatch(txBuilder(3, creation_time_));
+  {
+    auto state_log = open();
+    state_log->update(pending);
+    state_log->update(expired);
+    state_log->update(committed);
+  }
+
+  auto tx_factory = std::make_shared<shared_model::proto::ProtoTransportFactory<
+      shared_model::interface::Transaction,
+      shared_model::proto::Transaction>>(
+      std::make_unique<shared_model::validation::MockValidator<
+          shared_model::interface::Transaction>>(),
+      std::make_unique<shared_model::validation::MockValidator<
+          iroha::protocol::Transaction>>());
+  shared_model::interface::TransactionBatchParserImpl batch_parser;
+  shared_model::interface::TransactionBatchFactoryImpl batch_factory(
+      std::make_shared<shared_model::validation::DefaultBatchValidator>(
+          iroha::test::kTestsValidatorsConfig));
+  ametsuchi::MockTxPresenceCache tx_presence_cache;
+  EXPECT_CALL(tx_presence_cache,
+              check(A<const shared_model::interface::TransactionBatch &>()))
+      .WillRepeatedly(Invoke([&committed](const auto &batch) {
+        using namespace ametsuchi::tx_cache_status_responses;
+        const auto &hash = batch.transactions().front()->hash();
+        ametsuchi::TxPresenceCache::BatchStatusCollectionType result;
+        if (batch.reducedHash() == committed->reducedHash()) {
+          result.push_back(Committed{hash});
+        } else {
+          result.push_back(Missing{hash});
+        }
+        return boost::make_optional(result);
+      }));
+  DefaultCompleter completer(std::chrono::minutes(1));
+
+  {
+    auto state_log = open();
+    auto batches = recoverBatches(*state_log,
+                                  *tx_factory,
+                                  batch_parser,
+                                  batch_factory,
+                                  tx_presence_cache,
+                                  completer,
+                                  creation_time_,
+                                  getTestLogger("MstStateLog"));
+    ASSERT_EQ(1, batches.size());
+    EXPECT_EQ(pending->reducedHash(), batches.front()->reducedHash());
+  }
+
+  auto state_log = open();
+  ASSERT_EQ(1, state_log->recovered().size());
+  EXPECT_EQ(pending->reducedHash(),
+            state_log->recovered().front().reduced_hash);
+}
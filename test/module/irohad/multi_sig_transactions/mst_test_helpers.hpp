@@ -114,15 +114,6 @@ namespace iroha {
                            return boost::size(tx->signatures()) >= tx->quorum();
                          });
     }
-
-    bool isExpired(const DataType &batch,
-                   const TimeType &current_time) const override {
-      return std::any_of(batch->transactions().begin(),
-                         batch->transactions().end(),
-                         [&current_time](const auto &tx) {
-                           return tx->createdTime() < current_time;
-                         });
-    }
   };
 }  // namespace iroha
 
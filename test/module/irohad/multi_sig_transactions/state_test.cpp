@@ -7,6 +7,7 @@
 #include "framework/test_logger.hpp"
 #include "logger/logger.hpp"
 #include "module/irohad/multi_sig_transactions/mst_test_helpers.hpp"
+#include "multi_sig_transactions/state/mst_gossip.hpp"
 #include "multi_sig_transactions/state/mst_state.hpp"
 
 using namespace std;
@@ -377,3 +378,83 @@ TEST(StateTest, RemovingTestWhenByTimeHasExpired) {
 
   ASSERT_EQ(2, diff_state.getBatches().size());
 }
+
+/**
+ * @given state with a batch
+ * @when a valid and an invalid signature of the batch are added
+ * @then only the valid signature is inserted @and the batch is updated
+ */
+TEST(StateTest, AddSignaturesSkipsInvalid) {
+  auto state = MstState::empty(mst_state_log_, completer_);
+  auto batch = makeTestBatch(txBuilder(1, iroha::time::now()));
+  state += batch;
+
+  auto keypair = makeKey();
+  auto signed_blob = shared_model::crypto::CryptoSigner<>::sign(
+      shared_model::crypto::Blob(batch->transactions().at(0)->payload()),
+      keypair);
+  std::vector<BatchSignatures> signatures{BatchSignatures{
+      batch->reducedHash(),
+      {{DetachedSignature{keypair.publicKey(), signed_blob},
+        DetachedSignature{makeKey().publicKey(), signed_blob}}}}};
+
+  StateUpdateResult update{
+      std::make_shared<MstState>(MstState::empty(mst_state_log_, completer_)),
+      std::make_shared<MstState>(MstState::empty(mst_state_log_, completer_))};
+  state.addSignatures(signatures, update);
+
+  EXPECT_EQ(1, boost::size(batch->transactions().at(0)->signatures()));
+  EXPECT_TRUE(update.updated_state_->contains(batch));
+  EXPECT_TRUE(update.completed_state_->isEmpty());
+}
+
+/**
+ * @given state with a batch, which lacks one signature to be completed
+ * @when the signature is added
+ * @then the batch is completed and removed from the state
+ */
+TEST(StateTest, AddSignaturesCompletesBatch) {
+  auto state = MstState::empty(mst_state_log_, completer_);
+  auto batch = makeTestBatch(txBuilder(1, iroha::time::now(), 1));
+  state += batch;
+
+  auto keypair = makeKey();
+  std::vector<BatchSignatures> signatures{BatchSignatures{
+      batch->reducedHash(),
+      {{DetachedSignature{
+          keypair.publicKey(),
+          shared_model::crypto::CryptoSigner<>::sign(
+              shared_model::crypto::Blob(
+                  batch->transactions().at(0)->payload()),
+              keypair)}}}}};
+
+  StateUpdateResult update{
+      std::make_shared<MstState>(MstState::empty(mst_state_log_, completer_)),
+      std::make_shared<MstState>(MstState::empty(mst_state_log_, completer_))};
+  state.addSignatures(signatures, update);
+
+  EXPECT_TRUE(state.isEmpty());
+  EXPECT_TRUE(update.completed_state_->contains(batch));
+  EXPECT_TRUE(update.updated_state_->isEmpty());
+}
+
+/**
+ * @given state with batches, the oldest transactions of which are created at
+ * different times
+ * @when expiration time of the batches is requested
+ * @then it is computed by the completer from the oldest timestamp
+ * @and there is no expiration time for a batch out of the state
+ */
+TEST(StateTest, ExpirationTimeFromIndex) {
+  auto time = iroha::time::now();
+  auto completer = std::make_shared<DefaultCompleter>(std::chrono::minutes(1));
+  auto state = MstState::empty(mst_state_log_, completer);
+  auto batch = makeTestBatch(txBuilder(1, time), txBuilder(2, time + 5));
+  state += batch;
+
+  auto expiration_time = state.expirationTime(batch);
+  ASSERT_TRUE(expiration_time);
+  EXPECT_EQ(time + 60000, *expiration_time);
+  EXPECT_FALSE(state.expirationTime(makeTestBatch(txBuilder(3, time))));
+  EXPECT_EQ(time, oldestTimestamp(batch));
+}
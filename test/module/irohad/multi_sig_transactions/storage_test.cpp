@@ -31,6 +31,20 @@ class StorageTest : public testing::Test {
     storage->updateOwnState(makeTestBatch(txBuilder(3, creation_time)));
   }
 
+  /// Make gossip for the peer, which receives it
+  MstGossip send(const shared_model::crypto::PublicKey &peer_key) {
+    auto gossip = storage->getDiffState(peer_key, creation_time);
+    storage->gossipSent(peer_key, gossip, true);
+    return gossip;
+  }
+
+  /// @return empty gossip of a peer, which reads signatures and summaries
+  MstGossip compactGossip() {
+    MstGossip gossip{MstState::empty(getTestLogger("MstState"), completer_)};
+    gossip.compact_sender = true;
+    return gossip;
+  }
+
   std::shared_ptr<MstStorage> storage;
   const shared_model::crypto::PublicKey absent_peer_key;
 
@@ -54,7 +68,7 @@ TEST_F(StorageTest, StorageWhenApplyOtherState) {
 
   ASSERT_EQ(6,
             storage->getDiffState(absent_peer_key, creation_time)
-                .getBatches()
+                .batches.getBatches()
                 .size());
 }
 
@@ -67,7 +81,7 @@ TEST_F(StorageTest, StorageInsertOtherState) {
                 .size());
   ASSERT_EQ(0,
             storage->getDiffState(absent_peer_key, creation_time + 1)
-                .getBatches()
+                .batches.getBatches()
                 .size());
 }
 
@@ -76,7 +90,7 @@ TEST_F(StorageTest, StorageWhenCreateValidDiff) {
 
   ASSERT_EQ(3,
             storage->getDiffState(absent_peer_key, creation_time)
-                .getBatches()
+                .batches.getBatches()
                 .size());
 }
 
@@ -89,7 +103,7 @@ TEST_F(StorageTest, StorageWhenCreate) {
 
   ASSERT_EQ(0,
             storage->getDiffState(absent_peer_key, expiration_time)
-                .getBatches()
+                .batches.getBatches()
                 .size());
 }
 
@@ -117,3 +131,232 @@ TEST_F(StorageTest, StorageDoesNotFindNonExistingBatch) {
   auto distinct_batch = makeTestBatch(txBuilder(4, creation_time));
   EXPECT_FALSE(storage->batchInStorage(distinct_batch));
 }
+
+/**
+ * @given storage with three batches, which were propagated to a peer
+ * @when a new signature of one of the batches is added to the storage
+ * @then only the signature is propagated to the peer @and only once
+ */
+TEST_F(StorageTest, DiffContainsOnlyNewSignatures) {
+  const shared_model::crypto::PublicKey peer_key("peer");
+  storage->apply(peer_key, compactGossip());
+  ASSERT_EQ(3, send(peer_key).batches.getBatches().size());
+
+  auto batch = addSignatures(makeTestBatch(txBuilder(1, creation_time)),
+                             0,
+                             makeSignature("1", "1_pub_key"));
+  storage->updateOwnState(batch);
+
+  auto gossip = storage->getDiffState(peer_key, creation_time);
+  EXPECT_TRUE(gossip.batches.isEmpty());
+  ASSERT_EQ(1, gossip.signatures.size());
+  EXPECT_EQ(batch->reducedHash(), gossip.signatures.front().reduced_hash);
+  const auto &transactions = gossip.signatures.front().transactions;
+  ASSERT_EQ(1, transactions.size());
+  ASSERT_EQ(1, transactions.front().size());
+  EXPECT_EQ(shared_model::crypto::PublicKey("1_pub_key"),
+            transactions.front().front().public_key);
+
+  storage->gossipSent(peer_key, gossip, true);
+  EXPECT_TRUE(storage->getDiffState(peer_key, creation_time).isEmpty());
+}
+
+/**
+ * @given storage with three batches, which were propagated to a peer
+ * @when the peer reports a signature of a key in its summary @and a
+ * signature of another key with the same leading bytes is added to the
+ * storage
+ * @then the added signature is propagated to the peer
+ */
+TEST_F(StorageTest, SignatureOfKeyWithSamePrefixSent) {
+  const shared_model::crypto::PublicKey peer_key("peer");
+  send(peer_key);
+
+  auto batch = addSignatures(makeTestBatch(txBuilder(1, creation_time)),
+                             0,
+                             makeSignature("1", "same_prefix_key_1"));
+  auto summary = compactGossip();
+  summary.summaries.push_back(BatchSummary{
+      batch->reducedHash(),
+      {{signerKey(shared_model::crypto::PublicKey("same_prefix_key_2"))}}});
+  storage->apply(peer_key, summary);
+  storage->updateOwnState(batch);
+
+  auto gossip = storage->getDiffState(peer_key, creation_time);
+  ASSERT_EQ(1, gossip.signatures.size());
+  ASSERT_EQ(1, gossip.signatures[0].transactions.size());
+  ASSERT_EQ(1, gossip.signatures[0].transactions[0].size());
+  EXPECT_EQ(shared_model::crypto::PublicKey("same_prefix_key_1"),
+            gossip.signatures[0].transactions[0][0].public_key);
+}
+
+/**
+ * @given storage with three batches
+ * @when a signed batch is received from a peer
+ * @then the batch and its signatures are not propagated back to the peer
+ */
+TEST_F(StorageTest, ReceivedBatchNotSentBack) {
+  const shared_model::crypto::PublicKey peer_key("peer");
+  auto batch = addSignatures(makeTestBatch(txBuilder(4, creation_time)),
+                             0,
+                             makeSignature("1", "1_pub_key"));
+  auto received_state = MstState::empty(getTestLogger("MstState"), completer_);
+  received_state += batch;
+  storage->apply(peer_key, received_state);
+
+  auto gossip = storage->getDiffState(peer_key, creation_time);
+  EXPECT_EQ(3, gossip.batches.getBatches().size());
+  EXPECT_FALSE(gossip.batches.contains(batch));
+  EXPECT_TRUE(gossip.signatures.empty());
+}
+
+/**
+ * @given storage with three batches, which were propagated to a peer
+ * @when the peer reports a signature in its summary @and the same signature
+ * is added to the storage
+ * @then the signature is not propagated to the peer
+ */
+TEST_F(StorageTest, SummarizedSignatureNotSent) {
+  const shared_model::crypto::PublicKey peer_key("peer");
+  send(peer_key);
+
+  auto batch = addSignatures(makeTestBatch(txBuilder(1, creation_time)),
+                             0,
+                             makeSignature("1", "1_pub_key"));
+  auto summary = compactGossip();
+  summary.summaries.push_back(BatchSummary{
+      batch->reducedHash(),
+      {{signerKey(shared_model::crypto::PublicKey("1_pub_key"))}}});
+  storage->apply(peer_key, summary);
+  storage->updateOwnState(batch);
+
+  EXPECT_TRUE(storage->getDiffState(peer_key, creation_time).isEmpty());
+}
+
+/**
+ * @given storage with three batches, which were propagated to a peer
+ * @and a signature of the first batch, which the peer reported to have
+ * @when a signature of the second batch is added to the storage
+ * @then the peer gets the new signature with the summary of the first batch
+ */
+TEST_F(StorageTest, SummaryAttachedToSignatures) {
+  const shared_model::crypto::PublicKey peer_key("peer");
+  send(peer_key);
+
+  auto first_batch = addSignatures(makeTestBatch(txBuilder(1, creation_time)),
+                                   0,
+                                   makeSignature("1", "1_pub_key"));
+  auto summary = compactGossip();
+  summary.summaries.push_back(BatchSummary{
+      first_batch->reducedHash(),
+      {{signerKey(shared_model::crypto::PublicKey("1_pub_key"))}}});
+  storage->apply(peer_key, summary);
+  storage->updateOwnState(first_batch);
+  storage->updateOwnState(addSignatures(
+      makeTestBatch(txBuilder(2, creation_time)),
+      0,
+      makeSignature("2", "2_pub_key")));
+
+  auto gossip = storage->getDiffState(peer_key, creation_time);
+  ASSERT_EQ(1, gossip.signatures.size());
+  ASSERT_EQ(1, gossip.summaries.size());
+  EXPECT_EQ(first_batch->reducedHash(), gossip.summaries.front().reduced_hash);
+
+  storage->gossipSent(peer_key, gossip, true);
+  EXPECT_TRUE(storage->getDiffState(peer_key, creation_time).isEmpty());
+}
+
+/**
+ * @given storage with three batches, which were propagated to a peer
+ * @when the state is propagated to the peer again and to another peer
+ * @then the peer gets nothing, and the other peer gets all batches
+ */
+TEST_F(StorageTest, NewPeerGetsWholeState) {
+  const shared_model::crypto::PublicKey peer_key("peer");
+  ASSERT_EQ(3, send(peer_key).batches.getBatches().size());
+
+  EXPECT_TRUE(storage->getDiffState(peer_key, creation_time).isEmpty());
+  EXPECT_EQ(3,
+            storage->getDiffState(absent_peer_key, creation_time)
+                .batches.getBatches()
+                .size());
+}
+
+/**
+ * @given storage with a batch, which was propagated to a peer and expired
+ * @when the batch is added to the storage again
+ * @then the peer gets the whole batch
+ */
+TEST_F(StorageTest, ExpiredBatchForgotten) {
+  const shared_model::crypto::PublicKey peer_key("peer");
+  send(peer_key);
+  ASSERT_EQ(3,
+            storage->extractExpiredTransactions(creation_time + 1)
+                .getBatches()
+                .size());
+
+  storage->updateOwnState(makeTestBatch(txBuilder(1, creation_time)));
+  EXPECT_EQ(1,
+            storage->getDiffState(peer_key, creation_time)
+                .batches.getBatches()
+                .size());
+}
+
+/**
+ * @given storage with three batches
+ * @when the gossip with them to a peer is lost
+ * @then the peer gets the batches with the next gossip @and after it is
+ * delivered, the peer gets nothing
+ */
+TEST_F(StorageTest, LostGossipSentAgain) {
+  const shared_model::crypto::PublicKey peer_key("peer");
+  auto gossip = storage->getDiffState(peer_key, creation_time);
+  ASSERT_EQ(3, gossip.batches.getBatches().size());
+  storage->gossipSent(peer_key, gossip, false);
+
+  EXPECT_EQ(3, send(peer_key).batches.getBatches().size());
+  EXPECT_TRUE(storage->getDiffState(peer_key, creation_time).isEmpty());
+}
+
+/**
+ * @given storage with three batches, which are being sent to a peer
+ * @when a new signature of a batch is added @and the gossip is delivered
+ * @then the peer gets the signature, which the gossip did not carry
+ */
+TEST_F(StorageTest, SignatureAddedDuringSendingNotLost) {
+  const shared_model::crypto::PublicKey peer_key("peer");
+  storage->apply(peer_key, compactGossip());
+  auto gossip = storage->getDiffState(peer_key, creation_time);
+  auto batch = addSignatures(makeTestBatch(txBuilder(1, creation_time)),
+                             0,
+                             makeSignature("1", "1_pub_key"));
+  storage->updateOwnState(batch);
+  storage->gossipSent(peer_key, gossip, true);
+
+  auto next = storage->getDiffState(peer_key, creation_time);
+  EXPECT_TRUE(next.batches.isEmpty());
+  ASSERT_EQ(1, next.signatures.size());
+  EXPECT_EQ(batch->reducedHash(), next.signatures.front().reduced_hash);
+}
+
+/**
+ * @given storage with three batches, which were delivered to a peer, which
+ * has not shown that it reads signatures
+ * @when a new signature of a batch is added
+ * @then the peer gets the whole batch
+ */
+TEST_F(StorageTest, LegacyPeerGetsWholeBatches) {
+  const shared_model::crypto::PublicKey peer_key("peer");
+  send(peer_key);
+
+  auto batch = addSignatures(makeTestBatch(txBuilder(1, creation_time)),
+                             0,
+                             makeSignature("1", "1_pub_key"));
+  storage->updateOwnState(batch);
+
+  auto gossip = send(peer_key);
+  EXPECT_TRUE(gossip.signatures.empty());
+  ASSERT_EQ(1, gossip.batches.getBatches().size());
+  EXPECT_TRUE(gossip.batches.contains(batch));
+  EXPECT_TRUE(storage->getDiffState(peer_key, creation_time).isEmpty());
+}
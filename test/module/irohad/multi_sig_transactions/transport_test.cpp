@@ -163,9 +163,9 @@ TEST_F(TransportTest, SendAndReceive) {
   // with same parameters as on the client side
   EXPECT_CALL(*mst_notification_transport_, onNewState(_, _))
       .WillOnce(Invoke(
-          [this, &state](const auto &from_key, auto const &target_state) {
+          [this, &state](const auto &from_key, auto const &gossip) {
             EXPECT_EQ(this->my_key_.publicKey(), from_key);
-            EXPECT_TRUE(statesEqual(state, target_state));
+            EXPECT_TRUE(statesEqual(state, gossip.batches));
           }));
 
   ::grpc::ServerContext context;
@@ -174,7 +174,58 @@ TEST_F(TransportTest, SendAndReceive) {
       grpc::testing::MockClientAsyncResponseReader<google::protobuf::Empty>>();
   EXPECT_CALL(*stub, AsyncSendStateRaw(_, _, _))
       .WillOnce(DoAll(SaveArg<1>(&request), Return(r.get())));
-  transport->sendState(*peer, state);
+  transport->sendState(*peer, iroha::MstGossip{state}, [](bool) {});
+  auto response = transport->SendState(&context, &request, nullptr);
+  ASSERT_EQ(response.error_code(), grpc::StatusCode::OK);
+}
+
+/**
+ * @given Initialized transport
+ * AND gossip with signatures and summaries of batches, but without batches
+ * @when the gossip is sent via transport
+ * @then the received gossip contains the same signatures and summaries
+ * @and tells that the sender reads them
+ */
+TEST_F(TransportTest, SendAndReceiveSignatures) {
+  auto keypair = makeKey();
+  auto batch = makeTestBatch(txBuilder(1));
+  auto signed_blob = shared_model::crypto::CryptoSigner<>::sign(
+      shared_model::crypto::Blob(batch->transactions().at(0)->payload()),
+      keypair);
+  iroha::MstGossip gossip{
+      iroha::MstState::empty(getTestLogger("MstState"), completer_)};
+  gossip.signatures.push_back(iroha::BatchSignatures{
+      batch->reducedHash(),
+      {{iroha::DetachedSignature{keypair.publicKey(), signed_blob}}}});
+  gossip.summaries.push_back(iroha::BatchSummary{
+      batch->reducedHash(),
+      {{iroha::signerKey(makeKey().publicKey())}}});
+
+  EXPECT_CALL(*mst_notification_transport_, onNewState(_, _))
+      .WillOnce(Invoke([&](const auto &from_key, const auto &received) {
+        EXPECT_EQ(my_key_.publicKey(), from_key);
+        EXPECT_TRUE(received.batches.isEmpty());
+        ASSERT_EQ(1, received.signatures.size());
+        EXPECT_EQ(batch->reducedHash(), received.signatures[0].reduced_hash);
+        ASSERT_EQ(1, received.signatures[0].transactions.size());
+        ASSERT_EQ(1, received.signatures[0].transactions[0].size());
+        const auto &signature = received.signatures[0].transactions[0][0];
+        EXPECT_EQ(keypair.publicKey(), signature.public_key);
+        EXPECT_EQ(signed_blob, signature.signed_data);
+        ASSERT_EQ(1, received.summaries.size());
+        EXPECT_EQ(gossip.summaries[0].reduced_hash,
+                  received.summaries[0].reduced_hash);
+        EXPECT_EQ(gossip.summaries[0].signers, received.summaries[0].signers);
+        EXPECT_TRUE(received.compact_sender);
+      }));
+
+  ::grpc::ServerContext context;
+  ::iroha::network::transport::MstState request;
+  auto r = std::make_unique<
+      grpc::testing::MockClientAsyncResponseReader<google::protobuf::Empty>>();
+  EXPECT_CALL(*stub, AsyncSendStateRaw(_, _, _))
+      .WillOnce(DoAll(SaveArg<1>(&request), Return(r.get())));
+  transport->sendState(*peer, gossip, [](bool) {});
   auto response = transport->SendState(&context, &request, nullptr);
   ASSERT_EQ(response.error_code(), grpc::StatusCode::OK);
 }
@@ -202,8 +253,8 @@ TEST_F(TransportTest, ReplayAttack) {
   EXPECT_CALL(*mst_notification_transport_, onNewState(_, _))
       .Times(1)  // an empty state should not be propagated
       .WillOnce(
-          Invoke([&batch](::testing::Unused, const iroha::MstState &state) {
-            auto batches = state.getBatches();
+          Invoke([&batch](::testing::Unused, const iroha::MstGossip &gossip) {
+            auto batches = gossip.batches.getBatches();
             ASSERT_EQ(batches.size(), 1);
             ASSERT_EQ(**batches.begin(), *batch);
           }));
@@ -0,0 +1,151 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/async_grpc_client.hpp"
+
+#include <gtest/gtest.h>
+#include <grpcpp/alarm.h>
+#include "framework/test_logger.hpp"
+
+using namespace iroha::network;
+using namespace std::chrono_literals;
+
+using Client = AsyncGrpcClient<google::protobuf::Empty>;
+
+/**
+ * Reader, which finishes the call on the completion queue when the test
+ * completes it
+ */
+class FakeReader
+    : public grpc::ClientAsyncResponseReaderInterface<google::protobuf::Empty> {
+ public:
+  explicit FakeReader(grpc::CompletionQueue *cq) : cq_(cq) {}
+
+  void StartCall() override {}
+  void ReadInitialMetadata(void *) override {}
+  void Finish(google::protobuf::Empty *,
+              grpc::Status *status,
+              void *tag) override {
+    status_ = status;
+    tag_ = tag;
+  }
+
+  /// Finish the call with the status. The reader is deleted afterwards.
+  void complete(grpc::Status status = grpc::Status::OK) {
+    *status_ = std::move(status);
+    alarm_.Set(cq_, std::chrono::system_clock::now(), tag_);
+  }
+
+ private:
+  grpc::CompletionQueue *cq_;
+  grpc::Status *status_ = nullptr;
+  void *tag_ = nullptr;
+  grpc::Alarm alarm_;
+};
+
+class AsyncGrpcClientTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    options_.queues = 2;
+    options_.max_in_flight_per_peer = 2;
+    client_ = std::make_unique<Client>(getTestLogger("AsyncClient"), options_);
+  }
+
+  /// Make a call to the peer @return its reader, or nullptr if rejected
+  FakeReader *call(const std::string &peer) {
+    FakeReader *reader = nullptr;
+    auto accepted =
+        client_->Call(peer, "Test.Send", [&reader](auto, auto cq) {
+          reader = new FakeReader(cq);
+          return std::unique_ptr<grpc::ClientAsyncResponseReaderInterface<
+              google::protobuf::Empty>>(reader);
+        });
+    return accepted ? reader : nullptr;
+  }
+
+  /// Wait until no more than the given number of calls are in flight
+  Client::Metrics settle(size_t in_flight = 0) {
+    auto metrics = client_->metrics();
+    for (auto deadline = std::chrono::steady_clock::now() + 5s;
+         metrics.in_flight > in_flight
+         and std::chrono::steady_clock::now() < deadline;
+         metrics = client_->metrics()) {
+      std::this_thread::sleep_for(1ms);
+    }
+    return metrics;
+  }
+
+  Client::Options options_;
+  std::unique_ptr<Client> client_;
+};
+
+/**
+ * @given client with two calls
+ * @when one call succeeds and another fails
+ * @then both are counted for their method @and the failure is counted
+ */
+TEST_F(AsyncGrpcClientTest, MethodMetricsCollected) {
+  auto succeeded = call("peer1");
+  auto failed = call("peer2");
+  ASSERT_NE(nullptr, succeeded);
+  ASSERT_NE(nullptr, failed);
+
+  succeeded->complete();
+  failed->complete(grpc::Status(grpc::StatusCode::UNAVAILABLE, "down"));
+
+  auto metrics = settle();
+  EXPECT_EQ(0, metrics.in_flight);
+  ASSERT_EQ(1, metrics.methods.count("Test.Send"));
+  const auto &method = metrics.methods.at("Test.Send");
+  EXPECT_EQ(2, method.calls);
+  EXPECT_EQ(1, method.failures);
+  EXPECT_EQ(0, method.rejected);
+  EXPECT_LE(method.max_latency, method.total_latency);
+}
+
+/**
+ * @given client with the limit of two calls in flight per peer
+ * @when the third call to the same peer is made
+ * @then it is rejected @and calls to other peers are made
+ * @and the peer accepts calls again when one of its calls finishes
+ */
+TEST_F(AsyncGrpcClientTest, PeerInFlightLimited) {
+  auto first = call("peer1");
+  auto second = call("peer1");
+  ASSERT_NE(nullptr, first);
+  ASSERT_NE(nullptr, second);
+  EXPECT_EQ(nullptr, call("peer1"));
+  auto other = call("peer2");
+  ASSERT_NE(nullptr, other);
+  EXPECT_EQ(1, client_->metrics().methods.at("Test.Send").rejected);
+
+  first->complete();
+  settle(2);
+  auto third = call("peer1");
+  EXPECT_NE(nullptr, third);
+
+  second->complete();
+  other->complete();
+  if (third) {
+    third->complete();
+  }
+  settle();
+}
+
+/**
+ * @given client with a finished call
+ * @when the next call is made
+ * @then the object of the finished call is reused
+ */
+TEST_F(AsyncGrpcClientTest, CallObjectsReused) {
+  call("peer1")->complete();
+  settle();
+  EXPECT_EQ(0, client_->metrics().reused);
+
+  call("peer1")->complete();
+  auto metrics = settle();
+  EXPECT_EQ(1, metrics.reused);
+  EXPECT_EQ(2, metrics.methods.at("Test.Send").calls);
+}
@@ -13,6 +13,7 @@
 #include "cryptography/crypto_provider/crypto_defaults.hpp"
 #include "cryptography/hash.hpp"
 #include "datetime/time.hpp"
+#include "framework/test_client_factory.hpp"
 #include "framework/test_logger.hpp"
 #include "framework/test_subscriber.hpp"
 #include "module/irohad/ametsuchi/mock_block_query.hpp"
@@ -61,7 +62,8 @@ class BlockLoaderTest : public testing::Test {
         shared_model::proto::ProtoBlockFactory(
             std::move(validator_ptr),
             std::make_unique<MockValidator<iroha::protocol::Block>>()),
-        getTestLogger("BlockLoader"));
+        getTestLogger("BlockLoader"),
+        getTestInsecureClientFactory<iroha::network::proto::Loader>());
     service = std::make_shared<BlockLoaderService>(
         block_query_factory, block_cache, getTestLogger("BlockLoaderService"));
 
@@ -218,6 +220,39 @@ TEST_F(BlockLoaderTest, ValidWhenMultipleBlocks) {
   ASSERT_TRUE(wrapper.validate());
 }
 
+/**
+ * @given block loader and a peer with five blocks over the requested one
+ * @when retrieveBlockRange is called for two blocks
+ * @then only the blocks of the range are returned
+ */
+TEST_F(BlockLoaderTest, ValidWhenRangeRequested) {
+  const shared_model::interface::types::HeightType first_height = 3;
+  const shared_model::interface::types::HeightType count = 2;
+
+  EXPECT_CALL(*storage, getTopBlockHeight()).WillOnce(Return(first_height + 5));
+  for (auto i = first_height; i < first_height + count; ++i) {
+    auto blk = getBaseBlockBuilder()
+                   .height(i)
+                   .build()
+                   .signAndAddSignature(key)
+                   .finish();
+
+    EXPECT_CALL(*storage, getBlock(i))
+        .WillOnce(Return(ByMove(iroha::expected::makeValue(
+            clone<shared_model::interface::Block>(blk)))));
+  }
+
+  EXPECT_CALL(*peer_query, getLedgerPeers())
+      .WillOnce(Return(std::vector<wPeer>{peer}));
+  auto wrapper = make_test_subscriber<CallExact>(
+      loader->retrieveBlockRange(peer_key, first_height, count), count);
+  auto height = first_height;
+  wrapper.subscribe(
+      [&height](auto block) { ASSERT_EQ(block->height(), height++); });
+
+  ASSERT_TRUE(wrapper.validate());
+}
+
 MATCHER_P(RefAndPointerEq, arg1, "") {
   return arg == *arg1;
 }
@@ -0,0 +1,159 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/channel_pool.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "framework/result_gtest_checkers.hpp"
+#include "module/shared_model/interface_mocks.hpp"
+
+using namespace iroha::network;
+using namespace std::chrono_literals;
+
+using ::testing::_;
+using ::testing::ByMove;
+using ::testing::Invoke;
+using ::testing::Return;
+
+using ChannelResult =
+    iroha::expected::Result<std::shared_ptr<grpc::Channel>, std::string>;
+
+class MockChannelProvider : public ChannelProvider {
+ public:
+  MOCK_METHOD2(getChannel,
+               ChannelResult(const std::string &,
+                             const shared_model::interface::Peer &));
+};
+
+class ChannelPoolTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    auto provider = std::make_unique<MockChannelProvider>();
+    provider_ = provider.get();
+    ON_CALL(*provider_, getChannel(_, _))
+        .WillByDefault(Invoke([](const auto &, const auto &peer) {
+          return ChannelResult{iroha::expected::makeValue(grpc::CreateChannel(
+              peer.address(), grpc::InsecureChannelCredentials()))};
+        }));
+    pool_ = std::make_unique<ChannelPool>(
+        std::move(provider), kIdleTimeout, [this] { return now_; });
+  }
+
+  std::shared_ptr<grpc::Channel> getChannel(
+      const shared_model::interface::Peer &peer,
+      const std::string &service = "iroha.Service") {
+    auto channel = iroha::expected::resultToOptionalValue(
+        pool_->getChannel(service, peer));
+    EXPECT_TRUE(channel);
+    return channel.value_or(nullptr);
+  }
+
+  const std::chrono::milliseconds kIdleTimeout = 10s;
+  const shared_model::crypto::PublicKey kKey{std::string(32, '1')};
+  ChannelPool::Clock::time_point now_;
+  MockChannelProvider *provider_;
+  std::unique_ptr<ChannelPool> pool_;
+};
+
+/**
+ * @given pool with a channel to a peer
+ * @when the channel to the peer is requested for another service
+ * @then the same channel is returned and the provider is called once
+ */
+TEST_F(ChannelPoolTest, ChannelSharedByServices) {
+  auto peer = makePeer("127.0.0.1:1", kKey);
+  EXPECT_CALL(*provider_, getChannel(_, _)).Times(1);
+
+  auto channel = getChannel(*peer, "iroha.First");
+  EXPECT_EQ(getChannel(*peer, "iroha.Second"), channel);
+
+  auto metrics = pool_->metrics();
+  EXPECT_EQ(metrics.created, 1);
+  EXPECT_EQ(metrics.reused, 1);
+  EXPECT_EQ(metrics.channels, 1);
+}
+
+/**
+ * @given pool with a channel to a peer
+ * @when the address of the peer changes
+ * @then a new channel is created
+ */
+TEST_F(ChannelPoolTest, ChannelReplacedWhenAddressChanged) {
+  EXPECT_CALL(*provider_, getChannel(_, _)).Times(2);
+
+  auto channel = getChannel(*makePeer("127.0.0.1:1", kKey));
+  EXPECT_NE(getChannel(*makePeer("127.0.0.1:2", kKey)), channel);
+
+  auto metrics = pool_->metrics();
+  EXPECT_EQ(metrics.created, 2);
+  EXPECT_EQ(metrics.replaced, 1);
+  EXPECT_EQ(metrics.channels, 1);
+}
+
+/**
+ * @given pool with channels, one of which is referenced by a client
+ * @when the idle timeout passes
+ * @then only the channel without references is evicted
+ */
+TEST_F(ChannelPoolTest, IdleChannelEvicted) {
+  auto held_peer = makePeer("127.0.0.1:1", kKey);
+  auto idle_peer = makePeer(
+      "127.0.0.1:2", shared_model::crypto::PublicKey{std::string(32, '2')});
+  auto held_channel = getChannel(*held_peer);
+  getChannel(*idle_peer);
+
+  now_ += kIdleTimeout / 2;
+  EXPECT_EQ(pool_->evictIdle(), 0);
+
+  now_ += kIdleTimeout;
+  EXPECT_EQ(pool_->evictIdle(), 1);
+
+  auto metrics = pool_->metrics();
+  EXPECT_EQ(metrics.evicted, 1);
+  EXPECT_EQ(metrics.channels, 1);
+  EXPECT_EQ(getChannel(*held_peer), held_channel);
+}
+
+/**
+ * @given pool with an idle channel
+ * @when a channel is requested after the idle timeout
+ * @then the idle channel is evicted and a new one is created
+ */
+TEST_F(ChannelPoolTest, EvictionOnRequest) {
+  auto peer = makePeer("127.0.0.1:1", kKey);
+  EXPECT_CALL(*provider_, getChannel(_, _)).Times(2);
+  getChannel(*peer);
+
+  now_ += kIdleTimeout;
+  getChannel(*peer);
+
+  auto metrics = pool_->metrics();
+  EXPECT_EQ(metrics.evicted, 1);
+  EXPECT_EQ(metrics.created, 2);
+}
+
+/**
+ * @given channel provider which fails
+ * @when a channel is requested
+ * @then the error is returned, counted and nothing is cached
+ */
+TEST_F(ChannelPoolTest, ProviderErrorNotCached) {
+  auto peer = makePeer("127.0.0.1:1", kKey);
+  EXPECT_CALL(*provider_, getChannel(_, _))
+      .WillOnce(Return(ByMove(ChannelResult{
+          iroha::expected::makeError(std::string{"no certificate"})})))
+      .WillOnce(Invoke([](const auto &, const auto &peer) {
+        return ChannelResult{iroha::expected::makeValue(grpc::CreateChannel(
+            peer.address(), grpc::InsecureChannelCredentials()))};
+      }));
+
+  IROHA_ASSERT_RESULT_ERROR(pool_->getChannel("iroha.Service", *peer));
+  getChannel(*peer);
+
+  auto metrics = pool_->metrics();
+  EXPECT_EQ(metrics.failed, 1);
+  EXPECT_EQ(metrics.created, 1);
+}
@@ -18,6 +18,14 @@ using ::testing::Return;
 using ::testing::ReturnRef;
 using ::testing::UnorderedElementsAre;
 
+namespace {
+  /// @return batch with a single transaction with the hash
+  auto createBatch(const shared_model::interface::types::HashType &hash) {
+    return createMockBatchWithTransactions(
+        {createMockTransactionWithHash(hash)}, hash.hex());
+  }
+}  // namespace
+
 /**
  * @given empty cache
  * @when add to back is invoked with batch1 and batch2
@@ -27,10 +35,10 @@ TEST(OnDemandCacheTest, TestAddToBack) {
   OnDemandCache cache;
 
   shared_model::interface::types::HashType hash1("hash1");
-  auto batch1 = createMockBatchWithHash(hash1);
+  auto batch1 = createBatch(hash1);
 
   shared_model::interface::types::HashType hash2("hash2");
-  auto batch2 = createMockBatchWithHash(hash2);
+  auto batch2 = createBatch(hash2);
 
   cache.addToBack({batch1, batch2});
 
@@ -51,9 +59,9 @@ TEST(OnDemandCache, Pop) {
   shared_model::interface::types::HashType hash2("hash2");
   shared_model::interface::types::HashType hash3("hash3");
 
-  auto batch1 = createMockBatchWithHash(hash1);
-  auto batch2 = createMockBatchWithHash(hash2);
-  auto batch3 = createMockBatchWithHash(hash3);
+  auto batch1 = createBatch(hash1);
+  auto batch2 = createBatch(hash2);
+  auto batch3 = createBatch(hash3);
 
   cache.addToBack({batch1});
   /**
@@ -140,3 +148,111 @@ TEST(OnDemandCache, Remove) {
    */
   ASSERT_THAT(cache.head(), ElementsAre(batch2));
 }
+
+/**
+ * @given cache with batch1 in the head, batch2 in the middle and batch3 in the
+ * tail
+ * @when rotate is invoked
+ * @then batch1 is returned and moved to the tail, after batch2 and batch3
+ */
+TEST(OnDemandCache, Rotate) {
+  OnDemandCache cache;
+
+  shared_model::interface::types::HashType hash1("hash1");
+  shared_model::interface::types::HashType hash2("hash2");
+  shared_model::interface::types::HashType hash3("hash3");
+
+  auto batch1 = createBatch(hash1);
+  auto batch2 = createBatch(hash2);
+  auto batch3 = createBatch(hash3);
+
+  cache.addToBack({batch1});
+  cache.pop();
+  cache.addToBack({batch2});
+  cache.pop();
+  cache.addToBack({batch3});
+  /**
+   * 1. {batch1} <- will be rotated
+   * 2. {batch2}
+   * 3. {batch3}
+   */
+  ASSERT_THAT(cache.rotate(10), ElementsAre(batch1));
+  /**
+   * 1. {batch2}
+   * 2. {batch3}
+   * 3. {batch1}
+   */
+  ASSERT_THAT(cache.head(), ElementsAre(batch2));
+  ASSERT_THAT(cache.tail(), ElementsAre(batch1));
+
+  cache.remove({hash1});
+  ASSERT_THAT(cache.tail(), IsEmpty());
+}
+
+/**
+ * @given cache with two batches of two transactions in the head
+ * @when rotate is invoked with the limit of three transactions
+ * @then only one batch is returned, and both are moved to the tail
+ */
+TEST(OnDemandCache, RotateRespectsLimit) {
+  OnDemandCache cache;
+
+  auto batch1 = createMockBatchWithTransactions(
+      {createMockTransactionWithHash(shared_model::crypto::Hash("tx1")),
+       createMockTransactionWithHash(shared_model::crypto::Hash("tx2"))},
+      "abc");
+  auto batch2 = createMockBatchWithTransactions(
+      {createMockTransactionWithHash(shared_model::crypto::Hash("tx3")),
+       createMockTransactionWithHash(shared_model::crypto::Hash("tx4"))},
+      "123");
+
+  cache.addToBack({batch1, batch2});
+  cache.pop();
+  cache.pop();
+
+  ASSERT_EQ(cache.rotate(3).size(), 1);
+  ASSERT_THAT(cache.tail(), UnorderedElementsAre(batch1, batch2));
+}
+
+/**
+ * @given cache with batches in every slot, one of them popped
+ * @when remove is invoked with hashes of transactions in every slot
+ * @then the batches are removed from all slots, and the popped batch does not
+ * affect the cache
+ */
+TEST(OnDemandCache, RemoveFromAllSlots) {
+  OnDemandCache cache;
+
+  shared_model::interface::types::HashType hash1("hash1");
+  shared_model::interface::types::HashType hash2("hash2");
+  shared_model::interface::types::HashType hash3("hash3");
+  shared_model::interface::types::HashType hash4("hash4");
+
+  auto batch1 = createBatch(hash1);
+  auto batch2 = createBatch(hash2);
+  auto batch3 = createBatch(hash3);
+  auto batch4 = createBatch(hash4);
+
+  cache.addToBack({batch1});
+  cache.pop();
+  cache.addToBack({batch2});
+  cache.pop();
+  cache.addToBack({batch3, batch4});
+  /**
+   * 1. {batch1} <- will be popped
+   * 2. {batch2}
+   * 3. {batch3, batch4}
+   */
+  ASSERT_THAT(cache.pop(), ElementsAre(batch1));
+  cache.addToBack({batch1});
+  cache.remove({hash2, hash3});
+  /**
+   * 1. {}
+   * 2. {batch4}
+   * 3. {batch1}
+   */
+  EXPECT_THAT(cache.head(), IsEmpty());
+  EXPECT_THAT(cache.tail(), ElementsAre(batch1));
+  EXPECT_THAT(cache.pop(), IsEmpty());
+  EXPECT_THAT(cache.head(), ElementsAre(batch4));
+}
@@ -368,12 +368,9 @@ TEST_F(OnDemandOrderingGateTest, PopNonEmptyBatchesFromTheCache) {
   auto batch1 = createMockBatchWithTransactions({tx1}, "a");
   auto batch2 = createMockBatchWithTransactions({tx2}, "b");
 
-  cache::OrderingGateCache::BatchesSetType collection{batch1, batch2};
+  cache::OrderingGateCache::BatchesCollectionType collection{batch1, batch2};
 
-  EXPECT_CALL(*cache, pop()).WillOnce(Return(collection));
-
-  EXPECT_CALL(*cache, addToBack(UnorderedElementsAreArray(collection)))
-      .Times(1);
+  EXPECT_CALL(*cache, rotate(_)).WillOnce(Return(collection));
   EXPECT_CALL(*notification, onBatches(UnorderedElementsAreArray(collection)))
       .Times(1);
 
@@ -388,11 +385,8 @@ TEST_F(OnDemandOrderingGateTest, PopNonEmptyBatchesFromTheCache) {
  * @then nothing is propagated to the network
  */
 TEST_F(OnDemandOrderingGateTest, PopEmptyBatchesFromTheCache) {
-  cache::OrderingGateCache::BatchesSetType empty_collection{};
-
-  EXPECT_CALL(*cache, pop()).WillOnce(Return(empty_collection));
-  EXPECT_CALL(*cache, addToBack(UnorderedElementsAreArray(empty_collection)))
-      .Times(1);
+  EXPECT_CALL(*cache, rotate(_))
+      .WillOnce(Return(cache::OrderingGateCache::BatchesCollectionType{}));
   EXPECT_CALL(*notification, onBatches(_)).Times(0);
 
   rounds.get_subscriber().on_next(
@@ -413,7 +407,7 @@ TEST_F(OnDemandOrderingGateTest, BatchesRemoveFromCache) {
   auto batch1 = createMockBatchWithHash(hash1);
   auto batch2 = createMockBatchWithHash(hash2);
 
-  EXPECT_CALL(*cache, pop()).Times(1);
+  EXPECT_CALL(*cache, rotate(_)).Times(1);
   EXPECT_CALL(*cache, remove(UnorderedElementsAre(hash1, hash2))).Times(1);
 
   auto hashes =
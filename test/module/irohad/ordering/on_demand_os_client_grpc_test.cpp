@@ -56,6 +56,7 @@ class OnDemandOsClientGrpcTest : public ::testing::Test {
         std::move(validator), std::move(proto_validator));
     client =
         std::make_shared<OnDemandOsClientGrpc>(std::move(ustub),
+                                               "127.0.0.1:10001",
                                                async_call,
                                                proposal_factory,
                                                [&] { return timepoint; },
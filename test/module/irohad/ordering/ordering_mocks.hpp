@@ -29,6 +29,7 @@ namespace iroha {
       struct MockOrderingGateCache : public OrderingGateCache {
         MOCK_METHOD1(addToBack, void(const BatchesSetType &));
         MOCK_METHOD0(pop, BatchesSetType());
+        MOCK_METHOD1(rotate, BatchesCollectionType(size_t));
         MOCK_METHOD1(remove, void(const HashesSetType &));
         MOCK_CONST_METHOD0(head, const BatchesSetType &());
         MOCK_CONST_METHOD0(tail, const BatchesSetType &());
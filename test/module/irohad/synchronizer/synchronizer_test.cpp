@@ -604,3 +604,171 @@ TEST_F(SynchronizerTest, OneRoundDifference) {
 
   ASSERT_TRUE(wrapper.validate());
 }
+
+/**
+ * @given synchronizer, which downloads ranges of two blocks from three peers
+ * @and one of the peers sends no blocks
+ * @when the ledger is five blocks behind
+ * @then the ranges are downloaded from the other peers
+ * @and the blocks are applied in height order at once
+ */
+TEST_F(SynchronizerTest, ParallelDownload) {
+  DefaultValue<expected::Result<std::unique_ptr<MutableStorage>, std::string>>::
+      SetFactory(&createMockMutableStorage);
+  ParallelSyncOptions options;
+  options.max_peers = 3;
+  options.range_size = 2;
+  options.ranges_ahead = 1;
+  EXPECT_CALL(*consensus_gate, onOutcome())
+      .WillOnce(Return(gate_outcome.get_observable()));
+  auto parallel_synchronizer = std::make_shared<SynchronizerImpl>(
+      std::make_unique<MockCommandExecutor>(),
+      consensus_gate,
+      chain_validator,
+      mutable_factory,
+      block_query_factory,
+      block_loader,
+      getTestLogger("Synchronizer"),
+      options);
+  // the default synchronizer must not react to the outcome
+  synchronizer.reset();
+
+  const auto target_height = kHeight + 4;
+  std::vector<std::shared_ptr<shared_model::interface::Block>> chain;
+  auto prev_hash = commit_message->prevHash();
+  for (auto height = kHeight; height <= target_height; ++height) {
+    shared_model::proto::UnsignedWrapper<shared_model::proto::Block> block{
+        TestUnsignedBlockBuilder()
+            .height(height)
+            .prevHash(prev_hash)
+            .createdTime(iroha::time::now())
+            .build()};
+    for (const auto &key : ledger_peer_keys) {
+      block.signAndAddSignature(key);
+    }
+    chain.push_back(std::make_shared<shared_model::proto::Block>(
+        std::move(block).finish()));
+    prev_hash = chain.back()->hash();
+  }
+
+  EXPECT_CALL(*mutable_factory, createMutableStorage(_)).Times(1);
+  EXPECT_CALL(*mutable_factory, commit_(_))
+      .WillOnce(Return(ByMove(expected::makeValue(std::make_shared<LedgerState>(
+          ledger_peers, target_height, chain.back()->hash())))));
+  EXPECT_CALL(*block_loader, retrieveBlocks(_, _)).Times(0);
+  EXPECT_CALL(*block_loader, retrieveBlockRange(_, _, _))
+      .WillRepeatedly(::testing::Invoke(
+          [&](const auto &peer, auto first_height, auto count) -> Chain {
+            if (peer == public_keys.front()) {
+              return rxcpp::observable<>::empty<
+                  std::shared_ptr<shared_model::interface::Block>>();
+            }
+            auto begin = chain.begin() + (first_height - kHeight);
+            return rxcpp::observable<>::iterate(
+                std::vector<std::shared_ptr<shared_model::interface::Block>>(
+                    begin, begin + count));
+          }));
+  EXPECT_CALL(*chain_validator, validateAndApply(_, _))
+      .WillOnce(::testing::Invoke([&](auto blocks, auto &) {
+        std::vector<shared_model::interface::types::HeightType> heights;
+        blocks.subscribe([&heights](const auto &block) {
+          heights.push_back(block->height());
+        });
+        EXPECT_EQ(
+            (std::vector<shared_model::interface::types::HeightType>{
+                kHeight, kHeight + 1, kHeight + 2, kHeight + 3, target_height}),
+            heights);
+        return true;
+      }));
+
+  auto wrapper = make_test_subscriber<CallExact>(
+      parallel_synchronizer->on_commit_chain(), 1);
+  wrapper.subscribe([target_height](auto commit_event) {
+    ASSERT_EQ(commit_event.sync_outcome, SynchronizationOutcomeType::kCommit);
+    ASSERT_EQ(commit_event.round, (consensus::Round{target_height, 0}));
+  });
+
+  gate_outcome.get_subscriber().on_next(consensus::Future(
+      consensus::Round{target_height + 1, 1}, ledger_state, public_keys));
+
+  ASSERT_TRUE(wrapper.validate());
+}
+
+/**
+ * @given synchronizer, which downloads ranges of two blocks from two peers
+ * @and the peers ignore the requested count and send blocks up to the top
+ * @when the ledger is five blocks behind
+ * @then each block is applied once in height order
+ */
+TEST_F(SynchronizerTest, ParallelDownloadIgnoresBlocksPastRange) {
+  DefaultValue<expected::Result<std::unique_ptr<MutableStorage>, std::string>>::
+      SetFactory(&createMockMutableStorage);
+  ParallelSyncOptions options;
+  options.max_peers = 2;
+  options.range_size = 2;
+  options.ranges_ahead = 1;
+  EXPECT_CALL(*consensus_gate, onOutcome())
+      .WillOnce(Return(gate_outcome.get_observable()));
+  auto parallel_synchronizer = std::make_shared<SynchronizerImpl>(
+      std::make_unique<MockCommandExecutor>(),
+      consensus_gate,
+      chain_validator,
+      mutable_factory,
+      block_query_factory,
+      block_loader,
+      getTestLogger("Synchronizer"),
+      options);
+  // the default synchronizer must not react to the outcome
+  synchronizer.reset();
+
+  const auto target_height = kHeight + 4;
+  std::vector<std::shared_ptr<shared_model::interface::Block>> chain;
+  auto prev_hash = commit_message->prevHash();
+  for (auto height = kHeight; height <= target_height; ++height) {
+    shared_model::proto::UnsignedWrapper<shared_model::proto::Block> block{
+        TestUnsignedBlockBuilder()
+            .height(height)
+            .prevHash(prev_hash)
+            .createdTime(iroha::time::now())
+            .build()};
+    for (const auto &key : ledger_peer_keys) {
+      block.signAndAddSignature(key);
+    }
+    chain.push_back(std::make_shared<shared_model::proto::Block>(
+        std::move(block).finish()));
+    prev_hash = chain.back()->hash();
+  }
+
+  EXPECT_CALL(*mutable_factory, createMutableStorage(_)).Times(1);
+  EXPECT_CALL(*mutable_factory, commit_(_))
+      .WillOnce(Return(ByMove(expected::makeValue(std::make_shared<LedgerState>(
+          ledger_peers, target_height, chain.back()->hash())))));
+  EXPECT_CALL(*block_loader, retrieveBlocks(_, _)).Times(0);
+  EXPECT_CALL(*block_loader, retrieveBlockRange(_, _, _))
+      .WillRepeatedly(::testing::Invoke(
+          [&](const auto &, auto first_height, auto) -> Chain {
+            return rxcpp::observable<>::iterate(
+                std::vector<std::shared_ptr<shared_model::interface::Block>>(
+                    chain.begin() + (first_height - kHeight), chain.end()));
+          }));
+  EXPECT_CALL(*chain_validator, validateAndApply(_, _))
+      .WillOnce(::testing::Invoke([&](auto blocks, auto &) {
+        std::vector<shared_model::interface::types::HeightType> heights;
+        blocks.subscribe([&heights](const auto &block) {
+          heights.push_back(block->height());
+        });
+        EXPECT_EQ(
+            (std::vector<shared_model::interface::types::HeightType>{
+                kHeight, kHeight + 1, kHeight + 2, kHeight + 3, target_height}),
+            heights);
+        return true;
+      }));
+
+  auto wrapper = make_test_subscriber<CallExact>(
+      parallel_synchronizer->on_commit_chain(), 1);
+
+  gate_outcome.get_subscriber().on_next(consensus::Future(
+      consensus::Round{target_height + 1, 1}, ledger_state, public_keys));
+
+  ASSERT_TRUE(wrapper.validate());
+}
@@ -0,0 +1,174 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "tracing/hot_key_tracker.hpp"
+
+#include <map>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include "metrics/metrics.hpp"
+
+using namespace iroha::tracing;
+using ::testing::HasSubstr;
+
+namespace {
+  std::string account(size_t i) {
+    return "user" + std::to_string(i) + "@domain";
+  }
+
+  /// Keeps the values written by a collector
+  class TestWriter : public iroha::metrics::Writer {
+   public:
+    void counter(const std::string &name,
+                 const std::string &,
+                 const iroha::metrics::Labels &labels,
+                 double value) override {
+      values[name + labelsString(labels)] = value;
+    }
+
+    void gauge(const std::string &name,
+               const std::string &,
+               const iroha::metrics::Labels &labels,
+               double value) override {
+      values[name + labelsString(labels)] = value;
+    }
+
+    std::map<std::string, double> values;
+
+   private:
+    static std::string labelsString(const iroha::metrics::Labels &labels) {
+      std::string result;
+      for (const auto &label : labels) {
+        result += "," + label.first + "=" + label.second;
+      }
+      return result;
+    }
+  };
+}  // namespace
+
+/**
+ * @given heavy hitters with room for 3 keys
+ * @when a few keys occur much more often than many others
+ * @then the frequent keys are the top ones, with estimates not below their
+ * counts
+ */
+TEST(HeavyHittersTest, FindsFrequentKeys) {
+  HeavyHitters hitters(3, 256, 4);
+  const std::map<std::string, uint64_t> frequent{
+      {account(1), 1000}, {account(2), 500}, {account(3), 200}};
+  for (size_t round = 0; round < 1000; ++round) {
+    for (const auto &key : frequent) {
+      if (round < key.second) {
+        hitters.add(key.first);
+      }
+    }
+    hitters.add(account(100 + round));
+  }
+
+  const auto top = hitters.top();
+  ASSERT_EQ(top.size(), 3);
+  EXPECT_EQ(top[0].key, account(1));
+  EXPECT_EQ(top[1].key, account(2));
+  EXPECT_EQ(top[2].key, account(3));
+  for (const auto &entry : top) {
+    EXPECT_GE(entry.count, frequent.at(entry.key));
+    EXPECT_LE(entry.count, hitters.estimate(entry.key));
+  }
+  EXPECT_EQ(hitters.total(), 2700);
+}
+
+/**
+ * @given heavy hitters, whose heap is full of rare keys
+ * @when another key becomes frequent
+ * @then it replaces the least frequent key of the heap
+ */
+TEST(HeavyHittersTest, ReplacesLeastFrequentKey) {
+  HeavyHitters hitters(2, 1024, 4);
+  hitters.add(account(1), 5);
+  hitters.add(account(2), 1);
+  hitters.add(account(3), 3);
+
+  const auto top = hitters.top();
+  ASSERT_EQ(top.size(), 2);
+  EXPECT_EQ(top[0].key, account(1));
+  EXPECT_EQ(top[1].key, account(3));
+}
+
+/**
+ * @given disabled tracker
+ * @when accesses are recorded
+ * @then nothing is counted
+ */
+TEST(HotKeyTrackerTest, DisabledCountsNothing) {
+  HotKeyTracker tracker;
+  EXPECT_FALSE(tracker.enabled());
+  tracker.record(Phase::kApply, Access::kWrite, KeyKind::kAccount, account(1));
+  EXPECT_TRUE(
+      tracker.top(Phase::kApply, Access::kWrite, KeyKind::kAccount).empty());
+}
+
+/**
+ * @given enabled tracker
+ * @when accesses of different phases, accesses and kinds are recorded
+ * @then they are counted separately, and reported in JSON and metrics
+ */
+TEST(HotKeyTrackerTest, SeparatesAccesses) {
+  HotKeyTracker::Options options;
+  options.top_k = 2;
+  HotKeyTracker tracker(options);
+  ASSERT_TRUE(tracker.enabled());
+
+  for (size_t i = 0; i < 3; ++i) {
+    tracker.record(
+        Phase::kValidation, Access::kWrite, KeyKind::kAccount, account(1));
+  }
+  tracker.record(Phase::kApply, Access::kWrite, KeyKind::kAccount, account(2));
+  tracker.record(
+      Phase::kValidation, Access::kRead, KeyKind::kAsset, "coin#domain");
+
+  const auto written =
+      tracker.top(Phase::kValidation, Access::kWrite, KeyKind::kAccount);
+  ASSERT_EQ(written.size(), 1);
+  EXPECT_EQ(written[0].key, account(1));
+  EXPECT_EQ(written[0].count, 3);
+  const auto applied =
+      tracker.top(Phase::kApply, Access::kWrite, KeyKind::kAccount);
+  ASSERT_EQ(applied.size(), 1);
+  EXPECT_EQ(applied[0].key, account(2));
+  EXPECT_TRUE(
+      tracker.top(Phase::kApply, Access::kRead, KeyKind::kAsset).empty());
+
+  EXPECT_THAT(
+      tracker.toJson(),
+      HasSubstr(R"("validation":{"read":{"account":{"total":0,"top":[]})"
+                R"(,"asset":{"total":1,"top":[{"key":"coin#domain",)"
+                R"("count":1}]}})"));
+
+  TestWriter writer;
+  tracker.collect(writer);
+  EXPECT_EQ(writer.values.at("iroha_key_accesses_total,phase=validation,"
+                             "access=write,kind=account"),
+            3);
+  EXPECT_EQ(writer.values.at("iroha_hot_key_accesses,phase=validation,"
+                             "access=write,kind=account,key=user1@domain"),
+            3);
+}
+
+/**
+ * @given enabled tracker with counted accesses
+ * @when it is configured again
+ * @then the counts are dropped
+ */
+TEST(HotKeyTrackerTest, ConfigureDropsCounts) {
+  HotKeyTracker::Options options;
+  options.top_k = 2;
+  HotKeyTracker tracker(options);
+  tracker.record(Phase::kApply, Access::kWrite, KeyKind::kAccount, account(1));
+
+  tracker.configure(options);
+  EXPECT_TRUE(
+      tracker.top(Phase::kApply, Access::kWrite, KeyKind::kAccount).empty());
+}
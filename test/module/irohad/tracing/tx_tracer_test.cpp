@@ -0,0 +1,154 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "tracing/tx_tracer.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+using namespace iroha::tracing;
+using namespace std::chrono_literals;
+using ::testing::HasSubstr;
+
+class TxTracerTest : public ::testing::Test {
+ public:
+  /// @return hash, whose sampling prefix is the value
+  static shared_model::crypto::Hash makeHash(uint8_t value) {
+    shared_model::crypto::Blob::Bytes bytes(32, 0);
+    bytes[0] = value;
+    bytes[31] = 1;
+    return shared_model::crypto::Hash(shared_model::crypto::Blob(bytes));
+  }
+
+  TxTracer::Options options(uint32_t sample_rate) {
+    TxTracer::Options options;
+    options.sample_rate = sample_rate;
+    options.capacity = 2;
+    options.max_in_flight = 2;
+    options.timeout = 1min;
+    return options;
+  }
+
+  std::unique_ptr<TxTracer> makeTracer(uint32_t sample_rate) {
+    return std::make_unique<TxTracer>(options(sample_rate),
+                                      [this] { return now; });
+  }
+
+  TxTracer::Clock::time_point now;
+};
+
+/**
+ * @given tracer sampling one of two transactions
+ * @when transactions with even and odd hash prefixes pass all stages
+ * @then only the even one is traced, with the time of each stage
+ */
+TEST_F(TxTracerTest, TracesSampledTransactions) {
+  auto tracer = makeTracer(2);
+  const auto traced = makeHash(2), skipped = makeHash(3);
+  for (size_t i = 0; i < kStages; ++i) {
+    now += 10ms * (i + 1);
+    tracer->mark(traced, static_cast<Stage>(i));
+    tracer->mark(skipped, static_cast<Stage>(i));
+  }
+
+  const auto traces = tracer->traces();
+  ASSERT_EQ(traces.size(), 1);
+  EXPECT_EQ(traces[0].hash.toBlob(), traced);
+  EXPECT_EQ(traces[0].outcome, TxTracer::Outcome::kCommitted);
+  EXPECT_EQ(*traces[0].stages[1] - *traces[0].stages[0], 20ms);
+  EXPECT_THAT(tracer->toJson(),
+              HasSubstr(R"("stages":{"received":10000,"queued":30000,)"));
+  EXPECT_THAT(tracer->toJson(),
+              HasSubstr(R"("breakdown":{"queued":20000,"proposed":30000,)"));
+  EXPECT_THAT(tracer->toChromeTrace(),
+              HasSubstr(R"({"name":"queued","cat":"tx","ph":"X",)"
+                        R"("ts":10000,"dur":20000,"pid":1,"tid":0,)"));
+}
+
+/**
+ * @given disabled tracer
+ * @when a transaction passes all stages
+ * @then nothing is traced
+ */
+TEST_F(TxTracerTest, DisabledByDefault) {
+  TxTracer tracer;
+  for (size_t i = 0; i < kStages; ++i) {
+    tracer.mark(makeHash(0), static_cast<Stage>(i));
+  }
+  EXPECT_TRUE(tracer.traces().empty());
+  EXPECT_EQ(tracer.toJson(), "[]");
+}
+
+/**
+ * @given traced transaction which has passed the ordering
+ * @when it is rejected
+ * @then its trace ends as rejected after the last passed stage
+ */
+TEST_F(TxTracerTest, RejectEndsTrace) {
+  auto tracer = makeTracer(1);
+  const auto hash = makeHash(1);
+  tracer->mark(hash, Stage::kReceived);
+  tracer->mark(hash, Stage::kProposed);
+  tracer->reject(hash);
+  tracer->mark(hash, Stage::kValidated);
+
+  const auto traces = tracer->traces();
+  ASSERT_EQ(traces.size(), 1);
+  EXPECT_EQ(traces[0].outcome, TxTracer::Outcome::kRejected);
+  ASSERT_TRUE(traces[0].rejected_after);
+  EXPECT_EQ(*traces[0].rejected_after, Stage::kProposed);
+  EXPECT_THAT(tracer->toJson(),
+              HasSubstr(R"("outcome":"rejected","rejected_after":"proposed")"));
+}
+
+/**
+ * @given tracer keeping 2 unfinished and 2 ended traces
+ * @when more transactions are traced, and the unfinished ones time out
+ * @then stale unfinished traces are dropped to make room, and only the last
+ * ended traces are kept
+ */
+TEST_F(TxTracerTest, BoundedBuffers) {
+  auto tracer = makeTracer(1);
+  tracer->mark(makeHash(1), Stage::kReceived);
+  tracer->mark(makeHash(2), Stage::kReceived);
+  // no room until the first two time out
+  tracer->mark(makeHash(3), Stage::kReceived);
+  EXPECT_TRUE(tracer->traces().empty());
+
+  now += 2min;
+  tracer->mark(makeHash(3), Stage::kReceived);
+  tracer->mark(makeHash(3), Stage::kCommitted);
+
+  const auto traces = tracer->traces();
+  ASSERT_EQ(traces.size(), 2);
+  EXPECT_EQ(traces[0].outcome, TxTracer::Outcome::kDropped);
+  EXPECT_EQ(traces[1].hash.toBlob(), makeHash(3));
+  EXPECT_EQ(traces[1].outcome, TxTracer::Outcome::kCommitted);
+}
+
+/**
+ * @given tracer with room for more unfinished traces
+ * @when a transaction is not committed within the timeout @and another
+ * transaction is traced after it
+ * @then the unfinished trace is dropped
+ */
+TEST_F(TxTracerTest, StaleTraceDroppedWithRoom) {
+  auto tracer_options = options(1);
+  tracer_options.max_in_flight = 10;
+  auto tracer = std::make_unique<TxTracer>(tracer_options,
+                                           [this] { return now; });
+  tracer->mark(makeHash(1), Stage::kReceived);
+  now += 30s;
+  tracer->mark(makeHash(2), Stage::kReceived);
+  EXPECT_TRUE(tracer->traces().empty());
+
+  now += 45s;
+  tracer->mark(makeHash(2), Stage::kQueued);
+
+  const auto traces = tracer->traces();
+  ASSERT_EQ(traces.size(), 1);
+  EXPECT_EQ(traces[0].hash.toBlob(), makeHash(1));
+  EXPECT_EQ(traces[0].outcome, TxTracer::Outcome::kDropped);
+}
@@ -3,6 +3,12 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <cctype>
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include <vector>
+
 #include <gtest/gtest.h>
 #include "common/byteutils.hpp"
 
@@ -54,3 +60,67 @@ TEST(StringConverterTest, ConvertHexToBinaryAndBack) {
   ASSERT_EQ(ss.str(),
             bytestringToHexstring(hexstringToBytestring(ss.str()).value()));
 }
+
+/**
+ * @given hex string with a non-hex character after the part, which SIMD
+ * kernels process
+ * @when it is converted to binary string and validated
+ * @then the conversion fails @and the validation fails
+ */
+TEST(StringConverterTest, InvalidLongHexToBinary) {
+  std::string invalid_hex(130, 'a');
+  invalid_hex[100] = 'x';
+  ASSERT_FALSE(hexstringToBytestringResult(invalid_hex).match(
+      [](const auto &) { return true; }, [](const auto &) { return false; }));
+  ASSERT_FALSE(isHexString(invalid_hex));
+  ASSERT_TRUE(isHexString(std::string(130, 'A')));
+  ASSERT_TRUE(isHexString(""));
+}
+
+/**
+ * @given random bytes of different sizes
+ * @when they are encoded, decoded and validated by kernels of each
+ * instruction set supported by the CPU
+ * @then the results match the ones of the scalar kernels
+ * @and each non-hex character is detected at each position
+ */
+TEST(StringConverterTest, HexKernelsMatchScalar) {
+  using namespace hex_kernels;
+  const auto &scalar = *kernels(Isa::kScalar);
+  std::mt19937 random(42);
+  for (auto isa : {Isa::kSse2, Isa::kAvx2}) {
+    auto tested = kernels(isa);
+    if (not tested) {
+      continue;
+    }
+    SCOPED_TRACE(tested->name);
+    for (size_t size = 0; size < 130; ++size) {
+      std::vector<uint8_t> bytes(size);
+      for (auto &byte : bytes) {
+        byte = static_cast<uint8_t>(random());
+      }
+      std::string expected(size * 2, '\0'), hex(size * 2, '\0');
+      scalar.encode(bytes.data(), size, &expected[0]);
+      tested->encode(bytes.data(), size, &hex[0]);
+      ASSERT_EQ(expected, hex);
+
+      for (size_t i = 0; i < hex.size(); i += 3) {
+        hex[i] = static_cast<char>(std::toupper(hex[i]));
+      }
+      std::vector<uint8_t> decoded(size);
+      ASSERT_TRUE(tested->decode(hex.data(), hex.size(), decoded.data()));
+      ASSERT_EQ(bytes, decoded);
+      ASSERT_TRUE(tested->validate(hex.data(), hex.size()));
+
+      for (size_t i = 0; i < hex.size(); ++i) {
+        for (char c : {'g', 'G', '/', ':', '@', '`', ' ', '\x80', '\xff'}) {
+          auto invalid = hex;
+          invalid[i] = c;
+          ASSERT_FALSE(tested->validate(invalid.data(), invalid.size()));
+          ASSERT_FALSE(
+              tested->decode(invalid.data(), invalid.size(), decoded.data()));
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,200 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "metrics/metrics.hpp"
+
+#include <random>
+#include <thread>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <boost/asio.hpp>
+#include "common/result.hpp"
+#include "framework/test_logger.hpp"
+#include "metrics/metrics_server.hpp"
+
+using namespace iroha::metrics;
+using ::testing::HasSubstr;
+using ::testing::Not;
+
+/**
+ * @given counter
+ * @when it is incremented by several threads
+ * @then its value is the sum of all increments
+ */
+TEST(MetricsTest, CounterSumsThreads) {
+  Counter counter;
+  constexpr size_t kThreads = 16;
+  constexpr size_t kIncrements = 10000;
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < kThreads; ++i) {
+    threads.emplace_back([&counter] {
+      for (size_t j = 0; j < kIncrements; ++j) {
+        counter.increment();
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(counter.value(), kThreads * kIncrements);
+}
+
+/**
+ * @given random values of all magnitudes
+ * @when bucket of each value is found
+ * @then the value is within the bucket bounds, and the bucket is narrower
+ * than 1/16 of the value
+ */
+TEST(MetricsTest, HistogramBuckets) {
+  std::mt19937_64 random(42);
+  for (size_t i = 0; i < 100000; ++i) {
+    const auto value = random() >> (random() % 64);
+    if (value > Histogram::kMaxValue) {
+      continue;
+    }
+    const auto bucket = Histogram::bucket(value);
+    ASSERT_LT(bucket, Histogram::kBuckets);
+    const auto lower = Histogram::bucketLowerBound(bucket);
+    const auto upper = Histogram::bucketUpperBound(bucket);
+    ASSERT_LE(lower, value);
+    ASSERT_GE(upper, value);
+    ASSERT_LE(upper - lower, value / Histogram::kSubBuckets);
+  }
+  EXPECT_EQ(Histogram::bucket(Histogram::kMaxValue), Histogram::kBuckets - 1);
+  EXPECT_EQ(Histogram::bucket(~uint64_t{0}), Histogram::kBuckets - 1);
+}
+
+/**
+ * @given histogram of values from 1 to 10000
+ * @when quantiles are taken
+ * @then they are within the precision of the buckets
+ */
+TEST(MetricsTest, HistogramQuantiles) {
+  Histogram histogram(latencyBounds());
+  for (uint64_t value = 1; value <= 10000; ++value) {
+    histogram.record(value);
+  }
+  const auto snapshot = histogram.snapshot();
+  EXPECT_EQ(snapshot.count, 10000);
+  EXPECT_EQ(snapshot.sum, 10000 * 10001 / 2);
+  for (auto quantile : {0.5, 0.9, 0.99}) {
+    const auto expected = quantile * 10000;
+    EXPECT_NEAR(snapshot.quantile(quantile), expected, expected / 16);
+  }
+  EXPECT_EQ(snapshot.quantile(0), 1);
+  EXPECT_EQ(snapshot.countNotAbove(1000), 1000);
+}
+
+/**
+ * @given registry with a counter, a gauge, a histogram and a collector
+ * @when it is serialized
+ * @then all of them are in Prometheus text format, and the removed collector
+ * is not
+ */
+TEST(MetricsTest, RegistrySerialization) {
+  Registry registry;
+  registry.counter("test_total", "Test counter", {{"kind", "a"}}).increment(3);
+  EXPECT_EQ(&registry.counter("test_total", "Test counter", {{"kind", "a"}}),
+            &registry.counter("test_total", "Test counter", {{"kind", "a"}}));
+  registry.gauge("test_depth", "Test gauge").set(-2);
+  auto &histogram =
+      registry.histogram("test_latency", "Test histogram", {10, 100});
+  histogram.record(5);
+  histogram.record(50);
+  histogram.record(500);
+  auto handle = registry.addCollector([](Writer &writer) {
+    writer.gauge("test_collected", "Collected", {{"peer", "p\"1"}}, 1.5);
+  });
+  auto removed = registry.addCollector([](Writer &writer) {
+    writer.gauge("test_removed", "Removed", {}, 1);
+  });
+  removed.reset();
+
+  const auto text = registry.serialize();
+  EXPECT_THAT(text, HasSubstr("# HELP test_total Test counter\n"
+                              "# TYPE test_total counter\n"
+                              "test_total{kind=\"a\"} 3\n"));
+  EXPECT_THAT(text, HasSubstr("# TYPE test_depth gauge\ntest_depth -2\n"));
+  EXPECT_THAT(text,
+              HasSubstr("# TYPE test_latency histogram\n"
+                        "test_latency_bucket{le=\"10\"} 1\n"
+                        "test_latency_bucket{le=\"100\"} 2\n"
+                        "test_latency_bucket{le=\"+Inf\"} 3\n"
+                        "test_latency_sum 555\n"
+                        "test_latency_count 3\n"));
+  EXPECT_THAT(text, HasSubstr("test_collected{peer=\"p\\\"1\"} 1.5\n"));
+  EXPECT_THAT(text, Not(HasSubstr("test_removed")));
+}
+
+namespace {
+  /// @return response of the server to GET of the target
+  std::string get(uint16_t port, const std::string &target) {
+    using boost::asio::ip::tcp;
+    boost::asio::io_service io_service;
+    tcp::socket socket(io_service);
+    socket.connect(
+        tcp::endpoint(boost::asio::ip::address_v4::loopback(), port));
+    const auto request = "GET " + target + " HTTP/1.1\r\nHost: test\r\n\r\n";
+    boost::asio::write(socket, boost::asio::buffer(request));
+    boost::system::error_code error;
+    boost::asio::streambuf response;
+    boost::asio::read(socket, response, error);
+    return std::string(
+        boost::asio::buffers_begin(response.data()),
+        boost::asio::buffers_end(response.data()));
+  }
+}  // namespace
+
+/**
+ * @given metrics server on a free port
+ * @when /metrics and another target are requested
+ * @then the registry is served on /metrics, and 404 on the other target
+ */
+TEST(MetricsTest, ServerServesRegistry) {
+  Registry registry;
+  registry.counter("test_total", "Test counter").increment();
+  auto server = MetricsServer::create(
+      "127.0.0.1:0", registry, getTestLogger("MetricsServer"));
+  ASSERT_TRUE(iroha::expected::hasValue(server));
+  const auto port = server.assumeValue()->port();
+  ASSERT_NE(port, 0);
+
+  const auto metrics = get(port, "/metrics");
+  EXPECT_THAT(metrics, HasSubstr("HTTP/1.1 200 OK\r\n"));
+  EXPECT_THAT(metrics, HasSubstr("\r\n\r\n" + registry.serialize()));
+  EXPECT_THAT(get(port, "/"), HasSubstr("HTTP/1.1 404 Not Found\r\n"));
+}
+
+/**
+ * @given metrics server with a JSON page
+ * @when the page is requested
+ * @then the page function result is served as JSON
+ */
+TEST(MetricsTest, ServerServesJsonPages) {
+  Registry registry;
+  auto server = MetricsServer::create("127.0.0.1:0",
+                                      registry,
+                                      getTestLogger("MetricsServer"),
+                                      {{"/page", [] { return "{}"; }}});
+  ASSERT_TRUE(iroha::expected::hasValue(server));
+  const auto page = get(server.assumeValue()->port(), "/page");
+  EXPECT_THAT(page, HasSubstr("HTTP/1.1 200 OK\r\n"));
+  EXPECT_THAT(page, HasSubstr("Content-Type: application/json\r\n"));
+  EXPECT_THAT(page, HasSubstr("\r\n\r\n{}"));
+}
+
+/**
+ * @given an address which is not ip:port
+ * @when metrics server is created on it
+ * @then error is returned
+ */
+TEST(MetricsTest, ServerRejectsBadAddress) {
+  Registry registry;
+  EXPECT_TRUE(iroha::expected::hasError(MetricsServer::create(
+      "localhost", registry, getTestLogger("MetricsServer"))));
+  EXPECT_TRUE(iroha::expected::hasError(MetricsServer::create(
+      "127.0.0.1:99999", registry, getTestLogger("MetricsServer"))));
+}
@@ -5,7 +5,11 @@
 
 #include <gtest/gtest.h>
 
+#include "backend/protobuf/block.hpp"
 #include "backend/protobuf/proto_block_factory.hpp"
+#include "backend/protobuf/util.hpp"
+#include "cryptography/public_key.hpp"
+#include "cryptography/signed.hpp"
 #include "datetime/time.hpp"
 #include "module/shared_model/validators/validators.hpp"
 #include "validators/default_validator.hpp"
@@ -50,3 +54,39 @@ TEST_F(ProtoBlockFactoryTest, UnsafeBlockCreation) {
   ASSERT_EQ(block->prevHash().hex(), prev_hash.hex());
   ASSERT_EQ(block->transactions(), txs);
 }
+
+/**
+ * @given transactions
+ * @when block is created of them, which reuses their blobs
+ * @then blobs and hash of the block are the same as of the block created from
+ * its transport @and it stays so after the block is signed
+ */
+TEST_F(ProtoBlockFactoryTest, BlobsMatchTransport) {
+  std::vector<shared_model::proto::Transaction> txs;
+  for (int i = 0; i < 3; ++i) {
+    iroha::protocol::Transaction tx;
+    auto *payload = tx.mutable_payload()->mutable_reduced_payload();
+    payload->set_creator_account_id("admin@test");
+    payload->set_created_time(iroha::time::now() + i);
+    payload->add_commands()->mutable_transfer_asset()->set_amount("1.0");
+    txs.emplace_back(std::move(tx));
+  }
+  std::vector<shared_model::crypto::Hash> rejected_txs{
+      shared_model::crypto::Hash::fromHexString("abcdef")};
+
+  auto prev_hash = shared_model::crypto::Hash::fromHexString("12");
+
+  auto block = factory->unsafeCreateBlock(
+      1, prev_hash, iroha::time::now(), txs, rejected_txs);
+  const auto &transport =
+      static_cast<const proto::Block &>(*block).getTransport();
+  proto::Block from_transport(transport);
+
+  EXPECT_EQ(proto::makeBlob(transport), block->blob());
+  EXPECT_EQ(proto::makeBlob(transport.payload()), block->payload());
+  EXPECT_EQ(from_transport.hash(), block->hash());
+
+  block->addSignature(shared_model::crypto::Signed("signature"),
+                      shared_model::crypto::PublicKey("key"));
+  EXPECT_EQ(proto::makeBlob(transport), block->blob());
+}
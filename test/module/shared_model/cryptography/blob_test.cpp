@@ -6,6 +6,7 @@
 #include "cryptography/blob.hpp"
 #include <gtest/gtest.h>
 #include <memory>
+#include "cryptography/fixed_blob.hpp"
 
 using namespace shared_model::crypto;
 using namespace std::literals::string_literals;
@@ -43,3 +44,40 @@ TEST_F(BlobMock, BlobIsString) {
     ASSERT_EQ(binary[i], bin_str[i]);
   }
 }
+
+/**
+ * @given blob, which hex was not requested yet, and blob with requested hex
+ * @when both are copied and moved
+ * @then all of the blobs have the right hex
+ */
+TEST_F(BlobMock, HexOfCopies) {
+  Blob lazy(data);
+  Blob computed(data);
+  computed.hex();
+
+  Blob lazy_copy(lazy);
+  Blob computed_copy(computed);
+  Blob computed_moved(std::move(computed));
+  ASSERT_EQ(blob->hex(), lazy.hex());
+  ASSERT_EQ(blob->hex(), lazy_copy.hex());
+  ASSERT_EQ(blob->hex(), computed_copy.hex());
+  ASSERT_EQ(blob->hex(), computed_moved.hex());
+
+  lazy_copy = Blob("other"s);
+  ASSERT_EQ(Blob("other"s).hex(), lazy_copy.hex());
+}
+
+/**
+ * @given blobs of the fixed and of another size
+ * @when fixed blobs are made from them
+ * @then only the blob of the fixed size is converted @and back to the same
+ */
+TEST_F(BlobMock, FixedBlobFromBlob) {
+  ASSERT_FALSE(FixedBlob<4>::fromBlob(*blob));
+
+  auto fixed = FixedBlob<12>::fromBlob(*blob);
+  ASSERT_TRUE(fixed);
+  ASSERT_EQ(*blob, fixed->toBlob());
+  ASSERT_EQ(FixedBlob<12>::Hasher{}(*fixed),
+            FixedBlob<12>::Hasher{}(*FixedBlob<12>::fromBlob(*blob)));
+}
@@ -0,0 +1,261 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "validators/field_matchers.hpp"
+
+#include <random>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace shared_model::validation;
+
+/**
+ * Differential test of the field matchers against the regular expressions,
+ * which FieldValidator used before them. Inputs are random strings over an
+ * alphabet of the characters, which matter for the formats, and random
+ * mutations of valid and nearly valid values.
+ */
+class FieldMatchersTest : public ::testing::Test {
+ public:
+  using Matcher = bool (*)(const std::string &);
+
+  /// number of random inputs per format
+  static constexpr size_t kIterations = 20000;
+
+  std::string randomString(size_t max_size) {
+    static const std::string kAlphabet =
+        "abcxyzABCXYZ0123456789_-.@#:"
+        "aaaa0000..--"
+        " /\\%\t\xff";
+    std::uniform_int_distribution<size_t> size_dist(0, max_size);
+    std::uniform_int_distribution<size_t> char_dist(0, kAlphabet.size() - 1);
+    std::string str(size_dist(random_), '\0');
+    for (auto &c : str) {
+      c = kAlphabet[char_dist(random_)];
+    }
+    return str;
+  }
+
+  std::string mutate(std::string str) {
+    static const std::string kAlphabet{"aZ09_-.@#:\0 ", 12};
+    std::uniform_int_distribution<int> mutations_dist(0, 3);
+    for (auto mutations = mutations_dist(random_); mutations > 0;
+         --mutations) {
+      std::uniform_int_distribution<size_t> pos_dist(0, str.size());
+      auto pos = pos_dist(random_);
+      auto c = kAlphabet[std::uniform_int_distribution<size_t>(
+          0, kAlphabet.size() - 1)(random_)];
+      switch (std::uniform_int_distribution<int>(0, 3)(random_)) {
+        case 0:
+          str.insert(pos, 1, c);
+          break;
+        case 1:
+          if (pos < str.size()) {
+            str.erase(pos, 1);
+          }
+          break;
+        case 2:
+          if (pos < str.size()) {
+            str[pos] = c;
+          }
+          break;
+        default:
+          // repeat a piece to stress the length limits
+          str.insert(pos, str.substr(pos, 16));
+      }
+    }
+    return str;
+  }
+
+  /**
+   * Check that the matcher agrees with the pattern on the seeds, their
+   * mutations and random strings
+   * @return number of inputs, which are matched
+   */
+  size_t fuzz(Matcher matcher,
+              const std::string &pattern,
+              const std::vector<std::string> &seeds,
+              size_t max_size) {
+    std::regex regex(pattern);
+    size_t matched = 0;
+    auto check = [&](const std::string &input) {
+      auto expected = std::regex_match(input, regex);
+      EXPECT_EQ(expected, matcher(input))
+          << "input: '" << input << "', pattern: '" << pattern << "'";
+      matched += expected ? 1 : 0;
+    };
+    for (const auto &seed : seeds) {
+      check(seed);
+    }
+    std::uniform_int_distribution<size_t> seed_dist(0, seeds.size() - 1);
+    for (size_t i = 0; i < kIterations; ++i) {
+      check(i % 2 ? randomString(max_size) : mutate(seeds[seed_dist(random_)]));
+    }
+    return matched;
+  }
+
+  std::mt19937 random_{42};
+};
+
+constexpr size_t FieldMatchersTest::kIterations;
+
+namespace {
+  const std::string kLongLabel(63, 'a');
+
+  const std::vector<std::string> kNames{
+      "admin", "a", "user_1", std::string(32, 'z'), std::string(33, 'z'), ""};
+
+  const std::vector<std::string> kDomains{
+      "test",
+      "a",
+      "soramitsu.co.jp",
+      "a-b.c-d9",
+      "x1.y2.z3",
+      kLongLabel,
+      kLongLabel + "a",
+      kLongLabel + "." + kLongLabel,
+      "a-",
+      "-a",
+      "1a",
+      "a..b",
+      "a.",
+      ".a",
+      ""};
+
+  std::vector<std::string> join(const std::vector<std::string> &lhs,
+                                const std::string &separator,
+                                const std::vector<std::string> &rhs) {
+    std::vector<std::string> result;
+    for (const auto &l : lhs) {
+      for (const auto &r : rhs) {
+        result.push_back(l + separator + r);
+      }
+    }
+    return result;
+  }
+
+  const std::vector<std::string> kHosts{"127.0.0.1",
+                                        "0.0.0.0",
+                                        "255.255.255.255",
+                                        "256.1.1.1",
+                                        "01.1.1.1",
+                                        "1.1.1",
+                                        "1.1.1.1.1",
+                                        "1.1.1.1000",
+                                        "localhost",
+                                        "iroha-node.example.com",
+                                        "1.1.1.a"};
+
+  const std::vector<std::string> kPorts{"0",
+                                        "1",
+                                        "10001",
+                                        "50051",
+                                        "65535",
+                                        "65536",
+                                        "65529",
+                                        "99999",
+                                        "00",
+                                        "080",
+                                        "123456",
+                                        ""};
+}  // namespace
+
+/**
+ * @given names of accounts, assets and roles
+ * @when they are checked by the matcher and by the regular expression
+ * @then the results are the same
+ */
+TEST_F(FieldMatchersTest, Name) {
+  EXPECT_GT(fuzz(matchers::isName, matchers::patterns::name(), kNames, 40),
+            0);
+}
+
+/**
+ * @given domains
+ * @when they are checked by the matcher and by the regular expression
+ * @then the results are the same
+ */
+TEST_F(FieldMatchersTest, Domain) {
+  EXPECT_GT(
+      fuzz(matchers::isDomain, matchers::patterns::domain(), kDomains, 80),
+      0);
+}
+
+/**
+ * @given account ids
+ * @when they are checked by the matcher and by the regular expression
+ * @then the results are the same
+ */
+TEST_F(FieldMatchersTest, AccountId) {
+  EXPECT_GT(fuzz(matchers::isAccountId,
+                 matchers::patterns::accountId(),
+                 join(kNames, "@", kDomains),
+                 80),
+            0);
+}
+
+/**
+ * @given asset ids
+ * @when they are checked by the matcher and by the regular expression
+ * @then the results are the same
+ */
+TEST_F(FieldMatchersTest, AssetId) {
+  EXPECT_GT(fuzz(matchers::isAssetId,
+                 matchers::patterns::assetId(),
+                 join(kNames, "#", kDomains),
+                 80),
+            0);
+}
+
+/**
+ * @given keys of account details
+ * @when they are checked by the matcher and by the regular expression
+ * @then the results are the same
+ */
+TEST_F(FieldMatchersTest, AccountDetailKey) {
+  EXPECT_GT(fuzz(matchers::isAccountDetailKey,
+                 matchers::patterns::accountDetailKey(),
+                 {"key", "Key_1", std::string(64, 'K'), std::string(65, 'K')},
+                 80),
+            0);
+}
+
+/**
+ * @given peer addresses
+ * @when they are checked by the matcher and by the regular expression
+ * @then the results are the same
+ */
+TEST_F(FieldMatchersTest, PeerAddress) {
+  EXPECT_GT(fuzz(matchers::isPeerAddress,
+                 matchers::patterns::peerAddress(),
+                 join(kHosts, ":", kPorts),
+                 40),
+            0);
+}
+
+/**
+ * @given every IPv4 octet and every port
+ * @when they are checked in a peer address by the matcher and by the regular
+ * expression
+ * @then the results are the same
+ */
+TEST_F(FieldMatchersTest, PeerAddressNumbers) {
+  std::regex regex(matchers::patterns::peerAddress());
+  auto expect_same = [&regex](const std::string &input) {
+    EXPECT_EQ(std::regex_match(input, regex), matchers::isPeerAddress(input))
+        << "input: '" << input << "'";
+  };
+  for (int octet = 0; octet < 1000; ++octet) {
+    expect_same("1.2.3." + std::to_string(octet) + ":1");
+  }
+  for (int port = 0; port < 100000; port += 7) {
+    expect_same("host:" + std::to_string(port));
+  }
+  expect_same("host:65535");
+  expect_same("host:65536");
+}